@@ -0,0 +1,2172 @@
+#define HWIF_DEC_PIC_INF_REG            1
+#define HWIF_DEC_PIC_INF_SHIFT          24
+#define HWIF_DEC_PIC_INF_MASK           0x00000001U
+#define HWIF_DEC_TIMEOUT_REG            1
+#define HWIF_DEC_TIMEOUT_SHIFT          18
+#define HWIF_DEC_TIMEOUT_MASK           0x00000001U
+#define HWIF_DEC_SLICE_INT_REG          1
+#define HWIF_DEC_SLICE_INT_SHIFT        17
+#define HWIF_DEC_SLICE_INT_MASK         0x00000001U
+#define HWIF_DEC_ERROR_INT_REG          1
+#define HWIF_DEC_ERROR_INT_SHIFT        16
+#define HWIF_DEC_ERROR_INT_MASK         0x00000001U
+#define HWIF_DEC_ASO_INT_REG            1
+#define HWIF_DEC_ASO_INT_SHIFT          15
+#define HWIF_DEC_ASO_INT_MASK           0x00000001U
+#define HWIF_DEC_BUFFER_INT_REG         1
+#define HWIF_DEC_BUFFER_INT_SHIFT       14
+#define HWIF_DEC_BUFFER_INT_MASK        0x00000001U
+#define HWIF_DEC_BUS_INT_REG            1
+#define HWIF_DEC_BUS_INT_SHIFT          13
+#define HWIF_DEC_BUS_INT_MASK           0x00000001U
+#define HWIF_DEC_RDY_INT_REG            1
+#define HWIF_DEC_RDY_INT_SHIFT          12
+#define HWIF_DEC_RDY_INT_MASK           0x00000001U
+#define HWIF_DEC_IRQ_REG                1
+#define HWIF_DEC_IRQ_SHIFT              8
+#define HWIF_DEC_IRQ_MASK               0x00000001U
+#define HWIF_DEC_IRQ_DIS_REG            1
+#define HWIF_DEC_IRQ_DIS_SHIFT          4
+#define HWIF_DEC_IRQ_DIS_MASK           0x00000001U
+#define HWIF_DEC_E_REG                  1
+#define HWIF_DEC_E_SHIFT                0
+#define HWIF_DEC_E_MASK                 0x00000001U
+#define HWIF_DEC_AXI_RD_ID_REG          2
+#define HWIF_DEC_AXI_RD_ID_SHIFT        24
+#define HWIF_DEC_AXI_RD_ID_MASK         0x000000FFU
+#define HWIF_DEC_TIMEOUT_E_REG          2
+#define HWIF_DEC_TIMEOUT_E_SHIFT        23
+#define HWIF_DEC_TIMEOUT_E_MASK         0x00000001U
+#define HWIF_DEC_STRSWAP32_E_REG        2
+#define HWIF_DEC_STRSWAP32_E_SHIFT      22
+#define HWIF_DEC_STRSWAP32_E_MASK       0x00000001U
+#define HWIF_DEC_STRENDIAN_E_REG        2
+#define HWIF_DEC_STRENDIAN_E_SHIFT      21
+#define HWIF_DEC_STRENDIAN_E_MASK       0x00000001U
+#define HWIF_DEC_INSWAP32_E_REG         2
+#define HWIF_DEC_INSWAP32_E_SHIFT       20
+#define HWIF_DEC_INSWAP32_E_MASK        0x00000001U
+#define HWIF_DEC_OUTSWAP32_E_REG        2
+#define HWIF_DEC_OUTSWAP32_E_SHIFT      19
+#define HWIF_DEC_OUTSWAP32_E_MASK       0x00000001U
+#define HWIF_DEC_DATA_DISC_E_REG        2
+#define HWIF_DEC_DATA_DISC_E_SHIFT      18
+#define HWIF_DEC_DATA_DISC_E_MASK       0x00000001U
+#define HWIF_TILED_MODE_MSB_REG         2
+#define HWIF_TILED_MODE_MSB_SHIFT       17
+#define HWIF_TILED_MODE_MSB_MASK        0x00000001U
+#define HWIF_DEC_OUT_TILED_E_REG        2
+#define HWIF_DEC_OUT_TILED_E_SHIFT      17
+#define HWIF_DEC_OUT_TILED_E_MASK       0x00000001U
+#define HWIF_DEC_LATENCY_REG            2
+#define HWIF_DEC_LATENCY_SHIFT          11
+#define HWIF_DEC_LATENCY_MASK           0x0000003FU
+#define HWIF_DEC_CLK_GATE_E_REG         2
+#define HWIF_DEC_CLK_GATE_E_SHIFT       10
+#define HWIF_DEC_CLK_GATE_E_MASK        0x00000001U
+#define HWIF_DEC_IN_ENDIAN_REG          2
+#define HWIF_DEC_IN_ENDIAN_SHIFT        9
+#define HWIF_DEC_IN_ENDIAN_MASK         0x00000001U
+#define HWIF_DEC_OUT_ENDIAN_REG         2
+#define HWIF_DEC_OUT_ENDIAN_SHIFT       8
+#define HWIF_DEC_OUT_ENDIAN_MASK        0x00000001U
+#define HWIF_PRIORITY_MODE_REG          2
+#define HWIF_PRIORITY_MODE_SHIFT        5
+#define HWIF_PRIORITY_MODE_MASK         0x00000007U
+#define HWIF_TILED_MODE_LSB_REG         2
+#define HWIF_TILED_MODE_LSB_SHIFT       7
+#define HWIF_TILED_MODE_LSB_MASK        0x00000001U
+#define HWIF_DEC_ADV_PRE_DIS_REG        2
+#define HWIF_DEC_ADV_PRE_DIS_SHIFT      6
+#define HWIF_DEC_ADV_PRE_DIS_MASK       0x00000001U
+#define HWIF_DEC_SCMD_DIS_REG           2
+#define HWIF_DEC_SCMD_DIS_SHIFT         5
+#define HWIF_DEC_SCMD_DIS_MASK          0x00000001U
+#define HWIF_DEC_MAX_BURST_REG          2
+#define HWIF_DEC_MAX_BURST_SHIFT        0
+#define HWIF_DEC_MAX_BURST_MASK         0x0000001FU
+#define HWIF_DEC_MODE_REG               3
+#define HWIF_DEC_MODE_SHIFT             28
+#define HWIF_DEC_MODE_MASK              0x0000000FU
+#define HWIF_RLC_MODE_E_REG             3
+#define HWIF_RLC_MODE_E_SHIFT           27
+#define HWIF_RLC_MODE_E_MASK            0x00000001U
+#define HWIF_SKIP_MODE_REG              3
+#define HWIF_SKIP_MODE_SHIFT            26
+#define HWIF_SKIP_MODE_MASK             0x00000001U
+#define HWIF_DIVX3_E_REG                3
+#define HWIF_DIVX3_E_SHIFT              25
+#define HWIF_DIVX3_E_MASK               0x00000001U
+#define HWIF_PJPEG_E_REG                3
+#define HWIF_PJPEG_E_SHIFT              24
+#define HWIF_PJPEG_E_MASK               0x00000001U
+#define HWIF_PIC_INTERLACE_E_REG        3
+#define HWIF_PIC_INTERLACE_E_SHIFT      23
+#define HWIF_PIC_INTERLACE_E_MASK       0x00000001U
+#define HWIF_PIC_FIELDMODE_E_REG        3
+#define HWIF_PIC_FIELDMODE_E_SHIFT      22
+#define HWIF_PIC_FIELDMODE_E_MASK       0x00000001U
+#define HWIF_PIC_B_E_REG                3
+#define HWIF_PIC_B_E_SHIFT              21
+#define HWIF_PIC_B_E_MASK               0x00000001U
+#define HWIF_PIC_INTER_E_REG            3
+#define HWIF_PIC_INTER_E_SHIFT          20
+#define HWIF_PIC_INTER_E_MASK           0x00000001U
+#define HWIF_PIC_TOPFIELD_E_REG         3
+#define HWIF_PIC_TOPFIELD_E_SHIFT       19
+#define HWIF_PIC_TOPFIELD_E_MASK        0x00000001U
+#define HWIF_FWD_INTERLACE_E_REG        3
+#define HWIF_FWD_INTERLACE_E_SHIFT      18
+#define HWIF_FWD_INTERLACE_E_MASK       0x00000001U
+#define HWIF_SORENSON_E_REG             3
+#define HWIF_SORENSON_E_SHIFT           17
+#define HWIF_SORENSON_E_MASK            0x00000001U
+#define HWIF_REF_TOPFIELD_E_REG         3
+#define HWIF_REF_TOPFIELD_E_SHIFT       16
+#define HWIF_REF_TOPFIELD_E_MASK        0x00000001U
+#define HWIF_DEC_OUT_DIS_REG            3
+#define HWIF_DEC_OUT_DIS_SHIFT          15
+#define HWIF_DEC_OUT_DIS_MASK           0x00000001U
+#define HWIF_FILTERING_DIS_REG          3
+#define HWIF_FILTERING_DIS_SHIFT        14
+#define HWIF_FILTERING_DIS_MASK         0x00000001U
+#define HWIF_WEBP_E_REG                 3
+#define HWIF_WEBP_E_SHIFT               13
+#define HWIF_WEBP_E_MASK                0x00000001U
+#define HWIF_MVC_E_REG                  3
+#define HWIF_MVC_E_SHIFT                13
+#define HWIF_MVC_E_MASK                 0x00000001U
+#define HWIF_PIC_FIXED_QUANT_REG        3
+#define HWIF_PIC_FIXED_QUANT_SHIFT      13
+#define HWIF_PIC_FIXED_QUANT_MASK       0x00000001U
+#define HWIF_WRITE_MVS_E_REG            3
+#define HWIF_WRITE_MVS_E_SHIFT          12
+#define HWIF_WRITE_MVS_E_MASK           0x00000001U
+#define HWIF_REFTOPFIRST_E_REG          3
+#define HWIF_REFTOPFIRST_E_SHIFT        11
+#define HWIF_REFTOPFIRST_E_MASK         0x00000001U
+#define HWIF_SEQ_MBAFF_E_REG            3
+#define HWIF_SEQ_MBAFF_E_SHIFT          10
+#define HWIF_SEQ_MBAFF_E_MASK           0x00000001U
+#define HWIF_PICORD_COUNT_E_REG         3
+#define HWIF_PICORD_COUNT_E_SHIFT       9
+#define HWIF_PICORD_COUNT_E_MASK        0x00000001U
+#define HWIF_DEC_AHB_HLOCK_E_REG        3
+#define HWIF_DEC_AHB_HLOCK_E_SHIFT      8
+#define HWIF_DEC_AHB_HLOCK_E_MASK       0x00000001U
+#define HWIF_DEC_AXI_WR_ID_REG          3
+#define HWIF_DEC_AXI_WR_ID_SHIFT        0
+#define HWIF_DEC_AXI_WR_ID_MASK         0x000000FFU
+#define HWIF_PIC_MB_WIDTH_REG           4
+#define HWIF_PIC_MB_WIDTH_SHIFT         23
+#define HWIF_PIC_MB_WIDTH_MASK          0x000001FFU
+#define HWIF_MB_WIDTH_OFF_REG           4
+#define HWIF_MB_WIDTH_OFF_SHIFT         19
+#define HWIF_MB_WIDTH_OFF_MASK          0x0000000FU
+#define HWIF_PIC_MB_HEIGHT_P_REG        4
+#define HWIF_PIC_MB_HEIGHT_P_SHIFT      11
+#define HWIF_PIC_MB_HEIGHT_P_MASK       0x000000FFU
+#define HWIF_MB_HEIGHT_OFF_REG          4
+#define HWIF_MB_HEIGHT_OFF_SHIFT        7
+#define HWIF_MB_HEIGHT_OFF_MASK         0x0000000FU
+#define HWIF_ALT_SCAN_E_REG             4
+#define HWIF_ALT_SCAN_E_SHIFT           6
+#define HWIF_ALT_SCAN_E_MASK            0x00000001U
+#define HWIF_TOPFIELDFIRST_E_REG        4
+#define HWIF_TOPFIELDFIRST_E_SHIFT      5
+#define HWIF_TOPFIELDFIRST_E_MASK       0x00000001U
+#define HWIF_REF_FRAMES_REG             4
+#define HWIF_REF_FRAMES_SHIFT           0
+#define HWIF_REF_FRAMES_MASK            0x0000001FU
+#define HWIF_PIC_MB_W_EXT_REG           4
+#define HWIF_PIC_MB_W_EXT_SHIFT         3
+#define HWIF_PIC_MB_W_EXT_MASK          0x00000007U
+#define HWIF_PIC_MB_H_EXT_REG           4
+#define HWIF_PIC_MB_H_EXT_SHIFT         0
+#define HWIF_PIC_MB_H_EXT_MASK          0x00000007U
+#define HWIF_PIC_REFER_FLAG_REG         4
+#define HWIF_PIC_REFER_FLAG_SHIFT       0
+#define HWIF_PIC_REFER_FLAG_MASK        0x00000001U
+#define HWIF_STRM_START_BIT_REG         5
+#define HWIF_STRM_START_BIT_SHIFT       26
+#define HWIF_STRM_START_BIT_MASK        0x0000003FU
+#define HWIF_SYNC_MARKER_E_REG          5
+#define HWIF_SYNC_MARKER_E_SHIFT        25
+#define HWIF_SYNC_MARKER_E_MASK         0x00000001U
+#define HWIF_TYPE1_QUANT_E_REG          5
+#define HWIF_TYPE1_QUANT_E_SHIFT        24
+#define HWIF_TYPE1_QUANT_E_MASK         0x00000001U
+#define HWIF_CH_QP_OFFSET_REG           5
+#define HWIF_CH_QP_OFFSET_SHIFT         19
+#define HWIF_CH_QP_OFFSET_MASK          0x0000001FU
+#define HWIF_CH_QP_OFFSET2_REG          5
+#define HWIF_CH_QP_OFFSET2_SHIFT        14
+#define HWIF_CH_QP_OFFSET2_MASK         0x0000001FU
+#define HWIF_FIELDPIC_FLAG_E_REG        5
+#define HWIF_FIELDPIC_FLAG_E_SHIFT      0
+#define HWIF_FIELDPIC_FLAG_E_MASK       0x00000001U
+#define HWIF_INTRADC_VLC_THR_REG        5
+#define HWIF_INTRADC_VLC_THR_SHIFT      16
+#define HWIF_INTRADC_VLC_THR_MASK       0x00000007U
+#define HWIF_VOP_TIME_INCR_REG          5
+#define HWIF_VOP_TIME_INCR_SHIFT        0
+#define HWIF_VOP_TIME_INCR_MASK         0x0000FFFFU
+#define HWIF_DQ_PROFILE_REG             5
+#define HWIF_DQ_PROFILE_SHIFT           24
+#define HWIF_DQ_PROFILE_MASK            0x00000001U
+#define HWIF_DQBI_LEVEL_REG             5
+#define HWIF_DQBI_LEVEL_SHIFT           23
+#define HWIF_DQBI_LEVEL_MASK            0x00000001U
+#define HWIF_RANGE_RED_FRM_E_REG        5
+#define HWIF_RANGE_RED_FRM_E_SHIFT      22
+#define HWIF_RANGE_RED_FRM_E_MASK       0x00000001U
+#define HWIF_FAST_UVMC_E_REG            5
+#define HWIF_FAST_UVMC_E_SHIFT          20
+#define HWIF_FAST_UVMC_E_MASK           0x00000001U
+#define HWIF_TRANSDCTAB_REG             5
+#define HWIF_TRANSDCTAB_SHIFT           17
+#define HWIF_TRANSDCTAB_MASK            0x00000001U
+#define HWIF_TRANSACFRM_REG             5
+#define HWIF_TRANSACFRM_SHIFT           15
+#define HWIF_TRANSACFRM_MASK            0x00000003U
+#define HWIF_TRANSACFRM2_REG            5
+#define HWIF_TRANSACFRM2_SHIFT          13
+#define HWIF_TRANSACFRM2_MASK           0x00000003U
+#define HWIF_MB_MODE_TAB_REG            5
+#define HWIF_MB_MODE_TAB_SHIFT          10
+#define HWIF_MB_MODE_TAB_MASK           0x00000007U
+#define HWIF_MVTAB_REG                  5
+#define HWIF_MVTAB_SHIFT                7
+#define HWIF_MVTAB_MASK                 0x00000007U
+#define HWIF_CBPTAB_REG                 5
+#define HWIF_CBPTAB_SHIFT               4
+#define HWIF_CBPTAB_MASK                0x00000007U
+#define HWIF_2MV_BLK_PAT_TAB_REG        5
+#define HWIF_2MV_BLK_PAT_TAB_SHIFT      2
+#define HWIF_2MV_BLK_PAT_TAB_MASK       0x00000003U
+#define HWIF_4MV_BLK_PAT_TAB_REG        5
+#define HWIF_4MV_BLK_PAT_TAB_SHIFT      0
+#define HWIF_4MV_BLK_PAT_TAB_MASK       0x00000003U
+#define HWIF_QSCALE_TYPE_REG            5
+#define HWIF_QSCALE_TYPE_SHIFT          24
+#define HWIF_QSCALE_TYPE_MASK           0x00000001U
+#define HWIF_CON_MV_E_REG               5
+#define HWIF_CON_MV_E_SHIFT             4
+#define HWIF_CON_MV_E_MASK              0x00000001U
+#define HWIF_INTRA_DC_PREC_REG          5
+#define HWIF_INTRA_DC_PREC_SHIFT        2
+#define HWIF_INTRA_DC_PREC_MASK         0x00000003U
+#define HWIF_INTRA_VLC_TAB_REG          5
+#define HWIF_INTRA_VLC_TAB_SHIFT        1
+#define HWIF_INTRA_VLC_TAB_MASK         0x00000001U
+#define HWIF_FRAME_PRED_DCT_REG         5
+#define HWIF_FRAME_PRED_DCT_SHIFT       0
+#define HWIF_FRAME_PRED_DCT_MASK        0x00000001U
+#define HWIF_JPEG_QTABLES_REG           5
+#define HWIF_JPEG_QTABLES_SHIFT         11
+#define HWIF_JPEG_QTABLES_MASK          0x00000003U
+#define HWIF_JPEG_MODE_REG              5
+#define HWIF_JPEG_MODE_SHIFT            8
+#define HWIF_JPEG_MODE_MASK             0x00000007U
+#define HWIF_JPEG_FILRIGHT_E_REG        5
+#define HWIF_JPEG_FILRIGHT_E_SHIFT      7
+#define HWIF_JPEG_FILRIGHT_E_MASK       0x00000001U
+#define HWIF_JPEG_STREAM_ALL_REG        5
+#define HWIF_JPEG_STREAM_ALL_SHIFT      6
+#define HWIF_JPEG_STREAM_ALL_MASK       0x00000001U
+#define HWIF_CR_AC_VLCTABLE_REG         5
+#define HWIF_CR_AC_VLCTABLE_SHIFT       5
+#define HWIF_CR_AC_VLCTABLE_MASK        0x00000001U
+#define HWIF_CB_AC_VLCTABLE_REG         5
+#define HWIF_CB_AC_VLCTABLE_SHIFT       4
+#define HWIF_CB_AC_VLCTABLE_MASK        0x00000001U
+#define HWIF_CR_DC_VLCTABLE_REG         5
+#define HWIF_CR_DC_VLCTABLE_SHIFT       3
+#define HWIF_CR_DC_VLCTABLE_MASK        0x00000001U
+#define HWIF_CB_DC_VLCTABLE_REG         5
+#define HWIF_CB_DC_VLCTABLE_SHIFT       2
+#define HWIF_CB_DC_VLCTABLE_MASK        0x00000001U
+#define HWIF_CR_DC_VLCTABLE3_REG        5
+#define HWIF_CR_DC_VLCTABLE3_SHIFT      1
+#define HWIF_CR_DC_VLCTABLE3_MASK       0x00000001U
+#define HWIF_CB_DC_VLCTABLE3_REG        5
+#define HWIF_CB_DC_VLCTABLE3_SHIFT      0
+#define HWIF_CB_DC_VLCTABLE3_MASK       0x00000001U
+#define HWIF_STRM1_START_BIT_REG        5
+#define HWIF_STRM1_START_BIT_SHIFT      18
+#define HWIF_STRM1_START_BIT_MASK       0x0000003FU
+#define HWIF_HUFFMAN_E_REG              5
+#define HWIF_HUFFMAN_E_SHIFT            17
+#define HWIF_HUFFMAN_E_MASK             0x00000001U
+#define HWIF_MULTISTREAM_E_REG          5
+#define HWIF_MULTISTREAM_E_SHIFT        16
+#define HWIF_MULTISTREAM_E_MASK         0x00000001U
+#define HWIF_BOOLEAN_VALUE_REG          5
+#define HWIF_BOOLEAN_VALUE_SHIFT        8
+#define HWIF_BOOLEAN_VALUE_MASK         0x000000FFU
+#define HWIF_BOOLEAN_RANGE_REG          5
+#define HWIF_BOOLEAN_RANGE_SHIFT        0
+#define HWIF_BOOLEAN_RANGE_MASK         0x000000FFU
+#define HWIF_ALPHA_OFFSET_REG           5
+#define HWIF_ALPHA_OFFSET_SHIFT         5
+#define HWIF_ALPHA_OFFSET_MASK          0x0000001FU
+#define HWIF_BETA_OFFSET_REG            5
+#define HWIF_BETA_OFFSET_SHIFT          0
+#define HWIF_BETA_OFFSET_MASK           0x0000001FU
+#define HWIF_START_CODE_E_REG           6
+#define HWIF_START_CODE_E_SHIFT         31
+#define HWIF_START_CODE_E_MASK          0x00000001U
+#define HWIF_INIT_QP_REG                6
+#define HWIF_INIT_QP_SHIFT              25
+#define HWIF_INIT_QP_MASK               0x0000003FU
+#define HWIF_CH_8PIX_ILEAV_E_REG        6
+#define HWIF_CH_8PIX_ILEAV_E_SHIFT      24
+#define HWIF_CH_8PIX_ILEAV_E_MASK       0x00000001U
+#define HWIF_STREAM_LEN_EXT_REG         6
+#define HWIF_STREAM_LEN_EXT_SHIFT       24
+#define HWIF_STREAM_LEN_EXT_MASK        0x000000FFU
+#define HWIF_STREAM_LEN_REG             6
+#define HWIF_STREAM_LEN_SHIFT           0
+#define HWIF_STREAM_LEN_MASK            0x00FFFFFFU
+#define HWIF_CABAC_E_REG                7
+#define HWIF_CABAC_E_SHIFT              31
+#define HWIF_CABAC_E_MASK               0x00000001U
+#define HWIF_BLACKWHITE_E_REG           7
+#define HWIF_BLACKWHITE_E_SHIFT         30
+#define HWIF_BLACKWHITE_E_MASK          0x00000001U
+#define HWIF_DIR_8X8_INFER_E_REG        7
+#define HWIF_DIR_8X8_INFER_E_SHIFT      29
+#define HWIF_DIR_8X8_INFER_E_MASK       0x00000001U
+#define HWIF_WEIGHT_PRED_E_REG          7
+#define HWIF_WEIGHT_PRED_E_SHIFT        28
+#define HWIF_WEIGHT_PRED_E_MASK         0x00000001U
+#define HWIF_WEIGHT_BIPR_IDC_REG        7
+#define HWIF_WEIGHT_BIPR_IDC_SHIFT      26
+#define HWIF_WEIGHT_BIPR_IDC_MASK       0x00000003U
+#define HWIF_AVS_H264_H_EXT_REG         7
+#define HWIF_AVS_H264_H_EXT_SHIFT       25
+#define HWIF_AVS_H264_H_EXT_MASK        0x00000001U
+#define HWIF_FRAMENUM_LEN_REG           7
+#define HWIF_FRAMENUM_LEN_SHIFT         16
+#define HWIF_FRAMENUM_LEN_MASK          0x0000001FU
+#define HWIF_FRAMENUM_REG               7
+#define HWIF_FRAMENUM_SHIFT             0
+#define HWIF_FRAMENUM_MASK              0x0000FFFFU
+#define HWIF_BITPLANE0_E_REG            7
+#define HWIF_BITPLANE0_E_SHIFT          31
+#define HWIF_BITPLANE0_E_MASK           0x00000001U
+#define HWIF_BITPLANE1_E_REG            7
+#define HWIF_BITPLANE1_E_SHIFT          30
+#define HWIF_BITPLANE1_E_MASK           0x00000001U
+#define HWIF_BITPLANE2_E_REG            7
+#define HWIF_BITPLANE2_E_SHIFT          29
+#define HWIF_BITPLANE2_E_MASK           0x00000001U
+#define HWIF_ALT_PQUANT_REG             7
+#define HWIF_ALT_PQUANT_SHIFT           24
+#define HWIF_ALT_PQUANT_MASK            0x0000001FU
+#define HWIF_DQ_EDGES_REG               7
+#define HWIF_DQ_EDGES_SHIFT             20
+#define HWIF_DQ_EDGES_MASK              0x0000000FU
+#define HWIF_TTMBF_REG                  7
+#define HWIF_TTMBF_SHIFT                19
+#define HWIF_TTMBF_MASK                 0x00000001U
+#define HWIF_PQINDEX_REG                7
+#define HWIF_PQINDEX_SHIFT              14
+#define HWIF_PQINDEX_MASK               0x0000001FU
+#define HWIF_VC1_HEIGHT_EXT_REG         7
+#define HWIF_VC1_HEIGHT_EXT_SHIFT       13
+#define HWIF_VC1_HEIGHT_EXT_MASK        0x00000001U
+#define HWIF_BILIN_MC_E_REG             7
+#define HWIF_BILIN_MC_E_SHIFT           12
+#define HWIF_BILIN_MC_E_MASK            0x00000001U
+#define HWIF_UNIQP_E_REG                7
+#define HWIF_UNIQP_E_SHIFT              11
+#define HWIF_UNIQP_E_MASK               0x00000001U
+#define HWIF_HALFQP_E_REG               7
+#define HWIF_HALFQP_E_SHIFT             10
+#define HWIF_HALFQP_E_MASK              0x00000001U
+#define HWIF_TTFRM_REG                  7
+#define HWIF_TTFRM_SHIFT                8
+#define HWIF_TTFRM_MASK                 0x00000003U
+#define HWIF_2ND_BYTE_EMUL_E_REG        7
+#define HWIF_2ND_BYTE_EMUL_E_SHIFT      7
+#define HWIF_2ND_BYTE_EMUL_E_MASK       0x00000001U
+#define HWIF_DQUANT_E_REG               7
+#define HWIF_DQUANT_E_SHIFT             6
+#define HWIF_DQUANT_E_MASK              0x00000001U
+#define HWIF_VC1_ADV_E_REG              7
+#define HWIF_VC1_ADV_E_SHIFT            5
+#define HWIF_VC1_ADV_E_MASK             0x00000001U
+#define HWIF_PJPEG_FILDOWN_E_REG        7
+#define HWIF_PJPEG_FILDOWN_E_SHIFT      26
+#define HWIF_PJPEG_FILDOWN_E_MASK       0x00000001U
+#define HWIF_PJPEG_WDIV8_REG            7
+#define HWIF_PJPEG_WDIV8_SHIFT          25
+#define HWIF_PJPEG_WDIV8_MASK           0x00000001U
+#define HWIF_PJPEG_HDIV8_REG            7
+#define HWIF_PJPEG_HDIV8_SHIFT          24
+#define HWIF_PJPEG_HDIV8_MASK           0x00000001U
+#define HWIF_PJPEG_AH_REG               7
+#define HWIF_PJPEG_AH_SHIFT             20
+#define HWIF_PJPEG_AH_MASK              0x0000000FU
+#define HWIF_PJPEG_AL_REG               7
+#define HWIF_PJPEG_AL_SHIFT             16
+#define HWIF_PJPEG_AL_MASK              0x0000000FU
+#define HWIF_PJPEG_SS_REG               7
+#define HWIF_PJPEG_SS_SHIFT             8
+#define HWIF_PJPEG_SS_MASK              0x000000FFU
+#define HWIF_PJPEG_SE_REG               7
+#define HWIF_PJPEG_SE_SHIFT             0
+#define HWIF_PJPEG_SE_MASK              0x000000FFU
+#define HWIF_DCT1_START_BIT_REG         7
+#define HWIF_DCT1_START_BIT_SHIFT       26
+#define HWIF_DCT1_START_BIT_MASK        0x0000003FU
+#define HWIF_DCT2_START_BIT_REG         7
+#define HWIF_DCT2_START_BIT_SHIFT       20
+#define HWIF_DCT2_START_BIT_MASK        0x0000003FU
+#define HWIF_CH_MV_RES_REG              7
+#define HWIF_CH_MV_RES_SHIFT            13
+#define HWIF_CH_MV_RES_MASK             0x00000001U
+#define HWIF_INIT_DC_MATCH0_REG         7
+#define HWIF_INIT_DC_MATCH0_SHIFT       9
+#define HWIF_INIT_DC_MATCH0_MASK        0x00000007U
+#define HWIF_INIT_DC_MATCH1_REG         7
+#define HWIF_INIT_DC_MATCH1_SHIFT       6
+#define HWIF_INIT_DC_MATCH1_MASK        0x00000007U
+#define HWIF_VP7_VERSION_REG            7
+#define HWIF_VP7_VERSION_SHIFT          5
+#define HWIF_VP7_VERSION_MASK           0x00000001U
+#define HWIF_CONST_INTRA_E_REG          8
+#define HWIF_CONST_INTRA_E_SHIFT        31
+#define HWIF_CONST_INTRA_E_MASK         0x00000001U
+#define HWIF_FILT_CTRL_PRES_REG         8
+#define HWIF_FILT_CTRL_PRES_SHIFT       30
+#define HWIF_FILT_CTRL_PRES_MASK        0x00000001U
+#define HWIF_RDPIC_CNT_PRES_REG         8
+#define HWIF_RDPIC_CNT_PRES_SHIFT       29
+#define HWIF_RDPIC_CNT_PRES_MASK        0x00000001U
+#define HWIF_8X8TRANS_FLAG_E_REG        8
+#define HWIF_8X8TRANS_FLAG_E_SHIFT      28
+#define HWIF_8X8TRANS_FLAG_E_MASK       0x00000001U
+#define HWIF_REFPIC_MK_LEN_REG          8
+#define HWIF_REFPIC_MK_LEN_SHIFT        17
+#define HWIF_REFPIC_MK_LEN_MASK         0x000007FFU
+#define HWIF_IDR_PIC_E_REG              8
+#define HWIF_IDR_PIC_E_SHIFT            16
+#define HWIF_IDR_PIC_E_MASK             0x00000001U
+#define HWIF_IDR_PIC_ID_REG             8
+#define HWIF_IDR_PIC_ID_SHIFT           0
+#define HWIF_IDR_PIC_ID_MASK            0x0000FFFFU
+#define HWIF_MV_SCALEFACTOR_REG         8
+#define HWIF_MV_SCALEFACTOR_SHIFT       24
+#define HWIF_MV_SCALEFACTOR_MASK        0x000000FFU
+#define HWIF_REF_DIST_FWD_REG           8
+#define HWIF_REF_DIST_FWD_SHIFT         19
+#define HWIF_REF_DIST_FWD_MASK          0x0000001FU
+#define HWIF_REF_DIST_BWD_REG           8
+#define HWIF_REF_DIST_BWD_SHIFT         14
+#define HWIF_REF_DIST_BWD_MASK          0x0000001FU
+#define HWIF_LOOP_FILT_LIMIT_REG        8
+#define HWIF_LOOP_FILT_LIMIT_SHIFT      14
+#define HWIF_LOOP_FILT_LIMIT_MASK       0x0000000FU
+#define HWIF_VARIANCE_TEST_E_REG        8
+#define HWIF_VARIANCE_TEST_E_SHIFT      13
+#define HWIF_VARIANCE_TEST_E_MASK       0x00000001U
+#define HWIF_MV_THRESHOLD_REG           8
+#define HWIF_MV_THRESHOLD_SHIFT         10
+#define HWIF_MV_THRESHOLD_MASK          0x00000007U
+#define HWIF_VAR_THRESHOLD_REG          8
+#define HWIF_VAR_THRESHOLD_SHIFT        0
+#define HWIF_VAR_THRESHOLD_MASK         0x000003FFU
+#define HWIF_DIVX_IDCT_E_REG            8
+#define HWIF_DIVX_IDCT_E_SHIFT          8
+#define HWIF_DIVX_IDCT_E_MASK           0x00000001U
+#define HWIF_DIVX3_SLICE_SIZE_REG       8
+#define HWIF_DIVX3_SLICE_SIZE_SHIFT     0
+#define HWIF_DIVX3_SLICE_SIZE_MASK      0x000000FFU
+#define HWIF_PJPEG_REST_FREQ_REG        8
+#define HWIF_PJPEG_REST_FREQ_SHIFT      0
+#define HWIF_PJPEG_REST_FREQ_MASK       0x0000FFFFU
+#define HWIF_RV_PROFILE_REG             8
+#define HWIF_RV_PROFILE_SHIFT           30
+#define HWIF_RV_PROFILE_MASK            0x00000003U
+#define HWIF_RV_OSV_QUANT_REG           8
+#define HWIF_RV_OSV_QUANT_SHIFT         28
+#define HWIF_RV_OSV_QUANT_MASK          0x00000003U
+#define HWIF_RV_FWD_SCALE_REG           8
+#define HWIF_RV_FWD_SCALE_SHIFT         14
+#define HWIF_RV_FWD_SCALE_MASK          0x00003FFFU
+#define HWIF_RV_BWD_SCALE_REG           8
+#define HWIF_RV_BWD_SCALE_SHIFT         0
+#define HWIF_RV_BWD_SCALE_MASK          0x00003FFFU
+#define HWIF_INIT_DC_COMP0_REG          8
+#define HWIF_INIT_DC_COMP0_SHIFT        16
+#define HWIF_INIT_DC_COMP0_MASK         0x0000FFFFU
+#define HWIF_INIT_DC_COMP1_REG          8
+#define HWIF_INIT_DC_COMP1_SHIFT        0
+#define HWIF_INIT_DC_COMP1_MASK         0x0000FFFFU
+#define HWIF_PPS_ID_REG                 9
+#define HWIF_PPS_ID_SHIFT               24
+#define HWIF_PPS_ID_MASK                0x000000FFU
+#define HWIF_REFIDX1_ACTIVE_REG         9
+#define HWIF_REFIDX1_ACTIVE_SHIFT       19
+#define HWIF_REFIDX1_ACTIVE_MASK        0x0000001FU
+#define HWIF_REFIDX0_ACTIVE_REG         9
+#define HWIF_REFIDX0_ACTIVE_SHIFT       14
+#define HWIF_REFIDX0_ACTIVE_MASK        0x0000001FU
+#define HWIF_POC_LENGTH_REG             9
+#define HWIF_POC_LENGTH_SHIFT           0
+#define HWIF_POC_LENGTH_MASK            0x000000FFU
+#define HWIF_ICOMP0_E_REG               9
+#define HWIF_ICOMP0_E_SHIFT             24
+#define HWIF_ICOMP0_E_MASK              0x00000001U
+#define HWIF_ISCALE0_REG                9
+#define HWIF_ISCALE0_SHIFT              16
+#define HWIF_ISCALE0_MASK               0x000000FFU
+#define HWIF_ISHIFT0_REG                9
+#define HWIF_ISHIFT0_SHIFT              0
+#define HWIF_ISHIFT0_MASK               0x0000FFFFU
+#define HWIF_STREAM1_LEN_REG            9
+#define HWIF_STREAM1_LEN_SHIFT          0
+#define HWIF_STREAM1_LEN_MASK           0x00FFFFFFU
+#define HWIF_MB_CTRL_BASE_REG           9
+#define HWIF_MB_CTRL_BASE_SHIFT         0
+#define HWIF_MB_CTRL_BASE_MASK          0xFFFFFFFFU
+#define HWIF_PIC_SLICE_AM_REG           9
+#define HWIF_PIC_SLICE_AM_SHIFT         0
+#define HWIF_PIC_SLICE_AM_MASK          0x00001FFFU
+#define HWIF_COEFFS_PART_AM_REG         9
+#define HWIF_COEFFS_PART_AM_SHIFT       24
+#define HWIF_COEFFS_PART_AM_MASK        0x0000000FU
+#define HWIF_DIFF_MV_BASE_REG           10
+#define HWIF_DIFF_MV_BASE_SHIFT         0
+#define HWIF_DIFF_MV_BASE_MASK          0xFFFFFFFFU
+#define HWIF_PINIT_RLIST_F9_REG         10
+#define HWIF_PINIT_RLIST_F9_SHIFT       25
+#define HWIF_PINIT_RLIST_F9_MASK        0x0000001FU
+#define HWIF_PINIT_RLIST_F8_REG         10
+#define HWIF_PINIT_RLIST_F8_SHIFT       20
+#define HWIF_PINIT_RLIST_F8_MASK        0x0000001FU
+#define HWIF_PINIT_RLIST_F7_REG         10
+#define HWIF_PINIT_RLIST_F7_SHIFT       15
+#define HWIF_PINIT_RLIST_F7_MASK        0x0000001FU
+#define HWIF_PINIT_RLIST_F6_REG         10
+#define HWIF_PINIT_RLIST_F6_SHIFT       10
+#define HWIF_PINIT_RLIST_F6_MASK        0x0000001FU
+#define HWIF_PINIT_RLIST_F5_REG         10
+#define HWIF_PINIT_RLIST_F5_SHIFT       5
+#define HWIF_PINIT_RLIST_F5_MASK        0x0000001FU
+#define HWIF_PINIT_RLIST_F4_REG         10
+#define HWIF_PINIT_RLIST_F4_SHIFT       0
+#define HWIF_PINIT_RLIST_F4_MASK        0x0000001FU
+#define HWIF_ICOMP1_E_REG               10
+#define HWIF_ICOMP1_E_SHIFT             24
+#define HWIF_ICOMP1_E_MASK              0x00000001U
+#define HWIF_ISCALE1_REG                10
+#define HWIF_ISCALE1_SHIFT              16
+#define HWIF_ISCALE1_MASK               0x000000FFU
+#define HWIF_ISHIFT1_REG                10
+#define HWIF_ISHIFT1_SHIFT              0
+#define HWIF_ISHIFT1_MASK               0x0000FFFFU
+#define HWIF_SEGMENT_BASE_REG           10
+#define HWIF_SEGMENT_BASE_SHIFT         0
+#define HWIF_SEGMENT_BASE_MASK          0xFFFFFFFFU
+#define HWIF_SEGMENT_UPD_E_REG          10
+#define HWIF_SEGMENT_UPD_E_SHIFT        1
+#define HWIF_SEGMENT_UPD_E_MASK         0x00000001U
+#define HWIF_SEGMENT_E_REG              10
+#define HWIF_SEGMENT_E_SHIFT            0
+#define HWIF_SEGMENT_E_MASK             0x00000001U
+#define HWIF_I4X4_OR_DC_BASE_REG        11
+#define HWIF_I4X4_OR_DC_BASE_SHIFT      0
+#define HWIF_I4X4_OR_DC_BASE_MASK       0xFFFFFFFFU
+#define HWIF_PINIT_RLIST_F15_REG        11
+#define HWIF_PINIT_RLIST_F15_SHIFT      25
+#define HWIF_PINIT_RLIST_F15_MASK       0x0000001FU
+#define HWIF_PINIT_RLIST_F14_REG        11
+#define HWIF_PINIT_RLIST_F14_SHIFT      20
+#define HWIF_PINIT_RLIST_F14_MASK       0x0000001FU
+#define HWIF_PINIT_RLIST_F13_REG        11
+#define HWIF_PINIT_RLIST_F13_SHIFT      15
+#define HWIF_PINIT_RLIST_F13_MASK       0x0000001FU
+#define HWIF_PINIT_RLIST_F12_REG        11
+#define HWIF_PINIT_RLIST_F12_SHIFT      10
+#define HWIF_PINIT_RLIST_F12_MASK       0x0000001FU
+#define HWIF_PINIT_RLIST_F11_REG        11
+#define HWIF_PINIT_RLIST_F11_SHIFT      5
+#define HWIF_PINIT_RLIST_F11_MASK       0x0000001FU
+#define HWIF_PINIT_RLIST_F10_REG        11
+#define HWIF_PINIT_RLIST_F10_SHIFT      0
+#define HWIF_PINIT_RLIST_F10_MASK       0x0000001FU
+#define HWIF_ICOMP2_E_REG               11
+#define HWIF_ICOMP2_E_SHIFT             24
+#define HWIF_ICOMP2_E_MASK              0x00000001U
+#define HWIF_ISCALE2_REG                11
+#define HWIF_ISCALE2_SHIFT              16
+#define HWIF_ISCALE2_MASK               0x000000FFU
+#define HWIF_ISHIFT2_REG                11
+#define HWIF_ISHIFT2_SHIFT              0
+#define HWIF_ISHIFT2_MASK               0x0000FFFFU
+#define HWIF_DCT3_START_BIT_REG         11
+#define HWIF_DCT3_START_BIT_SHIFT       24
+#define HWIF_DCT3_START_BIT_MASK        0x0000003FU
+#define HWIF_DCT4_START_BIT_REG         11
+#define HWIF_DCT4_START_BIT_SHIFT       18
+#define HWIF_DCT4_START_BIT_MASK        0x0000003FU
+#define HWIF_DCT5_START_BIT_REG         11
+#define HWIF_DCT5_START_BIT_SHIFT       12
+#define HWIF_DCT5_START_BIT_MASK        0x0000003FU
+#define HWIF_DCT6_START_BIT_REG         11
+#define HWIF_DCT6_START_BIT_SHIFT       6
+#define HWIF_DCT6_START_BIT_MASK        0x0000003FU
+#define HWIF_DCT7_START_BIT_REG         11
+#define HWIF_DCT7_START_BIT_SHIFT       0
+#define HWIF_DCT7_START_BIT_MASK        0x0000003FU
+#define HWIF_RLC_VLC_BASE_REG           12
+#define HWIF_RLC_VLC_BASE_SHIFT         0
+#define HWIF_RLC_VLC_BASE_MASK          0xFFFFFFFFU
+#define HWIF_DEC_OUT_BASE_REG           13
+#define HWIF_DEC_OUT_BASE_SHIFT         0
+#define HWIF_DEC_OUT_BASE_MASK          0xFFFFFFFFU
+#define HWIF_DPB_ILACE_MODE_REG         13
+#define HWIF_DPB_ILACE_MODE_SHIFT       1
+#define HWIF_DPB_ILACE_MODE_MASK        0x00000001U
+#define HWIF_REFER0_BASE_REG            14
+#define HWIF_REFER0_BASE_SHIFT          0
+#define HWIF_REFER0_BASE_MASK           0xFFFFFFFFU
+#define HWIF_REFER0_FIELD_E_REG         14
+#define HWIF_REFER0_FIELD_E_SHIFT       1
+#define HWIF_REFER0_FIELD_E_MASK        0x00000001U
+#define HWIF_REFER0_TOPC_E_REG          14
+#define HWIF_REFER0_TOPC_E_SHIFT        0
+#define HWIF_REFER0_TOPC_E_MASK         0x00000001U
+#define HWIF_JPG_CH_OUT_BASE_REG        14
+#define HWIF_JPG_CH_OUT_BASE_SHIFT      0
+#define HWIF_JPG_CH_OUT_BASE_MASK       0xFFFFFFFFU
+#define HWIF_REFER1_BASE_REG            15
+#define HWIF_REFER1_BASE_SHIFT          0
+#define HWIF_REFER1_BASE_MASK           0xFFFFFFFFU
+#define HWIF_REFER1_FIELD_E_REG         15
+#define HWIF_REFER1_FIELD_E_SHIFT       1
+#define HWIF_REFER1_FIELD_E_MASK        0x00000001U
+#define HWIF_REFER1_TOPC_E_REG          15
+#define HWIF_REFER1_TOPC_E_SHIFT        0
+#define HWIF_REFER1_TOPC_E_MASK         0x00000001U
+#define HWIF_JPEG_SLICE_H_REG           15
+#define HWIF_JPEG_SLICE_H_SHIFT         0
+#define HWIF_JPEG_SLICE_H_MASK          0x000000FFU
+#define HWIF_REFER2_BASE_REG            16
+#define HWIF_REFER2_BASE_SHIFT          0
+#define HWIF_REFER2_BASE_MASK           0xFFFFFFFFU
+#define HWIF_REFER2_FIELD_E_REG         16
+#define HWIF_REFER2_FIELD_E_SHIFT       1
+#define HWIF_REFER2_FIELD_E_MASK        0x00000001U
+#define HWIF_REFER2_TOPC_E_REG          16
+#define HWIF_REFER2_TOPC_E_SHIFT        0
+#define HWIF_REFER2_TOPC_E_MASK         0x00000001U
+#define HWIF_AC1_CODE6_CNT_REG          16
+#define HWIF_AC1_CODE6_CNT_SHIFT        24
+#define HWIF_AC1_CODE6_CNT_MASK         0x0000007FU
+#define HWIF_AC1_CODE5_CNT_REG          16
+#define HWIF_AC1_CODE5_CNT_SHIFT        16
+#define HWIF_AC1_CODE5_CNT_MASK         0x0000003FU
+#define HWIF_AC1_CODE4_CNT_REG          16
+#define HWIF_AC1_CODE4_CNT_SHIFT        11
+#define HWIF_AC1_CODE4_CNT_MASK         0x0000001FU
+#define HWIF_AC1_CODE3_CNT_REG          16
+#define HWIF_AC1_CODE3_CNT_SHIFT        7
+#define HWIF_AC1_CODE3_CNT_MASK         0x0000000FU
+#define HWIF_AC1_CODE2_CNT_REG          16
+#define HWIF_AC1_CODE2_CNT_SHIFT        3
+#define HWIF_AC1_CODE2_CNT_MASK         0x00000007U
+#define HWIF_AC1_CODE1_CNT_REG          16
+#define HWIF_AC1_CODE1_CNT_SHIFT        0
+#define HWIF_AC1_CODE1_CNT_MASK         0x00000003U
+#define HWIF_REFER3_BASE_REG            17
+#define HWIF_REFER3_BASE_SHIFT          0
+#define HWIF_REFER3_BASE_MASK           0xFFFFFFFFU
+#define HWIF_REFER3_FIELD_E_REG         17
+#define HWIF_REFER3_FIELD_E_SHIFT       1
+#define HWIF_REFER3_FIELD_E_MASK        0x00000001U
+#define HWIF_REFER3_TOPC_E_REG          17
+#define HWIF_REFER3_TOPC_E_SHIFT        0
+#define HWIF_REFER3_TOPC_E_MASK         0x00000001U
+#define HWIF_AC1_CODE10_CNT_REG         17
+#define HWIF_AC1_CODE10_CNT_SHIFT       24
+#define HWIF_AC1_CODE10_CNT_MASK        0x000000FFU
+#define HWIF_AC1_CODE9_CNT_REG          17
+#define HWIF_AC1_CODE9_CNT_SHIFT        16
+#define HWIF_AC1_CODE9_CNT_MASK         0x000000FFU
+#define HWIF_AC1_CODE8_CNT_REG          17
+#define HWIF_AC1_CODE8_CNT_SHIFT        8
+#define HWIF_AC1_CODE8_CNT_MASK         0x000000FFU
+#define HWIF_AC1_CODE7_CNT_REG          17
+#define HWIF_AC1_CODE7_CNT_SHIFT        0
+#define HWIF_AC1_CODE7_CNT_MASK         0x000000FFU
+#define HWIF_REFER4_BASE_REG            18
+#define HWIF_REFER4_BASE_SHIFT          0
+#define HWIF_REFER4_BASE_MASK           0xFFFFFFFFU
+#define HWIF_REFER4_FIELD_E_REG         18
+#define HWIF_REFER4_FIELD_E_SHIFT       1
+#define HWIF_REFER4_FIELD_E_MASK        0x00000001U
+#define HWIF_REFER4_TOPC_E_REG          18
+#define HWIF_REFER4_TOPC_E_SHIFT        0
+#define HWIF_REFER4_TOPC_E_MASK         0x00000001U
+#define HWIF_PIC_HEADER_LEN_REG         18
+#define HWIF_PIC_HEADER_LEN_SHIFT       16
+#define HWIF_PIC_HEADER_LEN_MASK        0x0000FFFFU
+#define HWIF_PIC_4MV_E_REG              18
+#define HWIF_PIC_4MV_E_SHIFT            13
+#define HWIF_PIC_4MV_E_MASK             0x00000001U
+#define HWIF_RANGE_RED_REF_E_REG        18
+#define HWIF_RANGE_RED_REF_E_SHIFT      11
+#define HWIF_RANGE_RED_REF_E_MASK       0x00000001U
+#define HWIF_VC1_DIFMV_RANGE_REG        18
+#define HWIF_VC1_DIFMV_RANGE_SHIFT      9
+#define HWIF_VC1_DIFMV_RANGE_MASK       0x00000003U
+#define HWIF_MV_RANGE_REG               18
+#define HWIF_MV_RANGE_SHIFT             6
+#define HWIF_MV_RANGE_MASK              0x00000003U
+#define HWIF_OVERLAP_E_REG              18
+#define HWIF_OVERLAP_E_SHIFT            5
+#define HWIF_OVERLAP_E_MASK             0x00000001U
+#define HWIF_OVERLAP_METHOD_REG         18
+#define HWIF_OVERLAP_METHOD_SHIFT       3
+#define HWIF_OVERLAP_METHOD_MASK        0x00000003U
+#define HWIF_ALT_SCAN_FLAG_E_REG        18
+#define HWIF_ALT_SCAN_FLAG_E_SHIFT      19
+#define HWIF_ALT_SCAN_FLAG_E_MASK       0x00000001U
+#define HWIF_FCODE_FWD_HOR_REG          18
+#define HWIF_FCODE_FWD_HOR_SHIFT        15
+#define HWIF_FCODE_FWD_HOR_MASK         0x0000000FU
+#define HWIF_FCODE_FWD_VER_REG          18
+#define HWIF_FCODE_FWD_VER_SHIFT        11
+#define HWIF_FCODE_FWD_VER_MASK         0x0000000FU
+#define HWIF_FCODE_BWD_HOR_REG          18
+#define HWIF_FCODE_BWD_HOR_SHIFT        7
+#define HWIF_FCODE_BWD_HOR_MASK         0x0000000FU
+#define HWIF_FCODE_BWD_VER_REG          18
+#define HWIF_FCODE_BWD_VER_SHIFT        3
+#define HWIF_FCODE_BWD_VER_MASK         0x0000000FU
+#define HWIF_MV_ACCURACY_FWD_REG        18
+#define HWIF_MV_ACCURACY_FWD_SHIFT      2
+#define HWIF_MV_ACCURACY_FWD_MASK       0x00000001U
+#define HWIF_MV_ACCURACY_BWD_REG        18
+#define HWIF_MV_ACCURACY_BWD_SHIFT      1
+#define HWIF_MV_ACCURACY_BWD_MASK       0x00000001U
+#define HWIF_MPEG4_VC1_RC_REG           18
+#define HWIF_MPEG4_VC1_RC_SHIFT         1
+#define HWIF_MPEG4_VC1_RC_MASK          0x00000001U
+#define HWIF_PREV_ANC_TYPE_REG          18
+#define HWIF_PREV_ANC_TYPE_SHIFT        0
+#define HWIF_PREV_ANC_TYPE_MASK         0x00000001U
+#define HWIF_AC1_CODE14_CNT_REG         18
+#define HWIF_AC1_CODE14_CNT_SHIFT       24
+#define HWIF_AC1_CODE14_CNT_MASK        0x000000FFU
+#define HWIF_AC1_CODE13_CNT_REG         18
+#define HWIF_AC1_CODE13_CNT_SHIFT       16
+#define HWIF_AC1_CODE13_CNT_MASK        0x000000FFU
+#define HWIF_AC1_CODE12_CNT_REG         18
+#define HWIF_AC1_CODE12_CNT_SHIFT       8
+#define HWIF_AC1_CODE12_CNT_MASK        0x000000FFU
+#define HWIF_AC1_CODE11_CNT_REG         18
+#define HWIF_AC1_CODE11_CNT_SHIFT       0
+#define HWIF_AC1_CODE11_CNT_MASK        0x000000FFU
+#define HWIF_GREF_SIGN_BIAS_REG         18
+#define HWIF_GREF_SIGN_BIAS_SHIFT       0
+#define HWIF_GREF_SIGN_BIAS_MASK        0x00000001U
+#define HWIF_REFER5_BASE_REG            19
+#define HWIF_REFER5_BASE_SHIFT          0
+#define HWIF_REFER5_BASE_MASK           0xFFFFFFFFU
+#define HWIF_REFER5_FIELD_E_REG         19
+#define HWIF_REFER5_FIELD_E_SHIFT       1
+#define HWIF_REFER5_FIELD_E_MASK        0x00000001U
+#define HWIF_REFER5_TOPC_E_REG          19
+#define HWIF_REFER5_TOPC_E_SHIFT        0
+#define HWIF_REFER5_TOPC_E_MASK         0x00000001U
+#define HWIF_TRB_PER_TRD_D0_REG         19
+#define HWIF_TRB_PER_TRD_D0_SHIFT       0
+#define HWIF_TRB_PER_TRD_D0_MASK        0x07FFFFFFU
+#define HWIF_ICOMP3_E_REG               19
+#define HWIF_ICOMP3_E_SHIFT             24
+#define HWIF_ICOMP3_E_MASK              0x00000001U
+#define HWIF_ISCALE3_REG                19
+#define HWIF_ISCALE3_SHIFT              16
+#define HWIF_ISCALE3_MASK               0x000000FFU
+#define HWIF_ISHIFT3_REG                19
+#define HWIF_ISHIFT3_SHIFT              0
+#define HWIF_ISHIFT3_MASK               0x0000FFFFU
+#define HWIF_AC2_CODE4_CNT_REG          19
+#define HWIF_AC2_CODE4_CNT_SHIFT        27
+#define HWIF_AC2_CODE4_CNT_MASK         0x0000001FU
+#define HWIF_AC2_CODE3_CNT_REG          19
+#define HWIF_AC2_CODE3_CNT_SHIFT        23
+#define HWIF_AC2_CODE3_CNT_MASK         0x0000000FU
+#define HWIF_AC2_CODE2_CNT_REG          19
+#define HWIF_AC2_CODE2_CNT_SHIFT        19
+#define HWIF_AC2_CODE2_CNT_MASK         0x00000007U
+#define HWIF_AC2_CODE1_CNT_REG          19
+#define HWIF_AC2_CODE1_CNT_SHIFT        16
+#define HWIF_AC2_CODE1_CNT_MASK         0x00000003U
+#define HWIF_AC1_CODE16_CNT_REG         19
+#define HWIF_AC1_CODE16_CNT_SHIFT       8
+#define HWIF_AC1_CODE16_CNT_MASK        0x000000FFU
+#define HWIF_AC1_CODE15_CNT_REG         19
+#define HWIF_AC1_CODE15_CNT_SHIFT       0
+#define HWIF_AC1_CODE15_CNT_MASK        0x000000FFU
+#define HWIF_SCAN_MAP_1_REG             19
+#define HWIF_SCAN_MAP_1_SHIFT           24
+#define HWIF_SCAN_MAP_1_MASK            0x0000003FU
+#define HWIF_SCAN_MAP_2_REG             19
+#define HWIF_SCAN_MAP_2_SHIFT           18
+#define HWIF_SCAN_MAP_2_MASK            0x0000003FU
+#define HWIF_SCAN_MAP_3_REG             19
+#define HWIF_SCAN_MAP_3_SHIFT           12
+#define HWIF_SCAN_MAP_3_MASK            0x0000003FU
+#define HWIF_SCAN_MAP_4_REG             19
+#define HWIF_SCAN_MAP_4_SHIFT           6
+#define HWIF_SCAN_MAP_4_MASK            0x0000003FU
+#define HWIF_SCAN_MAP_5_REG             19
+#define HWIF_SCAN_MAP_5_SHIFT           0
+#define HWIF_SCAN_MAP_5_MASK            0x0000003FU
+#define HWIF_AREF_SIGN_BIAS_REG         19
+#define HWIF_AREF_SIGN_BIAS_SHIFT       0
+#define HWIF_AREF_SIGN_BIAS_MASK        0x00000001U
+#define HWIF_REFER6_BASE_REG            20
+#define HWIF_REFER6_BASE_SHIFT          0
+#define HWIF_REFER6_BASE_MASK           0xFFFFFFFFU
+#define HWIF_VP8_DEC_CH_BASE_REG        20
+#define HWIF_VP8_DEC_CH_BASE_SHIFT      0
+#define HWIF_VP8_DEC_CH_BASE_MASK       0xFFFFFFFFU
+#define HWIF_VP8_STRIDE_E_REG           20
+#define HWIF_VP8_STRIDE_E_SHIFT         1
+#define HWIF_VP8_STRIDE_E_MASK          0x00000001U
+#define HWIF_VP8_CH_BASE_E_REG          20
+#define HWIF_VP8_CH_BASE_E_SHIFT        0
+#define HWIF_VP8_CH_BASE_E_MASK         0x00000001U
+#define HWIF_REFER6_FIELD_E_REG         20
+#define HWIF_REFER6_FIELD_E_SHIFT       1
+#define HWIF_REFER6_FIELD_E_MASK        0x00000001U
+#define HWIF_REFER6_TOPC_E_REG          20
+#define HWIF_REFER6_TOPC_E_SHIFT        0
+#define HWIF_REFER6_TOPC_E_MASK         0x00000001U
+#define HWIF_TRB_PER_TRD_DM1_REG        20
+#define HWIF_TRB_PER_TRD_DM1_SHIFT      0
+#define HWIF_TRB_PER_TRD_DM1_MASK       0x07FFFFFFU
+#define HWIF_ICOMP4_E_REG               20
+#define HWIF_ICOMP4_E_SHIFT             24
+#define HWIF_ICOMP4_E_MASK              0x00000001U
+#define HWIF_ISCALE4_REG                20
+#define HWIF_ISCALE4_SHIFT              16
+#define HWIF_ISCALE4_MASK               0x000000FFU
+#define HWIF_ISHIFT4_REG                20
+#define HWIF_ISHIFT4_SHIFT              0
+#define HWIF_ISHIFT4_MASK               0x0000FFFFU
+#define HWIF_AC2_CODE8_CNT_REG          20
+#define HWIF_AC2_CODE8_CNT_SHIFT        24
+#define HWIF_AC2_CODE8_CNT_MASK         0x000000FFU
+#define HWIF_AC2_CODE7_CNT_REG          20
+#define HWIF_AC2_CODE7_CNT_SHIFT        16
+#define HWIF_AC2_CODE7_CNT_MASK         0x000000FFU
+#define HWIF_AC2_CODE6_CNT_REG          20
+#define HWIF_AC2_CODE6_CNT_SHIFT        8
+#define HWIF_AC2_CODE6_CNT_MASK         0x0000007FU
+#define HWIF_AC2_CODE5_CNT_REG          20
+#define HWIF_AC2_CODE5_CNT_SHIFT        0
+#define HWIF_AC2_CODE5_CNT_MASK         0x0000003FU
+#define HWIF_SCAN_MAP_6_REG             20
+#define HWIF_SCAN_MAP_6_SHIFT           24
+#define HWIF_SCAN_MAP_6_MASK            0x0000003FU
+#define HWIF_SCAN_MAP_7_REG             20
+#define HWIF_SCAN_MAP_7_SHIFT           18
+#define HWIF_SCAN_MAP_7_MASK            0x0000003FU
+#define HWIF_SCAN_MAP_8_REG             20
+#define HWIF_SCAN_MAP_8_SHIFT           12
+#define HWIF_SCAN_MAP_8_MASK            0x0000003FU
+#define HWIF_SCAN_MAP_9_REG             20
+#define HWIF_SCAN_MAP_9_SHIFT           6
+#define HWIF_SCAN_MAP_9_MASK            0x0000003FU
+#define HWIF_SCAN_MAP_10_REG            20
+#define HWIF_SCAN_MAP_10_SHIFT          0
+#define HWIF_SCAN_MAP_10_MASK           0x0000003FU
+#define HWIF_REFER7_BASE_REG            21
+#define HWIF_REFER7_BASE_SHIFT          0
+#define HWIF_REFER7_BASE_MASK           0xFFFFFFFFU
+#define HWIF_Y_STRIDE_POW2_REG          21
+#define HWIF_Y_STRIDE_POW2_SHIFT        27
+#define HWIF_Y_STRIDE_POW2_MASK         0x0000001FU
+#define HWIF_C_STRIDE_POW2_REG          21
+#define HWIF_C_STRIDE_POW2_SHIFT        22
+#define HWIF_C_STRIDE_POW2_MASK         0x0000001FU
+#define HWIF_REFER7_FIELD_E_REG         21
+#define HWIF_REFER7_FIELD_E_SHIFT       1
+#define HWIF_REFER7_FIELD_E_MASK        0x00000001U
+#define HWIF_REFER7_TOPC_E_REG          21
+#define HWIF_REFER7_TOPC_E_SHIFT        0
+#define HWIF_REFER7_TOPC_E_MASK         0x00000001U
+#define HWIF_TRB_PER_TRD_D1_REG         21
+#define HWIF_TRB_PER_TRD_D1_SHIFT       0
+#define HWIF_TRB_PER_TRD_D1_MASK        0x07FFFFFFU
+#define HWIF_AC2_CODE12_CNT_REG         21
+#define HWIF_AC2_CODE12_CNT_SHIFT       24
+#define HWIF_AC2_CODE12_CNT_MASK        0x000000FFU
+#define HWIF_AC2_CODE11_CNT_REG         21
+#define HWIF_AC2_CODE11_CNT_SHIFT       16
+#define HWIF_AC2_CODE11_CNT_MASK        0x000000FFU
+#define HWIF_AC2_CODE10_CNT_REG         21
+#define HWIF_AC2_CODE10_CNT_SHIFT       8
+#define HWIF_AC2_CODE10_CNT_MASK        0x000000FFU
+#define HWIF_AC2_CODE9_CNT_REG          21
+#define HWIF_AC2_CODE9_CNT_SHIFT        0
+#define HWIF_AC2_CODE9_CNT_MASK         0x000000FFU
+#define HWIF_SCAN_MAP_11_REG            21
+#define HWIF_SCAN_MAP_11_SHIFT          24
+#define HWIF_SCAN_MAP_11_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_12_REG            21
+#define HWIF_SCAN_MAP_12_SHIFT          18
+#define HWIF_SCAN_MAP_12_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_13_REG            21
+#define HWIF_SCAN_MAP_13_SHIFT          12
+#define HWIF_SCAN_MAP_13_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_14_REG            21
+#define HWIF_SCAN_MAP_14_SHIFT          6
+#define HWIF_SCAN_MAP_14_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_15_REG            21
+#define HWIF_SCAN_MAP_15_SHIFT          0
+#define HWIF_SCAN_MAP_15_MASK           0x0000003FU
+#define HWIF_REFER8_BASE_REG            22
+#define HWIF_REFER8_BASE_SHIFT          0
+#define HWIF_REFER8_BASE_MASK           0xFFFFFFFFU
+#define HWIF_DCT_STRM1_BASE_REG         22
+#define HWIF_DCT_STRM1_BASE_SHIFT       0
+#define HWIF_DCT_STRM1_BASE_MASK        0xFFFFFFFFU
+#define HWIF_REFER8_FIELD_E_REG         22
+#define HWIF_REFER8_FIELD_E_SHIFT       1
+#define HWIF_REFER8_FIELD_E_MASK        0x00000001U
+#define HWIF_REFER8_TOPC_E_REG          22
+#define HWIF_REFER8_TOPC_E_SHIFT        0
+#define HWIF_REFER8_TOPC_E_MASK         0x00000001U
+#define HWIF_AC2_CODE16_CNT_REG         22
+#define HWIF_AC2_CODE16_CNT_SHIFT       24
+#define HWIF_AC2_CODE16_CNT_MASK        0x000000FFU
+#define HWIF_AC2_CODE15_CNT_REG         22
+#define HWIF_AC2_CODE15_CNT_SHIFT       16
+#define HWIF_AC2_CODE15_CNT_MASK        0x000000FFU
+#define HWIF_AC2_CODE14_CNT_REG         22
+#define HWIF_AC2_CODE14_CNT_SHIFT       8
+#define HWIF_AC2_CODE14_CNT_MASK        0x000000FFU
+#define HWIF_AC2_CODE13_CNT_REG         22
+#define HWIF_AC2_CODE13_CNT_SHIFT       0
+#define HWIF_AC2_CODE13_CNT_MASK        0x000000FFU
+#define HWIF_SCAN_MAP_16_REG            22
+#define HWIF_SCAN_MAP_16_SHIFT          24
+#define HWIF_SCAN_MAP_16_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_17_REG            22
+#define HWIF_SCAN_MAP_17_SHIFT          18
+#define HWIF_SCAN_MAP_17_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_18_REG            22
+#define HWIF_SCAN_MAP_18_SHIFT          12
+#define HWIF_SCAN_MAP_18_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_19_REG            22
+#define HWIF_SCAN_MAP_19_SHIFT          6
+#define HWIF_SCAN_MAP_19_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_20_REG            22
+#define HWIF_SCAN_MAP_20_SHIFT          0
+#define HWIF_SCAN_MAP_20_MASK           0x0000003FU
+#define HWIF_REFER9_BASE_REG            23
+#define HWIF_REFER9_BASE_SHIFT          0
+#define HWIF_REFER9_BASE_MASK           0xFFFFFFFFU
+#define HWIF_DCT_STRM2_BASE_REG         23
+#define HWIF_DCT_STRM2_BASE_SHIFT       0
+#define HWIF_DCT_STRM2_BASE_MASK        0xFFFFFFFFU
+#define HWIF_REFER9_FIELD_E_REG         23
+#define HWIF_REFER9_FIELD_E_SHIFT       1
+#define HWIF_REFER9_FIELD_E_MASK        0x00000001U
+#define HWIF_REFER9_TOPC_E_REG          23
+#define HWIF_REFER9_TOPC_E_SHIFT        0
+#define HWIF_REFER9_TOPC_E_MASK         0x00000001U
+#define HWIF_DC1_CODE8_CNT_REG          23
+#define HWIF_DC1_CODE8_CNT_SHIFT        28
+#define HWIF_DC1_CODE8_CNT_MASK         0x0000000FU
+#define HWIF_DC1_CODE7_CNT_REG          23
+#define HWIF_DC1_CODE7_CNT_SHIFT        24
+#define HWIF_DC1_CODE7_CNT_MASK         0x0000000FU
+#define HWIF_DC1_CODE6_CNT_REG          23
+#define HWIF_DC1_CODE6_CNT_SHIFT        20
+#define HWIF_DC1_CODE6_CNT_MASK         0x0000000FU
+#define HWIF_DC1_CODE5_CNT_REG          23
+#define HWIF_DC1_CODE5_CNT_SHIFT        16
+#define HWIF_DC1_CODE5_CNT_MASK         0x0000000FU
+#define HWIF_DC1_CODE4_CNT_REG          23
+#define HWIF_DC1_CODE4_CNT_SHIFT        12
+#define HWIF_DC1_CODE4_CNT_MASK         0x0000000FU
+#define HWIF_DC1_CODE3_CNT_REG          23
+#define HWIF_DC1_CODE3_CNT_SHIFT        8
+#define HWIF_DC1_CODE3_CNT_MASK         0x0000000FU
+#define HWIF_DC1_CODE2_CNT_REG          23
+#define HWIF_DC1_CODE2_CNT_SHIFT        4
+#define HWIF_DC1_CODE2_CNT_MASK         0x00000007U
+#define HWIF_DC1_CODE1_CNT_REG          23
+#define HWIF_DC1_CODE1_CNT_SHIFT        0
+#define HWIF_DC1_CODE1_CNT_MASK         0x00000003U
+#define HWIF_SCAN_MAP_21_REG            23
+#define HWIF_SCAN_MAP_21_SHIFT          24
+#define HWIF_SCAN_MAP_21_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_22_REG            23
+#define HWIF_SCAN_MAP_22_SHIFT          18
+#define HWIF_SCAN_MAP_22_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_23_REG            23
+#define HWIF_SCAN_MAP_23_SHIFT          12
+#define HWIF_SCAN_MAP_23_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_24_REG            23
+#define HWIF_SCAN_MAP_24_SHIFT          6
+#define HWIF_SCAN_MAP_24_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_25_REG            23
+#define HWIF_SCAN_MAP_25_SHIFT          0
+#define HWIF_SCAN_MAP_25_MASK           0x0000003FU
+#define HWIF_REFER10_BASE_REG           24
+#define HWIF_REFER10_BASE_SHIFT         0
+#define HWIF_REFER10_BASE_MASK          0xFFFFFFFFU
+#define HWIF_DCT_STRM3_BASE_REG         24
+#define HWIF_DCT_STRM3_BASE_SHIFT       0
+#define HWIF_DCT_STRM3_BASE_MASK        0xFFFFFFFFU
+#define HWIF_REFER10_FIELD_E_REG        24
+#define HWIF_REFER10_FIELD_E_SHIFT      1
+#define HWIF_REFER10_FIELD_E_MASK       0x00000001U
+#define HWIF_REFER10_TOPC_E_REG         24
+#define HWIF_REFER10_TOPC_E_SHIFT       0
+#define HWIF_REFER10_TOPC_E_MASK        0x00000001U
+#define HWIF_DC1_CODE16_CNT_REG         24
+#define HWIF_DC1_CODE16_CNT_SHIFT       28
+#define HWIF_DC1_CODE16_CNT_MASK        0x0000000FU
+#define HWIF_DC1_CODE15_CNT_REG         24
+#define HWIF_DC1_CODE15_CNT_SHIFT       24
+#define HWIF_DC1_CODE15_CNT_MASK        0x0000000FU
+#define HWIF_DC1_CODE14_CNT_REG         24
+#define HWIF_DC1_CODE14_CNT_SHIFT       20
+#define HWIF_DC1_CODE14_CNT_MASK        0x0000000FU
+#define HWIF_DC1_CODE13_CNT_REG         24
+#define HWIF_DC1_CODE13_CNT_SHIFT       16
+#define HWIF_DC1_CODE13_CNT_MASK        0x0000000FU
+#define HWIF_DC1_CODE12_CNT_REG         24
+#define HWIF_DC1_CODE12_CNT_SHIFT       12
+#define HWIF_DC1_CODE12_CNT_MASK        0x0000000FU
+#define HWIF_DC1_CODE11_CNT_REG         24
+#define HWIF_DC1_CODE11_CNT_SHIFT       8
+#define HWIF_DC1_CODE11_CNT_MASK        0x0000000FU
+#define HWIF_DC1_CODE10_CNT_REG         24
+#define HWIF_DC1_CODE10_CNT_SHIFT       4
+#define HWIF_DC1_CODE10_CNT_MASK        0x0000000FU
+#define HWIF_DC1_CODE9_CNT_REG          24
+#define HWIF_DC1_CODE9_CNT_SHIFT        0
+#define HWIF_DC1_CODE9_CNT_MASK         0x0000000FU
+#define HWIF_SCAN_MAP_26_REG            24
+#define HWIF_SCAN_MAP_26_SHIFT          24
+#define HWIF_SCAN_MAP_26_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_27_REG            24
+#define HWIF_SCAN_MAP_27_SHIFT          18
+#define HWIF_SCAN_MAP_27_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_28_REG            24
+#define HWIF_SCAN_MAP_28_SHIFT          12
+#define HWIF_SCAN_MAP_28_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_29_REG            24
+#define HWIF_SCAN_MAP_29_SHIFT          6
+#define HWIF_SCAN_MAP_29_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_30_REG            24
+#define HWIF_SCAN_MAP_30_SHIFT          0
+#define HWIF_SCAN_MAP_30_MASK           0x0000003FU
+#define HWIF_REFER11_BASE_REG           25
+#define HWIF_REFER11_BASE_SHIFT         0
+#define HWIF_REFER11_BASE_MASK          0xFFFFFFFFU
+#define HWIF_DCT_STRM4_BASE_REG         25
+#define HWIF_DCT_STRM4_BASE_SHIFT       0
+#define HWIF_DCT_STRM4_BASE_MASK        0xFFFFFFFFU
+#define HWIF_REFER11_FIELD_E_REG        25
+#define HWIF_REFER11_FIELD_E_SHIFT      1
+#define HWIF_REFER11_FIELD_E_MASK       0x00000001U
+#define HWIF_REFER11_TOPC_E_REG         25
+#define HWIF_REFER11_TOPC_E_SHIFT       0
+#define HWIF_REFER11_TOPC_E_MASK        0x00000001U
+#define HWIF_DC2_CODE8_CNT_REG          25
+#define HWIF_DC2_CODE8_CNT_SHIFT        28
+#define HWIF_DC2_CODE8_CNT_MASK         0x0000000FU
+#define HWIF_DC2_CODE7_CNT_REG          25
+#define HWIF_DC2_CODE7_CNT_SHIFT        24
+#define HWIF_DC2_CODE7_CNT_MASK         0x0000000FU
+#define HWIF_DC2_CODE6_CNT_REG          25
+#define HWIF_DC2_CODE6_CNT_SHIFT        20
+#define HWIF_DC2_CODE6_CNT_MASK         0x0000000FU
+#define HWIF_DC2_CODE5_CNT_REG          25
+#define HWIF_DC2_CODE5_CNT_SHIFT        16
+#define HWIF_DC2_CODE5_CNT_MASK         0x0000000FU
+#define HWIF_DC2_CODE4_CNT_REG          25
+#define HWIF_DC2_CODE4_CNT_SHIFT        12
+#define HWIF_DC2_CODE4_CNT_MASK         0x0000000FU
+#define HWIF_DC2_CODE3_CNT_REG          25
+#define HWIF_DC2_CODE3_CNT_SHIFT        8
+#define HWIF_DC2_CODE3_CNT_MASK         0x0000000FU
+#define HWIF_DC2_CODE2_CNT_REG          25
+#define HWIF_DC2_CODE2_CNT_SHIFT        4
+#define HWIF_DC2_CODE2_CNT_MASK         0x00000007U
+#define HWIF_DC2_CODE1_CNT_REG          25
+#define HWIF_DC2_CODE1_CNT_SHIFT        0
+#define HWIF_DC2_CODE1_CNT_MASK         0x00000003U
+#define HWIF_SCAN_MAP_31_REG            25
+#define HWIF_SCAN_MAP_31_SHIFT          24
+#define HWIF_SCAN_MAP_31_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_32_REG            25
+#define HWIF_SCAN_MAP_32_SHIFT          18
+#define HWIF_SCAN_MAP_32_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_33_REG            25
+#define HWIF_SCAN_MAP_33_SHIFT          12
+#define HWIF_SCAN_MAP_33_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_34_REG            25
+#define HWIF_SCAN_MAP_34_SHIFT          6
+#define HWIF_SCAN_MAP_34_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_35_REG            25
+#define HWIF_SCAN_MAP_35_SHIFT          0
+#define HWIF_SCAN_MAP_35_MASK           0x0000003FU
+#define HWIF_REFER12_BASE_REG           26
+#define HWIF_REFER12_BASE_SHIFT         0
+#define HWIF_REFER12_BASE_MASK          0xFFFFFFFFU
+#define HWIF_DCT_STRM5_BASE_REG         26
+#define HWIF_DCT_STRM5_BASE_SHIFT       0
+#define HWIF_DCT_STRM5_BASE_MASK        0xFFFFFFFFU
+#define HWIF_REFER12_FIELD_E_REG        26
+#define HWIF_REFER12_FIELD_E_SHIFT      1
+#define HWIF_REFER12_FIELD_E_MASK       0x00000001U
+#define HWIF_REFER12_TOPC_E_REG         26
+#define HWIF_REFER12_TOPC_E_SHIFT       0
+#define HWIF_REFER12_TOPC_E_MASK        0x00000001U
+#define HWIF_DC2_CODE16_CNT_REG         26
+#define HWIF_DC2_CODE16_CNT_SHIFT       28
+#define HWIF_DC2_CODE16_CNT_MASK        0x0000000FU
+#define HWIF_DC2_CODE15_CNT_REG         26
+#define HWIF_DC2_CODE15_CNT_SHIFT       24
+#define HWIF_DC2_CODE15_CNT_MASK        0x0000000FU
+#define HWIF_DC2_CODE14_CNT_REG         26
+#define HWIF_DC2_CODE14_CNT_SHIFT       20
+#define HWIF_DC2_CODE14_CNT_MASK        0x0000000FU
+#define HWIF_DC2_CODE13_CNT_REG         26
+#define HWIF_DC2_CODE13_CNT_SHIFT       16
+#define HWIF_DC2_CODE13_CNT_MASK        0x0000000FU
+#define HWIF_DC2_CODE12_CNT_REG         26
+#define HWIF_DC2_CODE12_CNT_SHIFT       12
+#define HWIF_DC2_CODE12_CNT_MASK        0x0000000FU
+#define HWIF_DC2_CODE11_CNT_REG         26
+#define HWIF_DC2_CODE11_CNT_SHIFT       8
+#define HWIF_DC2_CODE11_CNT_MASK        0x0000000FU
+#define HWIF_DC2_CODE10_CNT_REG         26
+#define HWIF_DC2_CODE10_CNT_SHIFT       4
+#define HWIF_DC2_CODE10_CNT_MASK        0x0000000FU
+#define HWIF_DC2_CODE9_CNT_REG          26
+#define HWIF_DC2_CODE9_CNT_SHIFT        0
+#define HWIF_DC2_CODE9_CNT_MASK         0x0000000FU
+#define HWIF_SCAN_MAP_36_REG            26
+#define HWIF_SCAN_MAP_36_SHIFT          24
+#define HWIF_SCAN_MAP_36_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_37_REG            26
+#define HWIF_SCAN_MAP_37_SHIFT          18
+#define HWIF_SCAN_MAP_37_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_38_REG            26
+#define HWIF_SCAN_MAP_38_SHIFT          12
+#define HWIF_SCAN_MAP_38_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_39_REG            26
+#define HWIF_SCAN_MAP_39_SHIFT          6
+#define HWIF_SCAN_MAP_39_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_40_REG            26
+#define HWIF_SCAN_MAP_40_SHIFT          0
+#define HWIF_SCAN_MAP_40_MASK           0x0000003FU
+#define HWIF_REFER13_BASE_REG           27
+#define HWIF_REFER13_BASE_SHIFT         0
+#define HWIF_REFER13_BASE_MASK          0xFFFFFFFFU
+#define HWIF_REFER13_FIELD_E_REG        27
+#define HWIF_REFER13_FIELD_E_SHIFT      1
+#define HWIF_REFER13_FIELD_E_MASK       0x00000001U
+#define HWIF_REFER13_TOPC_E_REG         27
+#define HWIF_REFER13_TOPC_E_SHIFT       0
+#define HWIF_REFER13_TOPC_E_MASK        0x00000001U
+#define HWIF_DC3_CODE8_CNT_REG          27
+#define HWIF_DC3_CODE8_CNT_SHIFT        28
+#define HWIF_DC3_CODE8_CNT_MASK         0x0000000FU
+#define HWIF_DC3_CODE7_CNT_REG          27
+#define HWIF_DC3_CODE7_CNT_SHIFT        24
+#define HWIF_DC3_CODE7_CNT_MASK         0x0000000FU
+#define HWIF_DC3_CODE6_CNT_REG          27
+#define HWIF_DC3_CODE6_CNT_SHIFT        20
+#define HWIF_DC3_CODE6_CNT_MASK         0x0000000FU
+#define HWIF_DC3_CODE5_CNT_REG          27
+#define HWIF_DC3_CODE5_CNT_SHIFT        16
+#define HWIF_DC3_CODE5_CNT_MASK         0x0000000FU
+#define HWIF_DC3_CODE4_CNT_REG          27
+#define HWIF_DC3_CODE4_CNT_SHIFT        12
+#define HWIF_DC3_CODE4_CNT_MASK         0x0000000FU
+#define HWIF_DC3_CODE3_CNT_REG          27
+#define HWIF_DC3_CODE3_CNT_SHIFT        8
+#define HWIF_DC3_CODE3_CNT_MASK         0x0000000FU
+#define HWIF_DC3_CODE2_CNT_REG          27
+#define HWIF_DC3_CODE2_CNT_SHIFT        4
+#define HWIF_DC3_CODE2_CNT_MASK         0x00000007U
+#define HWIF_DC3_CODE1_CNT_REG          27
+#define HWIF_DC3_CODE1_CNT_SHIFT        0
+#define HWIF_DC3_CODE1_CNT_MASK         0x00000003U
+#define HWIF_BITPL_CTRL_BASE_REG        27
+#define HWIF_BITPL_CTRL_BASE_SHIFT      0
+#define HWIF_BITPL_CTRL_BASE_MASK       0xFFFFFFFFU
+#define HWIF_REFER14_BASE_REG           28
+#define HWIF_REFER14_BASE_SHIFT         0
+#define HWIF_REFER14_BASE_MASK          0xFFFFFFFFU
+#define HWIF_DCT_STRM6_BASE_REG         28
+#define HWIF_DCT_STRM6_BASE_SHIFT       0
+#define HWIF_DCT_STRM6_BASE_MASK        0xFFFFFFFFU
+#define HWIF_REFER14_FIELD_E_REG        28
+#define HWIF_REFER14_FIELD_E_SHIFT      1
+#define HWIF_REFER14_FIELD_E_MASK       0x00000001U
+#define HWIF_REFER14_TOPC_E_REG         28
+#define HWIF_REFER14_TOPC_E_SHIFT       0
+#define HWIF_REFER14_TOPC_E_MASK        0x00000001U
+#define HWIF_REF_INVD_CUR_1_REG         28
+#define HWIF_REF_INVD_CUR_1_SHIFT       16
+#define HWIF_REF_INVD_CUR_1_MASK        0x0000FFFFU
+#define HWIF_REF_INVD_CUR_0_REG         28
+#define HWIF_REF_INVD_CUR_0_SHIFT       0
+#define HWIF_REF_INVD_CUR_0_MASK        0x0000FFFFU
+#define HWIF_DC3_CODE16_CNT_REG         28
+#define HWIF_DC3_CODE16_CNT_SHIFT       28
+#define HWIF_DC3_CODE16_CNT_MASK        0x0000000FU
+#define HWIF_DC3_CODE15_CNT_REG         28
+#define HWIF_DC3_CODE15_CNT_SHIFT       24
+#define HWIF_DC3_CODE15_CNT_MASK        0x0000000FU
+#define HWIF_DC3_CODE14_CNT_REG         28
+#define HWIF_DC3_CODE14_CNT_SHIFT       20
+#define HWIF_DC3_CODE14_CNT_MASK        0x0000000FU
+#define HWIF_DC3_CODE13_CNT_REG         28
+#define HWIF_DC3_CODE13_CNT_SHIFT       16
+#define HWIF_DC3_CODE13_CNT_MASK        0x0000000FU
+#define HWIF_DC3_CODE12_CNT_REG         28
+#define HWIF_DC3_CODE12_CNT_SHIFT       12
+#define HWIF_DC3_CODE12_CNT_MASK        0x0000000FU
+#define HWIF_DC3_CODE11_CNT_REG         28
+#define HWIF_DC3_CODE11_CNT_SHIFT       8
+#define HWIF_DC3_CODE11_CNT_MASK        0x0000000FU
+#define HWIF_DC3_CODE10_CNT_REG         28
+#define HWIF_DC3_CODE10_CNT_SHIFT       4
+#define HWIF_DC3_CODE10_CNT_MASK        0x0000000FU
+#define HWIF_DC3_CODE9_CNT_REG          28
+#define HWIF_DC3_CODE9_CNT_SHIFT        0
+#define HWIF_DC3_CODE9_CNT_MASK         0x0000000FU
+#define HWIF_SCAN_MAP_41_REG            28
+#define HWIF_SCAN_MAP_41_SHIFT          24
+#define HWIF_SCAN_MAP_41_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_42_REG            28
+#define HWIF_SCAN_MAP_42_SHIFT          18
+#define HWIF_SCAN_MAP_42_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_43_REG            28
+#define HWIF_SCAN_MAP_43_SHIFT          12
+#define HWIF_SCAN_MAP_43_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_44_REG            28
+#define HWIF_SCAN_MAP_44_SHIFT          6
+#define HWIF_SCAN_MAP_44_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_45_REG            28
+#define HWIF_SCAN_MAP_45_SHIFT          0
+#define HWIF_SCAN_MAP_45_MASK           0x0000003FU
+#define HWIF_REFER15_BASE_REG           29
+#define HWIF_REFER15_BASE_SHIFT         0
+#define HWIF_REFER15_BASE_MASK          0xFFFFFFFFU
+#define HWIF_DCT_STRM7_BASE_REG         29
+#define HWIF_DCT_STRM7_BASE_SHIFT       0
+#define HWIF_DCT_STRM7_BASE_MASK        0xFFFFFFFFU
+#define HWIF_REFER15_FIELD_E_REG        29
+#define HWIF_REFER15_FIELD_E_SHIFT      1
+#define HWIF_REFER15_FIELD_E_MASK       0x00000001U
+#define HWIF_REFER15_TOPC_E_REG         29
+#define HWIF_REFER15_TOPC_E_SHIFT       0
+#define HWIF_REFER15_TOPC_E_MASK        0x00000001U
+#define HWIF_REF_INVD_CUR_3_REG         29
+#define HWIF_REF_INVD_CUR_3_SHIFT       16
+#define HWIF_REF_INVD_CUR_3_MASK        0x0000FFFFU
+#define HWIF_REF_INVD_CUR_2_REG         29
+#define HWIF_REF_INVD_CUR_2_SHIFT       0
+#define HWIF_REF_INVD_CUR_2_MASK        0x0000FFFFU
+#define HWIF_SCAN_MAP_46_REG            29
+#define HWIF_SCAN_MAP_46_SHIFT          24
+#define HWIF_SCAN_MAP_46_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_47_REG            29
+#define HWIF_SCAN_MAP_47_SHIFT          18
+#define HWIF_SCAN_MAP_47_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_48_REG            29
+#define HWIF_SCAN_MAP_48_SHIFT          12
+#define HWIF_SCAN_MAP_48_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_49_REG            29
+#define HWIF_SCAN_MAP_49_SHIFT          6
+#define HWIF_SCAN_MAP_49_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_50_REG            29
+#define HWIF_SCAN_MAP_50_SHIFT          0
+#define HWIF_SCAN_MAP_50_MASK           0x0000003FU
+#define HWIF_REFER1_NBR_REG             30
+#define HWIF_REFER1_NBR_SHIFT           16
+#define HWIF_REFER1_NBR_MASK            0x0000FFFFU
+#define HWIF_REFER0_NBR_REG             30
+#define HWIF_REFER0_NBR_SHIFT           0
+#define HWIF_REFER0_NBR_MASK            0x0000FFFFU
+#define HWIF_REF_DIST_CUR_1_REG         30
+#define HWIF_REF_DIST_CUR_1_SHIFT       16
+#define HWIF_REF_DIST_CUR_1_MASK        0x0000FFFFU
+#define HWIF_REF_DIST_CUR_0_REG         30
+#define HWIF_REF_DIST_CUR_0_SHIFT       0
+#define HWIF_REF_DIST_CUR_0_MASK        0x0000FFFFU
+#define HWIF_FILT_TYPE_REG              30
+#define HWIF_FILT_TYPE_SHIFT            31
+#define HWIF_FILT_TYPE_MASK             0x00000001U
+#define HWIF_FILT_SHARPNESS_REG         30
+#define HWIF_FILT_SHARPNESS_SHIFT       28
+#define HWIF_FILT_SHARPNESS_MASK        0x00000007U
+#define HWIF_FILT_MB_ADJ_0_REG          30
+#define HWIF_FILT_MB_ADJ_0_SHIFT        21
+#define HWIF_FILT_MB_ADJ_0_MASK         0x0000007FU
+#define HWIF_FILT_MB_ADJ_1_REG          30
+#define HWIF_FILT_MB_ADJ_1_SHIFT        14
+#define HWIF_FILT_MB_ADJ_1_MASK         0x0000007FU
+#define HWIF_FILT_MB_ADJ_2_REG          30
+#define HWIF_FILT_MB_ADJ_2_SHIFT        7
+#define HWIF_FILT_MB_ADJ_2_MASK         0x0000007FU
+#define HWIF_FILT_MB_ADJ_3_REG          30
+#define HWIF_FILT_MB_ADJ_3_SHIFT        0
+#define HWIF_FILT_MB_ADJ_3_MASK         0x0000007FU
+#define HWIF_REFER3_NBR_REG             31
+#define HWIF_REFER3_NBR_SHIFT           16
+#define HWIF_REFER3_NBR_MASK            0x0000FFFFU
+#define HWIF_REFER2_NBR_REG             31
+#define HWIF_REFER2_NBR_SHIFT           0
+#define HWIF_REFER2_NBR_MASK            0x0000FFFFU
+#define HWIF_SCAN_MAP_51_REG            31
+#define HWIF_SCAN_MAP_51_SHIFT          24
+#define HWIF_SCAN_MAP_51_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_52_REG            31
+#define HWIF_SCAN_MAP_52_SHIFT          18
+#define HWIF_SCAN_MAP_52_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_53_REG            31
+#define HWIF_SCAN_MAP_53_SHIFT          12
+#define HWIF_SCAN_MAP_53_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_54_REG            31
+#define HWIF_SCAN_MAP_54_SHIFT          6
+#define HWIF_SCAN_MAP_54_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_55_REG            31
+#define HWIF_SCAN_MAP_55_SHIFT          0
+#define HWIF_SCAN_MAP_55_MASK           0x0000003FU
+#define HWIF_REF_DIST_CUR_3_REG         31
+#define HWIF_REF_DIST_CUR_3_SHIFT       16
+#define HWIF_REF_DIST_CUR_3_MASK        0x0000FFFFU
+#define HWIF_REF_DIST_CUR_2_REG         31
+#define HWIF_REF_DIST_CUR_2_SHIFT       0
+#define HWIF_REF_DIST_CUR_2_MASK        0x0000FFFFU
+#define HWIF_FILT_REF_ADJ_0_REG         31
+#define HWIF_FILT_REF_ADJ_0_SHIFT       21
+#define HWIF_FILT_REF_ADJ_0_MASK        0x0000007FU
+#define HWIF_FILT_REF_ADJ_1_REG         31
+#define HWIF_FILT_REF_ADJ_1_SHIFT       14
+#define HWIF_FILT_REF_ADJ_1_MASK        0x0000007FU
+#define HWIF_FILT_REF_ADJ_2_REG         31
+#define HWIF_FILT_REF_ADJ_2_SHIFT       7
+#define HWIF_FILT_REF_ADJ_2_MASK        0x0000007FU
+#define HWIF_FILT_REF_ADJ_3_REG         31
+#define HWIF_FILT_REF_ADJ_3_SHIFT       0
+#define HWIF_FILT_REF_ADJ_3_MASK        0x0000007FU
+#define HWIF_REFER5_NBR_REG             32
+#define HWIF_REFER5_NBR_SHIFT           16
+#define HWIF_REFER5_NBR_MASK            0x0000FFFFU
+#define HWIF_REFER4_NBR_REG             32
+#define HWIF_REFER4_NBR_SHIFT           0
+#define HWIF_REFER4_NBR_MASK            0x0000FFFFU
+#define HWIF_SCAN_MAP_56_REG            32
+#define HWIF_SCAN_MAP_56_SHIFT          24
+#define HWIF_SCAN_MAP_56_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_57_REG            32
+#define HWIF_SCAN_MAP_57_SHIFT          18
+#define HWIF_SCAN_MAP_57_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_58_REG            32
+#define HWIF_SCAN_MAP_58_SHIFT          12
+#define HWIF_SCAN_MAP_58_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_59_REG            32
+#define HWIF_SCAN_MAP_59_SHIFT          6
+#define HWIF_SCAN_MAP_59_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_60_REG            32
+#define HWIF_SCAN_MAP_60_SHIFT          0
+#define HWIF_SCAN_MAP_60_MASK           0x0000003FU
+#define HWIF_REF_INVD_COL_1_REG         32
+#define HWIF_REF_INVD_COL_1_SHIFT       16
+#define HWIF_REF_INVD_COL_1_MASK        0x0000FFFFU
+#define HWIF_REF_INVD_COL_0_REG         32
+#define HWIF_REF_INVD_COL_0_SHIFT       0
+#define HWIF_REF_INVD_COL_0_MASK        0x0000FFFFU
+#define HWIF_FILT_LEVEL_0_REG           32
+#define HWIF_FILT_LEVEL_0_SHIFT         18
+#define HWIF_FILT_LEVEL_0_MASK          0x0000003FU
+#define HWIF_FILT_LEVEL_1_REG           32
+#define HWIF_FILT_LEVEL_1_SHIFT         12
+#define HWIF_FILT_LEVEL_1_MASK          0x0000003FU
+#define HWIF_FILT_LEVEL_2_REG           32
+#define HWIF_FILT_LEVEL_2_SHIFT         6
+#define HWIF_FILT_LEVEL_2_MASK          0x0000003FU
+#define HWIF_FILT_LEVEL_3_REG           32
+#define HWIF_FILT_LEVEL_3_SHIFT         0
+#define HWIF_FILT_LEVEL_3_MASK          0x0000003FU
+#define HWIF_REFER7_NBR_REG             33
+#define HWIF_REFER7_NBR_SHIFT           16
+#define HWIF_REFER7_NBR_MASK            0x0000FFFFU
+#define HWIF_REFER6_NBR_REG             33
+#define HWIF_REFER6_NBR_SHIFT           0
+#define HWIF_REFER6_NBR_MASK            0x0000FFFFU
+#define HWIF_SCAN_MAP_61_REG            33
+#define HWIF_SCAN_MAP_61_SHIFT          24
+#define HWIF_SCAN_MAP_61_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_62_REG            33
+#define HWIF_SCAN_MAP_62_SHIFT          18
+#define HWIF_SCAN_MAP_62_MASK           0x0000003FU
+#define HWIF_SCAN_MAP_63_REG            33
+#define HWIF_SCAN_MAP_63_SHIFT          12
+#define HWIF_SCAN_MAP_63_MASK           0x0000003FU
+#define HWIF_REF_INVD_COL_3_REG         33
+#define HWIF_REF_INVD_COL_3_SHIFT       16
+#define HWIF_REF_INVD_COL_3_MASK        0x0000FFFFU
+#define HWIF_REF_INVD_COL_2_REG         33
+#define HWIF_REF_INVD_COL_2_SHIFT       0
+#define HWIF_REF_INVD_COL_2_MASK        0x0000FFFFU
+#define HWIF_QUANT_DELTA_0_REG          33
+#define HWIF_QUANT_DELTA_0_SHIFT        27
+#define HWIF_QUANT_DELTA_0_MASK         0x0000001FU
+#define HWIF_QUANT_DELTA_1_REG          33
+#define HWIF_QUANT_DELTA_1_SHIFT        22
+#define HWIF_QUANT_DELTA_1_MASK         0x0000001FU
+#define HWIF_QUANT_0_REG                33
+#define HWIF_QUANT_0_SHIFT              11
+#define HWIF_QUANT_0_MASK               0x000007FFU
+#define HWIF_QUANT_1_REG                33
+#define HWIF_QUANT_1_SHIFT              0
+#define HWIF_QUANT_1_MASK               0x000007FFU
+#define HWIF_REFER9_NBR_REG             34
+#define HWIF_REFER9_NBR_SHIFT           16
+#define HWIF_REFER9_NBR_MASK            0x0000FFFFU
+#define HWIF_REFER8_NBR_REG             34
+#define HWIF_REFER8_NBR_SHIFT           0
+#define HWIF_REFER8_NBR_MASK            0x0000FFFFU
+#define HWIF_PRED_BC_TAP_0_3_REG        34
+#define HWIF_PRED_BC_TAP_0_3_SHIFT      22
+#define HWIF_PRED_BC_TAP_0_3_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_1_0_REG        34
+#define HWIF_PRED_BC_TAP_1_0_SHIFT      12
+#define HWIF_PRED_BC_TAP_1_0_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_1_1_REG        34
+#define HWIF_PRED_BC_TAP_1_1_SHIFT      2
+#define HWIF_PRED_BC_TAP_1_1_MASK       0x000003FFU
+#define HWIF_REFER11_NBR_REG            35
+#define HWIF_REFER11_NBR_SHIFT          16
+#define HWIF_REFER11_NBR_MASK           0x0000FFFFU
+#define HWIF_REFER10_NBR_REG            35
+#define HWIF_REFER10_NBR_SHIFT          0
+#define HWIF_REFER10_NBR_MASK           0x0000FFFFU
+#define HWIF_PRED_BC_TAP_1_2_REG        35
+#define HWIF_PRED_BC_TAP_1_2_SHIFT      22
+#define HWIF_PRED_BC_TAP_1_2_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_1_3_REG        35
+#define HWIF_PRED_BC_TAP_1_3_SHIFT      12
+#define HWIF_PRED_BC_TAP_1_3_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_2_0_REG        35
+#define HWIF_PRED_BC_TAP_2_0_SHIFT      2
+#define HWIF_PRED_BC_TAP_2_0_MASK       0x000003FFU
+#define HWIF_REFER13_NBR_REG            36
+#define HWIF_REFER13_NBR_SHIFT          16
+#define HWIF_REFER13_NBR_MASK           0x0000FFFFU
+#define HWIF_REFER12_NBR_REG            36
+#define HWIF_REFER12_NBR_SHIFT          0
+#define HWIF_REFER12_NBR_MASK           0x0000FFFFU
+#define HWIF_PRED_BC_TAP_2_1_REG        36
+#define HWIF_PRED_BC_TAP_2_1_SHIFT      22
+#define HWIF_PRED_BC_TAP_2_1_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_2_2_REG        36
+#define HWIF_PRED_BC_TAP_2_2_SHIFT      12
+#define HWIF_PRED_BC_TAP_2_2_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_2_3_REG        36
+#define HWIF_PRED_BC_TAP_2_3_SHIFT      2
+#define HWIF_PRED_BC_TAP_2_3_MASK       0x000003FFU
+#define HWIF_REFER15_NBR_REG            37
+#define HWIF_REFER15_NBR_SHIFT          16
+#define HWIF_REFER15_NBR_MASK           0x0000FFFFU
+#define HWIF_REFER14_NBR_REG            37
+#define HWIF_REFER14_NBR_SHIFT          0
+#define HWIF_REFER14_NBR_MASK           0x0000FFFFU
+#define HWIF_PRED_BC_TAP_3_0_REG        37
+#define HWIF_PRED_BC_TAP_3_0_SHIFT      22
+#define HWIF_PRED_BC_TAP_3_0_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_3_1_REG        37
+#define HWIF_PRED_BC_TAP_3_1_SHIFT      12
+#define HWIF_PRED_BC_TAP_3_1_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_3_2_REG        37
+#define HWIF_PRED_BC_TAP_3_2_SHIFT      2
+#define HWIF_PRED_BC_TAP_3_2_MASK       0x000003FFU
+#define HWIF_REFER_LTERM_E_REG          38
+#define HWIF_REFER_LTERM_E_SHIFT        0
+#define HWIF_REFER_LTERM_E_MASK         0xFFFFFFFFU
+#define HWIF_PRED_BC_TAP_3_3_REG        38
+#define HWIF_PRED_BC_TAP_3_3_SHIFT      22
+#define HWIF_PRED_BC_TAP_3_3_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_4_0_REG        38
+#define HWIF_PRED_BC_TAP_4_0_SHIFT      12
+#define HWIF_PRED_BC_TAP_4_0_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_4_1_REG        38
+#define HWIF_PRED_BC_TAP_4_1_SHIFT      2
+#define HWIF_PRED_BC_TAP_4_1_MASK       0x000003FFU
+#define HWIF_REFER_VALID_E_REG          39
+#define HWIF_REFER_VALID_E_SHIFT        0
+#define HWIF_REFER_VALID_E_MASK         0xFFFFFFFFU
+#define HWIF_PRED_BC_TAP_4_2_REG        39
+#define HWIF_PRED_BC_TAP_4_2_SHIFT      22
+#define HWIF_PRED_BC_TAP_4_2_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_4_3_REG        39
+#define HWIF_PRED_BC_TAP_4_3_SHIFT      12
+#define HWIF_PRED_BC_TAP_4_3_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_5_0_REG        39
+#define HWIF_PRED_BC_TAP_5_0_SHIFT      2
+#define HWIF_PRED_BC_TAP_5_0_MASK       0x000003FFU
+#define HWIF_QTABLE_BASE_REG            40
+#define HWIF_QTABLE_BASE_SHIFT          0
+#define HWIF_QTABLE_BASE_MASK           0xFFFFFFFFU
+#define HWIF_DIR_MV_BASE_REG            41
+#define HWIF_DIR_MV_BASE_SHIFT          0
+#define HWIF_DIR_MV_BASE_MASK           0xFFFFFFFFU
+#define HWIF_BINIT_RLIST_B2_REG         42
+#define HWIF_BINIT_RLIST_B2_SHIFT       25
+#define HWIF_BINIT_RLIST_B2_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_F2_REG         42
+#define HWIF_BINIT_RLIST_F2_SHIFT       20
+#define HWIF_BINIT_RLIST_F2_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_B1_REG         42
+#define HWIF_BINIT_RLIST_B1_SHIFT       15
+#define HWIF_BINIT_RLIST_B1_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_F1_REG         42
+#define HWIF_BINIT_RLIST_F1_SHIFT       10
+#define HWIF_BINIT_RLIST_F1_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_B0_REG         42
+#define HWIF_BINIT_RLIST_B0_SHIFT       5
+#define HWIF_BINIT_RLIST_B0_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_F0_REG         42
+#define HWIF_BINIT_RLIST_F0_SHIFT       0
+#define HWIF_BINIT_RLIST_F0_MASK        0x0000001FU
+#define HWIF_PRED_BC_TAP_5_1_REG        42
+#define HWIF_PRED_BC_TAP_5_1_SHIFT      22
+#define HWIF_PRED_BC_TAP_5_1_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_5_2_REG        42
+#define HWIF_PRED_BC_TAP_5_2_SHIFT      12
+#define HWIF_PRED_BC_TAP_5_2_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_5_3_REG        42
+#define HWIF_PRED_BC_TAP_5_3_SHIFT      2
+#define HWIF_PRED_BC_TAP_5_3_MASK       0x000003FFU
+#define HWIF_PJPEG_DCCB_BASE_REG        42
+#define HWIF_PJPEG_DCCB_BASE_SHIFT      0
+#define HWIF_PJPEG_DCCB_BASE_MASK       0xFFFFFFFFU
+#define HWIF_BINIT_RLIST_B5_REG         43
+#define HWIF_BINIT_RLIST_B5_SHIFT       25
+#define HWIF_BINIT_RLIST_B5_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_F5_REG         43
+#define HWIF_BINIT_RLIST_F5_SHIFT       20
+#define HWIF_BINIT_RLIST_F5_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_B4_REG         43
+#define HWIF_BINIT_RLIST_B4_SHIFT       15
+#define HWIF_BINIT_RLIST_B4_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_F4_REG         43
+#define HWIF_BINIT_RLIST_F4_SHIFT       10
+#define HWIF_BINIT_RLIST_F4_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_B3_REG         43
+#define HWIF_BINIT_RLIST_B3_SHIFT       5
+#define HWIF_BINIT_RLIST_B3_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_F3_REG         43
+#define HWIF_BINIT_RLIST_F3_SHIFT       0
+#define HWIF_BINIT_RLIST_F3_MASK        0x0000001FU
+#define HWIF_PRED_BC_TAP_6_0_REG        43
+#define HWIF_PRED_BC_TAP_6_0_SHIFT      22
+#define HWIF_PRED_BC_TAP_6_0_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_6_1_REG        43
+#define HWIF_PRED_BC_TAP_6_1_SHIFT      12
+#define HWIF_PRED_BC_TAP_6_1_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_6_2_REG        43
+#define HWIF_PRED_BC_TAP_6_2_SHIFT      2
+#define HWIF_PRED_BC_TAP_6_2_MASK       0x000003FFU
+#define HWIF_PJPEG_DCCR_BASE_REG        43
+#define HWIF_PJPEG_DCCR_BASE_SHIFT      0
+#define HWIF_PJPEG_DCCR_BASE_MASK       0xFFFFFFFFU
+#define HWIF_BINIT_RLIST_B8_REG         44
+#define HWIF_BINIT_RLIST_B8_SHIFT       25
+#define HWIF_BINIT_RLIST_B8_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_F8_REG         44
+#define HWIF_BINIT_RLIST_F8_SHIFT       20
+#define HWIF_BINIT_RLIST_F8_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_B7_REG         44
+#define HWIF_BINIT_RLIST_B7_SHIFT       15
+#define HWIF_BINIT_RLIST_B7_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_F7_REG         44
+#define HWIF_BINIT_RLIST_F7_SHIFT       10
+#define HWIF_BINIT_RLIST_F7_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_B6_REG         44
+#define HWIF_BINIT_RLIST_B6_SHIFT       5
+#define HWIF_BINIT_RLIST_B6_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_F6_REG         44
+#define HWIF_BINIT_RLIST_F6_SHIFT       0
+#define HWIF_BINIT_RLIST_F6_MASK        0x0000001FU
+#define HWIF_PRED_BC_TAP_6_3_REG        44
+#define HWIF_PRED_BC_TAP_6_3_SHIFT      22
+#define HWIF_PRED_BC_TAP_6_3_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_7_0_REG        44
+#define HWIF_PRED_BC_TAP_7_0_SHIFT      12
+#define HWIF_PRED_BC_TAP_7_0_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_7_1_REG        44
+#define HWIF_PRED_BC_TAP_7_1_SHIFT      2
+#define HWIF_PRED_BC_TAP_7_1_MASK       0x000003FFU
+#define HWIF_BINIT_RLIST_B11_REG        45
+#define HWIF_BINIT_RLIST_B11_SHIFT      25
+#define HWIF_BINIT_RLIST_B11_MASK       0x0000001FU
+#define HWIF_BINIT_RLIST_F11_REG        45
+#define HWIF_BINIT_RLIST_F11_SHIFT      20
+#define HWIF_BINIT_RLIST_F11_MASK       0x0000001FU
+#define HWIF_BINIT_RLIST_B10_REG        45
+#define HWIF_BINIT_RLIST_B10_SHIFT      15
+#define HWIF_BINIT_RLIST_B10_MASK       0x0000001FU
+#define HWIF_BINIT_RLIST_F10_REG        45
+#define HWIF_BINIT_RLIST_F10_SHIFT      10
+#define HWIF_BINIT_RLIST_F10_MASK       0x0000001FU
+#define HWIF_BINIT_RLIST_B9_REG         45
+#define HWIF_BINIT_RLIST_B9_SHIFT       5
+#define HWIF_BINIT_RLIST_B9_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_F9_REG         45
+#define HWIF_BINIT_RLIST_F9_SHIFT       0
+#define HWIF_BINIT_RLIST_F9_MASK        0x0000001FU
+#define HWIF_PRED_BC_TAP_7_2_REG        45
+#define HWIF_PRED_BC_TAP_7_2_SHIFT      22
+#define HWIF_PRED_BC_TAP_7_2_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_7_3_REG        45
+#define HWIF_PRED_BC_TAP_7_3_SHIFT      12
+#define HWIF_PRED_BC_TAP_7_3_MASK       0x000003FFU
+#define HWIF_PRED_TAP_2_M1_REG          45
+#define HWIF_PRED_TAP_2_M1_SHIFT        10
+#define HWIF_PRED_TAP_2_M1_MASK         0x00000003U
+#define HWIF_PRED_TAP_2_4_REG           45
+#define HWIF_PRED_TAP_2_4_SHIFT         8
+#define HWIF_PRED_TAP_2_4_MASK          0x00000003U
+#define HWIF_PRED_TAP_4_M1_REG          45
+#define HWIF_PRED_TAP_4_M1_SHIFT        6
+#define HWIF_PRED_TAP_4_M1_MASK         0x00000003U
+#define HWIF_PRED_TAP_4_4_REG           45
+#define HWIF_PRED_TAP_4_4_SHIFT         4
+#define HWIF_PRED_TAP_4_4_MASK          0x00000003U
+#define HWIF_PRED_TAP_6_M1_REG          45
+#define HWIF_PRED_TAP_6_M1_SHIFT        2
+#define HWIF_PRED_TAP_6_M1_MASK         0x00000003U
+#define HWIF_PRED_TAP_6_4_REG           45
+#define HWIF_PRED_TAP_6_4_SHIFT         0
+#define HWIF_PRED_TAP_6_4_MASK          0x00000003U
+#define HWIF_BINIT_RLIST_B14_REG        46
+#define HWIF_BINIT_RLIST_B14_SHIFT      25
+#define HWIF_BINIT_RLIST_B14_MASK       0x0000001FU
+#define HWIF_BINIT_RLIST_F14_REG        46
+#define HWIF_BINIT_RLIST_F14_SHIFT      20
+#define HWIF_BINIT_RLIST_F14_MASK       0x0000001FU
+#define HWIF_BINIT_RLIST_B13_REG        46
+#define HWIF_BINIT_RLIST_B13_SHIFT      15
+#define HWIF_BINIT_RLIST_B13_MASK       0x0000001FU
+#define HWIF_BINIT_RLIST_F13_REG        46
+#define HWIF_BINIT_RLIST_F13_SHIFT      10
+#define HWIF_BINIT_RLIST_F13_MASK       0x0000001FU
+#define HWIF_BINIT_RLIST_B12_REG        46
+#define HWIF_BINIT_RLIST_B12_SHIFT      5
+#define HWIF_BINIT_RLIST_B12_MASK       0x0000001FU
+#define HWIF_BINIT_RLIST_F12_REG        46
+#define HWIF_BINIT_RLIST_F12_SHIFT      0
+#define HWIF_BINIT_RLIST_F12_MASK       0x0000001FU
+#define HWIF_QUANT_DELTA_2_REG          46
+#define HWIF_QUANT_DELTA_2_SHIFT        27
+#define HWIF_QUANT_DELTA_2_MASK         0x0000001FU
+#define HWIF_QUANT_DELTA_3_REG          46
+#define HWIF_QUANT_DELTA_3_SHIFT        22
+#define HWIF_QUANT_DELTA_3_MASK         0x0000001FU
+#define HWIF_QUANT_2_REG                46
+#define HWIF_QUANT_2_SHIFT              11
+#define HWIF_QUANT_2_MASK               0x000007FFU
+#define HWIF_QUANT_3_REG                46
+#define HWIF_QUANT_3_SHIFT              0
+#define HWIF_QUANT_3_MASK               0x000007FFU
+#define HWIF_PINIT_RLIST_F3_REG         47
+#define HWIF_PINIT_RLIST_F3_SHIFT       25
+#define HWIF_PINIT_RLIST_F3_MASK        0x0000001FU
+#define HWIF_PINIT_RLIST_F2_REG         47
+#define HWIF_PINIT_RLIST_F2_SHIFT       20
+#define HWIF_PINIT_RLIST_F2_MASK        0x0000001FU
+#define HWIF_PINIT_RLIST_F1_REG         47
+#define HWIF_PINIT_RLIST_F1_SHIFT       15
+#define HWIF_PINIT_RLIST_F1_MASK        0x0000001FU
+#define HWIF_PINIT_RLIST_F0_REG         47
+#define HWIF_PINIT_RLIST_F0_SHIFT       10
+#define HWIF_PINIT_RLIST_F0_MASK        0x0000001FU
+#define HWIF_BINIT_RLIST_B15_REG        47
+#define HWIF_BINIT_RLIST_B15_SHIFT      5
+#define HWIF_BINIT_RLIST_B15_MASK       0x0000001FU
+#define HWIF_BINIT_RLIST_F15_REG        47
+#define HWIF_BINIT_RLIST_F15_SHIFT      0
+#define HWIF_BINIT_RLIST_F15_MASK       0x0000001FU
+#define HWIF_QUANT_DELTA_4_REG          47
+#define HWIF_QUANT_DELTA_4_SHIFT        27
+#define HWIF_QUANT_DELTA_4_MASK         0x0000001FU
+#define HWIF_QUANT_4_REG                47
+#define HWIF_QUANT_4_SHIFT              11
+#define HWIF_QUANT_4_MASK               0x000007FFU
+#define HWIF_QUANT_5_REG                47
+#define HWIF_QUANT_5_SHIFT              0
+#define HWIF_QUANT_5_MASK               0x000007FFU
+#define HWIF_STARTMB_X_REG              48
+#define HWIF_STARTMB_X_SHIFT            23
+#define HWIF_STARTMB_X_MASK             0x000001FFU
+#define HWIF_STARTMB_Y_REG              48
+#define HWIF_STARTMB_Y_SHIFT            14
+#define HWIF_STARTMB_Y_MASK             0x000001FFU
+#define HWIF_ERROR_CONC_MODE_REG        48
+#define HWIF_ERROR_CONC_MODE_SHIFT      12
+#define HWIF_ERROR_CONC_MODE_MASK       0x00000003U
+#define HWIF_PRED_BC_TAP_0_0_REG        49
+#define HWIF_PRED_BC_TAP_0_0_SHIFT      22
+#define HWIF_PRED_BC_TAP_0_0_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_0_1_REG        49
+#define HWIF_PRED_BC_TAP_0_1_SHIFT      12
+#define HWIF_PRED_BC_TAP_0_1_MASK       0x000003FFU
+#define HWIF_PRED_BC_TAP_0_2_REG        49
+#define HWIF_PRED_BC_TAP_0_2_SHIFT      2
+#define HWIF_PRED_BC_TAP_0_2_MASK       0x000003FFU
+#define HWIF_REFBU_E_REG                51
+#define HWIF_REFBU_E_SHIFT              31
+#define HWIF_REFBU_E_MASK               0x00000001U
+#define HWIF_REFBU_THR_REG              51
+#define HWIF_REFBU_THR_SHIFT            19
+#define HWIF_REFBU_THR_MASK             0x00000FFFU
+#define HWIF_REFBU_PICID_REG            51
+#define HWIF_REFBU_PICID_SHIFT          14
+#define HWIF_REFBU_PICID_MASK           0x0000001FU
+#define HWIF_REFBU_EVAL_E_REG           51
+#define HWIF_REFBU_EVAL_E_SHIFT         13
+#define HWIF_REFBU_EVAL_E_MASK          0x00000001U
+#define HWIF_REFBU_FPARMOD_E_REG        51
+#define HWIF_REFBU_FPARMOD_E_SHIFT      12
+#define HWIF_REFBU_FPARMOD_E_MASK       0x00000001U
+#define HWIF_REFBU_Y_OFFSET_REG         51
+#define HWIF_REFBU_Y_OFFSET_SHIFT       0
+#define HWIF_REFBU_Y_OFFSET_MASK        0x000001FFU
+#define HWIF_REFBU_HIT_SUM_REG          52
+#define HWIF_REFBU_HIT_SUM_SHIFT        16
+#define HWIF_REFBU_HIT_SUM_MASK         0x0000FFFFU
+#define HWIF_REFBU_INTRA_SUM_REG        52
+#define HWIF_REFBU_INTRA_SUM_SHIFT      0
+#define HWIF_REFBU_INTRA_SUM_MASK       0x0000FFFFU
+#define HWIF_REFBU_Y_MV_SUM_REG         53
+#define HWIF_REFBU_Y_MV_SUM_SHIFT       0
+#define HWIF_REFBU_Y_MV_SUM_MASK        0x003FFFFFU
+#define HWIF_REFBU2_BUF_E_REG           55
+#define HWIF_REFBU2_BUF_E_SHIFT         31
+#define HWIF_REFBU2_BUF_E_MASK          0x00000001U
+#define HWIF_REFBU2_THR_REG             55
+#define HWIF_REFBU2_THR_SHIFT           19
+#define HWIF_REFBU2_THR_MASK            0x00000FFFU
+#define HWIF_REFBU2_PICID_REG           55
+#define HWIF_REFBU2_PICID_SHIFT         14
+#define HWIF_REFBU2_PICID_MASK          0x0000001FU
+#define HWIF_APF_THRESHOLD_REG          55
+#define HWIF_APF_THRESHOLD_SHIFT        0
+#define HWIF_APF_THRESHOLD_MASK         0x00003FFFU
+#define HWIF_REFBU_TOP_SUM_REG          56
+#define HWIF_REFBU_TOP_SUM_SHIFT        16
+#define HWIF_REFBU_TOP_SUM_MASK         0x0000FFFFU
+#define HWIF_REFBU_BOT_SUM_REG          56
+#define HWIF_REFBU_BOT_SUM_SHIFT        0
+#define HWIF_REFBU_BOT_SUM_MASK         0x0000FFFFU
+#define HWIF_DEC_CH8PIX_BASE_REG        59
+#define HWIF_DEC_CH8PIX_BASE_SHIFT      0
+#define HWIF_DEC_CH8PIX_BASE_MASK       0xFFFFFFFFU
+#define HWIF_PP_BUS_INT_REG             60
+#define HWIF_PP_BUS_INT_SHIFT           13
+#define HWIF_PP_BUS_INT_MASK            0x00000001U
+#define HWIF_PP_RDY_INT_REG             60
+#define HWIF_PP_RDY_INT_SHIFT           12
+#define HWIF_PP_RDY_INT_MASK            0x00000001U
+#define HWIF_PP_IRQ_REG                 60
+#define HWIF_PP_IRQ_SHIFT               8
+#define HWIF_PP_IRQ_MASK                0x00000001U
+#define HWIF_PP_IRQ_DIS_REG             60
+#define HWIF_PP_IRQ_DIS_SHIFT           4
+#define HWIF_PP_IRQ_DIS_MASK            0x00000001U
+#define HWIF_PP_PIPELINE_E_REG          60
+#define HWIF_PP_PIPELINE_E_SHIFT        1
+#define HWIF_PP_PIPELINE_E_MASK         0x00000001U
+#define HWIF_PP_E_REG                   60
+#define HWIF_PP_E_SHIFT                 0
+#define HWIF_PP_E_MASK                  0x00000001U
+#define HWIF_PP_AXI_RD_ID_REG           61
+#define HWIF_PP_AXI_RD_ID_SHIFT         24
+#define HWIF_PP_AXI_RD_ID_MASK          0x000000FFU
+#define HWIF_PP_AXI_WR_ID_REG           61
+#define HWIF_PP_AXI_WR_ID_SHIFT         16
+#define HWIF_PP_AXI_WR_ID_MASK          0x000000FFU
+#define HWIF_PP_AHB_HLOCK_E_REG         61
+#define HWIF_PP_AHB_HLOCK_E_SHIFT       15
+#define HWIF_PP_AHB_HLOCK_E_MASK        0x00000001U
+#define HWIF_PP_SCMD_DIS_REG            61
+#define HWIF_PP_SCMD_DIS_SHIFT          14
+#define HWIF_PP_SCMD_DIS_MASK           0x00000001U
+#define HWIF_PP_IN_A2_ENDSEL_REG        61
+#define HWIF_PP_IN_A2_ENDSEL_SHIFT      13
+#define HWIF_PP_IN_A2_ENDSEL_MASK       0x00000001U
+#define HWIF_PP_IN_A1_SWAP32_REG        61
+#define HWIF_PP_IN_A1_SWAP32_SHIFT      12
+#define HWIF_PP_IN_A1_SWAP32_MASK       0x00000001U
+#define HWIF_PP_IN_A1_ENDIAN_REG        61
+#define HWIF_PP_IN_A1_ENDIAN_SHIFT      11
+#define HWIF_PP_IN_A1_ENDIAN_MASK       0x00000001U
+#define HWIF_PP_IN_SWAP32_E_REG         61
+#define HWIF_PP_IN_SWAP32_E_SHIFT       10
+#define HWIF_PP_IN_SWAP32_E_MASK        0x00000001U
+#define HWIF_PP_DATA_DISC_E_REG         61
+#define HWIF_PP_DATA_DISC_E_SHIFT       9
+#define HWIF_PP_DATA_DISC_E_MASK        0x00000001U
+#define HWIF_PP_CLK_GATE_E_REG          61
+#define HWIF_PP_CLK_GATE_E_SHIFT        8
+#define HWIF_PP_CLK_GATE_E_MASK         0x00000001U
+#define HWIF_PP_IN_ENDIAN_REG           61
+#define HWIF_PP_IN_ENDIAN_SHIFT         7
+#define HWIF_PP_IN_ENDIAN_MASK          0x00000001U
+#define HWIF_PP_OUT_ENDIAN_REG          61
+#define HWIF_PP_OUT_ENDIAN_SHIFT        6
+#define HWIF_PP_OUT_ENDIAN_MASK         0x00000001U
+#define HWIF_PP_OUT_SWAP32_E_REG        61
+#define HWIF_PP_OUT_SWAP32_E_SHIFT      5
+#define HWIF_PP_OUT_SWAP32_E_MASK       0x00000001U
+#define HWIF_PP_MAX_BURST_REG           61
+#define HWIF_PP_MAX_BURST_SHIFT         0
+#define HWIF_PP_MAX_BURST_MASK          0x0000001FU
+#define HWIF_DEINT_E_REG                62
+#define HWIF_DEINT_E_SHIFT              31
+#define HWIF_DEINT_E_MASK               0x00000001U
+#define HWIF_DEINT_THRESHOLD_REG        62
+#define HWIF_DEINT_THRESHOLD_SHIFT      16
+#define HWIF_DEINT_THRESHOLD_MASK       0x00003FFFU
+#define HWIF_DEINT_BLEND_E_REG          62
+#define HWIF_DEINT_BLEND_E_SHIFT        15
+#define HWIF_DEINT_BLEND_E_MASK         0x00000001U
+#define HWIF_DEINT_EDGE_DET_REG         62
+#define HWIF_DEINT_EDGE_DET_SHIFT       0
+#define HWIF_DEINT_EDGE_DET_MASK        0x00007FFFU
+#define HWIF_PP_IN_LU_BASE_REG          63
+#define HWIF_PP_IN_LU_BASE_SHIFT        0
+#define HWIF_PP_IN_LU_BASE_MASK         0xFFFFFFFFU
+#define HWIF_PP_IN_CB_BASE_REG          64
+#define HWIF_PP_IN_CB_BASE_SHIFT        0
+#define HWIF_PP_IN_CB_BASE_MASK         0xFFFFFFFFU
+#define HWIF_PP_IN_CR_BASE_REG          65
+#define HWIF_PP_IN_CR_BASE_SHIFT        0
+#define HWIF_PP_IN_CR_BASE_MASK         0xFFFFFFFFU
+#define HWIF_PP_OUT_LU_BASE_REG         66
+#define HWIF_PP_OUT_LU_BASE_SHIFT       0
+#define HWIF_PP_OUT_LU_BASE_MASK        0xFFFFFFFFU
+#define HWIF_PP_OUT_CH_BASE_REG         67
+#define HWIF_PP_OUT_CH_BASE_SHIFT       0
+#define HWIF_PP_OUT_CH_BASE_MASK        0xFFFFFFFFU
+#define HWIF_CONTRAST_THR1_REG          68
+#define HWIF_CONTRAST_THR1_SHIFT        24
+#define HWIF_CONTRAST_THR1_MASK         0x000000FFU
+#define HWIF_CONTRAST_OFF2_REG          68
+#define HWIF_CONTRAST_OFF2_SHIFT        10
+#define HWIF_CONTRAST_OFF2_MASK         0x000003FFU
+#define HWIF_CONTRAST_OFF1_REG          68
+#define HWIF_CONTRAST_OFF1_SHIFT        0
+#define HWIF_CONTRAST_OFF1_MASK         0x000003FFU
+#define HWIF_PP_IN_START_CH_REG         69
+#define HWIF_PP_IN_START_CH_SHIFT       31
+#define HWIF_PP_IN_START_CH_MASK        0x00000001U
+#define HWIF_PP_IN_CR_FIRST_REG         69
+#define HWIF_PP_IN_CR_FIRST_SHIFT       30
+#define HWIF_PP_IN_CR_FIRST_MASK        0x00000001U
+#define HWIF_PP_OUT_START_CH_REG        69
+#define HWIF_PP_OUT_START_CH_SHIFT      29
+#define HWIF_PP_OUT_START_CH_MASK       0x00000001U
+#define HWIF_PP_OUT_CR_FIRST_REG        69
+#define HWIF_PP_OUT_CR_FIRST_SHIFT      28
+#define HWIF_PP_OUT_CR_FIRST_MASK       0x00000001U
+#define HWIF_COLOR_COEFFA2_REG          69
+#define HWIF_COLOR_COEFFA2_SHIFT        18
+#define HWIF_COLOR_COEFFA2_MASK         0x000003FFU
+#define HWIF_COLOR_COEFFA1_REG          69
+#define HWIF_COLOR_COEFFA1_SHIFT        8
+#define HWIF_COLOR_COEFFA1_MASK         0x000003FFU
+#define HWIF_CONTRAST_THR2_REG          69
+#define HWIF_CONTRAST_THR2_SHIFT        0
+#define HWIF_CONTRAST_THR2_MASK         0x000000FFU
+#define HWIF_PP_OUT_H_EXT_REG           70
+#define HWIF_PP_OUT_H_EXT_SHIFT         30
+#define HWIF_PP_OUT_H_EXT_MASK          0x00000003U
+#define HWIF_COLOR_COEFFD_REG           70
+#define HWIF_COLOR_COEFFD_SHIFT         20
+#define HWIF_COLOR_COEFFD_MASK          0x000003FFU
+#define HWIF_COLOR_COEFFC_REG           70
+#define HWIF_COLOR_COEFFC_SHIFT         10
+#define HWIF_COLOR_COEFFC_MASK          0x000003FFU
+#define HWIF_COLOR_COEFFB_REG           70
+#define HWIF_COLOR_COEFFB_SHIFT         0
+#define HWIF_COLOR_COEFFB_MASK          0x000003FFU
+#define HWIF_PP_OUT_W_EXT_REG           71
+#define HWIF_PP_OUT_W_EXT_SHIFT         30
+#define HWIF_PP_OUT_W_EXT_MASK          0x00000003U
+#define HWIF_CROP_STARTX_REG            71
+#define HWIF_CROP_STARTX_SHIFT          21
+#define HWIF_CROP_STARTX_MASK           0x000001FFU
+#define HWIF_ROTATION_MODE_REG          71
+#define HWIF_ROTATION_MODE_SHIFT        18
+#define HWIF_ROTATION_MODE_MASK         0x00000007U
+#define HWIF_COLOR_COEFFF_REG           71
+#define HWIF_COLOR_COEFFF_SHIFT         10
+#define HWIF_COLOR_COEFFF_MASK          0x000000FFU
+#define HWIF_COLOR_COEFFE_REG           71
+#define HWIF_COLOR_COEFFE_SHIFT         0
+#define HWIF_COLOR_COEFFE_MASK          0x000003FFU
+#define HWIF_CROP_STARTY_REG            72
+#define HWIF_CROP_STARTY_SHIFT          24
+#define HWIF_CROP_STARTY_MASK           0x000000FFU
+#define HWIF_RANGEMAP_COEF_Y_REG        72
+#define HWIF_RANGEMAP_COEF_Y_SHIFT      18
+#define HWIF_RANGEMAP_COEF_Y_MASK       0x0000001FU
+#define HWIF_PP_IN_HEIGHT_REG           72
+#define HWIF_PP_IN_HEIGHT_SHIFT         9
+#define HWIF_PP_IN_HEIGHT_MASK          0x000000FFU
+#define HWIF_PP_IN_WIDTH_REG            72
+#define HWIF_PP_IN_WIDTH_SHIFT          0
+#define HWIF_PP_IN_WIDTH_MASK           0x000001FFU
+#define HWIF_PP_BOT_YIN_BASE_REG        73
+#define HWIF_PP_BOT_YIN_BASE_SHIFT      0
+#define HWIF_PP_BOT_YIN_BASE_MASK       0xFFFFFFFFU
+#define HWIF_PP_BOT_CIN_BASE_REG        74
+#define HWIF_PP_BOT_CIN_BASE_SHIFT      0
+#define HWIF_PP_BOT_CIN_BASE_MASK       0xFFFFFFFFU
+#define HWIF_RANGEMAP_Y_E_REG           79
+#define HWIF_RANGEMAP_Y_E_SHIFT         31
+#define HWIF_RANGEMAP_Y_E_MASK          0x00000001U
+#define HWIF_RANGEMAP_C_E_REG           79
+#define HWIF_RANGEMAP_C_E_SHIFT         30
+#define HWIF_RANGEMAP_C_E_MASK          0x00000001U
+#define HWIF_YCBCR_RANGE_REG            79
+#define HWIF_YCBCR_RANGE_SHIFT          29
+#define HWIF_YCBCR_RANGE_MASK           0x00000001U
+#define HWIF_RGB_PIX_IN32_REG           79
+#define HWIF_RGB_PIX_IN32_SHIFT         28
+#define HWIF_RGB_PIX_IN32_MASK          0x00000001U
+#define HWIF_RGB_R_PADD_REG             79
+#define HWIF_RGB_R_PADD_SHIFT           23
+#define HWIF_RGB_R_PADD_MASK            0x0000001FU
+#define HWIF_RGB_G_PADD_REG             79
+#define HWIF_RGB_G_PADD_SHIFT           18
+#define HWIF_RGB_G_PADD_MASK            0x0000001FU
+#define HWIF_SCALE_WRATIO_REG           79
+#define HWIF_SCALE_WRATIO_SHIFT         0
+#define HWIF_SCALE_WRATIO_MASK          0x0003FFFFU
+#define HWIF_PP_FAST_SCALE_E_REG        80
+#define HWIF_PP_FAST_SCALE_E_SHIFT      30
+#define HWIF_PP_FAST_SCALE_E_MASK       0x00000001U
+#define HWIF_PP_IN_STRUCT_REG           80
+#define HWIF_PP_IN_STRUCT_SHIFT         27
+#define HWIF_PP_IN_STRUCT_MASK          0x00000007U
+#define HWIF_HOR_SCALE_MODE_REG         80
+#define HWIF_HOR_SCALE_MODE_SHIFT       25
+#define HWIF_HOR_SCALE_MODE_MASK        0x00000003U
+#define HWIF_VER_SCALE_MODE_REG         80
+#define HWIF_VER_SCALE_MODE_SHIFT       23
+#define HWIF_VER_SCALE_MODE_MASK        0x00000003U
+#define HWIF_RGB_B_PADD_REG             80
+#define HWIF_RGB_B_PADD_SHIFT           18
+#define HWIF_RGB_B_PADD_MASK            0x0000001FU
+#define HWIF_SCALE_HRATIO_REG           80
+#define HWIF_SCALE_HRATIO_SHIFT         0
+#define HWIF_SCALE_HRATIO_MASK          0x0003FFFFU
+#define HWIF_WSCALE_INVRA_REG           81
+#define HWIF_WSCALE_INVRA_SHIFT         16
+#define HWIF_WSCALE_INVRA_MASK          0x0000FFFFU
+#define HWIF_HSCALE_INVRA_REG           81
+#define HWIF_HSCALE_INVRA_SHIFT         0
+#define HWIF_HSCALE_INVRA_MASK          0x0000FFFFU
+#define HWIF_R_MASK_REG                 82
+#define HWIF_R_MASK_SHIFT               0
+#define HWIF_R_MASK_MASK                0xFFFFFFFFU
+#define HWIF_G_MASK_REG                 83
+#define HWIF_G_MASK_SHIFT               0
+#define HWIF_G_MASK_MASK                0xFFFFFFFFU
+#define HWIF_B_MASK_REG                 84
+#define HWIF_B_MASK_SHIFT               0
+#define HWIF_B_MASK_MASK                0xFFFFFFFFU
+#define HWIF_PP_IN_FORMAT_REG           85
+#define HWIF_PP_IN_FORMAT_SHIFT         29
+#define HWIF_PP_IN_FORMAT_MASK          0x00000007U
+#define HWIF_PP_OUT_FORMAT_REG          85
+#define HWIF_PP_OUT_FORMAT_SHIFT        26
+#define HWIF_PP_OUT_FORMAT_MASK         0x00000007U
+#define HWIF_PP_OUT_HEIGHT_REG          85
+#define HWIF_PP_OUT_HEIGHT_SHIFT        15
+#define HWIF_PP_OUT_HEIGHT_MASK         0x000007FFU
+#define HWIF_PP_OUT_WIDTH_REG           85
+#define HWIF_PP_OUT_WIDTH_SHIFT         4
+#define HWIF_PP_OUT_WIDTH_MASK          0x000007FFU
+#define HWIF_PP_OUT_TILED_E_REG         85
+#define HWIF_PP_OUT_TILED_E_SHIFT       3
+#define HWIF_PP_OUT_TILED_E_MASK        0x00000001U
+#define HWIF_PP_OUT_SWAP16_E_REG        85
+#define HWIF_PP_OUT_SWAP16_E_SHIFT      2
+#define HWIF_PP_OUT_SWAP16_E_MASK       0x00000001U
+#define HWIF_PP_CROP8_R_E_REG           85
+#define HWIF_PP_CROP8_R_E_SHIFT         1
+#define HWIF_PP_CROP8_R_E_MASK          0x00000001U
+#define HWIF_PP_CROP8_D_E_REG           85
+#define HWIF_PP_CROP8_D_E_SHIFT         0
+#define HWIF_PP_CROP8_D_E_MASK          0x00000001U
+#define HWIF_PP_IN_FORMAT_ES_REG        86
+#define HWIF_PP_IN_FORMAT_ES_SHIFT      29
+#define HWIF_PP_IN_FORMAT_ES_MASK       0x00000007U
+#define HWIF_RANGEMAP_COEF_C_REG        86
+#define HWIF_RANGEMAP_COEF_C_SHIFT      23
+#define HWIF_RANGEMAP_COEF_C_MASK       0x0000001FU
+#define HWIF_MASK1_ABLEND_E_REG         86
+#define HWIF_MASK1_ABLEND_E_SHIFT       22
+#define HWIF_MASK1_ABLEND_E_MASK        0x00000001U
+#define HWIF_MASK1_STARTY_REG           86
+#define HWIF_MASK1_STARTY_SHIFT         11
+#define HWIF_MASK1_STARTY_MASK          0x000007FFU
+#define HWIF_MASK1_STARTX_REG           86
+#define HWIF_MASK1_STARTX_SHIFT         0
+#define HWIF_MASK1_STARTX_MASK          0x000007FFU
+#define HWIF_MASK1_STARTX_EXT_REG       87
+#define HWIF_MASK1_STARTX_EXT_SHIFT     29
+#define HWIF_MASK1_STARTX_EXT_MASK      0x00000003U
+#define HWIF_MASK1_STARTY_EXT_REG       87
+#define HWIF_MASK1_STARTY_EXT_SHIFT     27
+#define HWIF_MASK1_STARTY_EXT_MASK      0x00000003U
+#define HWIF_MASK2_STARTX_EXT_REG       87
+#define HWIF_MASK2_STARTX_EXT_SHIFT     25
+#define HWIF_MASK2_STARTX_EXT_MASK      0x00000003U
+#define HWIF_MASK2_STARTY_EXT_REG       87
+#define HWIF_MASK2_STARTY_EXT_SHIFT     23
+#define HWIF_MASK2_STARTY_EXT_MASK      0x00000003U
+#define HWIF_MASK2_ABLEND_E_REG         87
+#define HWIF_MASK2_ABLEND_E_SHIFT       22
+#define HWIF_MASK2_ABLEND_E_MASK        0x00000001U
+#define HWIF_MASK2_STARTY_REG           87
+#define HWIF_MASK2_STARTY_SHIFT         11
+#define HWIF_MASK2_STARTY_MASK          0x000007FFU
+#define HWIF_MASK2_STARTX_REG           87
+#define HWIF_MASK2_STARTX_SHIFT         0
+#define HWIF_MASK2_STARTX_MASK          0x000007FFU
+#define HWIF_EXT_ORIG_WIDTH_REG         88
+#define HWIF_EXT_ORIG_WIDTH_SHIFT       23
+#define HWIF_EXT_ORIG_WIDTH_MASK        0x000001FFU
+#define HWIF_MASK1_E_REG                88
+#define HWIF_MASK1_E_SHIFT              22
+#define HWIF_MASK1_E_MASK               0x00000001U
+#define HWIF_MASK1_ENDY_REG             88
+#define HWIF_MASK1_ENDY_SHIFT           11
+#define HWIF_MASK1_ENDY_MASK            0x000007FFU
+#define HWIF_MASK1_ENDX_REG             88
+#define HWIF_MASK1_ENDX_SHIFT           0
+#define HWIF_MASK1_ENDX_MASK            0x000007FFU
+#define HWIF_MASK1_ENDX_EXT_REG         89
+#define HWIF_MASK1_ENDX_EXT_SHIFT       29
+#define HWIF_MASK1_ENDX_EXT_MASK        0x00000003U
+#define HWIF_MASK1_ENDY_EXT_REG         89
+#define HWIF_MASK1_ENDY_EXT_SHIFT       27
+#define HWIF_MASK1_ENDY_EXT_MASK        0x00000003U
+#define HWIF_MASK2_ENDX_EXT_REG         89
+#define HWIF_MASK2_ENDX_EXT_SHIFT       25
+#define HWIF_MASK2_ENDX_EXT_MASK        0x00000003U
+#define HWIF_MASK2_ENDY_EXT_REG         89
+#define HWIF_MASK2_ENDY_EXT_SHIFT       23
+#define HWIF_MASK2_ENDY_EXT_MASK        0x00000003U
+#define HWIF_MASK2_E_REG                89
+#define HWIF_MASK2_E_SHIFT              22
+#define HWIF_MASK2_E_MASK               0x00000001U
+#define HWIF_MASK2_ENDY_REG             89
+#define HWIF_MASK2_ENDY_SHIFT           11
+#define HWIF_MASK2_ENDY_MASK            0x000007FFU
+#define HWIF_MASK2_ENDX_REG             89
+#define HWIF_MASK2_ENDX_SHIFT           0
+#define HWIF_MASK2_ENDX_MASK            0x000007FFU
+#define HWIF_RIGHT_CROSS_E_REG          90
+#define HWIF_RIGHT_CROSS_E_SHIFT        29
+#define HWIF_RIGHT_CROSS_E_MASK         0x00000001U
+#define HWIF_LEFT_CROSS_E_REG           90
+#define HWIF_LEFT_CROSS_E_SHIFT         28
+#define HWIF_LEFT_CROSS_E_MASK          0x00000001U
+#define HWIF_UP_CROSS_E_REG             90
+#define HWIF_UP_CROSS_E_SHIFT           27
+#define HWIF_UP_CROSS_E_MASK            0x00000001U
+#define HWIF_DOWN_CROSS_E_REG           90
+#define HWIF_DOWN_CROSS_E_SHIFT         26
+#define HWIF_DOWN_CROSS_E_MASK          0x00000001U
+#define HWIF_UP_CROSS_REG               90
+#define HWIF_UP_CROSS_SHIFT             15
+#define HWIF_UP_CROSS_MASK              0x000007FFU
+#define HWIF_DOWN_CROSS_EXT_REG         90
+#define HWIF_DOWN_CROSS_EXT_SHIFT       11
+#define HWIF_DOWN_CROSS_EXT_MASK        0x00000003U
+#define HWIF_DOWN_CROSS_REG             90
+#define HWIF_DOWN_CROSS_SHIFT           0
+#define HWIF_DOWN_CROSS_MASK            0x000007FFU
+#define HWIF_DITHER_SELECT_R_REG        91
+#define HWIF_DITHER_SELECT_R_SHIFT      30
+#define HWIF_DITHER_SELECT_R_MASK       0x00000003U
+#define HWIF_DITHER_SELECT_G_REG        91
+#define HWIF_DITHER_SELECT_G_SHIFT      28
+#define HWIF_DITHER_SELECT_G_MASK       0x00000003U
+#define HWIF_DITHER_SELECT_B_REG        91
+#define HWIF_DITHER_SELECT_B_SHIFT      26
+#define HWIF_DITHER_SELECT_B_MASK       0x00000003U
+#define HWIF_PP_TILED_MODE_REG          91
+#define HWIF_PP_TILED_MODE_SHIFT        22
+#define HWIF_PP_TILED_MODE_MASK         0x00000003U
+#define HWIF_RIGHT_CROSS_REG            91
+#define HWIF_RIGHT_CROSS_SHIFT          11
+#define HWIF_RIGHT_CROSS_MASK           0x000007FFU
+#define HWIF_LEFT_CROSS_REG             91
+#define HWIF_LEFT_CROSS_SHIFT           0
+#define HWIF_LEFT_CROSS_MASK            0x000007FFU
+#define HWIF_PP_IN_H_EXT_REG            92
+#define HWIF_PP_IN_H_EXT_SHIFT          29
+#define HWIF_PP_IN_H_EXT_MASK           0x00000007U
+#define HWIF_PP_IN_W_EXT_REG            92
+#define HWIF_PP_IN_W_EXT_SHIFT          26
+#define HWIF_PP_IN_W_EXT_MASK           0x00000007U
+#define HWIF_CROP_STARTY_EXT_REG        92
+#define HWIF_CROP_STARTY_EXT_SHIFT      23
+#define HWIF_CROP_STARTY_EXT_MASK       0x00000007U
+#define HWIF_CROP_STARTX_EXT_REG        92
+#define HWIF_CROP_STARTX_EXT_SHIFT      20
+#define HWIF_CROP_STARTX_EXT_MASK       0x00000007U
+#define HWIF_RIGHT_CROSS_EXT_REG        92
+#define HWIF_RIGHT_CROSS_EXT_SHIFT      18
+#define HWIF_RIGHT_CROSS_EXT_MASK       0x00000003U
+#define HWIF_LEFT_CROSS_EXT_REG         92
+#define HWIF_LEFT_CROSS_EXT_SHIFT       16
+#define HWIF_LEFT_CROSS_EXT_MASK        0x00000003U
+#define HWIF_UP_CROSS_EXT_REG           92
+#define HWIF_UP_CROSS_EXT_SHIFT         14
+#define HWIF_UP_CROSS_EXT_MASK          0x00000003U
+#define HWIF_DISPLAY_WIDTH_REG          92
+#define HWIF_DISPLAY_WIDTH_SHIFT        0
+#define HWIF_DISPLAY_WIDTH_MASK         0x00001FFFU
+#define HWIF_ABLEND1_BASE_REG           93
+#define HWIF_ABLEND1_BASE_SHIFT         0
+#define HWIF_ABLEND1_BASE_MASK          0xFFFFFFFFU
+#define HWIF_ABLEND2_BASE_REG           94
+#define HWIF_ABLEND2_BASE_SHIFT         0
+#define HWIF_ABLEND2_BASE_MASK          0xFFFFFFFFU
+#define HWIF_ABLEND2_SCANL_REG          95
+#define HWIF_ABLEND2_SCANL_SHIFT        13
+#define HWIF_ABLEND2_SCANL_MASK         0x00001FFFU
+#define HWIF_ABLEND1_SCANL_REG          95
+#define HWIF_ABLEND1_SCANL_SHIFT        0
+#define HWIF_ABLEND1_SCANL_MASK         0x00001FFFU
@@ -0,0 +1,26 @@
+#!/bin/sh
+#
+# Generates the register field headers included by regdrv.h and regdrv.c
+# from 8170regs.txt:
+#   8170enum.h      hwIfName_e entries
+#   8170table.h     hwDecRegSpec entries { swreg, bits, position }
+#   8170fields.h    HWIF_<field>_REG, _SHIFT and _MASK constants
+#
+# Usage: ./gen8170regs.sh   (run in decoder/common)
+
+set -e
+
+SPEC=8170regs.txt
+
+awk '!/^#/ && NF == 4 { printf "\t%s,\n", $1 }' $SPEC > 8170enum.h
+
+awk '!/^#/ && NF == 4 {
+        printf "/* %-22s */ {/*swreg*/%-2d, %2d, %2d},\n", $1, $2, $3, $4
+    }' $SPEC > 8170table.h
+
+awk '!/^#/ && NF == 4 {
+        mask = $3 >= 32 ? 4294967295 : 2 ^ $3 - 1
+        printf "#define %-31s %d\n", $1 "_REG", $2
+        printf "#define %-31s %d\n", $1 "_SHIFT", $4
+        printf "#define %-31s 0x%08XU\n", $1 "_MASK", mask
+    }' $SPEC > 8170fields.h
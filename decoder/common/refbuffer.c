@@ -55,6 +55,17 @@
     ((((u32)(p[2])) << 3) | (((u32)(p[3])) >> 5) | (((u32)(p[1] & 0x3)) << 11))
 #define SIGN_EXTEND(value, bits) (value) = (((value)<<(32-bits))>>(32-bits))
 
+/* Same as DIR_MV_BE_VER/DIR_MV_LE_VER from one 32-bit read of the MV word.
+ * The MVs are in uncached HW output memory, where a single word access is
+ * much cheaper than three byte accesses. Valid on a little-endian CPU only. */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define DIR_MV_WORD_READ
+#define DIR_MV_BE_VER_WORD(w) \
+    (((w) >> 5) & 0x1FFF)
+#define DIR_MV_LE_VER_WORD(w) \
+    ((((w) >> 13) & 0x7F8) | ((w) >> 29) | (((w) & 0x300) << 3))
+#endif
+
 /* Distribution ranges and zero point */
 #define VER_DISTR_MIN           (-256)
 #define VER_DISTR_MAX           (255)
@@ -466,7 +477,7 @@ u32 GetSettings(refBuffer_t *pRefbu, i32 *pX, i32 *pY, u32 isBpic,
         }
         /* MPEG-4 B-frames have no intra coding possibility, so extrapolate
          * hit rate to match it */
-        else if (pRefbu->predIntraBlk < 4*frmSizeInMbs &&
+        else if (pRefbu->predIntraBlk < (i32)(4*frmSizeInMbs) &&
             pRefbu->decMode == DEC_X170_MODE_MPEG4)
         {
             cov *= (128*4*frmSizeInMbs) / (4*frmSizeInMbs-pRefbu->predIntraBlk) ;
@@ -547,7 +558,9 @@ void BuildDistribution(u32 *pDistrVer,
 
     u32 mb;
     i32 ver;
+#ifndef DIR_MV_WORD_READ
     u8 * pMvTmp;
+#endif
     u32 mvs;
     u32 skipMv = mvsPerMb*4;
     u32 multiplier = 4;
@@ -567,6 +580,47 @@ void BuildDistribution(u32 *pDistrVer,
         multiplier *= div;
     }
 
+#ifdef DIR_MV_WORD_READ
+    skipMv /= 4;
+    if (bigEndian)
+    {
+        for (mb = 0 ; mb < mvs ; ++mb)
+        {
+            ver         = DIR_MV_BE_VER_WORD(*pMv);
+            SIGN_EXTEND(ver, 13);
+            /* Cut fraction and saturate */
+            /*lint -save -e702 */
+            ver >>= 2;
+            /*lint -restore */
+            if (ver >= VER_DISTR_MIN && ver <= VER_DISTR_MAX)
+            {
+                pDistrVer[ver] += multiplier;
+                if (ver < *minY)    *minY = ver;
+                if (ver > *maxY)    *maxY = ver;
+            }
+            pMv += skipMv; /* Skip all other blocks for macroblock */
+        }
+    }
+    else
+    {
+        for (mb = 0 ; mb < mvs ; ++mb)
+        {
+            ver         = DIR_MV_LE_VER_WORD(*pMv);
+            SIGN_EXTEND(ver, 13);
+            /* Cut fraction and saturate */
+            /*lint -save -e702 */
+            ver >>= 2;
+            /*lint -restore */
+            if (ver >= VER_DISTR_MIN && ver <= VER_DISTR_MAX)
+            {
+                pDistrVer[ver] += multiplier;
+                if (ver < *minY)    *minY = ver;
+                if (ver > *maxY)    *maxY = ver;
+            }
+            pMv += skipMv; /* Skip all other blocks for macroblock */
+        }
+    }
+#else
     pMvTmp = (u8*)pMv;
     if (bigEndian)
     {
@@ -610,6 +664,7 @@ void BuildDistribution(u32 *pDistrVer,
             pMvTmp += skipMv; /* Skip all other blocks for macroblock */
         }
     }
+#endif /* DIR_MV_WORD_READ */
 }
 
 
@@ -682,20 +737,25 @@ void DirectMvStatistics(refBuffer_t *pRefbu, u32 *pMv, i32 numIntraBlk,
         {
             i32 y;
             i32 penalty;
+            i32 first, last;
+
+            /* Only windows overlapping [minY, maxY] and the zero point
+             * (which has the intra correction) can be non-empty. An empty
+             * window never beats best, so the others are skipped */
+            minY = MIN(minY, 0) + VER_DISTR_ZERO_POINT;
+            maxY = MAX(maxY, 0) + VER_DISTR_ZERO_POINT;
+            first = MAX(0, minY - 2*VER_MV_RANGE);
+            last = MIN(VER_DISTR_RANGE-2*VER_MV_RANGE-2, maxY - 1);
 
             /* Initial sum */
             sum = 0;
-            minY += VER_DISTR_ZERO_POINT;
-            maxY += VER_DISTR_ZERO_POINT;
-
-            for (i = 0 ; i < 2*VER_MV_RANGE ; ++i)
+            for (i = first ; i < first + 2*VER_MV_RANGE ; ++i)
             {
                 sum += distrVer[i];
             }
             best = 0;
             /* Other sums */
-            maxY -= 2*VER_MV_RANGE;
-            for (i = 0 ; i < VER_DISTR_RANGE-2*VER_MV_RANGE-1 ; ++i)
+            for (i = first ; i <= last ; ++i)
             {
                 sum -= distrVer[i];
                 sum += distrVer[2*VER_MV_RANGE+i];
@@ -31,15 +31,6 @@
     Module defines
 ------------------------------------------------------------------------------*/
 
-#ifdef _ASSERT_USED
-#ifndef ASSERT
-#include <assert.h>
-#define ASSERT(expr) assert(expr)
-#endif
-#else
-#define ASSERT(expr)
-#endif
-
 static const u32 regMask[33] = { 0x00000000,
     0x00000001, 0x00000003, 0x00000007, 0x0000000F,
     0x0000001F, 0x0000003F, 0x0000007F, 0x000000FF,
@@ -81,7 +72,7 @@ static const u32 hwDecRegSpec[HWIF_LAST_REG + 1][3] = {
         Returns: 
 
 ------------------------------------------------------------------------------*/
-void SetDecRegister(u32 * regBase, u32 id, u32 value)
+void (SetDecRegister)(u32 * regBase, u32 id, u32 value)
 {
 
     u32 tmp;
@@ -108,7 +99,7 @@ void SetDecRegister(u32 * regBase, u32 id, u32 value)
         Returns: 
 
 ------------------------------------------------------------------------------*/
-u32 GetDecRegister(const u32 * regBase, u32 id)
+u32 (GetDecRegister)(const u32 * regBase, u32 id)
 {
 
     u32 tmp;
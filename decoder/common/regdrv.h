@@ -70,6 +70,52 @@ typedef enum
 
 } hwIfName_e;
 
+/* { SWREG, BITS, POSITION } of every field as HWIF_<field>_REG, _SHIFT and
+ * _MASK constants, generated by gen8170regs.sh together with 8170table.h */
+#include "8170fields.h"
+
+#define HWIF_DEC_IRQ_STAT_REG           1
+#define HWIF_DEC_IRQ_STAT_SHIFT         12
+#define HWIF_DEC_IRQ_STAT_MASK          0x0000007FU
+#define HWIF_PP_IRQ_STAT_REG            60
+#define HWIF_PP_IRQ_STAT_SHIFT          12
+#define HWIF_PP_IRQ_STAT_MASK           0x00000003U
+
+/* aliases */
+#define HWIF_MPEG4_DC_BASE_REG          HWIF_I4X4_OR_DC_BASE_REG
+#define HWIF_MPEG4_DC_BASE_SHIFT        HWIF_I4X4_OR_DC_BASE_SHIFT
+#define HWIF_MPEG4_DC_BASE_MASK         HWIF_I4X4_OR_DC_BASE_MASK
+#define HWIF_INTRA_4X4_BASE_REG         HWIF_I4X4_OR_DC_BASE_REG
+#define HWIF_INTRA_4X4_BASE_SHIFT       HWIF_I4X4_OR_DC_BASE_SHIFT
+#define HWIF_INTRA_4X4_BASE_MASK        HWIF_I4X4_OR_DC_BASE_MASK
+#define HWIF_VP6HWGOLDEN_BASE_REG       HWIF_REFER4_BASE_REG
+#define HWIF_VP6HWGOLDEN_BASE_SHIFT     HWIF_REFER4_BASE_SHIFT
+#define HWIF_VP6HWGOLDEN_BASE_MASK      HWIF_REFER4_BASE_MASK
+#define HWIF_VP6HWPART1_BASE_REG        HWIF_REFER13_BASE_REG
+#define HWIF_VP6HWPART1_BASE_SHIFT      HWIF_REFER13_BASE_SHIFT
+#define HWIF_VP6HWPART1_BASE_MASK       HWIF_REFER13_BASE_MASK
+#define HWIF_VP6HWPART2_BASE_REG        HWIF_RLC_VLC_BASE_REG
+#define HWIF_VP6HWPART2_BASE_SHIFT      HWIF_RLC_VLC_BASE_SHIFT
+#define HWIF_VP6HWPART2_BASE_MASK       HWIF_RLC_VLC_BASE_MASK
+#define HWIF_VP6HWPROBTBL_BASE_REG      HWIF_QTABLE_BASE_REG
+#define HWIF_VP6HWPROBTBL_BASE_SHIFT    HWIF_QTABLE_BASE_SHIFT
+#define HWIF_VP6HWPROBTBL_BASE_MASK     HWIF_QTABLE_BASE_MASK
+#define HWIF_PJPEG_COEFF_BUF_REG        HWIF_DIR_MV_BASE_REG
+#define HWIF_PJPEG_COEFF_BUF_SHIFT      HWIF_DIR_MV_BASE_SHIFT
+#define HWIF_PJPEG_COEFF_BUF_MASK       HWIF_DIR_MV_BASE_MASK
+#define HWIF_INTER_VIEW_BASE_REG        HWIF_REFER15_BASE_REG
+#define HWIF_INTER_VIEW_BASE_SHIFT      HWIF_REFER15_BASE_SHIFT
+#define HWIF_INTER_VIEW_BASE_MASK       HWIF_REFER15_BASE_MASK
+
+#ifdef _ASSERT_USED
+#ifndef ASSERT
+#include <assert.h>
+#define ASSERT(expr) assert(expr)
+#endif
+#else
+#define ASSERT(expr)
+#endif
+
 /*------------------------------------------------------------------------------
     Data types
 ------------------------------------------------------------------------------*/
@@ -81,4 +127,48 @@ typedef enum
 void SetDecRegister(u32 * regBase, u32 id, u32 value);
 u32 GetDecRegister(const u32 * regBase, u32 id);
 
+/* Set/GetDecRegister take a HWIF_ constant and access the field inline
+ * through its generated constants, a read-modify-write with immediate
+ * operands. Ids computed at run time call the functions in regdrv.c as
+ * (SetDecRegister)(...) and (GetDecRegister)(...). */
+#ifdef __GNUC__
+static __inline__ void SetDecRegisterBits(u32 * regBase, u32 id, u32 reg,
+                                          u32 shift, u32 mask, u32 value)
+{
+    ASSERT(id < HWIF_LAST_REG);
+    (void)id;
+
+    regBase[reg] = (regBase[reg] & ~(mask << shift)) |
+        ((value & mask) << shift);
+}
+
+static __inline__ u32 GetDecRegisterBits(const u32 * regBase, u32 id,
+                                         u32 reg, u32 shift, u32 mask)
+{
+    ASSERT(id < HWIF_LAST_REG);
+    (void)id;
+
+    return (regBase[reg] >> shift) & mask;
+}
+
+#define SetDecRegisterField(regBase, id, value) \
+    SetDecRegisterBits((regBase), (id), id##_REG, id##_SHIFT, id##_MASK, \
+                       (value))
+
+#define GetDecRegisterField(regBase, id) \
+    GetDecRegisterBits((regBase), (id), id##_REG, id##_SHIFT, id##_MASK)
+#else
+#define SetDecRegisterField(regBase, id, value) \
+    (SetDecRegister)((regBase), (id), (value))
+
+#define GetDecRegisterField(regBase, id) \
+    (GetDecRegister)((regBase), (id))
+#endif /* __GNUC__ */
+
+#define SetDecRegister(regBase, id, value) \
+    SetDecRegisterField(regBase, id, value)
+
+#define GetDecRegister(regBase, id) \
+    GetDecRegisterField(regBase, id)
+
 #endif /* #ifndef REGDRV_H */
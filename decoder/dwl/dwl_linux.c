@@ -48,6 +48,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #define DWL_MPEG2_E         31  /* 1 bit */
 #define DWL_VC1_E           29  /* 2 bits */
@@ -120,6 +121,40 @@ static void DWLFakeTimeout(u32 * status);
 pthread_t main_thread;
 #endif
 
+/* DWLWaitHwReady time of each thread, the thread waiting is the one that
+ * called the decoder */
+static pthread_once_t waitStatsOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t waitStatsKey;
+
+static void DWLWaitStatsKeyCreate(void)
+{
+    (void) pthread_key_create(&waitStatsKey, free);
+}
+
+static DWLWaitStats_t *DWLThreadWaitStats(void)
+{
+    DWLWaitStats_t *stats;
+
+    (void) pthread_once(&waitStatsOnce, DWLWaitStatsKeyCreate);
+
+    stats = (DWLWaitStats_t *) pthread_getspecific(waitStatsKey);
+    if (stats == NULL)
+    {
+        stats = (DWLWaitStats_t *) calloc(1, sizeof(DWLWaitStats_t));
+        if (stats != NULL)
+            (void) pthread_setspecific(waitStatsKey, stats);
+    }
+    return stats;
+}
+
+static u32 DWLTimeUs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u32) now.tv_sec * 1000000 + (u32) now.tv_nsec / 1000;
+}
+
 
 
 /*------------------------------------------------------------------------------
@@ -1174,6 +1209,8 @@ void DWLDisableHW(const void *instance, u32 offset, u32 value)
 i32 DWLWaitHwReady(const void *instance, u32 timeout)
 {
     const hX170dwl_t *dec_dwl = (hX170dwl_t *) instance;
+    DWLWaitStats_t *stats;
+    u32 start = DWLTimeUs();
 
     i32 ret;
 
@@ -1206,9 +1243,38 @@ i32 DWLWaitHwReady(const void *instance, u32 timeout)
         }
     }
 
+    stats = DWLThreadWaitStats();
+    if (stats != NULL)
+    {
+        stats->waits++;
+        stats->waitUs += DWLTimeUs() - start;
+    }
+
     return ret;
 }
 
+/*------------------------------------------------------------------------------
+    Function name   : DWLGetWaitStats
+    Description     : Time the calling thread has spent in DWLWaitHwReady,
+                      over all DWL instances, since the thread started.
+                      Callers take the difference over the span they measure
+
+    Return type     : void
+
+    Argument        : DWLWaitStats_t * stats
+------------------------------------------------------------------------------*/
+void DWLGetWaitStats(DWLWaitStats_t * stats)
+{
+    const DWLWaitStats_t *own = DWLThreadWaitStats();
+
+    assert(stats);
+
+    if (own != NULL)
+        *stats = *own;
+    else
+        (void) memset(stats, 0, sizeof(DWLWaitStats_t));
+}
+
 /*------------------------------------------------------------------------------
     Function name   : DWLmalloc
     Description     : Allocate a memory block. Same functionality as
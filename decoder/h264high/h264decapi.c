@@ -308,6 +308,8 @@ H264DecRet H264DecInit(H264DecInst * pDecInst, u32 noOutputReordering,
     pDecCont->storage.intraFreeze = useVideoFreezeConcealment;
 #endif
     pDecCont->storage.pictureBroken = HANTRO_FALSE;
+    /* intra only: slices before the first picture start are skipped */
+    pDecCont->nonIntraPic = HANTRO_TRUE;
 
     pDecCont->maxDecPicWidth = hwCfg.maxDecPicWidth;    /* max decodable picture width */
 
@@ -354,6 +356,7 @@ H264DecRet H264DecGetInfo(H264DecInst decInst, H264DecInfo * pDecInfo)
     u32 croppingFlag;
     decContainer_t *pDecCont = (decContainer_t *) decInst;
     storage_t *pStorage;
+    u32 i;
 
     DEC_API_TRC("H264DecGetInfo#");
 
@@ -393,6 +396,19 @@ H264DecRet H264DecGetInfo(H264DecInst decInst, H264DecInfo * pDecInfo)
     if (pStorage->mvc)
         pDecInfo->multiBuffPpSize *= 2;
 
+    /* picture buffers are allocated when first needed, see
+     * h264bsdAllocateDpbImage */
+    pDecInfo->picBuffAllocated = 0;
+    pDecInfo->picBuffBytesSaved = 0;
+    for (i = 0; i < MAX_NUM_VIEWS; i++)
+    {
+        const dpbStorage_t *dpb = pStorage->dpbs[i];
+
+        pDecInfo->picBuffAllocated += dpb->numAllocated;
+        pDecInfo->picBuffBytesSaved +=
+            (dpb->totBuffers - dpb->numAllocated) * dpb->picBuffSize;
+    }
+
     h264GetSarInfo(pStorage, &pDecInfo->sarWidth, &pDecInfo->sarHeight);
 
     h264bsdCroppingParams(pStorage,
@@ -591,6 +607,8 @@ H264DecRet H264DecDecode(H264DecInst decInst, const H264DecInput * pInput,
     tmpStream = pInput->pStream;
 
     pDecCont->skipNonReference = pInput->skipNonReference;
+    if (pInput->skipNonIntra)
+        pDecCont->skipNonIntra = HANTRO_TRUE;
 
     pDecCont->forceNalMode = 0;
 
@@ -1491,6 +1509,23 @@ H264DecRet H264DecDecode(H264DecInst decInst, const H264DecInput * pInput,
                 DEC_API_TRC("H264DecDecode# H264DEC_PIC_DECODED, UNPAIRED_FIELD\n");
                 returnValue = H264DEC_PIC_DECODED;
 
+                strmLen = 0;
+                break;
+            }
+        case H264BSD_MEMALLOC_ERROR:
+            {
+                /* DPB picture buffer could not be allocated, nothing was
+                 * decoded into the picture */
+                h264CheckReleasePpAndHw(pDecCont);
+
+                pDecCont->hwLength -= numReadBytes;
+                pDecCont->hwStreamStartBus = pInput->streamBusAddress +
+                    (u32) (tmpStream - pInput->pStream);
+                pDecCont->pHwStreamStart = tmpStream;
+
+                DEC_API_TRC("H264DecDecode# H264DEC_MEMFAIL, DPB picture buffer\n");
+                returnValue = H264DEC_MEMFAIL;
+
                 strmLen = 0;
                 break;
             }
@@ -2565,6 +2600,9 @@ static void bsdDecodeReturn(u32 retval)
     case H264BSD_FMO:
         DEBUG_PRINT("H264BSD_FMO\n");
         break;
+    case H264BSD_MEMALLOC_ERROR:
+        DEBUG_PRINT("H264BSD_MEMALLOC_ERROR\n");
+        break;
     default:
         DEBUG_PRINT("UNKNOWN\n");
         break;
@@ -2835,3 +2873,53 @@ H264DecRet H264DecSetMvc(H264DecInst decInst)
     return (H264DEC_OK);
 }
 
+/*------------------------------------------------------------------------------
+
+    Function: H264DecSetLowLatency()
+
+        Functional description:
+            This function configures decoder to output pictures in decoding
+            order as soon as they are decoded, without DPB output reordering,
+            unless the active SPS signals reordering (VUI bitstream
+            restriction with num_reorder_frames greater than 0). Streams
+            without that VUI information are assumed not to reorder; if such
+            a stream has B pictures they are output in decoding order. Must be
+            called before the first H264DecDecode.
+
+        Inputs:
+            decInst     decoder instance
+
+        Outputs:
+
+        Returns:
+            H264DEC_OK            success
+            H264DEC_PARAM_ERROR   invalid parameters
+            H264DEC_NOT_INITIALIZED   decoder instance not initialized yet
+
+------------------------------------------------------------------------------*/
+H264DecRet H264DecSetLowLatency(H264DecInst decInst)
+{
+    decContainer_t *pDecCont = (decContainer_t *) decInst;
+
+    DEC_API_TRC("H264DecSetLowLatency#");
+
+    if (decInst == NULL)
+    {
+        DEC_API_TRC("H264DecSetLowLatency# ERROR: decInst is NULL\n");
+        return (H264DEC_PARAM_ERROR);
+    }
+
+    /* Check for valid decoder instance */
+    if (pDecCont->checksum != pDecCont)
+    {
+        DEC_API_TRC("H264DecSetLowLatency# ERROR: Decoder not initialized\n");
+        return (H264DEC_NOT_INITIALIZED);
+    }
+
+    pDecCont->storage.lowLatency = HANTRO_TRUE;
+
+    DEC_API_TRC("H264DecSetLowLatency# OK\n");
+
+    return (H264DEC_OK);
+}
+
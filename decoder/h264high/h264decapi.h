@@ -82,6 +82,10 @@ extern "C"
         u32 picId;           /* Identifier for the picture to be decoded */
         u32 skipNonReference; /* Flag to enable decoder skip non-reference 
                                * frames to reduce processor load */
+        u32 skipNonIntra;    /* Flag to decode IDR pictures and pictures of
+                               * I slices only, e.g. for fast forward. An I
+                               * picture drops older references as an IDR
+                               * picture would */
     } H264DecInput;
 
     /* Output structure */
@@ -135,6 +139,8 @@ extern "C"
         u32 dpbMode;         /* DPB mode; frame, or field interlaced */       
         u32 picBuffSize;     /* number of picture buffers allocated&used by decoder */
         u32 multiBuffPpSize; /* number of picture buffers needed in decoder+postprocessor multibuffer mode */
+        u32 picBuffAllocated;   /* DPB picture buffers given memory so far */
+        u32 picBuffBytesSaved;  /* bytes of the DPB picture buffers not allocated */
     } H264DecInfo;
 
     /* Version information */
@@ -166,6 +172,8 @@ extern "C"
 
     H264DecRet H264DecSetMvc(H264DecInst pDecInst);
 
+    H264DecRet H264DecSetLowLatency(H264DecInst pDecInst);
+
     void H264DecRelease(H264DecInst decInst);
 
     H264DecRet H264DecDecode(H264DecInst decInst,
@@ -264,7 +264,7 @@ u32 H264RunAsic(decContainer_t * pDecCont, DecAsicBuffers_t * pAsicBuff)
 
         for (i = 0; i < 16; i++)
         {
-            SetDecRegister(pDecCont->h264Regs, refBase[i],
+            (SetDecRegister)(pDecCont->h264Regs, refBase[i],
                            pAsicBuff->refPicList[i]);
         }
         /* inter-view reference picture */
@@ -1309,7 +1309,7 @@ void H264SetupVlcRegs(decContainer_t * pDecCont)
 
         if (pDpb->buffer[n].status[0] == 3 || pDpb->buffer[n].status[1] == 3)
         {
-            SetDecRegister(pDecCont->h264Regs, refPicNum[i],
+            (SetDecRegister)(pDecCont->h264Regs, refPicNum[i],
                            pDpb->buffer[n].picNum);
         }
         else
@@ -1321,10 +1321,10 @@ void H264SetupVlcRegs(decContainer_t * pDecCont)
             {
                 i32 tmp = pDpb->buffer[n].frameNum - pDecCont->frameNumMask;
                 if (tmp < 0) tmp += pSps->maxFrameNum;
-                SetDecRegister(pDecCont->h264Regs, refPicNum[i], tmp);
+                (SetDecRegister)(pDecCont->h264Regs, refPicNum[i], tmp);
             }
             else
-                SetDecRegister(pDecCont->h264Regs, refPicNum[i],
+                (SetDecRegister)(pDecCont->h264Regs, refPicNum[i],
                                pDpb->buffer[n].frameNum);
 
         }
@@ -1529,8 +1529,8 @@ void H264InitRefPicList(decContainer_t * pDecCont)
             H264InitRefPicList1F(pDecCont, list0, list1);
             for (i = 0; i < 16; i++)
             {
-                SetDecRegister(pDecCont->h264Regs, refPicList0[i], list0[i]);
-                SetDecRegister(pDecCont->h264Regs, refPicList1[i], list1[i]);
+                (SetDecRegister)(pDecCont->h264Regs, refPicList0[i], list0[i]);
+                (SetDecRegister)(pDecCont->h264Regs, refPicList1[i], list1[i]);
             }
         }
         else
@@ -1548,8 +1548,8 @@ void H264InitRefPicList(decContainer_t * pDecCont)
             H264InitRefPicList1(pDecCont, list0, list1);
             for (i = 0; i < 16; i++)
             {
-                SetDecRegister(pDecCont->h264Regs, refPicList0[i], list0[i]);
-                SetDecRegister(pDecCont->h264Regs, refPicList1[i], list1[i]);
+                (SetDecRegister)(pDecCont->h264Regs, refPicList0[i], list0[i]);
+                (SetDecRegister)(pDecCont->h264Regs, refPicList1[i], list1[i]);
             }
         }
     }
@@ -1568,7 +1568,7 @@ void H264InitRefPicList(decContainer_t * pDecCont)
             }
             for (i = 0; i < 16; i++)
             {
-                SetDecRegister(pDecCont->h264Regs, refPicListP[i], listP[i]);
+                (SetDecRegister)(pDecCont->h264Regs, refPicListP[i], listP[i]);
 
                 /* copy to dpb for error handling purposes */
                 dpb[0].list[i] = listP[i];
@@ -1588,7 +1588,7 @@ void H264InitRefPicList(decContainer_t * pDecCont)
         for (i = 0; i < 16; i++)
         {
             if (!pDecCont->rlcMode)
-                SetDecRegister(pDecCont->h264Regs, refPicListP[i], listP[i]);
+                (SetDecRegister)(pDecCont->h264Regs, refPicListP[i], listP[i]);
             /* copy to dpb for error handling purposes */
             dpb[0].list[i] = listP[i];
             dpb[1].list[i] = listP[i];
@@ -105,6 +105,10 @@ typedef struct decContainer
 
     u32 keepHwReserved;
     u32 skipNonReference;
+    u32 skipNonIntra; /* set by skipNonIntra of the input, cleared by the
+                       * next IDR or I picture */
+    u32 intraRestart; /* current slice starts decoding again at an I picture */
+    u32 nonIntraPic;  /* first slice of the current picture was not I */
 
     workaround_t workarounds;
     u32 frameNumMask; /* for workaround */
@@ -120,6 +120,8 @@ void h264bsdInit(storage_t * pStorage, u32 noOutputReordering,
             H264BSD_ERROR           error in decoding
             H264BSD_PARAM_SET_ERROR serius error in decoding, failed to
                                     activate param sets
+            H264BSD_MEMALLOC_ERROR  no memory for the picture buffer of the
+                                    current picture
 
 ------------------------------------------------------------------------------*/
 u32 h264bsdDecode(decContainer_t * pDecCont, const u8 * byteStrm, u32 len,
@@ -219,6 +221,37 @@ u32 h264bsdDecode(decContainer_t * pDecCont, const u8 * byteStrm, u32 len,
         goto NEXT_NAL;
     }
 
+    /* intra only: IDR pictures and pictures of I slices are decoded, the
+     * references of the other pictures are not there. An I picture starts
+     * decoding again as an IDR picture would, see h264bsdRestartDpb. After
+     * intra only decoding the skipping goes on until the next I picture.
+     * The first slice of a picture decides for all of its slices. */
+    pDecCont->intraRestart = HANTRO_FALSE;
+    if (pDecCont->skipNonIntra &&
+        (nalUnit.nalUnitType == NAL_CODED_SLICE ||
+         nalUnit.nalUnitType == NAL_CODED_SLICE_EXT) &&
+        !IS_IDR_NAL_UNIT(&nalUnit))
+    {
+        u32 firstMb, sliceType;
+
+        if (h264bsdCheckSliceType(&strm, &firstMb, &sliceType) != HANTRO_OK)
+            pDecCont->nonIntraPic = HANTRO_TRUE;
+        else if (firstMb == 0)
+        {
+            pDecCont->nonIntraPic = !IS_I_SLICE(sliceType);
+            pDecCont->intraRestart = !pDecCont->nonIntraPic;
+        }
+
+        if (pDecCont->nonIntraPic)
+        {
+            DEBUG_PRINT("DISCARDED NAL (NON-INTRA PICTURE)\n");
+            ret = H264BSD_NONREF_PIC_SKIPPED;
+            goto NEXT_NAL;
+        }
+    }
+    if (IS_IDR_NAL_UNIT(&nalUnit))
+        pDecCont->skipNonIntra = HANTRO_FALSE;
+
     if (!pStorage->checkedAub)
     {
         pStorage->aub->prevModFrameNum =
@@ -263,6 +296,8 @@ u32 h264bsdDecode(decContainer_t * pDecCont, const u8 * byteStrm, u32 len,
                     DEBUG_PRINT("!validSliceunit\n");
                     pStorage->currImage->data =
                         h264bsdAllocateDpbImage(pStorage->dpb);
+                    if (pStorage->currImage->data == NULL)
+                        return (H264BSD_MEMALLOC_ERROR);
                     h264bsdInitRefPicList(pStorage->dpb);
 
                     h264bsdConceal(pStorage, pAsicBuff, P_SLICE);
@@ -295,6 +330,8 @@ u32 h264bsdDecode(decContainer_t * pDecCont, const u8 * byteStrm, u32 len,
                     {
                         pStorage->currImage->data =
                             h264bsdAllocateDpbImage(pStorage->dpb);
+                        if (pStorage->currImage->data == NULL)
+                            return (H264BSD_MEMALLOC_ERROR);
                         pStorage->sliceHeader->fieldPicFlag = 0;
                     }
                     else if (pStorage->view)
@@ -304,6 +341,8 @@ u32 h264bsdDecode(decContainer_t * pDecCont, const u8 * byteStrm, u32 len,
                         {
                             pStorage->currImage->data =
                                 h264bsdAllocateDpbImage(pStorage->dpb);
+                            if (pStorage->currImage->data == NULL)
+                                return (H264BSD_MEMALLOC_ERROR);
                         }
                         else
                         {
@@ -437,6 +476,8 @@ u32 h264bsdDecode(decContainer_t * pDecCont, const u8 * byteStrm, u32 len,
                 {
                     pStorage->currImage->data =
                         h264bsdAllocateDpbImage(pStorage->dpb);
+                    if (pStorage->currImage->data == NULL)
+                        return (H264BSD_MEMALLOC_ERROR);
                 }
                 else
                 {
@@ -590,6 +631,8 @@ u32 h264bsdDecode(decContainer_t * pDecCont, const u8 * byteStrm, u32 len,
                     {
                         pStorage->currImage->data =
                             h264bsdAllocateDpbImage(pStorage->dpb);
+                        if (pStorage->currImage->data == NULL)
+                            return (H264BSD_MEMALLOC_ERROR);
                     }
                     else
                     {
@@ -639,6 +682,16 @@ u32 h264bsdDecode(decContainer_t * pDecCont, const u8 * byteStrm, u32 len,
                         return (H264BSD_UNPAIRED_FIELD);
                     }
 
+                    if (pDecCont->intraRestart)
+                    {
+                        DEBUG_PRINT("Intra only: restart at I picture\n");
+                        h264bsdRestartDpb(pStorage->dpb,
+                                          pStorage->sliceHeader[1].frameNum);
+                        pDecCont->skipNonIntra = HANTRO_FALSE;
+                        /* nothing refers to a broken picture any more */
+                        pStorage->pictureBroken = HANTRO_FALSE;
+                    }
+
                     if (!IS_IDR_NAL_UNIT(&nalUnit) &&
                        !pDecCont->modeChange && !pDecCont->gapsCheckedForThis)
                     {
@@ -666,6 +719,8 @@ u32 h264bsdDecode(decContainer_t * pDecCont, const u8 * byteStrm, u32 len,
 
                     pStorage->currImage->data =
                         h264bsdAllocateDpbImage(pStorage->dpb);
+                    if (pStorage->currImage->data == NULL)
+                        return (H264BSD_MEMALLOC_ERROR);
 
 #ifdef SET_EMPTY_PICTURE_DATA   /* USE THIS ONLY FOR DEBUGGING PURPOSES */
                     {
@@ -43,7 +43,8 @@ enum
     H264BSD_NEW_ACCESS_UNIT,
     H264BSD_FMO,
     H264BSD_UNPAIRED_FIELD,
-    H264BSD_NONREF_PIC_SKIPPED
+    H264BSD_NONREF_PIC_SKIPPED,
+    H264BSD_MEMALLOC_ERROR
 };
 
 /*------------------------------------------------------------------------------
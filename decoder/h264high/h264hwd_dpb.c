@@ -207,6 +207,9 @@ static /*@null@ */ dpbPicture_t *FindSmallestPicOrderCnt(dpbStorage_t * dpb);
 
 static u32 OutputPicture(dpbStorage_t * dpb);
 
+static u32 AllocPicBuffer(dpbStorage_t * dpb, u32 i);
+static u32 AllocRefPicBuffers(dpbStorage_t * dpb);
+
 /*------------------------------------------------------------------------------
 
     Function: ComparePictures
@@ -1380,7 +1383,8 @@ u8 *h264bsdGetRefPicDataVlcMode(const dpbStorage_t * dpb, u32 index,
             positions for decoding of current picture
 
         Returns:
-            pointer to memory area for the image
+            pointer to memory area for the image, NULL if the memory of a
+            picture buffer used for the first time could not be allocated
 
 ------------------------------------------------------------------------------*/
 
@@ -1389,7 +1393,7 @@ void *h264bsdAllocateDpbImage(dpbStorage_t * dpb)
 
 /* Variables */
 
-    u32 i;
+    u32 i, unallocated;
 
 /* Code */
 
@@ -1399,12 +1403,21 @@ void *h264bsdAllocateDpbImage(dpbStorage_t * dpb)
      * ASSERT(dpb->fullness <= dpb->dpbSize);
      */
 
-    /* find first unused and not-to-be-displayed pic */
+    /* find first unused and not-to-be-displayed pic, one that already has
+     * memory is preferred so that the DPB only grows when it has to */
+    unallocated = dpb->dpbSize + 1;
     for (i = 0; i <= dpb->dpbSize; i++)
     {
         if (!dpb->buffer[i].toBeDisplayed && !IS_REFERENCE_F(dpb->buffer[i]))
-            break;
+        {
+            if (dpb->buffer[i].data->virtualAddress != NULL)
+                break;
+            if (unallocated > dpb->dpbSize)
+                unallocated = i;
+        }
     }
+    if (i > dpb->dpbSize)
+        i = unallocated;
 
     ASSERT(i <= dpb->dpbSize);
     dpb->currentOut = &dpb->buffer[i];
@@ -1447,6 +1460,20 @@ void *h264bsdAllocateDpbImage(dpbStorage_t * dpb)
 
     ASSERT(dpb->currentOut->data);
 
+    /* first use of this picture buffer */
+    if (dpb->currentOut->data->virtualAddress == NULL)
+    {
+        i = (u32) (dpb->currentOut->data - dpb->picBuffers);
+        if (AllocPicBuffer(dpb, i) != HANTRO_OK)
+        {
+            /* the slot stays free, nothing may be decoded into it. The
+             * hardware address still points to the first buffer, enough for
+             * the non-existing frames of a frame num gap */
+            DEBUG_PRINT("DPB: picture buffer %d allocation failed\n", i);
+            return NULL;
+        }
+    }
+
 #if 0
     if (DISPLAY_SMOOTHING && dpb->prevOutIdx != INVALID_MEM_IDX)
     {
@@ -1516,6 +1543,78 @@ static u32 SlidingWindowRefPicMarking(dpbStorage_t * dpb, u32 picStruct)
 
 }
 
+/*------------------------------------------------------------------------------
+
+    Function: AllocPicBuffer
+
+        Functional description:
+            Reserve memory for picture buffer i of the DPB. Size and layout
+            were set up by h264bsdInitDpb. Buffer without memory keeps the
+            bus address of the first buffer.
+
+        Returns:
+            HANTRO_OK       success
+            MEMORY_ALLOCATION_ERROR if memory allocation failed
+
+------------------------------------------------------------------------------*/
+
+u32 AllocPicBuffer(dpbStorage_t * dpb, u32 i)
+{
+
+    ASSERT(i < dpb->totBuffers);
+    ASSERT(dpb->picBuffers[i].virtualAddress == NULL);
+
+    if (DWLMallocRefFrm(dpb->dwl, dpb->picBuffSize, dpb->picBuffers + i) != 0)
+    {
+        dpb->picBuffers[i].virtualAddress = NULL;
+        dpb->picBuffers[i].busAddress = dpb->picBuffers[0].busAddress;
+        return (MEMORY_ALLOCATION_ERROR);
+    }
+
+    if (dpb->dirMvOffset)
+    {
+        void * base = (char *) (dpb->picBuffers[i].virtualAddress) +
+                  dpb->dirMvOffset;
+        (void)DWLmemset(base, 0, dpb->picSizeInMbs * 64);
+    }
+
+    dpb->numAllocated++;
+
+    return (HANTRO_OK);
+
+}
+
+/*------------------------------------------------------------------------------
+
+    Function: AllocRefPicBuffers
+
+        Functional description:
+            Reserve memory for the first maxRefFrames + 1 picture buffers,
+            as h264bsdInitDpb does. Used when the DPB is kept for a new
+            sequence with more reference frames.
+
+        Returns:
+            HANTRO_OK       success
+            MEMORY_ALLOCATION_ERROR if memory allocation failed
+
+------------------------------------------------------------------------------*/
+
+u32 AllocRefPicBuffers(dpbStorage_t * dpb)
+{
+
+    u32 i;
+
+    for (i = 0; i < MIN(dpb->totBuffers, dpb->maxRefFrames + 1); i++)
+    {
+        if (dpb->picBuffers[i].virtualAddress == NULL &&
+            AllocPicBuffer(dpb, i) != HANTRO_OK)
+            return (MEMORY_ALLOCATION_ERROR);
+    }
+
+    return (HANTRO_OK);
+
+}
+
 /*------------------------------------------------------------------------------
 
     Function: h264bsdInitDpb
@@ -1559,6 +1658,7 @@ u32 h264bsdInitDpb(const void *dwl,
 /* Variables */
 
     u32 i;
+    u32 initBuffers;
 
 /* Code */
 
@@ -1598,30 +1698,47 @@ u32 h264bsdInitDpb(const void *dwl,
         dpb->totBuffers++;
 //	ALOGD("%s: dpb->totBuffers = %d dpb->dpbSize = %d dpbSize = %d maxRefFrames = %d maxFrameNum = %d noReordering = %d displaySmoothing = %d isHighSupported = %d",
 //		__func__, dpb->totBuffers, dpb->dpbSize, dpbSize, maxRefFrames, maxFrameNum, noReordering, displaySmoothing, isHighSupported);
-    for (i = 0; i < dpb->totBuffers; i++)
+
+    if (isHighSupported)
+    {
+        /* yuv picture + direct mode motion vectors */
+        dpb->picBuffSize = picSizeInMbs * ((monoChrome ? 256 : 384) + 64);
+        dpb->dirMvOffset = picSizeInMbs * (monoChrome ? 256 : 384);
+    }
+    else
     {
-        u32 pic_buff_size;
+        dpb->picBuffSize = picSizeInMbs * 384;
+    }
+
+    if (enable2ndChroma && !monoChrome)
+    {
+        dpb->ch2Offset = dpb->picBuffSize;
+        dpb->picBuffSize += picSizeInMbs * 128;
+    }
+    DEBUG_PRINT("%s: pic_buff_size = %d picSizeInMbs = %d\n", __func__,
+                dpb->picBuffSize, picSizeInMbs);
 
-        if (isHighSupported)
+    /* level limits give the DPB size, most streams use far less of it: only
+     * the reference frames and the current picture get memory now, the rest
+     * when h264bsdAllocateDpbImage first needs them */
+    dpb->dwl = dwl;
+    initBuffers = MIN(dpb->totBuffers, dpb->maxRefFrames + 1);
+
+    for (i = 0; i < dpb->totBuffers; i++)
+    {
+        if (i < initBuffers)
         {
-            /* yuv picture + direct mode motion vectors */
-            pic_buff_size = picSizeInMbs * ((monoChrome ? 256 : 384) + 64);
-            dpb->dirMvOffset = picSizeInMbs * (monoChrome ? 256 : 384);
+            if (AllocPicBuffer(dpb, i) != HANTRO_OK)
+                return (MEMORY_ALLOCATION_ERROR);
         }
         else
         {
-            pic_buff_size = picSizeInMbs * 384;
+            /* no memory yet, hardware reference address points to valid
+             * memory anyway */
+            dpb->picBuffers[i].virtualAddress = NULL;
+            dpb->picBuffers[i].busAddress = dpb->picBuffers[0].busAddress;
         }
 
-        if (enable2ndChroma && !monoChrome)
-        {
-            dpb->ch2Offset = pic_buff_size;
-            pic_buff_size += picSizeInMbs * 128;
-        }
-	ALOGD("%s: pic_buff_size = %d picSizeInMbs = %d", __func__, pic_buff_size, picSizeInMbs);
-        if (DWLMallocRefFrm(dwl, pic_buff_size, dpb->picBuffers + i) != 0)
-            return (MEMORY_ALLOCATION_ERROR);
-
         if (i < dpb->dpbSize + 1)
         {
             dpb->buffer[i].data = dpb->picBuffers + i;
@@ -1632,13 +1749,6 @@ u32 h264bsdInitDpb(const void *dwl,
         {
             dpb->freeBuffers[dpb->numFreeBuffers++] = i;
         }
-
-        if (isHighSupported)
-        {
-            void * base = (char *) (dpb->picBuffers[i].virtualAddress) +
-                      dpb->dirMvOffset;
-            (void)DWLmemset(base, 0, picSizeInMbs * 64);
-        }
     }
 
     dpb->outBuf = DWLmalloc((dpb->dpbSize + 1) * sizeof(dpbOutPicture_t));
@@ -1701,8 +1811,9 @@ u32 h264bsdResetDpb(const void *dwl,
         if (dpb->dpbSize == new_dpbSize)
         {
             /* number of pictures and DPB size are not changing */
-            /* no need to reallocate DPB */
-            return (HANTRO_OK);
+            /* no need to reallocate DPB, but more reference frames need
+             * more picture buffers with memory */
+            return AllocRefPicBuffers(dpb);
         }
     }
 
@@ -2218,6 +2329,39 @@ void h264bsdFlushDpb(dpbStorage_t * dpb)
 
 }
 
+/*------------------------------------------------------------------------------
+
+    Function: h264bsdRestartDpb
+
+        Functional description:
+            Function to start decoding again at a non-IDR I picture, e.g.
+            after only intra pictures have been decoded. As for an IDR
+            picture, all reference pictures are marked unused for reference
+            and the pictures needed for display are put into the output
+            buffer. frame_num goes on from the I picture, so no non-existing
+            frames are generated for the pictures skipped before it.
+
+        Inputs:
+            dpb         pointer to dpb data structure
+            frameNum    frame number of the I picture
+
+------------------------------------------------------------------------------*/
+void h264bsdRestartDpb(dpbStorage_t * dpb, u32 frameNum)
+{
+
+    ASSERT(frameNum < dpb->maxFrameNum);
+
+    if (dpb->delayedOut != 0)
+    {
+        dpb->delayedOut = 0;
+        dpb->currentOut->toBeDisplayed = 0; /* remove it from output list */
+    }
+
+    (void) Mmcop5(dpb, FRAME);
+    dpb->prevRefFrameNum = (frameNum + dpb->maxFrameNum - 1) % dpb->maxFrameNum;
+
+}
+
 /*------------------------------------------------------------------------------
 
     Function: h264bsdFreeDpb
@@ -2238,6 +2382,11 @@ void h264bsdFreeDpb(const void *dwl, dpbStorage_t * dpb)
 
     ASSERT(dpb);
 
+    if (dpb->totBuffers)
+        DEBUG_PRINT("%s: %d of %d picture buffers allocated, %d bytes saved\n",
+                    __func__, dpb->numAllocated, dpb->totBuffers,
+                    (dpb->totBuffers - dpb->numAllocated) * dpb->picBuffSize);
+
     for (i = 0; i < dpb->totBuffers; i++)
     {
         if (dpb->picBuffers[i].virtualAddress != NULL)
@@ -116,6 +116,12 @@ typedef struct dpbStorage
     u32 totBuffers;
     DWLLinearMem_t picBuffers[16+1+16+1];
 
+    /* picture buffers beyond the reference frames are allocated when first
+     * needed, unallocated ones have NULL virtualAddress */
+    const void *dwl;
+    u32 picBuffSize;
+    u32 numAllocated;
+
     /* flag to prevent output when display smoothing is used and second field
      * of a picture was just decoded */
     u32 noOutput;
@@ -169,6 +175,8 @@ u32 h264bsdCheckGapsInFrameNum(dpbStorage_t * dpb, u32 frameNum, u32 isRefPic,
 
 void h264bsdFlushDpb(dpbStorage_t * dpb);
 
+void h264bsdRestartDpb(dpbStorage_t * dpb, u32 frameNum);
+
 void h264bsdFreeDpb(const void *dwl, dpbStorage_t * dpb);
 
 void ShellSort(dpbStorage_t * dpb, u32 *list, u32 type, i32 par);
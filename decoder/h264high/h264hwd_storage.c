@@ -1001,13 +1001,20 @@ u32 h264bsdAllocateSwResources(const void *dwl, storage_t * pStorage,
     /* dpb output reordering disabled if
      * 1) application set noReordering flag
      * 2) POC type equal to 2
-     * 3) num_reorder_frames in vui equal to 0 */
+     * 3) num_reorder_frames in vui equal to 0
+     * 4) application set lowLatency flag and vui does not give
+     *    num_reorder_frames. A stream that signals reordering is still
+     *    output in display order. */
     if (pStorage->noReordering ||
        pSps->picOrderCntType == 2 ||
        (pSps->vuiParametersPresentFlag &&
         pSps->vuiParameters->bitstreamRestrictionFlag &&
         !pSps->vuiParameters->numReorderFrames))
         noReorder = HANTRO_TRUE;
+    else if (pStorage->lowLatency &&
+             !(pSps->vuiParametersPresentFlag &&
+               pSps->vuiParameters->bitstreamRestrictionFlag))
+        noReorder = HANTRO_TRUE;
     else
         noReorder = HANTRO_FALSE;
 
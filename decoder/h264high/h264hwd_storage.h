@@ -120,6 +120,10 @@ typedef struct
     /* flag to store noOutputReordering flag set by the application */
     u32 noReordering;
 
+    /* low latency output set by the application: no reordering unless the
+     * active SPS signals it, see H264DecSetLowLatency */
+    u32 lowLatency;
+
     /* pointer to DPB of current view */
     dpbStorage_t *dpb;
 
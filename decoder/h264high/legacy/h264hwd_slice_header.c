@@ -2029,3 +2029,64 @@ u32 h264bsdCheckRedundantPicCnt(const strmData_t * pStrmData,
     return (HANTRO_OK);
 
 }
+
+/*------------------------------------------------------------------------------
+
+    Function: h264bsdCheckSliceType
+
+        Functional description:
+            Peek values of first_mb_in_slice and slice_type from the slice
+            header. Function does not
+            modify current stream positions but copies the stream data
+            structure to tmp structure which is used while accessing stream
+            data.
+
+        Inputs:
+            pStrmData       pointer to stream data structure
+
+        Outputs:
+            firstMbInSlice  value is stored here
+            sliceType       value is stored here
+
+        Returns:
+            HANTRO_OK       success
+            HANTRO_NOK      invalid stream data
+
+------------------------------------------------------------------------------*/
+
+u32 h264bsdCheckSliceType(strmData_t * pStrmData, u32 * firstMbInSlice,
+                          u32 * sliceType)
+{
+
+/* Variables */
+
+    u32 tmp, value;
+    strmData_t tmpStrmData[1];
+
+/* Code */
+
+    ASSERT(pStrmData);
+    ASSERT(firstMbInSlice);
+    ASSERT(sliceType);
+
+    /* don't touch original stream position params */
+    *tmpStrmData = *pStrmData;
+
+    /* first_mb_in_slice */
+    tmp = h264bsdDecodeExpGolombUnsigned(tmpStrmData, &value);
+    if (tmp != HANTRO_OK)
+        return (tmp);
+    *firstMbInSlice = value;
+
+    /* slice_type */
+    tmp = h264bsdDecodeExpGolombUnsigned(tmpStrmData, &value);
+    if (tmp != HANTRO_OK)
+        return (tmp);
+    if (value > 9)
+        return (HANTRO_NOK);
+
+    *sliceType = value;
+
+    return (HANTRO_OK);
+
+}
@@ -233,4 +233,7 @@ u32 h264bsdCheckFirstMbInSlice(strmData_t * pStrmData,
                          nalUnitType_e nalUnitType, 
                          u32 * firstMbInSlice);
 
+u32 h264bsdCheckSliceType(strmData_t * pStrmData, u32 * firstMbInSlice,
+                          u32 * sliceType);
+
 #endif /* #ifdef H264HWD_SLICE_HEADER_H */
@@ -59,6 +59,13 @@ extern "C"
         u32 clientType;
     } DWLInitParam_t;
 
+    /* Time the calling thread has spent in DWLWaitHwReady, all instances */
+    typedef struct DWLWaitStats
+    {
+        u32 waits;              /* DWLWaitHwReady calls */
+        u32 waitUs;             /* microseconds, wraps around */
+    } DWLWaitStats_t;
+
     /* Hardware configuration description */
 
     typedef struct DWLHwConfig
@@ -155,6 +162,7 @@ extern "C"
 
 /* HW synchronization */
     i32 DWLWaitHwReady(const void *instance, u32 timeout);
+    void DWLGetWaitStats(DWLWaitStats_t * stats);
 
 /* SW/SW shared memory */
     void *DWLmalloc(u32 n);
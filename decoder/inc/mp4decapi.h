@@ -96,6 +96,8 @@ extern "C"
         u32 picId;
         u32 skipNonReference; /* Flag to enable decoder skip non-reference 
                                * frames to reduce processor load */
+        u32 skipNonIntra;    /* Flag to decode I-VOPs only, e.g. for fast
+                               * forward */
     } MP4DecInput;
 
     /* Time code */
@@ -93,6 +93,8 @@ extern "C"
         u32 picId;
         u32 skipNonReference; /* Flag to enable decoder skip non-reference 
                                * frames to reduce processor load */
+        u32 skipNonIntra;    /* Flag to decode I pictures only, e.g. for
+                               * fast forward */
     } Mpeg2DecInput;
 
     /* Time code */
@@ -294,6 +294,27 @@ extern "C"
         PPOutput ppOutputBuffers[PP_MAX_MULTIBUFFER];
     } PPOutputBuffers;
 
+    /* One picture of a PPRunBatch() job. All other parameters are shared and
+     * come from the last successful PPSetConfig(), which itself still needs
+     * valid buffer addresses, e.g. those of the first picture. The config
+     * keeps its own addresses, PPGetConfig() after a batch returns them */
+    typedef struct PPBatchImage_
+    {
+        u32 inBusAddrLuma;
+        u32 inBusAddrCb;     /* chroma, or Cb of planar input */
+        u32 inBusAddrCr;     /* Cr of planar input */
+        u32 outBusAddr;
+        u32 outChromaBusAddr;
+        PPResult result;     /* set by PPRunBatch() */
+    } PPBatchImage;
+
+    typedef struct PPBatchStats_
+    {
+        u32 nbrOfImages;     /* pictures processed without errors */
+        u32 elapsedUs;       /* time HW was reserved for the batch */
+        u32 imagesPerSec;
+    } PPBatchStats;
+
 /*------------------------------------------------------------------------------
     Prototypes of PP API functions
 ------------------------------------------------------------------------------*/
@@ -313,10 +334,25 @@ extern "C"
 
     PPResult PPGetNextOutput(PPInst postPInst, PPOutput * pOut);
 
+    /* H264 multibuffer mode: post-process every decoded picture a second time
+     * into pBuffers, e.g. a thumbnail next to the display size picture. Input
+     * image of pPpConf is taken from the current config, buffer i of the
+     * second output gets the same picture as buffer i of the first. The
+     * second run starts when the first is done and runs while the decoder
+     * goes on; PPGetNextSecondOutput waits for it and returns its error.
+     * NULL pPpConf switches it off */
+    PPResult PPDecSetSecondOutput(PPInst postPInst, const PPConfig * pPpConf,
+                                  const PPOutputBuffers * pBuffers);
+
+    PPResult PPGetNextSecondOutput(PPInst postPInst, PPOutput * pOut);
+
     void PPRelease(PPInst pPpInst);
 
     PPResult PPGetResult(PPInst postPInst);
 
+    PPResult PPRunBatch(PPInst postPInst, PPBatchImage * pImages, u32 count,
+                        PPBatchStats * pStats);
+
     PPApiVersion PPGetAPIVersion(void);
 
     PPBuild PPGetBuild(void);
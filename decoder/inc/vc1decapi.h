@@ -127,6 +127,8 @@ extern "C"
                                  *  decoded picture. */
         u32 skipNonReference; /* Flag to enable decoder skip non-reference 
                                * frames to reduce processor load */
+        u32 skipNonIntra;    /* Flag to decode I pictures only, e.g. for
+                               * fast forward */
     } VC1DecInput;
 
     typedef struct
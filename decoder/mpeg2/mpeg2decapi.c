@@ -78,6 +78,7 @@
 void mpeg2RefreshRegs(DecContainer * pDecCont);
 void mpeg2FlushRegs(DecContainer * pDecCont);
 static u32 mpeg2HandleVlcModeError(DecContainer * pDecCont, u32 picNum);
+static u32 mpeg2SkipPicture(DecContainer * pDecCont);
 static void mpeg2HandleFrameEnd(DecContainer * pDecCont);
 static u32 RunDecoderAsic(DecContainer * pDecContainer, u32 strmBusAddress);
 static void Mpeg2FillPicStruct(Mpeg2DecPicture * pPicture,
@@ -587,8 +588,24 @@ Mpeg2DecRet Mpeg2DecDecode(Mpeg2DecInst decInst,
             {
             case DEC_PIC_HDR_RDY:
                 pDecCont->StrmStorage.lastBSkipped = 0;
+                /* I pictures only: keep skipping after the mode is switched
+                 * off until an I picture gives a valid reference again */
+                if (pInput->skipNonIntra)
+                    pDecCont->StrmStorage.skipNonIntra = 1;
+                else if (pDecCont->Hdrs.pictureCodingType == IFRAME &&
+                         pDecCont->ApiStorage.firstField)
+                    pDecCont->StrmStorage.skipNonIntra = 0;
+
+                if (pDecCont->StrmStorage.skipNonIntra &&
+                    pDecCont->Hdrs.pictureCodingType != IFRAME &&
+                    pDecCont->ApiStorage.firstField)
+                {
+                    MPEG2_API_TRC("Mpeg2DecDecode# MPEG2DEC_NONREF_PIC_SKIPPED\n");
+                    ret = mpeg2SkipPicture(pDecCont);
+                    Mpeg2CheckReleasePpAndHw(pDecCont);
+                }
                 /* if type inter predicted and no reference -> error */
-                if ((pDecCont->Hdrs.pictureCodingType == PFRAME &&
+                else if ((pDecCont->Hdrs.pictureCodingType == PFRAME &&
                     pDecCont->ApiStorage.firstField &&
                     pDecCont->StrmStorage.work0 == INVALID_ANCHOR_PICTURE) ||
                    (pDecCont->Hdrs.pictureCodingType == BFRAME &&
@@ -1102,6 +1119,36 @@ void mpeg2FlushRegs(DecContainer * pDecCont)
     }
 }
 
+/*------------------------------------------------------------------------------
+    Function name   : mpeg2SkipPicture
+    Description     : skip picture without decoding it, references are left
+                      as they are and B pictures are skipped until two new
+                      anchors have been decoded
+    Return type     : u32
+    Argument        : DecContainer *pDecCont
+------------------------------------------------------------------------------*/
+u32 mpeg2SkipPicture(DecContainer * pDecCont)
+{
+    u32 tmp;
+
+    tmp = mpeg2StrmDec_NextStartCode(pDecCont);
+    if (tmp != END_OF_STREAM)
+    {
+        pDecCont->StrmDesc.pStrmCurrPos -= 4;
+        pDecCont->StrmDesc.strmBuffReadBits -= 32;
+    }
+
+    if (pDecCont->Hdrs.pictureCodingType != BFRAME)
+        pDecCont->StrmStorage.skipB = 2;
+
+    pDecCont->ApiStorage.DecStat = STREAMDECODING;
+    pDecCont->StrmStorage.validPicHeader = FALSE;
+    pDecCont->StrmStorage.validPicExtHeader = FALSE;
+    pDecCont->Hdrs.pictureStructure = FRAMEPICTURE;
+
+    return (MPEG2DEC_NONREF_PIC_SKIPPED);
+}
+
 /*------------------------------------------------------------------------------
     Function name   : mpeg2HandleVlcModeError
     Description     :
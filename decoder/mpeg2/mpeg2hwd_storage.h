@@ -79,6 +79,7 @@ typedef struct
 
     u32 pictureBroken;
     u32 intraFreeze;
+    u32 skipNonIntra;   /* skip P and B pictures until the next I picture */
     u32 newHeadersChangeResolution;
     u32 previousB;
     u32 previousModeFull;
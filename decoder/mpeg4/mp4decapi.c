@@ -110,6 +110,7 @@
 void MP4RefreshRegs(DecContainer * pDecCont);
 void MP4FlushRegs(DecContainer * pDecCont);
 static u32 HandleVlcModeError(DecContainer * pDecCont, u32 picNum);
+static u32 SkipVop(DecContainer * pDecCont);
 static void HandleVopEnd(DecContainer * pDecCont);
 static u32 RunDecoderAsic(DecContainer * pDecContainer, u32 strmBusAddress);
 static void MP4FillPicStruct(MP4DecPicture * pPicture,
@@ -535,8 +536,23 @@ MP4DecRet MP4DecDecode(MP4DecInst decInst,
 
             case DEC_VOP_HDR_RDY:
 
+                /* I-VOPs only: keep skipping after the mode is switched off
+                 * until an I-VOP gives a valid reference again */
+                if (pInput->skipNonIntra)
+                    pDecCont->StrmStorage.skipNonIntra = 1;
+                else if (pDecCont->VopDesc.vopCodingType == IVOP &&
+                         pDecCont->VopDesc.vopCoded)
+                    pDecCont->StrmStorage.skipNonIntra = 0;
+
+                if (pDecCont->StrmStorage.skipNonIntra &&
+                    (pDecCont->VopDesc.vopCodingType != IVOP ||
+                     !pDecCont->VopDesc.vopCoded))
+                {
+                    MP4_API_TRC("MP4DecDecode# MP4DEC_NONREF_PIC_SKIPPED\n");
+                    ret = SkipVop(pDecCont);
+                }
                 /* if type inter predicted and no reference -> error */
-                if (((pDecCont->VopDesc.vopCodingType == PVOP ||
+                else if (((pDecCont->VopDesc.vopCodingType == PVOP ||
                        (pDecCont->VopDesc.vopCodingType == IVOP &&
                         !pDecCont->VopDesc.vopCoded)) &&
                     pDecCont->StrmStorage.work0 == INVALID_ANCHOR_PICTURE) ||
@@ -1686,6 +1702,29 @@ void MP4FlushRegs(DecContainer * pDecCont)
     }
 }
 
+/*------------------------------------------------------------------------------
+    Function name   : SkipVop
+    Description     : skip VOP without decoding it, references are left as
+                      they are and B-VOPs are skipped until two new anchors
+                      have been decoded
+    Return type     : u32
+    Argument        : DecContainer *pDecCont
+------------------------------------------------------------------------------*/
+u32 SkipVop(DecContainer * pDecCont)
+{
+
+    /* search for the next start code, not for a resync marker of this VOP */
+    pDecCont->StrmStorage.validVopHeader = HANTRO_FALSE;
+    (void) StrmDec_FindSync(pDecCont);
+
+    if (pDecCont->VopDesc.vopCodingType != BVOP)
+        pDecCont->StrmStorage.skipB = 2;
+
+    pDecCont->ApiStorage.DecStat = STREAMDECODING;
+
+    return MP4DEC_NONREF_PIC_SKIPPED;
+}
+
 /*------------------------------------------------------------------------------
     Function name   : HandleVlcModeError
     Description     : error handling for VLC mode
@@ -2816,7 +2855,9 @@ static u32 MP4SetRegs(DecContainer * pDecContainer, u32 strmBusAddress)
                    !pDecContainer->Hdrs.lowDelay);
     SetDecRegister(pDecContainer->mp4Regs, HWIF_DIR_MV_BASE,
                    pDecContainer->StrmStorage.directMvs.busAddress);
+    /* no anchor yet before the first I-VOP */
     SetDecRegister(pDecContainer->mp4Regs, HWIF_PREV_ANC_TYPE,
+                   pDecContainer->StrmStorage.work0 != INVALID_ANCHOR_PICTURE &&
                    pDecContainer->StrmStorage.pPicBuf[pDecContainer->
                                                       StrmStorage.work0].
                    picType == PVOP);
@@ -45,7 +45,25 @@
     3. Module defines
 ------------------------------------------------------------------------------*/
 
-static u32 RvlcTableSearch(DecContainer *, u32, u32, u32 *);
+static u32 RvlcTableSearch(u32, const u16 *, const u16 *, u32 *);
+
+/* number of leading one bits; value != 0xFFFFFFFF */
+#ifdef __GNUC__
+#define LEADING_ONES(value) ((u32)__builtin_clz(~(value)))
+#else
+#define LEADING_ONES(value) RvlcLeadingOnes(value)
+static u32 RvlcLeadingOnes(u32 value)
+{
+    u32 n = 0;
+
+    while (value & 0x80000000)
+    {
+        value <<= 1;
+        n++;
+    }
+    return (n);
+}
+#endif
 
 enum
 { ERROR = 0x7EEEFFFF, EMPTY = 0x00000000, ESCAPE = 0x0000FFFF };
@@ -589,7 +607,9 @@ static const u32 ShortInter[32] = {
 
 /* ------------- RVLC Table search ------------------------------*/
 
-u32 RvlcTableSearch(DecContainer * pDecContainer, u32 input, u32 mbNumber,
+/* The zero/one bit positions that determine the code length are found by
+ * counting leading ones instead of testing the bits one by one */
+u32 RvlcTableSearch(u32 input, const u16 * table1, const u16 * table2,
                     u32 * plen)
 {
     u32 SecondZero;
@@ -598,44 +618,27 @@ u32 RvlcTableSearch(DecContainer * pDecContainer, u32 input, u32 mbNumber,
     u32 index;
     i32 level;
     u32 length;
-    u32 tmp = 0;
-    u32 lastBit = 0;
-    u32 sign = 0;
-
-    SecondZero = 999;
-    length = 0;
+    u32 lastBit;
+    u32 sign;
 
     if (input < 0x80000000)
     {
         /* scan next (2nd) zero */
-        for (i = 0; i < 11; i++)
-        {
-            if (!(input & (0x40000000 >> i)))
-            {
-                SecondZero = i;
-                break;
-            }
-        }
-        if (SecondZero == 999)
+        SecondZero = LEADING_ONES(input << 1);
+        if (SecondZero >= 11)
         {
             return (ERROR);
         }
         /* scan next (3rd) zero, calculate rvlc length (without sign),
          * save the last bit of rvlc code and the sign bit */
-        for (i = (SecondZero + 1); i < 13; i++)
-        {
-            if (!(input & (0x40000000 >> i)))
-            {
-                length = i + 4;
-                lastBit = input & (0x20000000 >> i) ? 1 : 0;
-                sign = input & (0x10000000 >> i);
-                break;
-            }
-        }
-        if (!length)
+        i = SecondZero + 1 + LEADING_ONES(input << (SecondZero + 2));
+        if (i >= 13)
         {
             return (ERROR);
         }
+        length = i + 4;
+        lastBit = input & (0x20000000 >> i) ? 1 : 0;
+        sign = input & (0x10000000 >> i);
 
         /* calculate index to table */
 
@@ -645,83 +648,38 @@ u32 RvlcTableSearch(DecContainer * pDecContainer, u32 input, u32 mbNumber,
             return (ERROR);
         }
 
-        if (MB_IS_INTRA(mbNumber))
-        {
-            rlc = (u32) u16_rvlcTable1Intra[index];
-        }
-        else
-        {
-            rlc = (u32) u16_rvlcTable1Inter[index];
-        }
+        rlc = (u32) table1[index];
         if (rlc == EMPTY)
         {
             return (ERROR);
         }
-        *plen = length;
-        if (tmp == END_OF_STREAM)
-        {
-            return (tmp);
-        }
-        if (!sign)
-        {
-            return (rlc);
-        }
-        else
-        {
-            level = rlc & 0x1FF;
-            level = -level;
-            rlc = rlc & 0xFE00;
-            rlc = rlc | (level & 0x1FF);
-            return (rlc);
-        }
     }
     else
     {
         /* 1st bit is 1 (msb) */
         /* scan next high bit (starting from bit number 3) */
-        for (i = 2; i < 12; i++)
-        {
-            if (input & (0x40000000 >> i))
-            {
-                lastBit = input & (0x20000000 >> i) ? 1 : 0;
-                sign = input & (0x10000000 >> i);
-                length = i + 4;
-                break;
-            }
-        }
-        if (!length)
+        if ((input << 3) < 0x400000)
         {
             return (ERROR);
         }
-        index = (length - 6) * 2 + lastBit;
+        i = 2 + LEADING_ONES(~(input << 3));
+        lastBit = input & (0x20000000 >> i) ? 1 : 0;
+        sign = input & (0x10000000 >> i);
+        length = i + 4;
 
-        if (MB_IS_INTRA(mbNumber))
-        {
-            rlc = u16_rvlcTable2Intra[index];
-        }
-        else
-        {
-            rlc = u16_rvlcTable2Inter[index];
-        }
+        index = (length - 6) * 2 + lastBit;
+        rlc = (u32) table2[index];
+    }
 
-        *plen = length;
-        if (tmp == END_OF_STREAM)
-        {
-            return (tmp);
-        }
-        if (!sign)
-        {
-            return (rlc);
-        }
-        else
-        {
-            level = rlc & 0x1FF;
-            level = -level;
-            rlc = rlc & 0xFE00;
-            rlc = rlc | (level & 0x1FF);
-            return (rlc);
-        }
+    *plen = length;
+    if (sign)
+    {
+        level = rlc & 0x1FF;
+        level = -level;
+        rlc = rlc & 0xFE00;
+        rlc = rlc | (level & 0x1FF);
     }
+    return (rlc);
 }
 
 /*------------------------------------------------------------------------------
@@ -755,6 +713,8 @@ u32 StrmDec_DecodeRvlc(DecContainer * pDecContainer, u32 mbNumber,
     i32 level;
     u32 rlcAddrCount;
     u32 tmp = 0;
+    const u32 *shortTable;
+    const u16 *table1, *table2;
 
     MP4DEC_API_DEBUG((" Rvlc_Decode # \n"));
     /* read in 32 bits */
@@ -769,6 +729,19 @@ u32 StrmDec_DecodeRvlc(DecContainer * pDecContainer, u32 mbNumber,
             codedBlocks =
                 pDecContainer->StrmStorage.codedBits[mbNumber + MbNo];
 
+            if (MB_IS_INTRA(mbNumber + MbNo))
+            {
+                shortTable = ShortIntra;
+                table1 = u16_rvlcTable1Intra;
+                table2 = u16_rvlcTable2Intra;
+            }
+            else
+            {
+                shortTable = ShortInter;
+                table1 = u16_rvlcTable1Inter;
+                table2 = u16_rvlcTable2Inter;
+            }
+
             /* Check that there is enough 'space' in rlc data buffer (max
              * locations needed by block is 64) */
             if ((i32)
@@ -790,21 +763,13 @@ u32 StrmDec_DecodeRvlc(DecContainer * pDecContainer, u32 mbNumber,
                         {
                             length = 0;
                             /* short word search */
-                            if (MB_IS_INTRA(mbNumber + MbNo))
-                            {
-                                rlc = ShortIntra[tmpBuf >> 27];
-                            }
-                            else
-                            {
-                                rlc = ShortInter[tmpBuf >> 27];
-                            }
+                            rlc = shortTable[tmpBuf >> 27];
 
                             if (rlc == EMPTY)
                             {
                                 /* no escape or indexes between 0-4 or
                                  * ERROR-sig, normal table search */
-                                rlc = RvlcTableSearch(pDecContainer, tmpBuf,
-                                                      (mbNumber + MbNo),
+                                rlc = RvlcTableSearch(tmpBuf, table1, table2,
                                                       &length);
                                 usedBits += length;
                                 shiftt = length;
@@ -114,6 +114,7 @@ typedef struct
                          * against clumsily stuffed short video end markers */
     u32 intraFreeze;
     u32 pictureBroken;
+    u32 skipNonIntra;   /* skip P- and B-VOPs until the next I-VOP */
     u32 previousModeFull;
 
     u32 prevBIdx;
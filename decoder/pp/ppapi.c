@@ -106,6 +106,7 @@ static void PPDecSetOutBuffer(PPContainer * ppC, const DecPpInterface * decpp);
 static void PPDecDisplayIndex(const void *postPInst, u32 index);
 static void PPDecBufferData(const void *postPInst, u32 bufferIndex,
                             u32 inputBusLuma, u32 inputBusChroma);
+static void PPDecStartSecondOutput(PPContainer * ppC);
 
 #else
 #undef PP_DEC_PIPELINE_SUPPORT
@@ -113,6 +114,11 @@ static void PPDecBufferData(const void *postPInst, u32 bufferIndex,
 
 #define PP_IS_JOINED(ppC) (ppC->decInst != NULL ? 1 : 0)
 
+static PPResult PPDecInitSecondOutput(const PPContainer * ppC,
+                                      PPContainer * second);
+static void PPDecWaitSecondOutput(PPContainer * ppC);
+static void PPDecFreeSecondOutput(PPContainer * ppC);
+
 /*------------------------------------------------------------------------------
     Function name   : PPInit
     Description     : initialize pp
@@ -244,6 +250,7 @@ PPResult PPSetConfig(PPInst postPInst, PPConfig * pPpConf)
     PPRgbTransform *rgbT;
 
     i32 tmp;
+    u32 setupStart, setupUs, memoHit = 0;
 
     PP_API_TRC("PPSetConfig: postPInst=%p pPpConf=%p", postPInst, pPpConf);
 
@@ -276,6 +283,30 @@ PPResult PPSetConfig(PPInst postPInst, PPConfig * pPpConf)
             ppC->combinedModeBuffers.nbrOfBuffers = 1;
     }
 
+    setupStart = PPTimeUs();
+
+    /* only the buffers changed since the last setup: keep all the derived
+     * registers and program just the new addresses */
+    if (ppC->cfgValid && PPSetupMemoMatch(ppC, pPpConf))
+    {
+        tmp = PPCheckBufferAddresses(pPpConf, (ppC->decInst != NULL ? 1 : 0));
+
+        if (tmp != (i32) PP_OK)
+        {
+            ALOGE("PPSetConfig: error in line %d (%d)", __LINE__, tmp);
+            return (PPResult) tmp;
+        }
+
+        (void) DWLmemcpy(&ppC->prevCfg, &ppC->ppCfg, sizeof(PPConfig));
+
+        PPSetupMemoRestore(ppC, pPpConf);
+        PPSetupBufferAddresses(ppC);
+
+        memoHit = 1;
+        ppC->setupMemo.hits++;
+        goto setup_done;
+    }
+
     tmp = PPCheckConfig(ppC, pPpConf, (ppC->decInst != NULL ? 1 : 0), ppC->decType);
 
     if (tmp != (i32) PP_OK)
@@ -449,8 +480,18 @@ PPResult PPSetConfig(PPInst postPInst, PPConfig * pPpConf)
     }
 
     PPSetupHW(ppC);
-
-    ALOGV("PPSetConfig: return ok");
+    PPSetupMemoStore(ppC, pPpConf);
+    ppC->cfgValid = 1;
+
+  setup_done:
+    setupUs = PPTimeUs() - setupStart;
+    ppC->setupMemo.frames++;
+    ppC->setupMemo.setupUs += setupUs;
+
+    ALOGV("PPSetConfig: setup %u us (%s), %u/%u memoized, avg %u us",
+          setupUs, memoHit ? "addresses" : "full", ppC->setupMemo.hits,
+          ppC->setupMemo.frames,
+          ppC->setupMemo.setupUs / ppC->setupMemo.frames);
     return (PP_OK);
 }
 
@@ -477,6 +518,8 @@ void PPRelease(PPInst postPInst)
         (void) PPDecCombinedModeDisable(ppC, ppC->decInst);
     }
 
+    PPDecFreeSecondOutput(ppC);
+
     dwl = ppC->dwl;
 
     DWLfree(ppC);
@@ -526,6 +569,181 @@ PPResult PPGetResult(PPInst postPInst)
     return ret;
 }
 
+/*------------------------------------------------------------------------------
+    Function name   : PPCheckBatchImage
+    Description     : buffer address checks of PPCheckConfig for one picture
+    Return type     : PPResult
+    Argument        : const PPConfig * ppCfg
+    Argument        : const PPBatchImage * pImage
+------------------------------------------------------------------------------*/
+static PPResult PPCheckBatchImage(const PPConfig * ppCfg,
+                                  const PPBatchImage * pImage)
+{
+    const u32 address_mask = (PP_X170_DATA_BUS_WIDTH - 1);
+
+    if (pImage->inBusAddrLuma == 0 || (pImage->inBusAddrLuma & address_mask))
+        return PP_SET_IN_ADDRESS_INVALID;
+
+    if ((ppCfg->ppInImg.pixFormat & PP_PIXEL_FORMAT_YUV420_MASK) &&
+        (pImage->inBusAddrCb == 0 || (pImage->inBusAddrCb & address_mask)))
+        return PP_SET_IN_ADDRESS_INVALID;
+
+    if (ppCfg->ppInImg.pixFormat == PP_PIX_FMT_YCBCR_4_2_0_PLANAR &&
+        (pImage->inBusAddrCr == 0 || (pImage->inBusAddrCr & address_mask)))
+        return PP_SET_IN_ADDRESS_INVALID;
+
+    if (pImage->outBusAddr == 0 || (pImage->outBusAddr & address_mask))
+        return PP_SET_OUT_ADDRESS_INVALID;
+
+    if (ppCfg->ppOutImg.pixFormat == PP_PIX_FMT_YCBCR_4_2_0_SEMIPLANAR &&
+        (pImage->outChromaBusAddr == 0 ||
+         (pImage->outChromaBusAddr & address_mask)))
+        return PP_SET_OUT_ADDRESS_INVALID;
+
+    return PP_OK;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPRunBatch
+    Description     : post-process many pictures with the configuration of
+                      the last PPSetConfig(). The config is validated once,
+                      HW is reserved for the whole batch and only the buffer
+                      address registers are rewritten between pictures.
+                      Pictures with bad addresses are skipped, a HW error
+                      stops the batch. The buffer addresses of the config
+                      are restored afterwards.
+    Return type     : PPResult
+    Argument        : PPInst postPInst
+    Argument        : PPBatchImage * pImages
+    Argument        : u32 count
+    Argument        : PPBatchStats * pStats
+------------------------------------------------------------------------------*/
+PPResult PPRunBatch(PPInst postPInst, PPBatchImage * pImages, u32 count,
+                    PPBatchStats * pStats)
+{
+    PPContainer *ppC;
+    PPConfig *ppCfg;
+    PPResult ret = PP_OK;
+    u32 hwRegs[PP_X170_REGISTERS];
+    u32 savedIn[3], savedOut[2];
+    u32 started = 0;
+    u32 done = 0;
+    u32 start, elapsed;
+    u32 i;
+
+    PP_API_TRC("PPRunBatch # count %u", count);
+
+    if (postPInst == NULL || (pImages == NULL && count != 0))
+    {
+        return (PP_PARAM_ERROR);
+    }
+
+    ppC = (PPContainer *) postPInst;
+    ppCfg = &ppC->ppCfg;
+
+    /* standalone progressive frames only */
+    if (PP_IS_JOINED(ppC) || !ppC->cfgValid ||
+        ppCfg->ppInImg.picStruct != PP_PIC_FRAME_OR_TOP_FIELD)
+    {
+        return (PP_PARAM_ERROR);
+    }
+
+    if (PPGetStatus(ppC) != PP_STATUS_IDLE)
+    {
+        return PP_BUSY;
+    }
+
+    /* the batch reuses the config, its own buffers come back afterwards */
+    savedIn[0] = ppCfg->ppInImg.bufferBusAddr;
+    savedIn[1] = ppCfg->ppInImg.bufferCbBusAddr;
+    savedIn[2] = ppCfg->ppInImg.bufferCrBusAddr;
+    savedOut[0] = ppCfg->ppOutImg.bufferBusAddr;
+    savedOut[1] = ppCfg->ppOutImg.bufferChromaBusAddr;
+
+    start = PPTimeUs();
+
+    for (i = 0; i < count; i++)
+    {
+        PPBatchImage *pImage = &pImages[i];
+
+        pImage->result = PPCheckBatchImage(ppCfg, pImage);
+        if (pImage->result != PP_OK)
+        {
+            if (ret == PP_OK)
+                ret = pImage->result;
+            continue;
+        }
+
+        ppCfg->ppInImg.bufferBusAddr = pImage->inBusAddrLuma;
+        ppCfg->ppInImg.bufferCbBusAddr = pImage->inBusAddrCb;
+        ppCfg->ppInImg.bufferCrBusAddr = pImage->inBusAddrCr;
+        ppCfg->ppOutImg.bufferBusAddr = pImage->outBusAddr;
+        ppCfg->ppOutImg.bufferChromaBusAddr = pImage->outChromaBusAddr;
+        PPSetupBufferAddresses(ppC);
+
+        if (!started)
+        {
+            /* first picture programs the whole register set */
+            if (PPRun(ppC) != PP_OK)
+            {
+                PPSetStatus(ppC, PP_STATUS_IDLE);
+                ret = PP_BUSY;
+                for (; i < count; i++)
+                    pImages[i].result = PP_BUSY;
+                break;
+            }
+            started = 1;
+        }
+        else
+        {
+            PPFlushChangedRegs(ppC, hwRegs);
+            SetPpRegister(ppC->ppRegs, HWIF_PP_E, 1);
+            DWLEnableHW(ppC->dwl, PP_X170_REG_START, ppC->ppRegs[0]);
+        }
+
+        pImage->result = PPWaitHw(ppC);
+
+        /* HW registers now match the shadow registers */
+        (void) DWLmemcpy(hwRegs, ppC->ppRegs, sizeof(hwRegs));
+
+        if (pImage->result != PP_OK)
+        {
+            ret = pImage->result;
+            for (i++; i < count; i++)
+                pImages[i].result = PP_BUSY;
+            break;
+        }
+        done++;
+    }
+
+    if (started)
+    {
+        DWLReleaseHw(ppC->dwl);
+        PPSetStatus(ppC, PP_STATUS_IDLE);
+    }
+
+    ppCfg->ppInImg.bufferBusAddr = savedIn[0];
+    ppCfg->ppInImg.bufferCbBusAddr = savedIn[1];
+    ppCfg->ppInImg.bufferCrBusAddr = savedIn[2];
+    ppCfg->ppOutImg.bufferBusAddr = savedOut[0];
+    ppCfg->ppOutImg.bufferChromaBusAddr = savedOut[1];
+    PPSetupBufferAddresses(ppC);
+
+    elapsed = PPTimeUs() - start;
+
+    if (pStats != NULL)
+    {
+        pStats->nbrOfImages = done;
+        pStats->elapsedUs = elapsed;
+        pStats->imagesPerSec = elapsed ?
+            (u32) ((unsigned long long) done * 1000000U / elapsed) : 0;
+    }
+
+    ALOGV("PPRunBatch: %u/%u images in %u us", done, count, elapsed);
+
+    return ret;
+}
+
 /*------------------------------------------------------------------------------
     Function name   : PPDecWaitResult
     Description     : Wait for PP, not started here i.e PPRun not called
@@ -659,6 +877,10 @@ static void PPDecStartPp(const void *postPInst, const DecPpInterface * decpp)
         return;
     }
 
+    /* PP is needed again, the second output of the previous picture must
+     * be done by now */
+    PPDecWaitSecondOutput(ppC);
+
     ppC->PPCombinedRet = PP_OK;
 
     ppOutDeint = &ppC->ppCfg.ppOutDeinterlace;
@@ -755,6 +977,13 @@ static void PPDecStartPp(const void *postPInst, const DecPpInterface * decpp)
         }
 
         PPDecSetOutBuffer(ppC, decpp);
+
+        /* same picture goes to the second output once this run is done */
+        if (ppC->secondOut != NULL)
+        {
+            (void) DWLmemcpy(&ppC->secondDecPp, decpp, sizeof(DecPpInterface));
+            ppC->secondPending = 1;
+        }
     }
 
     /* If tiled-mode supported on PP, forward status of current picture */
@@ -1070,6 +1299,10 @@ static void PPDecConfigQueryFromDec(const void *postPInst,
 
     ppC = (PPContainer *) postPInst;
 
+    /* a new picture is about to be decoded, maybe into the buffer of a
+     * picture given out already: the second output must have read it */
+    PPDecWaitSecondOutput(ppC);
+
     decPpQuery->pipelineAccepted = 1;
     decPpQuery->ppConfigChanged = 0;
 
@@ -1178,7 +1411,13 @@ void PPDecEndCallback(const void *postPInst)
             ppRet = PPDecWaitResult(postPInst);
             ppC->PPCombinedRet = ppRet;
         }
+
+        if (ppC->PPCombinedRet == PP_OK && ppC->secondPending)
+        {
+            PPDecStartSecondOutput(ppC);
+        }
     }
+    ppC->secondPending = 0;
     PP_API_TRC("PPDecEndCallback # exit");
 }
 
@@ -1364,6 +1603,7 @@ PPResult PPDecCombinedModeEnable(PPInst postPInst, const void *pDecInst,
 
     ppC->decType = decType;
     ppC->decInst = pDecInst;
+    PPSetupMemoInvalidate(ppC);
 
     PP_API_TRC("PPDecCombinedModeEnable# OK \n");
     return PP_OK;
@@ -1477,6 +1717,8 @@ PPResult PPDecCombinedModeDisable(PPInst postPInst, const void *pDecInst)
 
     ppC->pipeline = 0;
     ppC->decInst = NULL;
+    PPSetupMemoInvalidate(ppC);
+    PPDecFreeSecondOutput(ppC);
 
     PP_API_TRC("PPDecCombinedModeDisable OK \n");
     return PP_OK;
@@ -1535,15 +1777,235 @@ PPResult PPDecSetMultipleOutput(PPInst postPInst,
     /* mark previously decoded pics dirty */
     ppC->currentSetupID++;
 
+    /* second output buffers pair with these by index */
+    if (ppC->secondOut != NULL &&
+        ppC->secondOut->combinedModeBuffers.nbrOfBuffers !=
+        pBuffers->nbrOfBuffers)
+        PPDecFreeSecondOutput(ppC);
+
     (void) DWLmemcpy(&ppC->combinedModeBuffers, pBuffers,
                      sizeof(PPOutputBuffers));
     ppC->multiBuffer = 1;
+    PPSetupMemoInvalidate(ppC);
 
     PP_API_TRC("PPDecSetMultipleOutput OK \n");
     return PP_OK;
 
 }
 
+/*------------------------------------------------------------------------------
+    Function name   : PPDecFreeSecondOutput
+    Description     : switch the second output off. The container shares
+                      dwl and decoder with ppC, so it is the only thing freed
+    Return type     : void
+    Argument        : container
+------------------------------------------------------------------------------*/
+static void PPDecFreeSecondOutput(PPContainer * ppC)
+{
+    PPDecWaitSecondOutput(ppC);
+
+    if (ppC->secondOut != NULL)
+    {
+        DWLfree(ppC->secondOut);
+        ppC->secondOut = NULL;
+    }
+
+    ppC->secondPending = 0;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPDecInitSecondOutput
+    Description     : set up the container of the second output like PPInit
+                      and PPDecCombinedModeEnable set up ppC. dwl and decInst
+                      are borrowed from ppC, the second output never releases
+                      them and is not registered to the decoder. Setup IDs
+                      and buffer data are copied, so pictures decoded before
+                      are rerun by PPGetNextSecondOutput
+    Return type     : PPResult
+    Argument        : container of the first output
+    Argument        : container to set up
+------------------------------------------------------------------------------*/
+static PPResult PPDecInitSecondOutput(const PPContainer * ppC,
+                                      PPContainer * second)
+{
+    (void) DWLmemset(second, 0, sizeof(PPContainer));
+
+    second->dwl = ppC->dwl;
+
+    PPInitDataStructures(second);
+
+    PPInitHW(second);
+
+    if (PPSelectOutputSize(second) != PP_OK)
+        return PP_DWL_ERROR;
+
+    second->pipeline = 0;
+    second->hwId = ppC->hwId;
+    second->fastVerticalDownscaleDisable = ppC->fastVerticalDownscaleDisable;
+    second->fastHorizontalDownscaleDisable =
+        ppC->fastHorizontalDownscaleDisable;
+    PPSetStatus(second, PP_STATUS_IDLE);
+
+    second->decInst = ppC->decInst;
+    second->decType = ppC->decType;
+
+    second->multiBuffer = 1;
+    second->currentSetupID = ppC->currentSetupID;
+    second->displayIndex = ppC->displayIndex;
+    (void) DWLmemcpy(second->bufferData, ppC->bufferData,
+                     sizeof(ppC->bufferData));
+
+    return PP_OK;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPDecWaitSecondOutput
+    Description     : wait for the second output run started at the end of
+                      the first one, if still running. Called before the PP
+                      is used again and before the decoder starts a new
+                      picture, which may reuse the input buffer. The result
+                      is kept for PPGetNextSecondOutput
+    Return type     : void
+    Argument        : container
+------------------------------------------------------------------------------*/
+static void PPDecWaitSecondOutput(PPContainer * ppC)
+{
+    PPContainer *second = ppC->secondOut;
+
+    if (second == NULL || !ppC->secondRunning)
+        return;
+
+    ppC->secondRunning = 0;
+    second->PPCombinedRet = WaitForPp(second);
+
+    if (second->PPCombinedRet != PP_OK)
+    {
+        ALOGE("PPDecWaitSecondOutput: buffer %u failed (%d)",
+              ppC->secondDecPp.bufferIndex, second->PPCombinedRet);
+    }
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPDecSetSecondOutput
+    Description     : API function for a second output of H264 multibuffer
+                      mode, call after PPDecSetMultipleOutput and PPSetConfig
+    Return type     : PPResult
+    Argument        : PPInst postPInst
+    Argument        : const PPConfig * pPpConf, NULL to switch it off
+    Argument        : const PPOutputBuffers * pBuffers
+------------------------------------------------------------------------------*/
+PPResult PPDecSetSecondOutput(PPInst postPInst, const PPConfig * pPpConf,
+                              const PPOutputBuffers * pBuffers)
+{
+    PPContainer *ppC;
+    PPContainer *second;
+    PPConfig cfg;
+    PPResult ret;
+    u32 i;
+
+    ppC = (PPContainer *) postPInst;
+
+    PP_API_TRC("PPDecSetSecondOutput\n");
+
+    if (ppC == NULL)
+        return PP_PARAM_ERROR;
+
+    if (PPGetStatus(ppC) != PP_STATUS_IDLE)
+        return PP_BUSY;
+
+    PPDecWaitSecondOutput(ppC);
+
+    if (pPpConf == NULL)
+    {
+        PPDecFreeSecondOutput(ppC);
+        return PP_OK;
+    }
+
+    if (pBuffers == NULL || ppC->decInst == NULL ||
+        ppC->decType != PP_PIPELINED_DEC_TYPE_H264 ||
+        !ppC->multiBuffer || !ppC->cfgValid)
+        return PP_PARAM_ERROR;
+
+    if (pBuffers->nbrOfBuffers != ppC->combinedModeBuffers.nbrOfBuffers)
+        return PP_PARAM_ERROR;
+
+    for (i = 0; i < pBuffers->nbrOfBuffers; i++)
+        if (pBuffers->ppOutputBuffers[i].bufferBusAddr == 0)
+            return PP_PARAM_ERROR;
+
+    second = ppC->secondOut;
+    if (second == NULL)
+    {
+        second = (PPContainer *) DWLmalloc(sizeof(PPContainer));
+        if (second == NULL)
+            return PP_MEMFAIL;
+    }
+
+    ret = PPDecInitSecondOutput(ppC, second);
+    if (ret != PP_OK)
+    {
+        ppC->secondOut = second;
+        PPDecFreeSecondOutput(ppC);
+        return ret;
+    }
+    (void) DWLmemcpy(&second->combinedModeBuffers, pBuffers,
+                     sizeof(PPOutputBuffers));
+
+    (void) DWLmemcpy(&cfg, pPpConf, sizeof(PPConfig));
+    (void) DWLmemcpy(&cfg.ppInImg, &ppC->ppCfg.ppInImg, sizeof(PPInImage));
+
+    ret = PPSetConfig(second, &cfg);
+    if (ret != PP_OK)
+    {
+        ppC->secondOut = second;
+        PPDecFreeSecondOutput(ppC);
+        return ret;
+    }
+
+    ppC->secondOut = second;
+    ppC->secondPending = 0;
+
+    PP_API_TRC("PPDecSetSecondOutput OK \n");
+    return PP_OK;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPGetNextSecondOutput
+    Description     : PPGetNextOutput for the second output, gives the same
+                      picture in display order
+    Return type     : PPResult
+    Argument        : PPInst postPInst
+    Argument        : PPOutput * pOut
+------------------------------------------------------------------------------*/
+PPResult PPGetNextSecondOutput(PPInst postPInst, PPOutput * pOut)
+{
+    PPContainer *ppC;
+    PPResult ret;
+
+    ppC = (PPContainer *) postPInst;
+
+    PP_API_TRC("PPGetNextSecondOutput\n");
+
+    if (ppC == NULL || ppC->secondOut == NULL)
+        return PP_PARAM_ERROR;
+
+    if (PPGetStatus(ppC) != PP_STATUS_IDLE)
+        return PP_BUSY;
+
+    PPDecWaitSecondOutput(ppC);
+
+    /* a failed second output run is reported here once, the decoder only
+     * sees the result of the first output */
+    ret = ppC->secondOut->PPCombinedRet;
+    if (ret != PP_OK)
+    {
+        ppC->secondOut->PPCombinedRet = PP_OK;
+        return ret;
+    }
+
+    return PPGetNextOutput(ppC->secondOut, pOut);
+}
+
 /*------------------------------------------------------------------------------
     Function name   : PPGetNextOutput
     Description     : API function for acquiring pp output location
@@ -1574,6 +2036,9 @@ PPResult PPGetNextOutput(PPInst postPInst, PPOutput * pOut)
         return PP_BUSY;
     }
 
+    /* a rerun below needs the PP */
+    PPDecWaitSecondOutput(ppC);
+
     if (ppC->multiBuffer)
     {
         const PPOutput *out;
@@ -1721,6 +2186,9 @@ void PPDecDisplayIndex(const void *postPInst, u32 index)
 
     ppC->displayIndex = index;
 
+    if (ppC->secondOut != NULL)
+        ppC->secondOut->displayIndex = index;
+
     return;
 }
 
@@ -1745,9 +2213,50 @@ void PPDecBufferData(const void *postPInst, u32 bufferIndex,
     ppC->bufferData[bufferIndex].inputBusLuma = inputBusLuma;
     ppC->bufferData[bufferIndex].inputBusChroma = inputBusChroma;
 
+    if (ppC->secondOut != NULL)
+        PPDecBufferData(ppC->secondOut, bufferIndex,
+                        inputBusLuma, inputBusChroma);
+
     return;
 }
 
+/*------------------------------------------------------------------------------
+    Function name   : PPDecStartSecondOutput
+    Description     : start post-processing the picture just finished again,
+                      with the config and buffers of the second output. The
+                      decoder has written the picture to memory by now, so
+                      this run is never pipelined. It is not waited for here,
+                      the decoder goes on meanwhile; see
+                      PPDecWaitSecondOutput
+    Return type     : void
+    Argument        : container
+------------------------------------------------------------------------------*/
+static void PPDecStartSecondOutput(PPContainer * ppC)
+{
+    PPContainer *second = ppC->secondOut;
+
+    PP_API_TRC("PPDecStartSecondOutput #");
+
+    ppC->secondPending = 0;
+    ppC->secondDecPp.usePipeline = 0;
+
+    PPDecStartPp(second, &ppC->secondDecPp);
+
+    if (second->PPCombinedRet == PP_OK)
+    {
+        ppC->secondRunning = 1;
+    }
+    else
+    {
+        /* PPRun may have failed after marking the instance running */
+        PPSetStatus(second, PP_STATUS_IDLE);
+        ALOGE("PPDecStartSecondOutput: buffer %u failed (%d)",
+              ppC->secondDecPp.bufferIndex, second->PPCombinedRet);
+    }
+
+    PP_API_TRC("PPDecStartSecondOutput # exit");
+}
+
 #endif /*PP_DEC_PIPELINE_SUPPORT */
 
 #ifdef ANDROID
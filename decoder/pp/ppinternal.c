@@ -30,6 +30,9 @@
 #include "ppcfg.h"
 #include "decapicommon.h"
 
+#include <string.h>
+#include <time.h>
+
 #ifdef ANDROID_LOG
 #define LOG_TAG "G1_PP"
 #include <log/log.h>
@@ -133,6 +136,31 @@ void PPFlushRegs(PPContainer * ppC)
     }
 }
 
+/*------------------------------------------------------------------------------
+    Function name   : PPFlushChangedRegs
+    Description     : write only the registers that differ from the values
+                      last written to HW, kept in hwRegs. The first register
+                      is left to DWLEnableHW()
+    Return type     : void
+    Argument        : PPContainer * ppC
+    Argument        : u32 * hwRegs
+------------------------------------------------------------------------------*/
+void PPFlushChangedRegs(PPContainer * ppC, u32 * hwRegs)
+{
+    i32 i;
+    u32 offset = PP_X170_REG_START + 4;
+
+    for (i = 1; i < PP_X170_REGISTERS; i++)
+    {
+        if (ppC->ppRegs[i] != hwRegs[i])
+        {
+            DWLWriteReg(ppC->dwl, offset, ppC->ppRegs[i]);
+            hwRegs[i] = ppC->ppRegs[i];
+        }
+        offset += 4;
+    }
+}
+
 /*------------------------------------------------------------------------------
     Function name   : PPInitHW
     Description     :
@@ -379,18 +407,8 @@ void PPSetupHW(PPContainer * ppC)
         }
     }
 
-    /* output buffer setup */
-    SetPpRegister(ppRegs, HWIF_PP_OUT_LU_BASE,
-                  (u32) (ppOutImg->bufferBusAddr +
-                         ppC->frmBufferLumaOrRgbOffset));
-
-    /* chromas not needed for RGB and YUYV 422 out */
-    if (ppOutImg->pixFormat == PP_PIX_FMT_YCBCR_4_2_0_SEMIPLANAR)
-    {
-        SetPpRegister(ppRegs, HWIF_PP_OUT_CH_BASE,
-                      (u32) (ppOutImg->bufferChromaBusAddr +
-                             ppC->frmBufferChromaOffset));
-    }
+    /* input and output buffers */
+    PPSetupBufferAddresses(ppC);
 
     SetPpRegister(ppRegs, HWIF_PP_OUT_FORMAT, ppC->outFormat);
     if (ppC->outFormat == PP_ASIC_OUT_FORMAT_422)
@@ -422,26 +440,6 @@ void PPSetupHW(PPContainer * ppC)
     {
         SetPpRegister(ppRegs, HWIF_PP_IN_STRUCT, ppInImg->picStruct);
         LOG_ANDROID("%s: ppInImg->picStruct = %u", __func__, ppInImg->picStruct);
-        if (ppInImg->picStruct != PP_PIC_BOT_FIELD &&
-           ppInImg->picStruct != PP_PIC_BOT_FIELD_FRAME)
-        {
-            SetPpRegister(ppRegs, HWIF_PP_IN_LU_BASE, ppInImg->bufferBusAddr);
-            SetPpRegister(ppRegs, HWIF_PP_IN_CB_BASE, ppInImg->bufferCbBusAddr);
-        }
-
-        if (ppInImg->picStruct != PP_PIC_FRAME_OR_TOP_FIELD &&
-           ppInImg->picStruct != PP_PIC_TOP_FIELD_FRAME)
-        {
-            SetPpRegister(ppRegs, HWIF_PP_BOT_YIN_BASE,
-                          ppInImg->bufferBusAddrBot);
-            SetPpRegister(ppRegs, HWIF_PP_BOT_CIN_BASE,
-                          ppInImg->bufferBusAddrChBot);
-        }
-
-        if (ppInImg->pixFormat == PP_PIX_FMT_YCBCR_4_2_0_PLANAR)
-        {
-            SetPpRegister(ppRegs, HWIF_PP_IN_CR_BASE, ppInImg->bufferCrBusAddr);
-        }
     }
 
     SetPpRegister(ppRegs, HWIF_EXT_ORIG_WIDTH, (ppInImg->width + 15) / 16);
@@ -755,6 +753,64 @@ void PPSetupHW(PPContainer * ppC)
     }
 }
 
+/*------------------------------------------------------------------------------
+    Function name   : PPSetupBufferAddresses
+    Description     : program input and output buffer addresses of ppCfg.
+                      This is all that changes between pictures of a batch
+    Return type     : void
+    Argument        : PPContainer * ppC
+------------------------------------------------------------------------------*/
+void PPSetupBufferAddresses(PPContainer * ppC)
+{
+    PPOutImage *ppOutImg;
+    PPInImage *ppInImg;
+    u32 *ppRegs;
+
+    ASSERT(ppC != NULL);
+
+    ppOutImg = &ppC->ppCfg.ppOutImg;
+    ppInImg = &ppC->ppCfg.ppInImg;
+    ppRegs = ppC->ppRegs;
+
+    /* output buffer setup */
+    SetPpRegister(ppRegs, HWIF_PP_OUT_LU_BASE,
+                  (u32) (ppOutImg->bufferBusAddr +
+                         ppC->frmBufferLumaOrRgbOffset));
+
+    /* chromas not needed for RGB and YUYV 422 out */
+    if (ppOutImg->pixFormat == PP_PIX_FMT_YCBCR_4_2_0_SEMIPLANAR)
+    {
+        SetPpRegister(ppRegs, HWIF_PP_OUT_CH_BASE,
+                      (u32) (ppOutImg->bufferChromaBusAddr +
+                             ppC->frmBufferChromaOffset));
+    }
+
+    /* input buffers come from the decoder in pipeline mode */
+    if (ppC->decInst != NULL)
+        return;
+
+    if (ppInImg->picStruct != PP_PIC_BOT_FIELD &&
+       ppInImg->picStruct != PP_PIC_BOT_FIELD_FRAME)
+    {
+        SetPpRegister(ppRegs, HWIF_PP_IN_LU_BASE, ppInImg->bufferBusAddr);
+        SetPpRegister(ppRegs, HWIF_PP_IN_CB_BASE, ppInImg->bufferCbBusAddr);
+    }
+
+    if (ppInImg->picStruct != PP_PIC_FRAME_OR_TOP_FIELD &&
+       ppInImg->picStruct != PP_PIC_TOP_FIELD_FRAME)
+    {
+        SetPpRegister(ppRegs, HWIF_PP_BOT_YIN_BASE,
+                      ppInImg->bufferBusAddrBot);
+        SetPpRegister(ppRegs, HWIF_PP_BOT_CIN_BASE,
+                      ppInImg->bufferBusAddrChBot);
+    }
+
+    if (ppInImg->pixFormat == PP_PIX_FMT_YCBCR_4_2_0_PLANAR)
+    {
+        SetPpRegister(ppRegs, HWIF_PP_IN_CR_BASE, ppInImg->bufferCrBusAddr);
+    }
+}
+
 /*------------------------------------------------------------------------------
     Function name   : PPCheckTiledOutput
     Description     :
@@ -2993,6 +3049,26 @@ static u32 PPSelectDitheringValue(u32 mask)
     Argument        : PPContainer *
 ------------------------------------------------------------------------------*/
 PPResult WaitForPp(PPContainer * ppC)
+{
+    PPResult ret;
+
+    ret = PPWaitHw(ppC);
+
+    DWLReleaseHw(ppC->dwl);
+
+    PPSetStatus(ppC, PP_STATUS_IDLE);
+
+    return ret;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPWaitHw
+    Description     : Wait PP HW to finish and turn it off, but keep it
+                      reserved
+    Return type     : PPResult
+    Argument        : PPContainer *
+------------------------------------------------------------------------------*/
+PPResult PPWaitHw(PPContainer * ppC)
 {
     const void *dwl;
     i32 dwlret = 0;
@@ -3024,9 +3100,6 @@ PPResult WaitForPp(PPContainer * ppC)
     SetPpRegister(ppC->ppRegs, HWIF_PP_PIPELINE_E, 0); 
 
     DWLDisableHW(ppC->dwl, PP_X170_REG_START, ppC->ppRegs[0]);
-    DWLReleaseHw(ppC->dwl);
-
-    PPSetStatus(ppC, PP_STATUS_IDLE);
 
     if (irq_stat & DEC_8170_IRQ_BUS)
         ret = PP_HW_BUS_ERROR;
@@ -3104,3 +3177,207 @@ u32 PPCheckSetupChanges(PPConfig * prevCfg, PPConfig * newCfg)
     return changes;
 
 }
+
+/*------------------------------------------------------------------------------
+    Function name   : PPCheckBufferAddresses
+    Description     : buffer address part of PPCheckConfig
+    Return type     : i32
+    Argument        : const PPConfig * ppCfg
+    Argument        : u32 decLinked
+------------------------------------------------------------------------------*/
+i32 PPCheckBufferAddresses(const PPConfig * ppCfg, u32 decLinked)
+{
+    const PPInImage *ppInImg = &ppCfg->ppInImg;
+    const PPOutImage *ppOutImg = &ppCfg->ppOutImg;
+    const u32 address_mask = (PP_X170_DATA_BUS_WIDTH - 1);
+
+    if (!decLinked)
+    {
+        if (ppInImg->picStruct != PP_PIC_BOT_FIELD &&
+           ppInImg->picStruct != PP_PIC_BOT_FIELD_FRAME)
+        {
+            if ((ppInImg->bufferBusAddr == 0) ||
+               (ppInImg->bufferBusAddr & address_mask))
+                return (i32) PP_SET_IN_ADDRESS_INVALID;
+
+            if ((ppInImg->pixFormat & PP_PIXEL_FORMAT_YUV420_MASK) &&
+               (ppInImg->bufferCbBusAddr == 0 ||
+                (ppInImg->bufferCbBusAddr & address_mask)))
+                return (i32) PP_SET_IN_ADDRESS_INVALID;
+
+            if (ppInImg->pixFormat == PP_PIX_FMT_YCBCR_4_2_0_PLANAR &&
+               (ppInImg->bufferCrBusAddr == 0 ||
+                (ppInImg->bufferCrBusAddr & address_mask)))
+                return (i32) PP_SET_IN_ADDRESS_INVALID;
+        }
+
+        if (ppInImg->picStruct != PP_PIC_FRAME_OR_TOP_FIELD &&
+           ppInImg->picStruct != PP_PIC_TOP_FIELD_FRAME)
+        {
+            if ((ppInImg->bufferBusAddrBot == 0) ||
+               (ppInImg->bufferBusAddrBot & address_mask))
+                return (i32) PP_SET_IN_ADDRESS_INVALID;
+
+            if ((ppInImg->pixFormat & PP_PIXEL_FORMAT_YUV420_MASK) &&
+               (ppInImg->bufferBusAddrChBot == 0 ||
+                (ppInImg->bufferBusAddrChBot & address_mask)))
+                return (i32) PP_SET_IN_ADDRESS_INVALID;
+        }
+    }
+
+    if (ppOutImg->bufferBusAddr == 0 || ppOutImg->bufferBusAddr & address_mask)
+        return (i32) PP_SET_OUT_ADDRESS_INVALID;
+
+    if (ppOutImg->pixFormat == PP_PIX_FMT_YCBCR_4_2_0_SEMIPLANAR &&
+       (ppOutImg->bufferChromaBusAddr == 0 ||
+        (ppOutImg->bufferChromaBusAddr & address_mask)))
+        return (i32) PP_SET_OUT_ADDRESS_INVALID;
+
+    return (i32) PP_OK;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPClearBufferAddresses
+    Description     : copy config without the per picture buffer addresses
+    Return type     : void
+    Argument        : PPConfig * dst
+    Argument        : const PPConfig * src
+------------------------------------------------------------------------------*/
+static void PPClearBufferAddresses(PPConfig * dst, const PPConfig * src)
+{
+    (void) DWLmemcpy(dst, src, sizeof(PPConfig));
+
+    dst->ppInImg.bufferBusAddr = 0;
+    dst->ppInImg.bufferCbBusAddr = 0;
+    dst->ppInImg.bufferCrBusAddr = 0;
+    dst->ppInImg.bufferBusAddrBot = 0;
+    dst->ppInImg.bufferBusAddrChBot = 0;
+    dst->ppOutImg.bufferBusAddr = 0;
+    dst->ppOutImg.bufferChromaBusAddr = 0;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPSetupMemoMatch
+    Description     : check if ppCfg needs the same setup as the memoized one.
+                      VC-1 rescales every picture in PPDecStartPp, so it
+                      always gets the full setup
+    Return type     : u32
+    Argument        : const PPContainer * ppC
+    Argument        : const PPConfig * ppCfg
+------------------------------------------------------------------------------*/
+u32 PPSetupMemoMatch(const PPContainer * ppC, const PPConfig * ppCfg)
+{
+    const PPSetupMemo *memo = &ppC->setupMemo;
+    PPConfig key;
+
+    if (!memo->valid ||
+       ppC->decType == PP_PIPELINED_DEC_TYPE_VC1 ||
+       memo->decType != ppC->decType ||
+       memo->fastVerticalDownscaleDisable !=
+       ppC->fastVerticalDownscaleDisable ||
+       memo->fastHorizontalDownscaleDisable !=
+       ppC->fastHorizontalDownscaleDisable)
+        return 0;
+
+    PPClearBufferAddresses(&key, ppCfg);
+
+    return memcmp(&key, &memo->key, sizeof(PPConfig)) == 0;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPSetupMemoStore
+    Description     : remember the result of a full setup of ppCfg
+    Return type     : void
+    Argument        : PPContainer * ppC
+    Argument        : const PPConfig * ppCfg, config as given by the user
+------------------------------------------------------------------------------*/
+void PPSetupMemoStore(PPContainer * ppC, const PPConfig * ppCfg)
+{
+    PPSetupMemo *memo = &ppC->setupMemo;
+
+    PPClearBufferAddresses(&memo->key, ppCfg);
+    PPClearBufferAddresses(&memo->cfg, &ppC->ppCfg);
+
+    memo->decType = ppC->decType;
+    memo->fastVerticalDownscaleDisable = ppC->fastVerticalDownscaleDisable;
+    memo->fastHorizontalDownscaleDisable = ppC->fastHorizontalDownscaleDisable;
+
+    (void) DWLmemcpy(memo->regs, ppC->ppRegs, sizeof(memo->regs));
+
+    memo->inWidth = ppC->inWidth;
+    memo->inHeight = ppC->inHeight;
+    memo->cVnorm = ppC->cVnorm;
+    memo->cVfast = ppC->cVfast;
+    memo->cHnorm = ppC->cHnorm;
+    memo->cHfast = ppC->cHfast;
+    memo->cHfast4x = ppC->cHfast4x;
+    memo->fastScaleMode = ppC->fastScaleMode;
+    memo->fastVerticalDownscale = ppC->fastVerticalDownscale;
+    memo->fastHorizontalDownscale = ppC->fastHorizontalDownscale;
+
+    memo->valid = 1;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPSetupMemoRestore
+    Description     : take the memoized setup in use for ppCfg, only buffer
+                      addresses are taken from ppCfg. The first register holds
+                      HW control bits, not setup, and is left alone
+    Return type     : void
+    Argument        : PPContainer * ppC
+    Argument        : const PPConfig * ppCfg
+------------------------------------------------------------------------------*/
+void PPSetupMemoRestore(PPContainer * ppC, const PPConfig * ppCfg)
+{
+    const PPSetupMemo *memo = &ppC->setupMemo;
+    PPConfig *cfg = &ppC->ppCfg;
+
+    (void) DWLmemcpy(cfg, &memo->cfg, sizeof(PPConfig));
+
+    cfg->ppInImg.bufferBusAddr = ppCfg->ppInImg.bufferBusAddr;
+    cfg->ppInImg.bufferCbBusAddr = ppCfg->ppInImg.bufferCbBusAddr;
+    cfg->ppInImg.bufferCrBusAddr = ppCfg->ppInImg.bufferCrBusAddr;
+    cfg->ppInImg.bufferBusAddrBot = ppCfg->ppInImg.bufferBusAddrBot;
+    cfg->ppInImg.bufferBusAddrChBot = ppCfg->ppInImg.bufferBusAddrChBot;
+    cfg->ppOutImg.bufferBusAddr = ppCfg->ppOutImg.bufferBusAddr;
+    cfg->ppOutImg.bufferChromaBusAddr = ppCfg->ppOutImg.bufferChromaBusAddr;
+
+    (void) DWLmemcpy(ppC->ppRegs + 1, memo->regs + 1,
+                     (PP_X170_REGISTERS - 1) * sizeof(u32));
+
+    ppC->inWidth = memo->inWidth;
+    ppC->inHeight = memo->inHeight;
+    ppC->cVnorm = memo->cVnorm;
+    ppC->cVfast = memo->cVfast;
+    ppC->cHnorm = memo->cHnorm;
+    ppC->cHfast = memo->cHfast;
+    ppC->cHfast4x = memo->cHfast4x;
+    ppC->fastScaleMode = memo->fastScaleMode;
+    ppC->fastVerticalDownscale = memo->fastVerticalDownscale;
+    ppC->fastHorizontalDownscale = memo->fastHorizontalDownscale;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPSetupMemoInvalidate
+    Description     : forget the memoized setup, e.g. when the pipeline
+                      mode changes
+    Return type     : void
+    Argument        : PPContainer * ppC
+------------------------------------------------------------------------------*/
+void PPSetupMemoInvalidate(PPContainer * ppC)
+{
+    ppC->setupMemo.valid = 0;
+}
+
+/*------------------------------------------------------------------------------
+    Function name   : PPTimeUs
+    Description     : monotonic time for instrumentation
+    Return type     : u32, wraps around
+------------------------------------------------------------------------------*/
+u32 PPTimeUs(void)
+{
+    struct timespec ts;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u32) ts.tv_sec * 1000000U + (u32) ts.tv_nsec / 1000U;
+}
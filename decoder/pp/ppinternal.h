@@ -27,6 +27,7 @@
 #include "ppapi.h"
 #include "basetype.h"
 #include "regdrv.h"
+#include "decppif.h"
 
 /*------------------------------------------------------------------------------
     2. Internal Definitions
@@ -39,9 +40,9 @@
  * regBase points to start of pp regs, setReg uses start of decoder regs */
 
 #define SetPpRegister(regBase,id,value)   /*lint -e(428)   */ \
-    SetDecRegister(regBase-(PP_X170_REG_START>>2),(u32)id,value)
+    SetDecRegister(regBase-(PP_X170_REG_START>>2),id,value)
 #define GetPpRegister(regBase,id)   /*lint -e(428)   */  \
-    GetDecRegister(regBase-(PP_X170_REG_START>>2),(u32)id)
+    GetDecRegister(regBase-(PP_X170_REG_START>>2),id)
 
 #define PP_OUT_MAX_WIDTH_D1     720
 #define PP_OUT_MIN_WIDTH    16
@@ -122,6 +123,34 @@ typedef struct BufferData_
     u32 setupID;
 } PPBufferData;
 
+/* PPSetConfig() memo: registers and state derived from the last fully set up
+ * config. Reused when a new config differs only in buffer addresses */
+typedef struct PPSetupMemo_
+{
+    u32 valid;
+    PPConfig key;            /* config as given, buffer addresses cleared */
+    PPConfig cfg;            /* config as set up, buffer addresses cleared */
+    u32 decType;
+    u32 fastVerticalDownscaleDisable;
+    u32 fastHorizontalDownscaleDisable;
+    u32 regs[PP_X170_REGISTERS];
+    u32 inWidth;
+    u32 inHeight;
+    u32 cVnorm;
+    u32 cVfast;
+    u32 cHnorm;
+    u32 cHfast;
+    u32 cHfast4x;
+    u32 fastScaleMode;
+    u32 fastVerticalDownscale;
+    u32 fastHorizontalDownscale;
+
+    /* setup time instrumentation */
+    u32 frames;
+    u32 hits;
+    u32 setupUs;
+} PPSetupMemo;
+
 typedef struct PPContainer_
 {
     u32 ppRegs[PP_X170_REGISTERS];
@@ -186,6 +215,16 @@ typedef struct PPContainer_
     u32 hwEndianVer;
     u32 tiledModeSupport;
     u32 jpeg16kSupport;
+    u32 cfgValid; /* ppCfg has passed PPCheckConfig */
+    PPSetupMemo setupMemo;
+
+    /* H264 multibuffer second output: a container of its own config and
+     * output buffers, run on each picture after this one. It shares dwl and
+     * decInst with this container and owns neither */
+    struct PPContainer_ *secondOut;
+    DecPpInterface secondDecPp; /* input picture of the pending run */
+    u32 secondPending;          /* this run going, second one to start */
+    u32 secondRunning;          /* second run started, not waited for */
 } PPContainer;
 
 /*------------------------------------------------------------------------------
@@ -202,13 +241,23 @@ void PPSetupScaling(PPContainer * ppC, const PPOutImage * ppOutImg);
 PPResult PPRun(PPContainer * ppC);
 void PPRefreshRegs(PPContainer * ppC);
 void PPFlushRegs(PPContainer * ppC);
+void PPFlushChangedRegs(PPContainer * ppC, u32 * hwRegs);
+void PPSetupBufferAddresses(PPContainer * ppC);
 
 u32 PPGetStatus(const PPContainer * ppC);
 void PPSetStatus(PPContainer * ppC, u32 status);
 
 i32 PPSelectOutputSize(PPContainer * ppC);
 PPResult WaitForPp(PPContainer * ppC);
+PPResult PPWaitHw(PPContainer * ppC);
 u32 PPCheckSetupChanges(PPConfig * prevCfg, PPConfig * newCfg);
+i32 PPCheckBufferAddresses(const PPConfig * ppCfg, u32 decLinked);
+
+u32 PPSetupMemoMatch(const PPContainer * ppC, const PPConfig * ppCfg);
+void PPSetupMemoStore(PPContainer * ppC, const PPConfig * ppCfg);
+void PPSetupMemoRestore(PPContainer * ppC, const PPConfig * ppCfg);
+void PPSetupMemoInvalidate(PPContainer * ppC);
+u32 PPTimeUs(void);
 void PPSetConfigIdData(PPContainer * ppC);
 
 #endif
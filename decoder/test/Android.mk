@@ -0,0 +1,267 @@
+LOCAL_PATH:= $(call my-dir)
+
+# Host checks of the software hot paths against the code they replaced,
+# run as out/host/<os>-x86/bin/g1dec_hot_paths_test [iterations]
+include $(CLEAR_VARS)
+
+common_src_dir := $(LOCAL_PATH)/..
+
+LOCAL_SRC_FILES := g1_hot_paths_test.c \
+		   regdrv_check.c \
+		   refbuffer_check.c \
+		   ../common/regdrv.c
+
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/ \
+		    $(common_src_dir)/inc \
+		    $(common_src_dir)/config \
+		    $(common_src_dir)/common
+
+LOCAL_CFLAGS := -Wall -Wextra
+
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_MODULE := g1dec_hot_paths_test
+
+include $(BUILD_HOST_EXECUTABLE)
+
+# Host check of the MPEG-4 data partitioned decoding over clips written by
+# the test, bit exact against checksums of the decoder output, run as
+# out/host/<os>-x86/bin/g1dec_mpeg4_dp_test [iterations]
+include $(CLEAR_VARS)
+
+common_src_dir := $(LOCAL_PATH)/..
+
+# mp4dechwd_rvlc.c and mp4dechwd_vlc.c are included by the test
+LOCAL_SRC_FILES := mpeg4_dp_test.c \
+		   ../mpeg4/mp4decapi.c \
+		   ../mpeg4/mp4dechwd_error_conceal.c \
+		   ../mpeg4/mp4dechwd_motiontexture.c \
+		   ../mpeg4/mp4dechwd_strmdec.c \
+		   ../mpeg4/mp4decapi_internal.c \
+		   ../mpeg4/mp4dechwd_utils.c \
+		   ../mpeg4/mp4dechwd_vop.c \
+		   ../mpeg4/mp4dechwd_headers.c \
+		   ../mpeg4/mp4dechwd_shortvideo.c \
+		   ../mpeg4/mp4dechwd_videopacket.c \
+		   ../mpeg4/mp4dechwd_custom.c \
+		   ../common/bqueue.c \
+		   ../common/refbuffer.c \
+		   ../common/regdrv.c \
+		   ../common/tiledref.c \
+		   ../common/workaround.c
+
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/ \
+		    $(common_src_dir)/inc \
+		    $(common_src_dir)/config \
+		    $(common_src_dir)/common \
+		    $(common_src_dir)/mpeg4 \
+		    $(common_src_dir)/dwl
+
+LOCAL_CFLAGS := -D_MP4_RLC_BUFFER_SIZE=384 -DANDROID_MOD
+
+LOCAL_SHARED_LIBRARIES := liblog
+
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_MODULE := g1dec_mpeg4_dp_test
+
+include $(BUILD_HOST_EXECUTABLE)
+
+# Host check of the H.264 DPB picture buffers allocated on demand, with
+# streams changing the number of reference frames and the memory running
+# out, run as out/host/<os>-x86/bin/g1dec_h264_dpb_test
+include $(CLEAR_VARS)
+
+common_src_dir := $(LOCAL_PATH)/..
+
+LOCAL_SRC_FILES := h264_dpb_test.c \
+		   ../h264high/h264hwd_dpb.c
+
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/ \
+		    $(common_src_dir)/inc \
+		    $(common_src_dir)/config \
+		    $(common_src_dir)/common \
+		    $(common_src_dir)/h264high \
+		    $(common_src_dir)/h264high/legacy
+
+LOCAL_CFLAGS := -D_ASSERT_USED
+
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_MODULE := g1dec_h264_dpb_test
+
+include $(BUILD_HOST_EXECUTABLE)
+
+# Host check of the DWLWaitHwReady time counted per thread, on the polling
+# DWL with the hardware faked by a thread writing the interrupt register,
+# run as out/host/<os>-x86/bin/g1dec_dwl_wait_test
+include $(CLEAR_VARS)
+
+common_src_dir := $(LOCAL_PATH)/..
+
+LOCAL_SRC_FILES := dwl_wait_test.c \
+		   ../dwl/dwl_linux.c \
+		   ../dwl/dwl_linux_lock.c \
+		   ../dwl/dwl_x170_linux_no_drv.c
+
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/ \
+		    $(common_src_dir)/inc \
+		    $(common_src_dir)/common \
+		    $(common_src_dir)/dwl
+
+LOCAL_CFLAGS := -DDEC_MODULE_PATH=\"/dev/hx170dec\" \
+		-DMEMALLOC_MODULE_PATH=\"/dev/memalloc\" \
+		-D_ASSERT_USED \
+		-Wno-unused-parameter
+
+LOCAL_LDLIBS := -lpthread
+
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_MODULE := g1dec_dwl_wait_test
+
+include $(BUILD_HOST_EXECUTABLE)
+
+# H.264 harnesses run on the board through the polling DWL. They share
+# h264_harness.c for the timing, stream loading and decoder set up. None of
+# them has been run on a board yet; their numbers are still to be taken.
+h264_harness_src_files := h264_harness.c \
+			  ../dwl/dwl_linux.c \
+			  ../dwl/dwl_linux_lock.c \
+			  ../dwl/dwl_x170_linux_no_drv.c
+
+h264_harness_c_includes := $(LOCAL_PATH)/ \
+			   $(LOCAL_PATH)/../inc \
+			   $(LOCAL_PATH)/../config \
+			   $(LOCAL_PATH)/../common \
+			   $(LOCAL_PATH)/../dwl \
+			   $(LOCAL_PATH)/../h264high
+
+h264_harness_cflags := -DDEC_MODULE_PATH=\"/dev/hx170dec\" \
+		       -DMEMALLOC_MODULE_PATH=\"/dev/memalloc\" \
+		       -DANDROID_MOD \
+		       -Wno-unused-parameter
+
+# H.264 output latency with and without H264DecSetLowLatency:
+#   g1dec_h264_latency <stream.h264> [lowlatency]
+include $(CLEAR_VARS)
+
+LOCAL_SRC_FILES := h264_latency.c $(h264_harness_src_files)
+LOCAL_C_INCLUDES := $(h264_harness_c_includes)
+LOCAL_CFLAGS := $(h264_harness_cflags)
+LOCAL_STATIC_LIBRARIES := libdecx170h264 libg1common
+LOCAL_SHARED_LIBRARIES := liblog
+LOCAL_MODULE_TAGS := optional
+LOCAL_MODULE := g1dec_h264_latency
+
+include $(BUILD_EXECUTABLE)
+
+# H.264 intra only decoding (skipNonIntra) checked bit exact against a full
+# decode, with the pictures per second of both:
+#   g1dec_h264_intra_only <stream.h264>
+include $(CLEAR_VARS)
+
+LOCAL_SRC_FILES := h264_intra_only.c $(h264_harness_src_files)
+LOCAL_C_INCLUDES := $(h264_harness_c_includes)
+LOCAL_CFLAGS := $(h264_harness_cflags)
+LOCAL_STATIC_LIBRARIES := libdecx170h264 libg1common
+LOCAL_SHARED_LIBRARIES := liblog
+LOCAL_MODULE_TAGS := optional
+LOCAL_MODULE := g1dec_h264_intra_only
+
+include $(BUILD_EXECUTABLE)
+
+# H.264 seek latency, decoding from the seek point against skipping to the
+# keyframe as the OMX video decoder does:
+#   g1dec_h264_seek <stream.h264> [seeks]
+include $(CLEAR_VARS)
+
+LOCAL_SRC_FILES := h264_seek.c $(h264_harness_src_files)
+LOCAL_C_INCLUDES := $(h264_harness_c_includes)
+LOCAL_CFLAGS := $(h264_harness_cflags)
+LOCAL_STATIC_LIBRARIES := libdecx170h264 libg1common
+LOCAL_SHARED_LIBRARIES := liblog
+LOCAL_MODULE_TAGS := optional
+LOCAL_MODULE := g1dec_h264_seek
+
+include $(BUILD_EXECUTABLE)
+
+# H.264 with the PP second output checked bit exact against single output
+# runs of both sizes. The PP is built in with H.264 pipeline support only:
+#   g1dec_h264_pp_second_output <stream.h264>
+include $(CLEAR_VARS)
+
+LOCAL_SRC_FILES := h264_pp_second_output.c \
+		   ../pp/ppapi.c \
+		   ../pp/ppinternal.c \
+		   $(h264_harness_src_files)
+LOCAL_C_INCLUDES := $(h264_harness_c_includes) \
+		    $(LOCAL_PATH)/../pp
+LOCAL_CFLAGS := $(h264_harness_cflags) \
+		-DPP_H264DEC_PIPELINE_SUPPORT
+LOCAL_STATIC_LIBRARIES := libdecx170h264 libg1common
+LOCAL_SHARED_LIBRARIES := liblog
+LOCAL_MODULE_TAGS := optional
+LOCAL_MODULE := g1dec_h264_pp_second_output
+
+include $(BUILD_EXECUTABLE)
+
+# Host variant of g1dec_h264_pp_second_output on the fake DWL of
+# dwl_fake_hw.c, decoding the clip written by the harness: checks the PP
+# setup of both outputs and their buffers, not the hardware scaler, run as
+# out/host/<os>-x86/bin/g1dec_h264_pp_second_output_test
+include $(CLEAR_VARS)
+
+LOCAL_SRC_FILES := h264_pp_second_output.c \
+		   h264_harness.c \
+		   dwl_fake_hw.c \
+		   ../pp/ppapi.c \
+		   ../pp/ppinternal.c \
+		   ../h264high/h264decapi.c \
+		   ../h264high/h264hwd_asic.c \
+		   ../h264high/h264hwd_cavlc.c \
+		   ../h264high/h264hwd_decoder.c \
+		   ../h264high/h264hwd_inter_prediction.c \
+		   ../h264high/h264hwd_macroblock_layer.c \
+		   ../h264high/h264hwd_storage.c \
+		   ../h264high/h264decapi_e.c \
+		   ../h264high/h264hwd_cabac.c \
+		   ../h264high/h264hwd_conceal.c \
+		   ../h264high/h264hwd_dpb.c \
+		   ../h264high/h264hwd_intra_prediction.c \
+		   ../h264high/h264hwd_slice_data.c \
+		   ../h264high/h264_pp_pipeline.c \
+		   ../h264high/legacy/h264hwd_byte_stream.c \
+		   ../h264high/legacy/h264hwd_neighbour.c \
+		   ../h264high/legacy/h264hwd_pic_param_set.c \
+		   ../h264high/legacy/h264hwd_slice_group_map.c \
+		   ../h264high/legacy/h264hwd_stream.c \
+		   ../h264high/legacy/h264hwd_vlc.c \
+		   ../h264high/legacy/h264hwd_nal_unit.c \
+		   ../h264high/legacy/h264hwd_pic_order_cnt.c \
+		   ../h264high/legacy/h264hwd_seq_param_set.c \
+		   ../h264high/legacy/h264hwd_slice_header.c \
+		   ../h264high/legacy/h264hwd_util.c \
+		   ../h264high/legacy/h264hwd_vui.c \
+		   ../common/bqueue.c \
+		   ../common/refbuffer.c \
+		   ../common/regdrv.c \
+		   ../common/tiledref.c \
+		   ../common/workaround.c
+
+LOCAL_C_INCLUDES := $(h264_harness_c_includes) \
+		    $(LOCAL_PATH)/../h264high/legacy \
+		    $(LOCAL_PATH)/../pp
+
+LOCAL_CFLAGS := -DPP_H264DEC_PIPELINE_SUPPORT \
+		-DANDROID_MOD \
+		-D_ASSERT_USED \
+		-Wno-unused-parameter
+
+LOCAL_SHARED_LIBRARIES := liblog
+
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_MODULE := g1dec_h264_pp_second_output_test
+
+include $(BUILD_HOST_EXECUTABLE)
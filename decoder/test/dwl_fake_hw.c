@@ -0,0 +1,310 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : DWL of the host variants of the harnesses. Memory comes from
+--             the heap, at bus addresses of its own. The hardware is faked
+--             when its interrupt is waited for, from the registers as they
+--             are then: the decoder fills the output picture with a pattern
+--             of the slice position in the stream and moves the stream
+--             address to the next start code, the PP scales its input by
+--             nearest neighbour, both 4:2:0 semi-planar only. Reserving a
+--             core that is reserved already hangs on the board; here it
+--             stops the test, as does the hardware touching memory outside
+--             the buffers.
+--
+------------------------------------------------------------------------------*/
+
+#include "basetype.h"
+#include "dwl.h"
+#include "regdrv.h"
+#include "ppinternal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FAKE_REGISTERS      128
+#define FAKE_BUFFERS        64
+#define FAKE_BUS_BASE       0x10000000
+
+typedef struct
+{
+    u32 clientType;
+} fakeDwl_t;
+
+static u32 regs[FAKE_REGISTERS];
+static DWLLinearMem_t buffers[FAKE_BUFFERS];
+static u32 nextBusAddress = FAKE_BUS_BASE;
+static u32 reserved[2];     /* decoder, PP */
+static u32 decStarted;
+static u32 ppStarted;
+
+static void Fail(const char *what, u32 value)
+{
+    printf("FAIL fake DWL: %s (0x%08x)\n", what, value);
+    exit(1);
+}
+
+/* memory of bus address bus, size bytes of it in a single buffer */
+static u8 *Memory(u32 bus, u32 size)
+{
+    u32 i;
+
+    for (i = 0; i < FAKE_BUFFERS; i++)
+    {
+        if (buffers[i].virtualAddress != NULL &&
+            bus >= buffers[i].busAddress &&
+            bus - buffers[i].busAddress + size <= buffers[i].size)
+            return (u8 *)buffers[i].virtualAddress +
+                (bus - buffers[i].busAddress);
+    }
+    Fail("hardware access outside the buffers", bus);
+    return NULL;
+}
+
+static void FakeDecode(void)
+{
+    u32 width = GetDecRegister(regs, HWIF_PIC_MB_WIDTH) * 16;
+    u32 height = GetDecRegister(regs, HWIF_PIC_MB_HEIGHT_P) * 16;
+    u32 strm = GetDecRegister(regs, HWIF_RLC_VLC_BASE) +
+        GetDecRegister(regs, HWIF_STRM_START_BIT) / 8;
+    u32 len = GetDecRegister(regs, HWIF_STREAM_LEN) -
+        GetDecRegister(regs, HWIF_STRM_START_BIT) / 8;
+    const u8 *p = Memory(strm, len);
+    u8 *out = Memory(GetDecRegister(regs, HWIF_DEC_OUT_BASE),
+                     width * height * 3 / 2);
+    u32 i;
+
+    for (i = 0; i < width * height * 3 / 2; i++)
+        out[i] = (u8)(strm * 31 + i * 7 + (i / width) * 3);
+
+    /* one slice per picture: the hardware stops at the next start code */
+    for (i = 3; i + 3 <= len; i++)
+        if (p[i] == 0 && p[i + 1] == 0 && p[i + 2] == 1)
+            break;
+    SetDecRegister(regs, HWIF_RLC_VLC_BASE, strm + (i + 3 <= len ? i : len));
+}
+
+static void FakePp(u32 inLuma, u32 inChroma)
+{
+    u32 inWidth = GetDecRegister(regs, HWIF_PP_IN_WIDTH) * 16;
+    u32 inHeight = GetDecRegister(regs, HWIF_PP_IN_HEIGHT) * 16;
+    u32 outWidth = GetDecRegister(regs, HWIF_PP_OUT_WIDTH);
+    u32 outHeight = GetDecRegister(regs, HWIF_PP_OUT_HEIGHT);
+    const u8 *inY, *inC;
+    u8 *outY, *outC;
+    u32 x, y;
+
+    if (GetDecRegister(regs, HWIF_PP_IN_FORMAT) !=
+        PP_ASIC_IN_FORMAT_420_SEMIPLANAR ||
+        GetDecRegister(regs, HWIF_PP_OUT_FORMAT) != PP_ASIC_OUT_FORMAT_420)
+        Fail("PP format not faked", GetDecRegister(regs, HWIF_PP_IN_FORMAT));
+    if (!inWidth || !inHeight || !outWidth || !outHeight)
+        Fail("PP picture size 0", outWidth);
+
+    inY = Memory(inLuma, inWidth * inHeight);
+    inC = Memory(inChroma, inWidth * inHeight / 2);
+    outY = Memory(GetDecRegister(regs, HWIF_PP_OUT_LU_BASE),
+                  outWidth * outHeight);
+    outC = Memory(GetDecRegister(regs, HWIF_PP_OUT_CH_BASE),
+                  outWidth * outHeight / 2);
+
+    for (y = 0; y < outHeight; y++)
+        for (x = 0; x < outWidth; x++)
+            outY[y * outWidth + x] =
+                inY[(y * inHeight / outHeight) * inWidth +
+                    x * inWidth / outWidth];
+    for (y = 0; y < outHeight / 2; y++)
+        for (x = 0; x < outWidth; x++)
+            outC[y * outWidth + x] =
+                inC[(y * inHeight / outHeight) * inWidth +
+                    (x / 2 * inWidth / outWidth) * 2 + (x & 1)];
+}
+
+u32 DWLReadAsicID(void)
+{
+    return 0x81901000;
+}
+
+void DWLReadAsicConfig(DWLHwConfig_t * pHwCfg)
+{
+    memset(pHwCfg, 0, sizeof(*pHwCfg));
+    pHwCfg->maxDecPicWidth = 1920;
+    pHwCfg->maxPpOutPicWidth = 1920;
+    pHwCfg->h264Support = H264_HIGH_PROFILE;
+    pHwCfg->ppSupport = PP_SUPPORTED;
+    pHwCfg->ppConfig = PP_SCALING;
+}
+
+const void *DWLInit(DWLInitParam_t * param)
+{
+    fakeDwl_t *dwl = (fakeDwl_t *)calloc(1, sizeof(fakeDwl_t));
+
+    if (dwl != NULL)
+        dwl->clientType = param->clientType;
+    return dwl;
+}
+
+i32 DWLRelease(const void *instance)
+{
+    free((void *)instance);
+    return DWL_OK;
+}
+
+i32 DWLReserveHw(const void *instance)
+{
+    u32 pp = ((const fakeDwl_t *)instance)->clientType == DWL_CLIENT_TYPE_PP;
+
+    if (reserved[pp])
+        Fail(pp ? "PP reserved twice" : "decoder reserved twice", 0);
+    reserved[pp] = 1;
+    return DWL_OK;
+}
+
+void DWLReleaseHw(const void *instance)
+{
+    u32 pp = ((const fakeDwl_t *)instance)->clientType == DWL_CLIENT_TYPE_PP;
+
+    reserved[pp] = 0;
+}
+
+i32 DWLMallocLinear(const void *instance, u32 size, DWLLinearMem_t * info)
+{
+    u32 i;
+
+    (void)instance;
+    for (i = 0; i < FAKE_BUFFERS && buffers[i].virtualAddress; i++)
+        ;
+    if (i == FAKE_BUFFERS)
+        return DWL_ERROR;
+    info->virtualAddress = (u32 *)calloc(1, size);
+    if (info->virtualAddress == NULL)
+        return DWL_ERROR;
+    info->busAddress = nextBusAddress;
+    info->size = size;
+    nextBusAddress += (size + 0xFFF) & ~0xFFF;
+    buffers[i] = *info;
+    return DWL_OK;
+}
+
+void DWLFreeLinear(const void *instance, DWLLinearMem_t * info)
+{
+    u32 i;
+
+    (void)instance;
+    for (i = 0; i < FAKE_BUFFERS; i++)
+        if (buffers[i].virtualAddress == info->virtualAddress)
+            buffers[i].virtualAddress = NULL;
+    free(info->virtualAddress);
+}
+
+i32 DWLMallocRefFrm(const void *instance, u32 size, DWLLinearMem_t * info)
+{
+    return DWLMallocLinear(instance, size, info);
+}
+
+void DWLFreeRefFrm(const void *instance, DWLLinearMem_t * info)
+{
+    DWLFreeLinear(instance, info);
+}
+
+void DWLWriteReg(const void *instance, u32 offset, u32 value)
+{
+    (void)instance;
+    regs[offset / 4] = value;
+}
+
+u32 DWLReadReg(const void *instance, u32 offset)
+{
+    (void)instance;
+    return regs[offset / 4];
+}
+
+void DWLEnableHW(const void *instance, u32 offset, u32 value)
+{
+    (void)instance;
+    regs[offset / 4] = value;
+    if (offset == PP_X170_REG_START)
+        ppStarted |= GetDecRegister(regs, HWIF_PP_E);
+    else
+        decStarted |= GetDecRegister(regs, HWIF_DEC_E);
+}
+
+void DWLDisableHW(const void *instance, u32 offset, u32 value)
+{
+    (void)instance;
+    regs[offset / 4] = value;
+}
+
+i32 DWLWaitHwReady(const void *instance, u32 timeout)
+{
+    (void)timeout;
+    if (((const fakeDwl_t *)instance)->clientType == DWL_CLIENT_TYPE_PP)
+    {
+        if (!ppStarted)
+            return DWL_HW_WAIT_TIMEOUT;
+        ppStarted = 0;
+        FakePp(GetDecRegister(regs, HWIF_PP_IN_LU_BASE),
+               GetDecRegister(regs, HWIF_PP_IN_CB_BASE));
+        SetDecRegister(regs, HWIF_PP_E, 0);
+        SetDecRegister(regs, HWIF_PP_IRQ, 1);
+        SetDecRegister(regs, HWIF_PP_IRQ_STAT, DEC_8170_IRQ_RDY);
+    }
+    else
+    {
+        if (!decStarted)
+            return DWL_HW_WAIT_TIMEOUT;
+        decStarted = 0;
+        FakeDecode();
+        /* pipelined PP: its input is the picture being decoded */
+        if (GetDecRegister(regs, HWIF_PP_PIPELINE_E))
+        {
+            u32 out = GetDecRegister(regs, HWIF_DEC_OUT_BASE);
+            u32 size = GetDecRegister(regs, HWIF_PIC_MB_WIDTH) *
+                GetDecRegister(regs, HWIF_PIC_MB_HEIGHT_P) * 256;
+
+            FakePp(out, out + size);
+        }
+        SetDecRegister(regs, HWIF_DEC_E, 0);
+        SetDecRegister(regs, HWIF_DEC_IRQ, 1);
+        SetDecRegister(regs, HWIF_DEC_IRQ_STAT, DEC_8170_IRQ_RDY);
+    }
+    return DWL_HW_WAIT_OK;
+}
+
+void *DWLmalloc(u32 n)
+{
+    return malloc(n);
+}
+
+void DWLfree(void *p)
+{
+    free(p);
+}
+
+void *DWLcalloc(u32 n, u32 s)
+{
+    return calloc(n, s);
+}
+
+void *DWLmemcpy(void *d, const void *s, u32 n)
+{
+    return memcpy(d, s, n);
+}
+
+void *DWLmemset(void *d, i32 c, u32 n)
+{
+    return memset(d, c, n);
+}
@@ -0,0 +1,161 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : Host check of the DWLWaitHwReady time kept by DWLGetWaitStats.
+--             The polling DWL waits on a register array in memory; another
+--             thread raises the picture ready interrupt bit after a known
+--             delay, as the hardware would. The time counted must be the
+--             time spent in the call, at least the delay, and only for the
+--             thread that waited.
+--
+--  Usage    : g1dec_dwl_wait_test
+--
+------------------------------------------------------------------------------*/
+
+#include "basetype.h"
+#include "dwl.h"
+#include "dwl_linux.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* time of the call itself besides the wait: clock reads and bookkeeping */
+#define TEST_CALL_OVERHEAD_US   500
+
+typedef struct
+{
+    hX170dwl_t dwl;
+    u32 regs[128];
+    u32 delayUs;
+} fakeHw_t;
+
+static u32 TimeUs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u32)now.tv_sec * 1000000 + (u32)now.tv_nsec / 1000;
+}
+
+/* the hardware: decoder interrupt after the delay */
+static void *RunHw(void *arg)
+{
+    fakeHw_t *hw = (fakeHw_t *)arg;
+
+    if (hw->delayUs)
+        usleep(hw->delayUs);
+    hw->dwl.pRegBase[HX170DEC_REG_START / 4] |= DWL_HW_PIC_RDY_BIT;
+    return NULL;
+}
+
+/* one hardware run; returns the failures, the call time in *pCallUs and the
+ * time counted in *pWaitUs */
+static u32 WaitOnce(fakeHw_t *hw, u32 delayUs, u32 *pCallUs, u32 *pWaitUs)
+{
+    DWLWaitStats_t before, after;
+    pthread_t thread;
+    u32 start;
+    i32 ret;
+
+    memset(hw->regs, 0, sizeof(hw->regs));
+    hw->delayUs = delayUs;
+
+    DWLGetWaitStats(&before);
+    if (pthread_create(&thread, NULL, RunHw, hw) != 0)
+    {
+        printf("FAIL cannot start the hardware thread\n");
+        return 1;
+    }
+    start = TimeUs();
+    ret = DWLWaitHwReady(&hw->dwl, (u32)(-1));
+    *pCallUs = TimeUs() - start;
+    DWLGetWaitStats(&after);
+    (void)pthread_join(thread, NULL);
+
+    *pWaitUs = after.waitUs - before.waitUs;
+
+    if (ret != DWL_HW_WAIT_OK)
+    {
+        printf("FAIL wait of %u us returned %d\n", delayUs, ret);
+        return 1;
+    }
+    if (after.waits - before.waits != 1)
+    {
+        printf("FAIL wait of %u us counted %u times\n", delayUs,
+               after.waits - before.waits);
+        return 1;
+    }
+    return 0;
+}
+
+static void *WaitInThread(void *arg)
+{
+    u32 callUs, waitUs;
+
+    (void)WaitOnce((fakeHw_t *)arg, 10000, &callUs, &waitUs);
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    static const u32 delays[] = { 0, 2000, 10000, 40000 };
+    const u32 numDelays = sizeof(delays) / sizeof(delays[0]);
+    fakeHw_t hw;
+    DWLWaitStats_t before, after;
+    pthread_t thread;
+    u32 failures = 0;
+    u32 i;
+
+    memset(&hw, 0, sizeof(hw));
+    hw.dwl.clientType = DWL_CLIENT_TYPE_H264_DEC;
+    hw.dwl.pRegBase = hw.regs;
+    hw.dwl.regSize = sizeof(hw.regs);
+
+    for (i = 0; i < numDelays; i++)
+    {
+        u32 callUs = 0, waitUs = 0;
+
+        failures += WaitOnce(&hw, delays[i], &callUs, &waitUs);
+
+        /* counted: the call, which ends after the hardware is done */
+        if (waitUs > callUs || waitUs + TEST_CALL_OVERHEAD_US < callUs ||
+            waitUs + TEST_CALL_OVERHEAD_US < delays[i])
+        {
+            printf("FAIL hardware done after %u us: %u us counted, call took "
+                   "%u us\n", delays[i], waitUs, callUs);
+            failures++;
+        }
+        printf("hardware done after %5u us: %5u us counted, call %5u us\n",
+               delays[i], waitUs, callUs);
+    }
+
+    /* another thread's wait is not this thread's time */
+    DWLGetWaitStats(&before);
+    if (pthread_create(&thread, NULL, WaitInThread, &hw) == 0)
+        (void)pthread_join(thread, NULL);
+    DWLGetWaitStats(&after);
+    if (after.waits != before.waits || after.waitUs != before.waitUs)
+    {
+        printf("FAIL wait of another thread counted\n");
+        failures++;
+    }
+
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+
+    return failures ? 1 : 0;
+}
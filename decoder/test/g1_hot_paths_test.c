@@ -0,0 +1,69 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : Host checks of the software hot paths against the code they
+--             replaced: register field access through the generated field
+--             constants and direct MV statistics. Each check compares the
+--             results and prints the time taken by the old and the new code.
+--
+--  Usage    : g1dec_hot_paths_test [iterations]
+--
+------------------------------------------------------------------------------*/
+
+#include "basetype.h"
+
+#include "hot_paths_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*------------------------------------------------------------------------------
+    Helpers
+------------------------------------------------------------------------------*/
+
+/* microseconds of CLOCK_MONOTONIC, wrapping; only differences are used */
+u32 TestTimeUs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u32)ts.tv_sec * 1000000U + (u32)(ts.tv_nsec / 1000);
+}
+
+u32 TestRandom(void)
+{
+    static u32 seed = 12345;
+
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) | (seed << 16);
+}
+
+/*------------------------------------------------------------------------------
+    main
+------------------------------------------------------------------------------*/
+
+int main(int argc, char **argv)
+{
+    u32 iterations = argc > 1 ? (u32)atoi(argv[1]) : 200;
+    u32 failures = 0;
+
+    failures += RegdrvCheck(iterations);
+    failures += DirectMvCheck(iterations);
+
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,331 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : Host check of the H.264 DPB picture buffers allocated on
+--             demand. Runs the DPB of the decoder through IPBB streams whose
+--             number of reference frames changes between sequences, with
+--             the memory of the DWL running out part of the time. Every
+--             picture gets its id written in its buffer; a reference or a
+--             picture waiting for output that gets overwritten by a later
+--             picture, or a picture given a buffer without memory, fails.
+--
+--  Usage    : g1dec_h264_dpb_test
+--
+------------------------------------------------------------------------------*/
+
+#include "basetype.h"
+#include "dwl.h"
+#include "h264hwd_dpb.h"
+#include "h264hwd_util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_PIC_SIZE_IN_MBS    16
+#define TEST_MAX_FRAME_NUM      16
+
+typedef struct
+{
+    u32 dpbSize;
+    u32 numRefFrames;
+    u32 numPics;
+    u32 bFrames;        /* non-reference pictures between references */
+} testSeq_t;
+
+static u32 allocCount;
+static u32 allocFailFrom;      /* allocations from this one on fail */
+static u32 allocFailTo;
+static u32 busAddress = 0x10000000;
+
+/*------------------------------------------------------------------------------
+    DWL of the host: picture buffers from the heap, failing on request
+------------------------------------------------------------------------------*/
+
+i32 DWLMallocRefFrm(const void *instance, u32 size, DWLLinearMem_t * info)
+{
+    u32 n = allocCount++;
+
+    if (n >= allocFailFrom && n < allocFailTo)
+        return DWL_ERROR;
+
+    info->virtualAddress = (u32 *)malloc(size);
+    if (info->virtualAddress == NULL)
+        return DWL_ERROR;
+    info->busAddress = busAddress;
+    info->size = size;
+    busAddress += (size + 0xFFF) & ~0xFFF;
+    return DWL_OK;
+}
+
+void DWLFreeRefFrm(const void *instance, DWLLinearMem_t * info)
+{
+    free(info->virtualAddress);
+    info->virtualAddress = NULL;
+}
+
+void *DWLmalloc(u32 n)
+{
+    return malloc(n);
+}
+
+void DWLfree(void *p)
+{
+    free(p);
+}
+
+void *DWLmemset(void *d, i32 c, u32 n)
+{
+    return memset(d, c, n);
+}
+
+/*------------------------------------------------------------------------------
+    Checks
+------------------------------------------------------------------------------*/
+
+static u32 IsReference(const dpbPicture_t * pic)
+{
+    u32 i;
+
+    for (i = 0; i < 2; i++)
+        if (pic->status[i] == SHORT_TERM || pic->status[i] == LONG_TERM)
+            return HANTRO_TRUE;
+    return HANTRO_FALSE;
+}
+
+/* pictures the DPB still needs must have their id in their buffer */
+static u32 CheckHeldPictures(const dpbStorage_t * dpb)
+{
+    u32 failures = 0;
+    u32 i;
+
+    for (i = 0; i <= dpb->dpbSize; i++)
+    {
+        const dpbPicture_t *pic = &dpb->buffer[i];
+
+        if (pic == dpb->currentOut || pic->data == NULL ||
+            !(pic->toBeDisplayed || IsReference(pic)))
+            continue;
+
+        if (pic->data->virtualAddress == NULL ||
+            pic->data->virtualAddress[0] != pic->picId)
+        {
+            printf("FAIL picture %u in DPB slot %u overwritten\n",
+                   pic->picId, i);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+/* output pictures must be in display order and intact */
+static u32 DrainOutput(dpbStorage_t * dpb, i32 * lastPoc, u32 * numOut)
+{
+    dpbOutPicture_t *out;
+    u32 failures = 0;
+
+    while ((out = h264bsdDpbOutputPicture(dpb)) != NULL)
+    {
+        i32 poc = (i32)out->data->virtualAddress[1];
+
+        if (out->data->virtualAddress[0] != out->picId)
+        {
+            printf("FAIL output picture %u overwritten\n", out->picId);
+            failures++;
+        }
+        else if (!out->isIdr && poc < *lastPoc)
+        {
+            printf("FAIL output picture %u out of display order\n",
+                   out->picId);
+            failures++;
+        }
+        *lastPoc = poc;
+        (*numOut)++;
+    }
+    return failures;
+}
+
+/* Decodes the sequences one after the other, each starting with an IDR
+ * picture and reconfiguring the DPB as a new SPS would. Returns the number
+ * of failures, counts the pictures the DPB could not get memory for. */
+static u32 RunStream(const testSeq_t * seqs, u32 numSeqs, u32 * numNoMem)
+{
+    dpbStorage_t *dpb = (dpbStorage_t *)calloc(1, sizeof(dpbStorage_t));
+    decRefPicMarking_t mark;
+    u32 failures = 0;
+    u32 picId = 0;
+    u32 numOut = 0;
+    u32 numDecoded = 0;
+    i32 lastPoc = 0;
+    u32 s, n;
+
+    memset(&mark, 0, sizeof(mark));
+
+    for (s = 0; s < numSeqs; s++)
+    {
+        const testSeq_t *seq = &seqs[s];
+        u32 frameNum = 0;
+        u32 ret;
+
+        if (s == 0)
+            ret = h264bsdInitDpb(NULL, dpb, TEST_PIC_SIZE_IN_MBS,
+                                 seq->dpbSize, seq->numRefFrames,
+                                 TEST_MAX_FRAME_NUM, 0, 0, 0, 1, 0, 0);
+        else
+        {
+            /* new SPS of the same picture size, as h264bsdActivateParamSets */
+            h264bsdFlushDpb(dpb);
+            failures += DrainOutput(dpb, &lastPoc, &numOut);
+            ret = h264bsdResetDpb(NULL, dpb, TEST_PIC_SIZE_IN_MBS,
+                                  seq->dpbSize, seq->numRefFrames,
+                                  TEST_MAX_FRAME_NUM, 0, 0, 0, 1, 0, 0);
+        }
+        if (ret != HANTRO_OK)
+        {
+            /* the decoder gives H264DEC_MEMFAIL, nothing to check */
+            (*numNoMem)++;
+            h264bsdFreeDpb(NULL, dpb);
+            memset(dpb, 0, sizeof(dpbStorage_t));
+            continue;
+        }
+
+        /* buffers of the reference frames are allocated up front */
+        if (dpb->numAllocated < MIN(dpb->totBuffers, dpb->maxRefFrames + 1))
+        {
+            printf("FAIL sequence %u: %u buffers for %u reference frames\n",
+                   s, dpb->numAllocated, dpb->maxRefFrames);
+            failures++;
+        }
+
+        for (n = 0; n < seq->numPics; n++)
+        {
+            /* I P B B P B B ..: a B picture is shown before the reference
+             * decoded just before it */
+            u32 group = seq->bFrames + 1;
+            u32 isIdr = n == 0;
+            u32 isRef = isIdr || (n - 1) % group == 0;
+            i32 poc[2];
+            image_t image;
+
+            poc[0] = poc[1] = isIdr ? 0 :
+                isRef ? (i32)(2 * (n + seq->bFrames)) : (i32)(2 * (n - 1));
+
+            memset(&image, 0, sizeof(image));
+            image.picStruct = FRAME;
+            image.data = (DWLLinearMem_t *)h264bsdAllocateDpbImage(dpb);
+            if (image.data == NULL)
+            {
+                /* H264DEC_MEMFAIL, the picture is not decoded */
+                (*numNoMem)++;
+                failures += CheckHeldPictures(dpb);
+                continue;
+            }
+            if (image.data->virtualAddress == NULL)
+            {
+                printf("FAIL picture %u given a buffer without memory\n",
+                       picId);
+                failures++;
+                break;
+            }
+
+            /* "decode" */
+            image.data->virtualAddress[0] = picId;
+            image.data->virtualAddress[1] = (u32)poc[0];
+            failures += CheckHeldPictures(dpb);
+
+            if (isIdr)
+                lastPoc = -1;
+            ret = h264bsdMarkDecRefPic(dpb, isRef ? &mark : NULL, &image,
+                                       frameNum, poc, isIdr,
+                                       picId, 0, 0);
+            if (ret != HANTRO_OK)
+            {
+                printf("FAIL picture %u not marked\n", picId);
+                failures++;
+            }
+            h264DpbUpdateOutputList(dpb, &image);
+            failures += DrainOutput(dpb, &lastPoc, &numOut);
+
+            if (isRef)
+                frameNum = (frameNum + 1) % TEST_MAX_FRAME_NUM;
+            picId++;
+            numDecoded++;
+        }
+    }
+
+    h264bsdFlushDpb(dpb);
+    failures += DrainOutput(dpb, &lastPoc, &numOut);
+    if (numOut != numDecoded)
+    {
+        printf("FAIL %u pictures decoded, %u output\n", numDecoded, numOut);
+        failures++;
+    }
+
+    h264bsdFreeDpb(NULL, dpb);
+    free(dpb);
+
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    /* reference frames up within the same DPB size (DPB kept), then down
+     * with a smaller DPB (DPB reallocated), then up again. The first
+     * sequence is too short to have the DPB grow. */
+    static const testSeq_t seqs[] = {
+        { 5, 1, 2, 0 },
+        { 5, 4, 40, 2 },
+        { 3, 2, 40, 1 },
+        { 6, 5, 40, 3 }
+    };
+    const u32 numSeqs = sizeof(seqs) / sizeof(seqs[0]);
+    u32 failures = 0;
+    u32 numNoMem = 0;
+    u32 numAllocs;
+
+    /* plenty of memory */
+    allocCount = 0;
+    allocFailFrom = allocFailTo = ~0U;
+    failures += RunStream(seqs, numSeqs, &numNoMem);
+    if (numNoMem)
+    {
+        printf("FAIL %u pictures without memory\n", numNoMem);
+        failures++;
+    }
+    numAllocs = allocCount;
+    printf("%u picture buffer allocations\n", numAllocs);
+
+    /* memory running out at every point of the stream in turn, for a
+     * while */
+    for (allocFailFrom = 1; allocFailFrom < numAllocs; allocFailFrom++)
+    {
+        u32 noMem = 0;
+
+        allocCount = 0;
+        allocFailTo = allocFailFrom + 3;
+        failures += RunStream(seqs, numSeqs, &noMem);
+        numNoMem += noMem;
+    }
+    printf("%u pictures or sequences without memory\n", numNoMem);
+    if (!numNoMem)
+    {
+        printf("FAIL allocation failures not seen\n");
+        failures++;
+    }
+
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,292 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : Helpers shared by the H.264 harnesses
+--
+------------------------------------------------------------------------------*/
+
+#include "h264_harness.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CLIP_MB_WIDTH   (HARNESS_CLIP_WIDTH / 16)
+#define CLIP_MBS        (CLIP_MB_WIDTH * (HARNESS_CLIP_HEIGHT / 16))
+#define CLIP_GOP        6
+#define CLIP_REF_FRAMES 4
+#define CLIP_IDRS       ((HARNESS_CLIP_PICTURES + CLIP_GOP - 1) / CLIP_GOP)
+#define CLIP_SIZE       (CLIP_IDRS * CLIP_MBS * 400 + HARNESS_CLIP_PICTURES * 64)
+
+typedef struct
+{
+    u8 *data;
+    u32 bits;
+} bitWriter_t;
+
+static void PutBits(bitWriter_t *w, u32 value, u32 n)
+{
+    while (n--)
+    {
+        if (!(w->bits & 7))
+            w->data[w->bits / 8] = 0;
+        if ((value >> n) & 1)
+            w->data[w->bits / 8] |= 0x80 >> (w->bits & 7);
+        w->bits++;
+    }
+}
+
+/* ue(v) */
+static void PutUe(bitWriter_t *w, u32 value)
+{
+    u32 len = 0;
+
+    while ((value + 1) >> (len + 1))
+        len++;
+    PutBits(w, 0, len);
+    PutBits(w, value + 1, len + 1);
+}
+
+/* rbsp_trailing_bits */
+static void PutTrailing(bitWriter_t *w)
+{
+    PutBits(w, 1, 1);
+    while (w->bits & 7)
+        PutBits(w, 0, 1);
+}
+
+/* start code and the NAL unit of the rbsp in w, with emulation prevention */
+static u32 PutNal(u8 *p, u32 nalHeader, const bitWriter_t *w)
+{
+    u32 len = 0, zeros = 0;
+    u32 i;
+
+    p[len++] = 0;
+    p[len++] = 0;
+    p[len++] = 1;
+    p[len++] = (u8)nalHeader;
+    for (i = 0; i < w->bits / 8; i++)
+    {
+        if (zeros == 2 && w->data[i] <= 3)
+        {
+            p[len++] = 3;
+            zeros = 0;
+        }
+        zeros = w->data[i] ? 0 : zeros + 1;
+        p[len++] = w->data[i];
+    }
+    return len;
+}
+
+u32 HarnessTimeUs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u32)ts.tv_sec * 1000000U + (u32)(ts.tv_nsec / 1000);
+}
+
+u32 HarnessHash(const u8 *p, u32 size)
+{
+    u32 h = 2166136261U;
+    u32 i;
+
+    for (i = 0; i < size; i++)
+        h = (h ^ p[i]) * 16777619U;
+    return h;
+}
+
+i32 HarnessLoadStream(const char *file, harnessStream_t *pStream)
+{
+    DWLInitParam_t dwlInit;
+    FILE *fid;
+    long size;
+
+    memset(pStream, 0, sizeof(harnessStream_t));
+
+    fid = fopen(file, "rb");
+    if (fid == NULL)
+    {
+        printf("cannot open %s\n", file);
+        return -1;
+    }
+    fseek(fid, 0, SEEK_END);
+    size = ftell(fid);
+    rewind(fid);
+
+    dwlInit.clientType = DWL_CLIENT_TYPE_H264_DEC;
+    pStream->dwl = DWLInit(&dwlInit);
+    if (pStream->dwl == NULL || size <= 0 ||
+        DWLMallocLinear(pStream->dwl, (u32)size, &pStream->mem) != DWL_OK)
+    {
+        printf("cannot set up the decoder input\n");
+        fclose(fid);
+        return -1;
+    }
+    if (fread(pStream->mem.virtualAddress, 1, (size_t)size, fid) !=
+        (size_t)size)
+    {
+        printf("cannot read %s\n", file);
+        fclose(fid);
+        return -1;
+    }
+    fclose(fid);
+
+    pStream->size = (u32)size;
+    return 0;
+}
+
+i32 HarnessWriteClip(harnessStream_t *pStream)
+{
+    DWLInitParam_t dwlInit;
+    bitWriter_t w;
+    u8 *p;
+    u32 n, mb, i;
+
+    memset(pStream, 0, sizeof(harnessStream_t));
+
+    dwlInit.clientType = DWL_CLIENT_TYPE_H264_DEC;
+    pStream->dwl = DWLInit(&dwlInit);
+    w.data = (u8 *)malloc(CLIP_SIZE);
+    if (pStream->dwl == NULL || w.data == NULL ||
+        DWLMallocLinear(pStream->dwl, CLIP_SIZE, &pStream->mem) != DWL_OK)
+    {
+        printf("cannot set up the decoder input\n");
+        free(w.data);
+        return -1;
+    }
+    p = (u8 *)pStream->mem.virtualAddress;
+
+    /* SPS: baseline, POC in the slices and no VUI, so the decoder holds
+     * the pictures until its DPB is full or an IDR flushes it and goes round
+     * its picture buffers */
+    w.bits = 0;
+    PutBits(&w, 66, 8);                 /* profile_idc */
+    PutBits(&w, 0, 8);                  /* constraint flags */
+    PutBits(&w, 30, 8);                 /* level_idc */
+    PutUe(&w, 0);                       /* seq_parameter_set_id */
+    PutUe(&w, 0);                       /* log2_max_frame_num_minus4 */
+    PutUe(&w, 0);                       /* pic_order_cnt_type */
+    PutUe(&w, 0);                       /* log2_max_pic_order_cnt_lsb_minus4 */
+    PutUe(&w, CLIP_REF_FRAMES);         /* num_ref_frames */
+    PutBits(&w, 0, 1);                  /* gaps_in_frame_num_allowed */
+    PutUe(&w, CLIP_MB_WIDTH - 1);
+    PutUe(&w, HARNESS_CLIP_HEIGHT / 16 - 1);
+    PutBits(&w, 1, 1);                  /* frame_mbs_only */
+    PutBits(&w, 1, 1);                  /* direct_8x8_inference */
+    PutBits(&w, 0, 1);                  /* frame_cropping */
+    PutBits(&w, 0, 1);                  /* vui_parameters_present */
+    PutTrailing(&w);
+    pStream->size += PutNal(p + pStream->size, 0x67, &w);
+
+    /* PPS: CAVLC, everything else off */
+    w.bits = 0;
+    PutUe(&w, 0);                       /* pic_parameter_set_id */
+    PutUe(&w, 0);                       /* seq_parameter_set_id */
+    PutBits(&w, 0, 1);                  /* entropy_coding_mode */
+    PutBits(&w, 0, 1);                  /* pic_order_present */
+    PutUe(&w, 0);                       /* num_slice_groups_minus1 */
+    PutUe(&w, 0);                       /* num_ref_idx_l0_active_minus1 */
+    PutUe(&w, 0);                       /* num_ref_idx_l1_active_minus1 */
+    PutBits(&w, 0, 3);                  /* weighted prediction */
+    PutUe(&w, 0);                       /* pic_init_qp_minus26 */
+    PutUe(&w, 0);                       /* pic_init_qs_minus26 */
+    PutUe(&w, 0);                       /* chroma_qp_index_offset */
+    PutBits(&w, 0, 3);                  /* deblocking control, constrained
+                                         * intra, redundant_pic_cnt */
+    PutTrailing(&w);
+    pStream->size += PutNal(p + pStream->size, 0x68, &w);
+
+    for (n = 0; n < HARNESS_CLIP_PICTURES; n++)
+    {
+        u32 idr = !(n % CLIP_GOP);
+
+        w.bits = 0;
+        PutUe(&w, 0);                   /* first_mb_in_slice */
+        PutUe(&w, idr ? 7 : 5);         /* I or P, whole picture */
+        PutUe(&w, 0);                   /* pic_parameter_set_id */
+        PutBits(&w, n % CLIP_GOP, 4);   /* frame_num */
+        if (idr)
+            PutUe(&w, (n / CLIP_GOP) & 1);  /* idr_pic_id */
+        PutBits(&w, 2 * (n % CLIP_GOP), 4); /* pic_order_cnt_lsb */
+        if (idr)
+        {
+            PutBits(&w, 0, 2);          /* no_output_of_prior_pics,
+                                         * long_term_reference */
+        }
+        else
+        {
+            PutBits(&w, 0, 3);          /* num_ref_idx_override,
+                                         * reordering, adaptive marking */
+        }
+        PutUe(&w, 0);                   /* slice_qp_delta */
+
+        if (idr)
+        {
+            /* I_PCM macroblocks, samples never 0 */
+            for (mb = 0; mb < CLIP_MBS; mb++)
+            {
+                PutUe(&w, 25);
+                while (w.bits & 7)
+                    PutBits(&w, 0, 1);
+                for (i = 0; i < 384; i++)
+                    PutBits(&w, 1 + (mb * 37 + i * 7 + n * 5) % 255, 8);
+            }
+        }
+        else
+        {
+            PutUe(&w, CLIP_MBS);        /* mb_skip_run */
+        }
+        PutTrailing(&w);
+        pStream->size += PutNal(p + pStream->size, idr ? 0x65 : 0x41, &w);
+    }
+
+    free(w.data);
+    return 0;
+}
+
+void HarnessReleaseStream(harnessStream_t *pStream)
+{
+    if (pStream->dwl == NULL)
+        return;
+
+    if (pStream->size)
+        DWLFreeLinear(pStream->dwl, &pStream->mem);
+    DWLRelease(pStream->dwl);
+    pStream->dwl = NULL;
+}
+
+H264DecRet HarnessDecInit(H264DecInst *pDecInst)
+{
+    *pDecInst = NULL;
+    return H264DecInit(pDecInst, 0, 0, 0, DEC_REF_FRM_RASTER_SCAN);
+}
+
+void HarnessSetInput(const harnessStream_t *pStream, u32 offset, u32 len,
+                     H264DecInput *pInput)
+{
+    memset(pInput, 0, sizeof(H264DecInput));
+    pInput->pStream = (u8 *)pStream->mem.virtualAddress + offset;
+    pInput->streamBusAddress = pStream->mem.busAddress + offset;
+    pInput->dataLen = len;
+}
+
+void HarnessNextInput(H264DecInput *pInput, const H264DecOutput *pOutput)
+{
+    pInput->streamBusAddress += pInput->dataLen - pOutput->dataLeft;
+    pInput->pStream = pOutput->pStrmCurrPos;
+    pInput->dataLen = pOutput->dataLeft;
+}
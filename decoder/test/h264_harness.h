@@ -0,0 +1,70 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : Helpers shared by the H.264 harnesses run on the board through
+--             the polling DWL, or on the host through dwl_fake_hw.c: timing,
+--             the stream in a linear buffer, read from a file or written by
+--             the harness, and decoder set up
+--
+------------------------------------------------------------------------------*/
+
+#ifndef H264_HARNESS_H
+#define H264_HARNESS_H
+
+#include "basetype.h"
+#include "dwl.h"
+#include "h264decapi.h"
+
+#define HARNESS_CLIP_WIDTH      128
+#define HARNESS_CLIP_HEIGHT     96
+#define HARNESS_CLIP_PICTURES   12
+
+/* stream file in a linear buffer of its own DWL instance */
+typedef struct
+{
+    const void *dwl;
+    DWLLinearMem_t mem;
+    u32 size;
+} harnessStream_t;
+
+/* microseconds of CLOCK_MONOTONIC, wrapping; only differences are used */
+u32 HarnessTimeUs(void);
+
+/* FNV-1a of a picture */
+u32 HarnessHash(const u8 *p, u32 size);
+
+/* DWLInit for H.264 and the file read into a linear buffer; prints what
+ * failed and returns -1 */
+i32 HarnessLoadStream(const char *file, harnessStream_t *pStream);
+
+/* a stream of HARNESS_CLIP_PICTURES written in a linear buffer instead: an
+ * IDR of I_PCM macroblocks every six pictures, P pictures of skipped
+ * macroblocks in between */
+i32 HarnessWriteClip(harnessStream_t *pStream);
+
+/* frees the stream of either */
+void HarnessReleaseStream(harnessStream_t *pStream);
+
+/* decoder in display order with raster scan output */
+H264DecRet HarnessDecInit(H264DecInst *pDecInst);
+
+/* input of length len from offset in the stream */
+void HarnessSetInput(const harnessStream_t *pStream, u32 offset, u32 len,
+                     H264DecInput *pInput);
+
+/* input advanced past the data the last H264DecDecode consumed */
+void HarnessNextInput(H264DecInput *pInput, const H264DecOutput *pOutput);
+
+#endif /* H264_HARNESS_H */
@@ -0,0 +1,178 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : H.264 intra only decoding (skipNonIntra) on the board through
+--             the polling DWL. The stream is decoded once fully and once
+--             intra only. Every picture output by the intra only run must be
+--             bit exact with the same picture of the full run; pictures are
+--             matched by the stream offset they were decoded from. Prints
+--             the pictures per second of both runs.
+--
+--  Usage    : g1dec_h264_intra_only <stream.h264>
+--
+------------------------------------------------------------------------------*/
+
+#include "basetype.h"
+#include "dwl.h"
+#include "h264decapi.h"
+#include "h264_harness.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    u32 picId;          /* stream offset of the decode call */
+    u32 hash;
+} outPic_t;
+
+typedef struct
+{
+    outPic_t *pics;
+    u32 numPics;
+    u32 maxPics;
+    u32 decoded;
+    u32 skipped;
+    u32 timeUs;
+    u32 monoChrome;
+} decodeRun_t;
+
+static void TakeOutput(H264DecInst decInst, decodeRun_t *pRun, u32 endOfStream)
+{
+    H264DecPicture pic;
+
+    while (H264DecNextPicture(decInst, &pic, endOfStream) == H264DEC_PIC_RDY)
+    {
+        u32 size = pic.picWidth * pic.picHeight;
+
+        if (!pRun->monoChrome)
+            size = size * 3 / 2;
+
+        if (pRun->numPics == pRun->maxPics)
+        {
+            pRun->maxPics = pRun->maxPics ? 2 * pRun->maxPics : 256;
+            pRun->pics = (outPic_t *)realloc(pRun->pics,
+                                             pRun->maxPics * sizeof(outPic_t));
+        }
+        pRun->pics[pRun->numPics].picId = pic.picId;
+        pRun->pics[pRun->numPics].hash =
+            HarnessHash((const u8 *)pic.pOutputPicture, size);
+        pRun->numPics++;
+    }
+}
+
+static i32 Decode(const harnessStream_t *pStream, u32 intraOnly,
+                  decodeRun_t *pRun)
+{
+    H264DecInst decInst = NULL;
+    H264DecInput input;
+    H264DecOutput output;
+    H264DecInfo info;
+    H264DecRet ret;
+    u32 start;
+
+    ret = HarnessDecInit(&decInst);
+    if (ret != H264DEC_OK)
+        return ret;
+
+    HarnessSetInput(pStream, 0, pStream->size, &input);
+    input.skipNonIntra = intraOnly;
+
+    start = HarnessTimeUs();
+    while (input.dataLen > 0)
+    {
+        input.picId = pStream->size - input.dataLen;
+        ret = H264DecDecode(decInst, &input, &output);
+
+        if (ret == H264DEC_HDRS_RDY &&
+            H264DecGetInfo(decInst, &info) == H264DEC_OK)
+            pRun->monoChrome = info.monoChrome;
+        else if (ret == H264DEC_PIC_DECODED || ret == H264DEC_PENDING_FLUSH)
+            pRun->decoded++;
+        else if (ret == H264DEC_NONREF_PIC_SKIPPED)
+            pRun->skipped++;
+        else if (ret < 0)
+        {
+            printf("H264DecDecode failed %d at offset %u\n", ret,
+                   input.picId);
+            break;
+        }
+
+        TakeOutput(decInst, pRun, 0);
+
+        HarnessNextInput(&input, &output);
+    }
+    TakeOutput(decInst, pRun, 1);
+    pRun->timeUs = HarnessTimeUs() - start;
+
+    H264DecRelease(decInst);
+
+    return ret < 0 ? ret : H264DEC_OK;
+}
+
+int main(int argc, char **argv)
+{
+    harnessStream_t stream;
+    decodeRun_t full, intra;
+    u32 failures = 0;
+    u32 i, j;
+
+    if (argc < 2)
+    {
+        printf("usage: %s <stream.h264>\n", argv[0]);
+        return 1;
+    }
+
+    if (HarnessLoadStream(argv[1], &stream) != 0)
+        return 1;
+
+    memset(&full, 0, sizeof(full));
+    memset(&intra, 0, sizeof(intra));
+    if (Decode(&stream, 0, &full) != H264DEC_OK ||
+        Decode(&stream, 1, &intra) != H264DEC_OK)
+        failures++;
+
+    for (i = 0; i < intra.numPics; i++)
+    {
+        for (j = 0; j < full.numPics; j++)
+            if (full.pics[j].picId == intra.pics[i].picId)
+                break;
+
+        if (j == full.numPics || full.pics[j].hash != intra.pics[i].hash)
+        {
+            if (failures++ < 10)
+                printf("FAIL picture at offset %u %s\n", intra.pics[i].picId,
+                       j == full.numPics ? "not output by the full decode" :
+                       "differs from the full decode");
+        }
+    }
+    if (!intra.numPics)
+        failures++;
+
+    printf("full: %u pictures output in %u ms, %.1f fps\n", full.numPics,
+           full.timeUs / 1000, full.numPics * 1e6 / (full.timeUs + 1));
+    printf("intra only: %u pictures output, %u skipped in %u ms, %.1f fps, "
+           "%.1f stream pictures per second\n", intra.numPics, intra.skipped,
+           intra.timeUs / 1000, intra.numPics * 1e6 / (intra.timeUs + 1),
+           (intra.decoded + intra.skipped) * 1e6 / (intra.timeUs + 1));
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+
+    free(full.pics);
+    free(intra.pics);
+    HarnessReleaseStream(&stream);
+
+    return failures ? 1 : 0;
+}
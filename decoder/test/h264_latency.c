@@ -0,0 +1,141 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : H.264 output latency with and without H264DecSetLowLatency.
+--             Decodes an Annex B stream on the board through the polling
+--             DWL and measures, for every output picture, the time from the
+--             H264DecDecode call that decoded it to H264DecNextPicture
+--             giving it out, and how many decoded pictures were still held.
+--
+--  Usage    : g1dec_h264_latency <stream.h264> [lowlatency]
+--
+------------------------------------------------------------------------------*/
+
+#include "basetype.h"
+#include "dwl.h"
+#include "h264decapi.h"
+#include "h264_harness.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_PICS_IN_FLIGHT  64
+
+typedef struct
+{
+    u32 decoded;        /* pictures decoded */
+    u32 output;         /* pictures output */
+    u32 maxHeld;        /* most pictures decoded but not output */
+    u32 outOfOrder;     /* pictures output before an earlier decoded one */
+    u32 lastPicId;
+    double sumUs;
+    u32 maxUs;
+    u32 decodeUs[MAX_PICS_IN_FLIGHT];   /* by picId */
+} latency_t;
+
+static void TakeOutput(H264DecInst decInst, latency_t *pLat, u32 endOfStream)
+{
+    H264DecPicture pic;
+
+    while (H264DecNextPicture(decInst, &pic, endOfStream) == H264DEC_PIC_RDY)
+    {
+        u32 us = HarnessTimeUs() -
+                 pLat->decodeUs[pic.picId % MAX_PICS_IN_FLIGHT];
+        u32 held = pLat->decoded - pLat->output;
+
+        if (pLat->output && pic.picId < pLat->lastPicId)
+            pLat->outOfOrder++;
+        pLat->lastPicId = pic.picId;
+        pLat->output++;
+        pLat->sumUs += us;
+        if (us > pLat->maxUs)
+            pLat->maxUs = us;
+        /* decoded but not output before this one, itself included */
+        if (held > pLat->maxHeld)
+            pLat->maxHeld = held;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    u32 lowLatency = argc > 2 && !strcmp(argv[2], "lowlatency");
+    harnessStream_t stream;
+    H264DecInst decInst = NULL;
+    H264DecInput input;
+    H264DecOutput output;
+    H264DecRet ret;
+    latency_t *pLat;
+    u32 t;
+
+    if (argc < 2)
+    {
+        printf("usage: %s <stream.h264> [lowlatency]\n", argv[0]);
+        return 1;
+    }
+
+    pLat = (latency_t *)calloc(1, sizeof(latency_t));
+    if (pLat == NULL || HarnessLoadStream(argv[1], &stream) != 0)
+        return 1;
+
+    ret = HarnessDecInit(&decInst);
+    if (ret == H264DEC_OK && lowLatency)
+        ret = H264DecSetLowLatency(decInst);
+    if (ret != H264DEC_OK)
+    {
+        printf("H264DecInit failed %d\n", ret);
+        return 1;
+    }
+
+    HarnessSetInput(&stream, 0, stream.size, &input);
+
+    while (input.dataLen > 0)
+    {
+        input.picId = pLat->decoded;
+        t = HarnessTimeUs();
+        ret = H264DecDecode(decInst, &input, &output);
+
+        if (ret == H264DEC_PIC_DECODED || ret == H264DEC_PENDING_FLUSH)
+        {
+            pLat->decodeUs[pLat->decoded % MAX_PICS_IN_FLIGHT] = t;
+            pLat->decoded++;
+        }
+        else if (ret < 0)
+        {
+            printf("H264DecDecode failed %d after %u pictures\n", ret,
+                   pLat->decoded);
+            break;
+        }
+
+        TakeOutput(decInst, pLat, 0);
+
+        HarnessNextInput(&input, &output);
+    }
+    TakeOutput(decInst, pLat, 1);
+
+    printf("%s: %u decoded, %u output, %u out of decoding order\n",
+           lowLatency ? "low latency" : "display order", pLat->decoded,
+           pLat->output, pLat->outOfOrder);
+    if (pLat->output)
+        printf("decode to output %.0f us average, %u us max, "
+               "%u pictures held at most\n", pLat->sumUs / pLat->output,
+               pLat->maxUs, pLat->maxHeld);
+
+    H264DecRelease(decInst);
+    HarnessReleaseStream(&stream);
+    free(pLat);
+
+    return 0;
+}
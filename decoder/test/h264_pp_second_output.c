@@ -0,0 +1,306 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : H.264 with the PP second output (PPDecSetSecondOutput) on the
+--             board through the polling DWL. The stream is decoded with a
+--             full size first output and a half size second output, then
+--             once with each size as the only output. Every picture of both
+--             outputs must be bit exact with the same picture of the single
+--             output run of its size. Prints the time of each run.
+--             Without a stream the clip of HarnessWriteClip is decoded.
+--             Built for the host on the fake DWL of dwl_fake_hw.c too, which
+--             checks the PP setup of both outputs, not the hardware scaler.
+--
+--  Usage    : g1dec_h264_pp_second_output [stream.h264]
+--
+------------------------------------------------------------------------------*/
+
+#include "basetype.h"
+#include "dwl.h"
+#include "h264decapi.h"
+#include "h264_harness.h"
+#include "ppapi.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    u32 width;
+    u32 height;
+    DWLLinearMem_t mem[PP_MAX_MULTIBUFFER];
+    PPOutputBuffers buffers;
+} ppOut_t;
+
+typedef struct
+{
+    u32 *hashes;
+    u32 numPics;
+    u32 maxPics;
+} hashList_t;
+
+typedef struct
+{
+    hashList_t first;
+    hashList_t second;
+    u32 timeUs;
+} decodeRun_t;
+
+static void AddHash(hashList_t *pList, const ppOut_t *pOut, const PPOutput *pic)
+{
+    u32 i;
+
+    for (i = 0; i < pOut->buffers.nbrOfBuffers; i++)
+        if (pOut->mem[i].busAddress == pic->bufferBusAddr)
+            break;
+
+    if (pList->numPics == pList->maxPics)
+    {
+        pList->maxPics = pList->maxPics ? 2 * pList->maxPics : 256;
+        pList->hashes = (u32 *)realloc(pList->hashes,
+                                       pList->maxPics * sizeof(u32));
+    }
+    /* an address not given to the PP can't match any picture */
+    pList->hashes[pList->numPics++] = i == pOut->buffers.nbrOfBuffers ? 0 :
+        HarnessHash((const u8 *)pOut->mem[i].virtualAddress,
+             pOut->width * pOut->height * 3 / 2);
+}
+
+static i32 AllocOutput(const void *dwl, ppOut_t *pOut, u32 count)
+{
+    u32 size = pOut->width * pOut->height * 3 / 2;
+    u32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        PPOutput *pBuf = &pOut->buffers.ppOutputBuffers[i];
+
+        if (DWLMallocLinear(dwl, size, &pOut->mem[i]) != DWL_OK)
+            return -1;
+        pOut->buffers.nbrOfBuffers = i + 1;
+        pBuf->bufferBusAddr = pOut->mem[i].busAddress;
+        pBuf->bufferChromaBusAddr =
+            pOut->mem[i].busAddress + pOut->width * pOut->height;
+    }
+    return 0;
+}
+
+static void FreeOutput(const void *dwl, ppOut_t *pOut)
+{
+    u32 i;
+
+    for (i = 0; i < pOut->buffers.nbrOfBuffers; i++)
+        DWLFreeLinear(dwl, &pOut->mem[i]);
+    pOut->buffers.nbrOfBuffers = 0;
+}
+
+/* output size of the stream size for scale 1, half of it for 2 */
+static void OutputSize(const H264DecInfo *pInfo, u32 scale, ppOut_t *pOut)
+{
+    pOut->width = scale == 1 ? pInfo->picWidth : (pInfo->picWidth / 2) & ~7;
+    pOut->height = scale == 1 ? pInfo->picHeight :
+        (pInfo->picHeight / 2) & ~1;
+}
+
+/* stream headers decoded: PP config of the first output and, if given, the
+ * half size second one */
+static i32 SetUpPp(const void *dwl, H264DecInst decInst, PPInst pp,
+                   u32 firstScale, ppOut_t *pFirst, ppOut_t *pSecond)
+{
+    H264DecInfo info;
+    PPConfig cfg;
+    u32 count;
+
+    if (H264DecGetInfo(decInst, &info) != H264DEC_OK)
+        return -1;
+
+    count = info.multiBuffPpSize;
+    if (count == 0 || count > PP_MAX_MULTIBUFFER)
+        count = PP_MAX_MULTIBUFFER;
+
+    OutputSize(&info, firstScale, pFirst);
+    if (AllocOutput(dwl, pFirst, count) != 0 ||
+        PPDecSetMultipleOutput(pp, &pFirst->buffers) != PP_OK ||
+        PPGetConfig(pp, &cfg) != PP_OK)
+        return -1;
+
+    cfg.ppInImg.pixFormat = info.monoChrome ? PP_PIX_FMT_YCBCR_4_0_0 :
+        PP_PIX_FMT_YCBCR_4_2_0_SEMIPLANAR;
+    cfg.ppInImg.picStruct = PP_PIC_FRAME_OR_TOP_FIELD;
+    cfg.ppInImg.videoRange = info.videoRange;
+    cfg.ppInImg.width = info.picWidth;
+    cfg.ppInImg.height = info.picHeight;
+    cfg.ppOutImg.pixFormat = PP_PIX_FMT_YCBCR_4_2_0_SEMIPLANAR;
+    cfg.ppOutImg.width = pFirst->width;
+    cfg.ppOutImg.height = pFirst->height;
+    if (PPSetConfig(pp, &cfg) != PP_OK)
+        return -1;
+
+    if (pSecond == NULL)
+        return 0;
+
+    OutputSize(&info, 2, pSecond);
+    cfg.ppOutImg.width = pSecond->width;
+    cfg.ppOutImg.height = pSecond->height;
+    if (AllocOutput(dwl, pSecond, count) != 0 ||
+        PPDecSetSecondOutput(pp, &cfg, &pSecond->buffers) != PP_OK)
+        return -1;
+
+    return 0;
+}
+
+static void TakeOutput(H264DecInst decInst, PPInst pp, const ppOut_t *pFirst,
+                       const ppOut_t *pSecond, decodeRun_t *pRun,
+                       u32 endOfStream)
+{
+    H264DecPicture pic;
+    PPOutput out;
+
+    while (H264DecNextPicture(decInst, &pic, endOfStream) == H264DEC_PIC_RDY)
+    {
+        if (PPGetNextOutput(pp, &out) == PP_OK)
+            AddHash(&pRun->first, pFirst, &out);
+        if (pSecond != NULL && PPGetNextSecondOutput(pp, &out) == PP_OK)
+            AddHash(&pRun->second, pSecond, &out);
+    }
+}
+
+/* decodes the stream with the first output at firstScale (see OutputSize)
+ * and, if dual, a half size second output */
+static i32 Decode(const harnessStream_t *pStream, u32 firstScale, u32 dual,
+                  decodeRun_t *pRun)
+{
+    const void *dwl = pStream->dwl;
+    H264DecInst decInst = NULL;
+    PPInst pp = NULL;
+    H264DecInput input;
+    H264DecOutput output;
+    H264DecRet ret;
+    ppOut_t first, second;
+    u32 start;
+    i32 err = 0;
+
+    memset(&first, 0, sizeof(first));
+    memset(&second, 0, sizeof(second));
+
+    if (HarnessDecInit(&decInst) != H264DEC_OK)
+        return -1;
+    if (PPInit(&pp) != PP_OK ||
+        PPDecCombinedModeEnable(pp, decInst, PP_PIPELINED_DEC_TYPE_H264) !=
+        PP_OK)
+    {
+        if (pp != NULL)
+            PPRelease(pp);
+        H264DecRelease(decInst);
+        return -1;
+    }
+
+    HarnessSetInput(pStream, 0, pStream->size, &input);
+
+    start = HarnessTimeUs();
+    while (input.dataLen > 0)
+    {
+        ret = H264DecDecode(decInst, &input, &output);
+
+        if (ret == H264DEC_HDRS_RDY && !first.buffers.nbrOfBuffers)
+        {
+            if (SetUpPp(dwl, decInst, pp, firstScale, &first,
+                        dual ? &second : NULL) != 0)
+            {
+                printf("PP setup failed\n");
+                err = -1;
+                break;
+            }
+        }
+        else if (ret < 0)
+        {
+            printf("H264DecDecode failed %d\n", ret);
+            err = -1;
+            break;
+        }
+
+        TakeOutput(decInst, pp, &first, dual ? &second : NULL, pRun, 0);
+
+        HarnessNextInput(&input, &output);
+    }
+    TakeOutput(decInst, pp, &first, dual ? &second : NULL, pRun, 1);
+    pRun->timeUs = HarnessTimeUs() - start;
+
+    (void) PPDecCombinedModeDisable(pp, decInst);
+    PPRelease(pp);
+    H264DecRelease(decInst);
+    FreeOutput(dwl, &first);
+    FreeOutput(dwl, &second);
+
+    return err;
+}
+
+static u32 Compare(const char *name, const hashList_t *pGot,
+                   const hashList_t *pRef)
+{
+    u32 failures = 0;
+    u32 i;
+
+    if (pGot->numPics != pRef->numPics || !pRef->numPics)
+    {
+        printf("FAIL %s: %u pictures, %u in the single output run\n", name,
+               pGot->numPics, pRef->numPics);
+        failures++;
+    }
+    for (i = 0; i < pGot->numPics && i < pRef->numPics; i++)
+    {
+        if (pGot->hashes[i] != pRef->hashes[i] && failures++ < 10)
+            printf("FAIL %s: picture %u differs from the single output run\n",
+                   name, i);
+    }
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    harnessStream_t stream;
+    decodeRun_t dual, full, half;
+    u32 failures = 0;
+
+    if (argc > 1 ? HarnessLoadStream(argv[1], &stream) != 0 :
+        HarnessWriteClip(&stream) != 0)
+        return 1;
+
+    memset(&dual, 0, sizeof(dual));
+    memset(&full, 0, sizeof(full));
+    memset(&half, 0, sizeof(half));
+    if (Decode(&stream, 1, 1, &dual) != 0 ||
+        Decode(&stream, 1, 0, &full) != 0 ||
+        Decode(&stream, 2, 0, &half) != 0)
+        failures++;
+
+    failures += Compare("first output", &dual.first, &full.first);
+    failures += Compare("second output", &dual.second, &half.first);
+
+    printf("both outputs: %u pictures in %u ms\n", dual.first.numPics,
+           dual.timeUs / 1000);
+    printf("full size only: %u ms, half size only: %u ms\n",
+           full.timeUs / 1000, half.timeUs / 1000);
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+
+    free(dual.first.hashes);
+    free(dual.second.hashes);
+    free(full.first.hashes);
+    free(half.first.hashes);
+    HarnessReleaseStream(&stream);
+
+    return failures ? 1 : 0;
+}
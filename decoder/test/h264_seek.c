@@ -0,0 +1,284 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : H.264 seek latency on the board through the polling DWL.
+--             Seeks to access units spread over an Annex B stream and times
+--             the first picture output from the first keyframe at or after
+--             the seek point, decoding from the seek point as is and
+--             skipping the access units before the keyframe the way the OMX
+--             video decoder does after an input port flush (first slice
+--             header: IDR or I slice).
+--
+--  Usage    : g1dec_h264_seek <stream.h264> [seeks]
+--
+------------------------------------------------------------------------------*/
+
+#include "basetype.h"
+#include "dwl.h"
+#include "h264decapi.h"
+#include "h264_harness.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    u32 offset;         /* first byte, start code included */
+    u32 slice;          /* offset of the first slice NAL unit */
+} unit_t;
+
+typedef struct
+{
+    u32 seeks;
+    u32 keyUs;          /* sum of seek to keyframe picture output */
+    u32 maxKeyUs;
+    u32 broken;         /* pictures output before the keyframe picture */
+    u32 skipped;        /* access units not decoded */
+} seekRun_t;
+
+/* Exp-Golomb code, emulation prevention ignored, enough for the first
+ * fields of a slice header */
+static u32 ReadUe(const u8 *data, u32 len, u32 *bit)
+{
+    u32 zeros = 0;
+    u32 val = 0;
+    u32 n;
+
+    while (*bit < len * 8 && !((data[*bit >> 3] >> (7 - (*bit & 7))) & 1))
+    {
+        zeros++;
+        (*bit)++;
+    }
+    if (zeros > 31 || *bit + 1 + zeros > len * 8)
+        return 0xFFFFFFFF;
+    (*bit)++;
+    for (n = 0; n < zeros; n++)
+    {
+        val = (val << 1) | ((data[*bit >> 3] >> (7 - (*bit & 7))) & 1);
+        (*bit)++;
+    }
+    return (1U << zeros) - 1 + val;
+}
+
+/* slice NAL unit starting at data (after the start code): first_mb_in_slice
+ * and whether it starts a GOP */
+static u32 SliceInfo(const u8 *data, u32 len, u32 *keyframe)
+{
+    u32 bit = 0;
+    u32 firstMb;
+    u32 sliceType;
+
+    firstMb = ReadUe(data + 1, len - 1, &bit);
+    sliceType = ReadUe(data + 1, len - 1, &bit);
+
+    *keyframe = (data[0] & 0x1F) == 5 ||
+        (sliceType != 0xFFFFFFFF && (sliceType % 5 == 2 || sliceType % 5 == 4));
+    return firstMb;
+}
+
+/* splits the stream in access units, at slices with first_mb_in_slice 0;
+ * the NAL units in front of a slice go with it. Returns the number of
+ * units, the stream headers end at units[0].slice */
+static u32 SplitStream(const u8 *data, u32 size, unit_t *units, u32 maxUnits)
+{
+    u32 count = 0;
+    u32 pending = size;
+    u32 keyframe;
+    u32 i;
+
+    for (i = 0; i + 4 < size && count < maxUnits; i++)
+    {
+        u32 type;
+
+        if (data[i] || data[i + 1] || data[i + 2] != 0x01)
+            continue;
+
+        type = data[i + 3] & 0x1F;
+        if (type == 1 || type == 5)
+        {
+            if (SliceInfo(data + i + 3, size - i - 3, &keyframe) == 0)
+            {
+                units[count].offset = pending < i ? pending : i;
+                units[count].slice = i;
+                count++;
+            }
+            pending = size;
+        }
+        else if (pending == size)
+            pending = i;
+        i += 2;
+    }
+    return count;
+}
+
+/* Times one seek to unit seekTo. The decoder has seen the stream headers
+ * only, as after an input port flush. */
+static void Seek(const harnessStream_t *pStream, const unit_t *units,
+                 u32 numUnits, u32 seekTo, u32 skipToKeyframe,
+                 seekRun_t *pRun)
+{
+    const u8 *data = (const u8 *)pStream->mem.virtualAddress;
+    u32 size = pStream->size;
+    H264DecInst decInst = NULL;
+    H264DecInput input;
+    H264DecOutput output;
+    H264DecPicture pic;
+    H264DecRet ret;
+    u32 start, unit, key, keyframe;
+    u32 done = 0;
+
+    /* first keyframe at or after the seek point */
+    for (key = seekTo; key < numUnits; key++)
+    {
+        SliceInfo(data + units[key].slice + 3, size - units[key].slice - 3,
+                  &keyframe);
+        if (keyframe)
+            break;
+    }
+    if (key == numUnits)
+        return;
+
+    if (HarnessDecInit(&decInst) != H264DEC_OK)
+        return;
+
+    HarnessSetInput(pStream, 0, units[0].slice, &input);
+    while (input.dataLen > 0 &&
+           H264DecDecode(decInst, &input, &output) >= 0)
+        HarnessNextInput(&input, &output);
+
+    start = HarnessTimeUs();
+    unit = seekTo;
+    if (skipToKeyframe)
+    {
+        /* what the OMX decoder pays for each skipped buffer */
+        for (; unit < numUnits; unit++)
+        {
+            SliceInfo(data + units[unit].slice + 3,
+                      size - units[unit].slice - 3, &keyframe);
+            if (keyframe)
+                break;
+            pRun->skipped++;
+        }
+    }
+
+    HarnessSetInput(pStream, units[unit].offset, size - units[unit].offset,
+                    &input);
+    while (!done)
+    {
+        u32 pos;
+
+        if (input.dataLen > 0)
+        {
+            /* picId is the access unit the decode call starts in */
+            pos = size - input.dataLen;
+            while (unit + 1 < numUnits && units[unit + 1].offset <= pos)
+                unit++;
+            input.picId = unit;
+
+            ret = H264DecDecode(decInst, &input, &output);
+            if (ret < 0)
+                break;
+            HarnessNextInput(&input, &output);
+        }
+
+        while (!done && H264DecNextPicture(decInst, &pic, input.dataLen == 0)
+               == H264DEC_PIC_RDY)
+        {
+            if (pic.picId >= key)
+                done = 1;
+            else
+                pRun->broken++;
+        }
+        if (input.dataLen == 0)
+            break;
+    }
+
+    if (done)
+    {
+        u32 us = HarnessTimeUs() - start;
+
+        pRun->seeks++;
+        pRun->keyUs += us;
+        if (us > pRun->maxKeyUs)
+            pRun->maxKeyUs = us;
+    }
+
+    H264DecRelease(decInst);
+}
+
+static void Report(const char *name, const seekRun_t *pRun)
+{
+    if (!pRun->seeks)
+    {
+        printf("%s: no keyframe picture output\n", name);
+        return;
+    }
+    printf("%s: %u seeks, keyframe picture after %u us average, %u us max, "
+           "%u earlier pictures output, %u access units skipped\n", name,
+           pRun->seeks, pRun->keyUs / pRun->seeks, pRun->maxKeyUs,
+           pRun->broken, pRun->skipped);
+}
+
+int main(int argc, char **argv)
+{
+    u32 numSeeks = argc > 2 ? (u32)atoi(argv[2]) : 20;
+    harnessStream_t stream;
+    seekRun_t asIs, skip;
+    unit_t *units;
+    u32 numUnits, i;
+
+    if (argc < 2 || !numSeeks)
+    {
+        printf("usage: %s <stream.h264> [seeks]\n", argv[0]);
+        return 1;
+    }
+
+    if (HarnessLoadStream(argv[1], &stream) != 0)
+        return 1;
+    units = (unit_t *)malloc(stream.size / 4 * sizeof(unit_t));
+    if (units == NULL)
+        return 1;
+
+    numUnits = SplitStream((const u8 *)stream.mem.virtualAddress, stream.size,
+                           units, stream.size / 4);
+    if (numUnits < 2)
+    {
+        printf("no access units found\n");
+        return 1;
+    }
+    if (numSeeks > numUnits - 1)
+        numSeeks = numUnits - 1;
+
+    memset(&asIs, 0, sizeof(asIs));
+    memset(&skip, 0, sizeof(skip));
+    for (i = 0; i < numSeeks; i++)
+    {
+        /* spread over the stream, the first unit left out */
+        u32 seekTo = 1 + (u32)((double)i * (numUnits - 1) / numSeeks);
+
+        Seek(&stream, units, numUnits, seekTo, 0, &asIs);
+        Seek(&stream, units, numUnits, seekTo, 1, &skip);
+    }
+
+    printf("%u access units\n", numUnits);
+    Report("decode from the seek point", &asIs);
+    Report("skip to the keyframe", &skip);
+
+    free(units);
+    HarnessReleaseStream(&stream);
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : Host checks of the software hot paths against the code they
+--             replaced
+--
+------------------------------------------------------------------------------*/
+
+#ifndef HOT_PATHS_TEST_H
+#define HOT_PATHS_TEST_H
+
+#include "basetype.h"
+
+/* each returns the number of failures and prints its timings */
+u32 RegdrvCheck(u32 iterations);
+u32 DirectMvCheck(u32 iterations);
+
+u32 TestTimeUs(void);
+u32 TestRandom(void);
+
+#endif /* HOT_PATHS_TEST_H */
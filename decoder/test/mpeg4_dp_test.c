@@ -0,0 +1,997 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : Host check of the MPEG-4 data partitioned decoding, with and
+--             without reversible VLCs. Small QCIF clips are written by the
+--             test from a fixed seed with the code tables of the decoder,
+--             and decoded through MP4DecDecode on a fake DWL. Each time the
+--             hardware would be started the fake DWL checksums the register
+--             file and the shared buffers (control words, motion vectors,
+--             DC coefficients, RLC words), so the checksum of a clip is the
+--             software decoding output bit by bit. The expected checksums
+--             are the ones of the decoder before the RVLC table search
+--             counted leading ones. The table search is also compared with
+--             the bit by bit search it replaced, over every code prefix.
+--
+--  Usage    : g1dec_mpeg4_dp_test [iterations]
+--
+------------------------------------------------------------------------------*/
+
+/* the modules themselves, for their code tables and local functions */
+#include "../mpeg4/mp4dechwd_rvlc.c"
+#include "../mpeg4/mp4dechwd_vlc.c"
+
+#include "mp4decapi.h"
+#include "mp4decdrv.h"
+#include "dwl.h"
+#include "regdrv.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TEST_WIDTH          176
+#define TEST_HEIGHT         144
+#define TEST_MBS            ((TEST_WIDTH / 16) * (TEST_HEIGHT / 16))
+#define TEST_MB_NUM_BITS    7   /* StrmDec_NumBits(TEST_MBS - 1) */
+#define TEST_TIME_RES       30
+#define TEST_TIME_BITS      5   /* StrmDec_NumBits(TEST_TIME_RES - 1) */
+#define TEST_CLIP_SIZE      (256 * 1024)
+#define TEST_REGISTERS      128
+#define TEST_BUFFERS        32
+#define TEST_BUS_BASE       0x10000000
+
+/* partition markers, as in mp4dechwd_motiontexture.c */
+#define TEST_MOTION_MARKER  0x1F001     /* 17 bits */
+#define TEST_DC_MARKER      0x6B001     /* 19 bits */
+
+/*------------------------------------------------------------------------------
+    Helpers
+------------------------------------------------------------------------------*/
+
+static u32 seed;
+
+static u32 TimeUs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u32)now.tv_sec * 1000000 + (u32)now.tv_nsec / 1000;
+}
+
+static u32 Random(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) | (seed << 16);
+}
+
+/*------------------------------------------------------------------------------
+    Reference: RvlcTableSearch as it was, the zero/one bits tested one by one
+------------------------------------------------------------------------------*/
+static u32 RvlcTableSearchRef(u32 input, const u16 * table1,
+                              const u16 * table2, u32 * plen)
+{
+    u32 SecondZero;
+    u32 i;
+    u32 rlc;
+    u32 index;
+    i32 level;
+    u32 length;
+    u32 lastBit = 0;
+    u32 sign = 0;
+
+    SecondZero = 999;
+    length = 0;
+
+    if (input < 0x80000000)
+    {
+        for (i = 0; i < 11; i++)
+        {
+            if (!(input & (0x40000000 >> i)))
+            {
+                SecondZero = i;
+                break;
+            }
+        }
+        if (SecondZero == 999)
+            return (ERROR);
+        for (i = (SecondZero + 1); i < 13; i++)
+        {
+            if (!(input & (0x40000000 >> i)))
+            {
+                length = i + 4;
+                lastBit = input & (0x20000000 >> i) ? 1 : 0;
+                sign = input & (0x10000000 >> i);
+                break;
+            }
+        }
+        if (!length)
+            return (ERROR);
+
+        index = ((length - 6) * 22) + (SecondZero * 2) + lastBit;
+        if (index >= 234)
+            return (ERROR);
+
+        rlc = (u32) table1[index];
+        if (rlc == EMPTY)
+            return (ERROR);
+    }
+    else
+    {
+        for (i = 2; i < 12; i++)
+        {
+            if (input & (0x40000000 >> i))
+            {
+                lastBit = input & (0x20000000 >> i) ? 1 : 0;
+                sign = input & (0x10000000 >> i);
+                length = i + 4;
+                break;
+            }
+        }
+        if (!length)
+            return (ERROR);
+        index = (length - 6) * 2 + lastBit;
+        rlc = (u32) table2[index];
+    }
+
+    *plen = length;
+    if (sign)
+    {
+        level = rlc & 0x1FF;
+        level = -level;
+        rlc = rlc & 0xFE00;
+        rlc = rlc | (level & 0x1FF);
+    }
+    return (rlc);
+}
+
+/* longest code with its sign bit is 17 bits, so every 20-bit prefix covers
+ * all codes; the low bits are random to catch reads past the code */
+static u32 RvlcCheck(u32 iterations)
+{
+    const u16 *table1[2] = { u16_rvlcTable1Intra, u16_rvlcTable1Inter };
+    const u16 *table2[2] = { u16_rvlcTable2Intra, u16_rvlcTable2Inter };
+    u32 failures = 0;
+    u32 timeRef = 0, timeTest = 0;
+    u32 sumRef = 0, sumTest = 0;
+    u32 n, prefix, t, intra;
+
+    for (intra = 0; intra < 2; intra++)
+    {
+        for (prefix = 0; prefix < (1 << 20); prefix++)
+        {
+            u32 input = (prefix << 12) | (Random() & 0xFFF);
+            u32 lenRef = 0, lenTest = 0;
+            u32 rlcRef, rlcTest;
+
+            rlcRef = RvlcTableSearchRef(input, table1[intra], table2[intra],
+                                        &lenRef);
+            rlcTest = RvlcTableSearch(input, table1[intra], table2[intra],
+                                      &lenTest);
+            if (rlcRef != rlcTest || (rlcRef != ERROR && lenRef != lenTest))
+            {
+                if (failures++ < 10)
+                    printf("FAIL RVLC %s %08x: %x/%u, was %x/%u\n",
+                           intra ? "inter" : "intra", input, rlcTest, lenTest,
+                           rlcRef, lenRef);
+            }
+        }
+    }
+
+    for (n = 0; n < iterations; n++)
+    {
+        u32 len = 0;
+
+        t = TimeUs();
+        for (prefix = 0; prefix < (1 << 16); prefix++)
+            sumRef += RvlcTableSearchRef(prefix << 16 | n, table1[n & 1],
+                                         table2[n & 1], &len) + len;
+        timeRef += TimeUs() - t;
+
+        len = 0;
+        t = TimeUs();
+        for (prefix = 0; prefix < (1 << 16); prefix++)
+            sumTest += RvlcTableSearch(prefix << 16 | n, table1[n & 1],
+                                       table2[n & 1], &len) + len;
+        timeTest += TimeUs() - t;
+    }
+
+    printf("RVLC table search: %u codes, %u us before, %u us now%s\n",
+           iterations << 16, timeRef, timeTest,
+           sumRef == sumTest ? "" : " (sums differ)");
+
+    return failures;
+}
+
+/*------------------------------------------------------------------------------
+    Code tables of the clip writer, [intra][last << 15 | run << 9 | level]
+------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    u32 code;
+    u32 len;
+} testCode_t;
+
+static testCode_t rvlcCodes[2][1 << 16];    /* level signed, sign included */
+static testCode_t vlcCodes[2][1 << 16];     /* level positive, sign after */
+static testCode_t vlcEscape;
+
+/* every code up to 17 bits through the short word lookup of
+ * StrmDec_DecodeRvlc and the reference table search */
+static void RvlcBuildCodes(void)
+{
+    u32 intra, len, code, rlc, used;
+
+    for (intra = 0; intra < 2; intra++)
+    {
+        const u32 *shortTable = intra ? ShortIntra : ShortInter;
+        const u16 *table1 = intra ? u16_rvlcTable1Intra : u16_rvlcTable1Inter;
+        const u16 *table2 = intra ? u16_rvlcTable2Intra : u16_rvlcTable2Inter;
+
+        for (len = 4; len <= 17; len++)
+        {
+            for (code = 0; code < (1U << len); code++)
+            {
+                u32 input = code << (32 - len);
+
+                used = 0;
+                rlc = shortTable[input >> 27];
+                if (rlc == EMPTY)
+                    rlc = RvlcTableSearchRef(input, table1, table2, &used);
+                else if (rlc != ESCAPE && rlc != ERROR)
+                    used = 4 + (input < 0xC0000000);
+                if (rlc == ERROR || rlc == ESCAPE || used != len ||
+                    rvlcCodes[intra][rlc & 0xFFFF].len)
+                    continue;
+                rvlcCodes[intra][rlc & 0xFFFF].code = code;
+                rvlcCodes[intra][rlc & 0xFFFF].len = len;
+            }
+        }
+    }
+}
+
+/* the tables are indexed with the first 'bits' bits of the code; entries of
+ * the codes shorter than that repeat */
+static void VlcAddCodes(testCode_t * codes, const vlcTable_t * table,
+                        u32 entries, u32 first, u32 bits)
+{
+    u32 i;
+
+    for (i = 0; i < entries; i++)
+    {
+        u32 len = table[i].len;
+        u32 lrl = table[i].lrl;
+
+        if (lrl == 65535 && !vlcEscape.len)
+        {
+            /* the bit after the escape prefix is read as a sign bit; the
+             * escape code has it set */
+            vlcEscape.code = ((i + first) >> (bits - len)) << 1 | 1;
+            vlcEscape.len = len + 1;
+        }
+        else if (lrl != 65535 && len && len <= bits && (lrl & 0x1FF) && !codes[lrl].len)
+        {
+            codes[lrl].code = (i + first) >> (bits - len);
+            codes[lrl].len = len;
+        }
+    }
+}
+
+static void VlcBuildCodes(void)
+{
+    VlcAddCodes(vlcCodes[1], vlcIntraTable1, 112, 16, 7);
+    VlcAddCodes(vlcCodes[1], vlcIntraTable2, 96, 32, 10);
+    VlcAddCodes(vlcCodes[1], vlcIntraTable3, 121, 8, 12);
+    VlcAddCodes(vlcCodes[0], vlcInterTable1, 112, 16, 7);
+    VlcAddCodes(vlcCodes[0], vlcInterTable2, 96, 32, 10);
+    VlcAddCodes(vlcCodes[0], vlcInterTable3, 121, 8, 12);
+}
+
+/*------------------------------------------------------------------------------
+    Clip writer
+------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    u8 *data;
+    u32 bits;
+} testWriter_t;
+
+typedef struct
+{
+    u32 notCoded;
+    u32 type;
+    u32 cbp;    /* cbpy << 2 | cbpc, block 0 in bit 5 */
+    u32 acPred;
+    u32 dquant;
+    u32 mvs;
+    u32 mv[8];  /* code index per component: 0, +1, -1 */
+    i32 dc[6];
+} testMb_t;
+
+typedef struct
+{
+    const char *name;
+    u32 reversibleVlc;
+    u32 seed;
+    u32 vops;
+    u32 checksum;   /* expected */
+} testClip_t;
+
+/* mcbpc of I-VOPs by cbpc, MB_INTRA and MB_INTRAQ */
+static const testCode_t mcbpcIntra[2][4] = {
+    { { 0x1, 1 }, { 0x1, 3 }, { 0x2, 3 }, { 0x3, 3 } },
+    { { 0x1, 4 }, { 0x1, 6 }, { 0x2, 6 }, { 0x3, 6 } }
+};
+
+/* intra cbpy codes; inter macroblocks use the code of 15 - cbpy */
+static const testCode_t cbpyCodes[16] = {
+    { 0x3, 4 }, { 0x5, 5 }, { 0x4, 5 }, { 0x9, 4 },
+    { 0x3, 5 }, { 0x7, 4 }, { 0x3, 6 }, { 0xB, 4 },
+    { 0x2, 5 }, { 0x2, 6 }, { 0x5, 4 }, { 0xA, 4 },
+    { 0x4, 4 }, { 0x8, 4 }, { 0x6, 4 }, { 0x3, 2 }
+};
+
+/* dct_dc_size codes by size, luminance and chrominance */
+static const testCode_t dcSizeCodes[2][6] = {
+    { { 0x3, 3 }, { 0x3, 2 }, { 0x2, 2 }, { 0x2, 3 }, { 0x1, 3 }, { 0x1, 4 } },
+    { { 0x3, 2 }, { 0x2, 2 }, { 0x1, 2 }, { 0x1, 3 }, { 0x1, 4 }, { 0x1, 5 } }
+};
+
+static const testCode_t mvCodes[3] = { { 0x1, 1 }, { 0x2, 3 }, { 0x3, 3 } };
+
+static void PutBits(testWriter_t * w, u32 value, u32 numBits)
+{
+    while (numBits--)
+    {
+        if ((value >> numBits) & 1)
+            w->data[w->bits >> 3] |= 0x80 >> (w->bits & 7);
+        w->bits++;
+    }
+}
+
+static void PutCode(testWriter_t * w, const testCode_t * code)
+{
+    PutBits(w, code->code, code->len);
+}
+
+/* zero and ones up to the next byte boundary, a whole byte if aligned */
+static void PutStuffing(testWriter_t * w)
+{
+    PutBits(w, 0, 1);
+    while (w->bits & 7)
+        PutBits(w, 1, 1);
+}
+
+static void PutDc(testWriter_t * w, u32 block, i32 dc)
+{
+    u32 size = 0;
+    u32 abs = dc < 0 ? -dc : dc;
+
+    while (abs >> size)
+        size++;
+    PutCode(w, &dcSizeCodes[block >= 4][size]);
+    if (size)
+        PutBits(w, dc > 0 ? (u32)dc : (u32)(dc + (1 << size) - 1), size);
+}
+
+static void PutCoeff(testWriter_t * w, u32 reversibleVlc, u32 intra, u32 last,
+                     u32 run, i32 level)
+{
+    u32 abs = level < 0 ? -level : level;
+    u32 key = last << 15 | run << 9;
+
+    if (reversibleVlc)
+    {
+        key |= (u32)level & 0x1FF;
+        if (abs < 256 && rvlcCodes[intra][key].len)
+        {
+            PutCode(w, &rvlcCodes[intra][key]);
+        }
+        else
+        {
+            PutBits(w, 0x1, 5);
+            PutBits(w, last, 1);
+            PutBits(w, run, 6);
+            PutBits(w, 1, 1);
+            PutBits(w, abs, 11);
+            PutBits(w, 1, 1);
+            PutBits(w, 0, 4);
+            PutBits(w, level < 0, 1);
+        }
+    }
+    else
+    {
+        key |= abs;
+        if (abs < 512 && vlcCodes[intra][key].len)
+        {
+            PutCode(w, &vlcCodes[intra][key]);
+            PutBits(w, level < 0, 1);
+        }
+        else
+        {
+            /* type 3 escape: fixed length */
+            PutCode(w, &vlcEscape);
+            PutBits(w, 0x3, 2);
+            PutBits(w, last, 1);
+            PutBits(w, run, 6);
+            PutBits(w, 1, 1);
+            PutBits(w, (u32)level & 0xFFF, 12);
+            PutBits(w, 1, 1);
+        }
+    }
+}
+
+/* mostly short runs and small levels, some escapes with levels over 255 */
+static void PutBlock(testWriter_t * w, u32 reversibleVlc, u32 intra)
+{
+    u32 pos = intra ? 1 : 0;    /* intra DC coded separately */
+    u32 coeffs = 1 + Random() % 8;
+    u32 run, last, r;
+    i32 level;
+
+    do
+    {
+        run = (Random() % 4) ? Random() % 3 : Random() % 20;
+        if (pos + run > 63)
+            run = 63 - pos;
+        pos += run + 1;
+        last = !--coeffs || pos == 64;
+
+        r = Random() % 32;
+        if (r < 24)
+            level = 1 + r % 3;
+        else if (r < 30)
+            level = 4 + Random() % 60;
+        else
+            level = 256 + Random() % 700;
+        if (Random() & 1)
+            level = -level;
+
+        PutCoeff(w, reversibleVlc, intra, last, run, level);
+    } while (!last);
+}
+
+static void NewMb(testMb_t * mb, u32 vopType)
+{
+    u32 r = Random() % 16;
+    u32 i;
+
+    memset(mb, 0, sizeof(*mb));
+
+    if (vopType == IVOP)
+        mb->type = r < 12 ? MB_INTRA : MB_INTRAQ;
+    else if (r < 4)
+        mb->notCoded = 1;
+    else if (r < 9)
+        mb->type = MB_INTER;
+    else if (r < 11)
+        mb->type = MB_INTERQ;
+    else if (r < 13)
+        mb->type = MB_INTER4V;
+    else
+        mb->type = r < 15 ? MB_INTRA : MB_INTRAQ;
+
+    if (mb->notCoded)
+        return;
+
+    /* chroma patterns the test codes cover */
+    if (vopType == IVOP || mb->type == MB_INTER)
+        mb->cbp = Random() % 4;
+    else if (mb->type == MB_INTERQ)
+        mb->cbp = Random() % 3;
+    mb->cbp |= (Random() % 16) << 2;
+
+    mb->acPred = Random() & 1;
+    if (mb->type == MB_INTRAQ || mb->type == MB_INTERQ)
+        mb->dquant = Random() % 4;
+    if (mb->type == MB_INTER || mb->type == MB_INTERQ)
+        mb->mvs = 1;
+    else if (mb->type == MB_INTER4V)
+        mb->mvs = 4;
+    for (i = 0; i < 2 * mb->mvs; i++)
+        mb->mv[i] = Random() % 3;
+    /* up to size 4, long zero runs could emulate the DC marker */
+    for (i = 0; i < 6; i++)
+        mb->dc[i] = (i32)(Random() % 31) - 15;
+}
+
+static void PutMcbpc(testWriter_t * w, const testMb_t * mb, u32 vopType)
+{
+    u32 cbpc = mb->cbp & 0x3;
+
+    if (vopType == IVOP)
+    {
+        PutCode(w, &mcbpcIntra[mb->type == MB_INTRAQ][cbpc]);
+        return;
+    }
+
+    PutBits(w, 0, 1);   /* not_coded */
+    switch (mb->type)
+    {
+    case MB_INTER:
+        if (cbpc == 3)
+            PutBits(w, 0x5, 6);
+        else
+            PutBits(w, cbpc ? 0x4 - cbpc : 0x1, cbpc ? 4 : 1);
+        break;
+    case MB_INTERQ:
+        if (cbpc)
+            PutBits(w, 0x8 - cbpc, 7);
+        else
+            PutBits(w, 0x3, 3);
+        break;
+    case MB_INTER4V:
+        PutBits(w, 0x2, 3);
+        break;
+    case MB_INTRA:
+        PutBits(w, 0x3, 5);
+        break;
+    default:
+        PutBits(w, 0x4, 6);
+        break;
+    }
+}
+
+static void PutVideoPacket(testWriter_t * w, u32 reversibleVlc, u32 vopType,
+                           u32 firstMb, u32 numMbs)
+{
+    testMb_t mbs[TEST_MBS];
+    u32 i, j, intra;
+
+    for (i = 0; i < numMbs; i++)
+        NewMb(&mbs[i], vopType);
+
+    /* first partition: macroblock types, I-VOP DC, P-VOP motion vectors */
+    for (i = 0; i < numMbs; i++)
+    {
+        const testMb_t *mb = &mbs[i];
+
+        if (Random() % 32 == 0)
+        {
+            if (vopType == PVOP)
+                PutBits(w, 0, 1);
+            PutBits(w, 0x1, 9);     /* macroblock stuffing */
+        }
+        if (mb->notCoded)
+        {
+            PutBits(w, 1, 1);
+            continue;
+        }
+        PutMcbpc(w, mb, vopType);
+        if (vopType == IVOP)
+        {
+            if (mb->type == MB_INTRAQ)
+                PutBits(w, mb->dquant, 2);
+            for (j = 0; j < 6; j++)
+                PutDc(w, j, mb->dc[j]);
+        }
+        for (j = 0; j < 2 * mb->mvs; j++)
+            PutCode(w, &mvCodes[mb->mv[j]]);
+    }
+    if (firstMb + numMbs == TEST_MBS && Random() % 2)
+    {
+        if (vopType == PVOP)
+            PutBits(w, 0, 1);
+        PutBits(w, 0x1, 9);
+    }
+    if (vopType == IVOP)
+        PutBits(w, TEST_DC_MARKER, 19);
+    else
+        PutBits(w, TEST_MOTION_MARKER, 17);
+
+    /* second partition: cbpy, P-VOP intra DC */
+    for (i = 0; i < numMbs; i++)
+    {
+        const testMb_t *mb = &mbs[i];
+
+        if (mb->notCoded)
+            continue;
+        intra = mb->type == MB_INTRA || mb->type == MB_INTRAQ;
+        if (intra)
+            PutBits(w, mb->acPred, 1);
+        PutCode(w, &cbpyCodes[intra ? mb->cbp >> 2 : 15 - (mb->cbp >> 2)]);
+        if (vopType == PVOP)
+        {
+            if (mb->type == MB_INTRAQ || mb->type == MB_INTERQ)
+                PutBits(w, mb->dquant, 2);
+            if (intra)
+                for (j = 0; j < 6; j++)
+                    PutDc(w, j, mb->dc[j]);
+        }
+    }
+
+    /* texture */
+    for (i = 0; i < numMbs; i++)
+    {
+        const testMb_t *mb = &mbs[i];
+
+        intra = mb->type == MB_INTRA || mb->type == MB_INTRAQ;
+        for (j = 0; j < 6; j++)
+            if (!mb->notCoded && (mb->cbp >> (5 - j)) & 1)
+                PutBlock(w, reversibleVlc, intra);
+    }
+
+    PutStuffing(w);
+}
+
+static void PutVop(testWriter_t * w, u32 reversibleVlc, u32 vopType, u32 n)
+{
+    u32 mb, numMbs;
+
+    PutBits(w, 0x1B6, 32);
+    PutBits(w, vopType, 2);
+    PutBits(w, 0, 1);                       /* modulo_time_base */
+    PutBits(w, 1, 1);
+    PutBits(w, n % TEST_TIME_RES, TEST_TIME_BITS);
+    PutBits(w, 1, 1);
+    PutBits(w, 1, 1);                       /* vop_coded */
+    if (vopType == PVOP)
+        PutBits(w, n & 1, 1);               /* rounding type */
+    PutBits(w, 0, 3);                       /* intra DC always VLC coded */
+    PutBits(w, 4 + Random() % 16, 5);
+    if (vopType == PVOP)
+        PutBits(w, 1, 3);                   /* fcode */
+
+    for (mb = 0; mb < TEST_MBS; mb += numMbs)
+    {
+        numMbs = 1 + Random() % 40;
+        if (mb + numMbs > TEST_MBS)
+            numMbs = TEST_MBS - mb;
+        if (mb)
+        {
+            PutBits(w, 0x1, 17);            /* resync marker, fcode 1 */
+            PutBits(w, mb, TEST_MB_NUM_BITS);
+            PutBits(w, 4 + Random() % 16, 5);
+            PutBits(w, 0, 1);               /* no header extension */
+        }
+        PutVideoPacket(w, reversibleVlc, vopType, mb, numMbs);
+    }
+}
+
+static u32 WriteClip(const testClip_t * clip, u8 * data)
+{
+    testWriter_t w;
+    u32 n;
+
+    memset(data, 0, TEST_CLIP_SIZE);
+    w.data = data;
+    w.bits = 0;
+    seed = clip->seed;
+
+    PutBits(&w, 0x1B0, 32);                 /* visual object sequence */
+    PutBits(&w, 0x03, 8);
+    PutBits(&w, 0x1B5, 32);                 /* visual object */
+    PutBits(&w, 0, 1);
+    PutBits(&w, 1, 4);                      /* video */
+    PutBits(&w, 0, 1);
+    PutStuffing(&w);
+    PutBits(&w, 0x100, 32);                 /* video object */
+    PutBits(&w, 0x120, 32);                 /* video object layer */
+    PutBits(&w, 0, 1);
+    PutBits(&w, 1, 8);                      /* simple object */
+    PutBits(&w, 0, 1);
+    PutBits(&w, 1, 4);                      /* square pixels */
+    PutBits(&w, 1, 1);                      /* vol control parameters */
+    PutBits(&w, 1, 2);                      /* 4:2:0 */
+    PutBits(&w, 1, 1);                      /* low delay */
+    PutBits(&w, 0, 1);
+    PutBits(&w, 0, 2);                      /* rectangular */
+    PutBits(&w, 1, 1);
+    PutBits(&w, TEST_TIME_RES, 16);
+    PutBits(&w, 1, 1);
+    PutBits(&w, 0, 1);
+    PutBits(&w, 1, 1);
+    PutBits(&w, TEST_WIDTH, 13);
+    PutBits(&w, 1, 1);
+    PutBits(&w, TEST_HEIGHT, 13);
+    PutBits(&w, 1, 1);
+    PutBits(&w, 0, 1);                      /* progressive */
+    PutBits(&w, 1, 1);                      /* obmc disabled */
+    PutBits(&w, 0, 1);                      /* no sprites */
+    PutBits(&w, 0, 1);                      /* 8 bit */
+    PutBits(&w, 0, 1);                      /* H.263 quantization */
+    PutBits(&w, 1, 1);                      /* no complexity estimation */
+    PutBits(&w, 0, 1);                      /* resync markers */
+    PutBits(&w, 1, 1);                      /* data partitioned */
+    PutBits(&w, clip->reversibleVlc, 1);
+    PutBits(&w, 0, 1);                      /* no scalability */
+    PutStuffing(&w);
+
+    for (n = 0; n < clip->vops; n++)
+        PutVop(&w, clip->reversibleVlc, n % 4 ? PVOP : IVOP, n);
+
+    return w.bits / 8;
+}
+
+/*------------------------------------------------------------------------------
+    Fake DWL: memory from the heap, no hardware; the decoder state given to
+    the hardware is checksummed when it would start
+------------------------------------------------------------------------------*/
+
+static u32 regs[TEST_REGISTERS];
+static DWLLinearMem_t linear[TEST_BUFFERS];
+static u32 nextBusAddress;
+static u32 checksum;
+static u32 hwRuns;
+
+static void Checksum(const void *data, u32 size)
+{
+    const u8 *p = (const u8 *)data;
+
+    /* FNV-1a */
+    while (size--)
+        checksum = (checksum ^ *p++) * 16777619;
+}
+
+u32 DWLReadAsicID(void)
+{
+    return 0x81700000;
+}
+
+void DWLReadAsicConfig(DWLHwConfig_t * pHwCfg)
+{
+    memset(pHwCfg, 0, sizeof(*pHwCfg));
+    pHwCfg->maxDecPicWidth = 1920;
+    pHwCfg->mpeg4Support = MPEG4_ADVANCED_SIMPLE_PROFILE;
+}
+
+const void *DWLInit(DWLInitParam_t * param)
+{
+    (void)param;
+    return regs;
+}
+
+i32 DWLRelease(const void *instance)
+{
+    (void)instance;
+    return DWL_OK;
+}
+
+i32 DWLReserveHw(const void *instance)
+{
+    (void)instance;
+    return DWL_OK;
+}
+
+void DWLReleaseHw(const void *instance)
+{
+    (void)instance;
+}
+
+static i32 FakeMalloc(u32 size, DWLLinearMem_t * info)
+{
+    info->virtualAddress = (u32 *)calloc(1, size);
+    if (info->virtualAddress == NULL)
+        return DWL_ERROR;
+    info->busAddress = nextBusAddress;
+    info->size = size;
+    nextBusAddress += (size + 0xFFF) & ~0xFFF;
+    return DWL_OK;
+}
+
+i32 DWLMallocRefFrm(const void *instance, u32 size, DWLLinearMem_t * info)
+{
+    (void)instance;
+    return FakeMalloc(size, info);
+}
+
+void DWLFreeRefFrm(const void *instance, DWLLinearMem_t * info)
+{
+    (void)instance;
+    free(info->virtualAddress);
+}
+
+i32 DWLMallocLinear(const void *instance, u32 size, DWLLinearMem_t * info)
+{
+    u32 i;
+
+    (void)instance;
+    for (i = 0; i < TEST_BUFFERS && linear[i].virtualAddress; i++)
+        ;
+    if (i == TEST_BUFFERS || FakeMalloc(size, info) != DWL_OK)
+        return DWL_ERROR;
+    linear[i] = *info;
+    return DWL_OK;
+}
+
+void DWLFreeLinear(const void *instance, DWLLinearMem_t * info)
+{
+    u32 i;
+
+    (void)instance;
+    for (i = 0; i < TEST_BUFFERS; i++)
+        if (linear[i].virtualAddress == info->virtualAddress)
+            linear[i].virtualAddress = NULL;
+    free(info->virtualAddress);
+}
+
+void DWLWriteReg(const void *instance, u32 offset, u32 value)
+{
+    (void)instance;
+    regs[offset / 4] = value;
+}
+
+u32 DWLReadReg(const void *instance, u32 offset)
+{
+    (void)instance;
+    return regs[offset / 4];
+}
+
+void DWLEnableHW(const void *instance, u32 offset, u32 value)
+{
+    u32 i;
+
+    (void)instance;
+    regs[offset / 4] = value;
+
+    Checksum(regs, sizeof(regs));
+    for (i = 0; i < TEST_BUFFERS; i++)
+        if (linear[i].virtualAddress)
+            Checksum(linear[i].virtualAddress, linear[i].size);
+    hwRuns++;
+}
+
+void DWLDisableHW(const void *instance, u32 offset, u32 value)
+{
+    (void)instance;
+    regs[offset / 4] = value;
+}
+
+i32 DWLWaitHwReady(const void *instance, u32 timeout)
+{
+    (void)instance;
+    (void)timeout;
+    SetDecRegister(regs, HWIF_DEC_IRQ_STAT, MP4_DEC_X170_IRQ_DEC_RDY);
+    return DWL_HW_WAIT_OK;
+}
+
+void *DWLmalloc(u32 n)
+{
+    return malloc(n);
+}
+
+void DWLfree(void *p)
+{
+    free(p);
+}
+
+void *DWLmemcpy(void *d, const void *s, u32 n)
+{
+    return memcpy(d, s, n);
+}
+
+void *DWLmemset(void *d, i32 c, u32 n)
+{
+    return memset(d, c, n);
+}
+
+/*------------------------------------------------------------------------------
+    Clip decoding
+------------------------------------------------------------------------------*/
+
+static const testClip_t clips[] = {
+    { "data partitioned, RVLC", 1, 0x4D503431, 12, 0x69518590 },
+    { "data partitioned, VLC", 0, 0x4D503432, 12, 0xD001241F }
+};
+
+static u32 ClipCheck(const testClip_t * clip)
+{
+    MP4DecInst dec;
+    MP4DecInput in;
+    MP4DecOutput out;
+    MP4DecPicture pic;
+    DWLLinearMem_t strm;
+    MP4DecRet ret;
+    u32 pictures = 0, errMbs = 0, calls = 0;
+    u32 failures = 0;
+    u32 size, t;
+
+    memset(regs, 0, sizeof(regs));
+    memset(linear, 0, sizeof(linear));
+    nextBusAddress = TEST_BUS_BASE;
+    checksum = 2166136261U;
+    hwRuns = 0;
+
+    if (DWLMallocLinear(NULL, TEST_CLIP_SIZE, &strm) != DWL_OK)
+        return 1;
+    size = WriteClip(clip, (u8 *)strm.virtualAddress);
+
+    if (MP4DecInit(&dec, MP4DEC_MPEG4, 0, 0, DEC_REF_FRM_RASTER_SCAN) !=
+        MP4DEC_OK)
+    {
+        printf("FAIL %s: MP4DecInit\n", clip->name);
+        DWLFreeLinear(NULL, &strm);
+        return 1;
+    }
+
+    memset(&in, 0, sizeof(in));
+    in.pStream = (const u8 *)strm.virtualAddress;
+    in.streamBusAddress = strm.busAddress;
+    in.dataLen = size;
+
+    t = TimeUs();
+    while (in.dataLen && calls++ < 4 * clip->vops + 8)
+    {
+        ret = MP4DecDecode(dec, &in, &out);
+        if (ret < 0)
+        {
+            printf("FAIL %s: MP4DecDecode %d at byte %u\n", clip->name, ret,
+                   (u32)(in.pStream - (const u8 *)strm.virtualAddress));
+            failures++;
+            break;
+        }
+        while (MP4DecNextPicture(dec, &pic, 0) == MP4DEC_PIC_RDY)
+        {
+            pictures++;
+            errMbs += pic.nbrOfErrMBs;
+        }
+        in.pStream = out.pStrmCurrPos;
+        in.streamBusAddress = out.strmCurrBusAddress;
+        in.dataLen = out.dataLeft;
+    }
+    while (MP4DecNextPicture(dec, &pic, 1) == MP4DEC_PIC_RDY)
+    {
+        pictures++;
+        errMbs += pic.nbrOfErrMBs;
+    }
+    t = TimeUs() - t;
+
+    MP4DecRelease(dec);
+    DWLFreeLinear(NULL, &strm);
+
+    printf("%s: %u bytes, %u pictures, %u hw runs, %u error MBs, "
+           "checksum %08x, %u us\n", clip->name, size, pictures, hwRuns,
+           errMbs, checksum, t);
+
+    if (pictures != clip->vops || hwRuns != clip->vops || errMbs)
+    {
+        printf("FAIL %s: not every VOP decoded without errors\n", clip->name);
+        failures++;
+    }
+    if (checksum != clip->checksum)
+    {
+        printf("FAIL %s: checksum %08x, was %08x\n", clip->name, checksum,
+               clip->checksum);
+        failures++;
+    }
+
+    return failures;
+}
+
+/*------------------------------------------------------------------------------
+    main
+------------------------------------------------------------------------------*/
+
+int main(int argc, char **argv)
+{
+    u32 iterations = argc > 1 ? (u32)atoi(argv[1]) : 200;
+    u32 failures = 0;
+    u32 i;
+
+    seed = 12345;
+    failures += RvlcCheck(iterations);
+
+    RvlcBuildCodes();
+    VlcBuildCodes();
+    for (i = 0; i < sizeof(clips) / sizeof(clips[0]); i++)
+        failures += ClipCheck(&clips[i]);
+
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+
+    return failures ? 1 : 0;
+}
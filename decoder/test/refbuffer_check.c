@@ -0,0 +1,263 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : Direct MV statistics of refbuffer.c against the byte reads and
+--             full window search they replaced
+--
+------------------------------------------------------------------------------*/
+
+/* the module itself, for its macros and local functions */
+#include "../common/refbuffer.c"
+
+#include "hot_paths_test.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_TEST_MBS    8160    /* 1920x1088 */
+
+/*------------------------------------------------------------------------------
+    Reference: BuildDistribution and DirectMvStatistics as they were, three
+    byte reads per MV and the window slid over the whole histogram
+------------------------------------------------------------------------------*/
+static void BuildDistributionRef(u32 *pDistrVer, u32 *pMv, i32 frmSizeInMbs,
+                                 u32 mvsPerMb, u32 bigEndian,
+                                 i32 *minY, i32 *maxY)
+{
+    u32 mb;
+    i32 ver;
+    u8 * pMvTmp;
+    u32 mvs;
+    u32 skipMv = mvsPerMb*4;
+    u32 multiplier = 4;
+    u32 div = 2;
+
+    mvs = frmSizeInMbs;
+    if (mvs > MAX_DIRECT_MVS)
+    {
+        while (mvs/div > MAX_DIRECT_MVS)
+            div++;
+
+        mvs /= div;
+        skipMv *= div;
+        multiplier *= div;
+    }
+
+    pMvTmp = (u8*)pMv;
+    for (mb = 0 ; mb < mvs ; ++mb)
+    {
+        ver = bigEndian ? DIR_MV_BE_VER(pMvTmp) : DIR_MV_LE_VER(pMvTmp);
+        SIGN_EXTEND(ver, 13);
+        ver >>= 2;
+        if (ver >= VER_DISTR_MIN && ver <= VER_DISTR_MAX)
+        {
+            pDistrVer[ver] += multiplier;
+            if (ver < *minY)    *minY = ver;
+            if (ver > *maxY)    *maxY = ver;
+        }
+        pMvTmp += skipMv;
+    }
+}
+
+static void DirectMvStatisticsRef(refBuffer_t *pRefbu, u32 *pMv,
+                                  i32 numIntraBlk, u32 bigEndian)
+{
+    i32 * pTmp;
+    i32 frmSizeInMbs;
+    i32 i;
+    i32 oy = 0;
+    i32 best = 0;
+    i32 sum;
+    i32 minY = VER_DISTR_MAX, maxY = VER_DISTR_MIN;
+    u32  distrVer[VER_DISTR_RANGE] = { 0 };
+    u32 *pDistrVer = distrVer + VER_DISTR_ZERO_POINT;
+
+    if (pRefbu->prevWasField)
+        frmSizeInMbs = pRefbu->fldSizeInMbs;
+    else
+        frmSizeInMbs = pRefbu->frmSizeInMbs;
+
+    pTmp = pRefbu->oy;
+    pTmp[2] = pTmp[1];
+    pTmp[1] = pTmp[0];
+
+    if (numIntraBlk < 4*frmSizeInMbs)
+    {
+        i32 y;
+        i32 penalty;
+
+        BuildDistributionRef(pDistrVer, pMv, frmSizeInMbs, pRefbu->mvsPerMb,
+                             bigEndian, &minY, &maxY);
+        pDistrVer[0] -= numIntraBlk;
+
+        sum = 0;
+        for (i = 0 ; i < 2*VER_MV_RANGE ; ++i)
+            sum += distrVer[i];
+        for (i = 0 ; i < VER_DISTR_RANGE-2*VER_MV_RANGE-1 ; ++i)
+        {
+            sum -= distrVer[i];
+            sum += distrVer[2*VER_MV_RANGE+i];
+            y = VER_DISTR_MIN+VER_MV_RANGE+i+1;
+            if (ABS(y) > 8)
+            {
+                penalty = ABS(y)-8;
+                penalty = (frmSizeInMbs*penalty)/16;
+            }
+            else
+            {
+                penalty = 0;
+            }
+            if (sum - penalty > best)
+            {
+                best = sum - penalty;
+                oy = y;
+            }
+            else if (sum - penalty == best)
+            {
+                if (ABS(y) < ABS(oy))  oy = y;
+            }
+        }
+
+        if (pRefbu->prevWasField)
+            best *= 2;
+        pRefbu->coverage[0] = best;
+        pTmp[0] = oy;
+    }
+    else
+    {
+        pTmp[0] = 0;
+    }
+}
+
+/*------------------------------------------------------------------------------
+    Test data
+------------------------------------------------------------------------------*/
+
+/* direct MV word with vertical component ver (13 bit, quarter pel) as the HW
+ * writes it in either endianness, the other bits random */
+static u32 MvWord(i32 ver, u32 bigEndian)
+{
+    u32 v = (u32)ver & 0x1FFF;
+    u32 w = TestRandom();
+
+    if (bigEndian)
+        return (w & ~(0x1FFFU << 5)) | (v << 5);
+
+    /* ver[10:3] in w[23:16], ver[2:0] in w[31:29], ver[12:11] in w[9:8] */
+    w &= ~(0xFFU << 16) & ~(0x7U << 29) & ~(0x3U << 8);
+    return w | ((v >> 3 & 0xFF) << 16) | ((v & 0x7) << 29) | ((v >> 11) << 8);
+}
+
+static void FillMvs(u32 *pMv, u32 mbs, u32 mvsPerMb, u32 bigEndian)
+{
+    static const i32 spreads[] = { 0, 4, 64, 1024, 8192 };
+    i32 center = (i32)(TestRandom() % 2201) - 1100;
+    i32 spread = spreads[TestRandom() % 5];
+    u32 zeros = TestRandom() % 4;   /* share of zero MVs in quarters */
+    u32 mirror = TestRandom() % 4 == 0;
+    u32 i;
+
+    /* mirrored: every other MB at +c or -(c+1) pels, so that the windows
+     * around the two clusters tie and the smaller offset has to be chosen */
+    if (mirror)
+        center = 17 + (i32)(TestRandom() % 200);
+
+    for (i = 0; i < mbs * mvsPerMb; i++)
+    {
+        i32 ver = 0;
+
+        if (mirror)
+        {
+            ver = (i / mvsPerMb) & 1 ? -4 * (center + 1) : 4 * center;
+        }
+        else if (TestRandom() % 4 >= zeros)
+        {
+            ver = center + (spread ? (i32)(TestRandom() % (2*spread + 1)) - spread : 0);
+            ver = MIN(MAX(ver, -4096), 4095);
+        }
+        pMv[i] = MvWord(ver, bigEndian);
+    }
+}
+
+u32 DirectMvCheck(u32 iterations)
+{
+    static const i32 sizes[] = { 99, 396, 1200, 1350, 3600, 8160 };
+    u32 *pMv = (u32 *)malloc(MAX_TEST_MBS * 4 * sizeof(u32));
+    refBuffer_t ref, test;
+    u32 failures = 0;
+    u32 timeRef = 0, timeTest = 0;
+    u32 n, i, t;
+
+    for (n = 0; n < iterations; n++)
+    {
+        u32 bigEndian = TestRandom() & 1;
+        i32 intra;
+
+        memset(&ref, 0, sizeof(ref));
+        ref.frmSizeInMbs = sizes[TestRandom() % 6];
+        ref.fldSizeInMbs = ref.frmSizeInMbs / 2;
+        ref.mvsPerMb = (TestRandom() & 1) ? 4 : 1;
+        ref.prevWasField = TestRandom() & 1;
+        test = ref;
+
+        FillMvs(pMv, ref.frmSizeInMbs, ref.mvsPerMb, bigEndian);
+        intra = (i32)(TestRandom() % (4 * ref.frmSizeInMbs + 16));
+
+        /* time a few runs of each on the same data */
+        t = TestTimeUs();
+        for (i = 0; i < 8; i++)
+            DirectMvStatisticsRef(&ref, pMv, intra, bigEndian);
+        timeRef += TestTimeUs() - t;
+        t = TestTimeUs();
+        for (i = 0; i < 8; i++)
+            DirectMvStatistics(&test, pMv, intra, bigEndian);
+        timeTest += TestTimeUs() - t;
+
+        if (ref.coverage[0] != test.coverage[0] ||
+            memcmp(ref.oy, test.oy, sizeof(ref.oy)))
+        {
+            if (failures++ < 10)
+                printf("FAIL direct MV %d MBs %s %s intra %d: coverage %d/%d oy %d/%d\n",
+                       ref.frmSizeInMbs, bigEndian ? "BE" : "LE",
+                       ref.prevWasField ? "field" : "frame", intra,
+                       ref.coverage[0], test.coverage[0], ref.oy[0], test.oy[0]);
+        }
+    }
+
+    printf("direct MV statistics: %u buffers, %u us before, %u us now\n",
+           iterations * 8, timeRef, timeTest);
+
+#ifdef DIR_MV_WORD_READ
+    /* the word macros against the byte macros for every vertical value */
+    for (n = 0; n < 0x2000 * 16; n++)
+    {
+        u32 bigEndian = n & 1;
+        u32 w = MvWord((i32)(n >> 4), bigEndian);
+        u8 *p = (u8 *)&w;
+        u32 byteVer = bigEndian ? DIR_MV_BE_VER(p) : DIR_MV_LE_VER(p);
+        u32 wordVer = bigEndian ? DIR_MV_BE_VER_WORD(w) : DIR_MV_LE_VER_WORD(w);
+
+        if (byteVer != wordVer || byteVer != ((n >> 4) & 0x1FFF))
+        {
+            if (failures++ < 10)
+                printf("FAIL DIR_MV_%s_VER_WORD(%08x) %x, bytes %x\n",
+                       bigEndian ? "BE" : "LE", w, wordVer, byteVer);
+        }
+    }
+#endif
+
+    free(pMv);
+    return failures;
+}
@@ -0,0 +1,374 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2011 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Abstract : Register field access through the generated field constants
+--             against the table based functions, replaying the register
+--             setup each codec does for a picture
+--
+------------------------------------------------------------------------------*/
+
+#include "basetype.h"
+#include "regdrv.h"
+
+#include "hot_paths_test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_REGISTERS      128
+
+/*------------------------------------------------------------------------------
+    Per-picture register setup: every SetDecRegister of these functions with
+    its field id, in source order, regardless of the branches around it
+------------------------------------------------------------------------------*/
+
+/* jpegdecinternal.c: JpegDecInitHW, JpegDecWriteLenBits,
+ * JpegDecChromaTableSelectors and JpegDecSetHwStrmParams */
+#define JPEG_PICTURE_FIELDS(F) \
+    F(HWIF_PIC_MB_W_EXT) F(HWIF_PIC_MB_WIDTH) F(HWIF_PIC_MB_H_EXT) \
+    F(HWIF_PIC_MB_HEIGHT_P) F(HWIF_DEC_MODE) F(HWIF_DEC_OUT_DIS) \
+    F(HWIF_FILTERING_DIS) F(HWIF_JPEG_QTABLES) F(HWIF_JPEG_MODE) \
+    F(HWIF_RLC_MODE_E) F(HWIF_JPEG_FILRIGHT_E) F(HWIF_PJPEG_FILDOWN_E) \
+    F(HWIF_JPEG_SLICE_H) F(HWIF_PJPEG_E) F(HWIF_PJPEG_E) F(HWIF_PJPEG_SS) \
+    F(HWIF_PJPEG_SE) F(HWIF_PJPEG_AH) F(HWIF_PJPEG_AL) \
+    F(HWIF_PJPEG_COEFF_BUF) F(HWIF_DEC_OUT_DIS) F(HWIF_PJPEG_COEFF_BUF) \
+    F(HWIF_PJPEG_DCCB_BASE) F(HWIF_PJPEG_DCCR_BASE) F(HWIF_DEC_OUT_DIS) \
+    F(HWIF_QTABLE_BASE) F(HWIF_SYNC_MARKER_E) F(HWIF_PJPEG_REST_FREQ) \
+    F(HWIF_SYNC_MARKER_E) F(HWIF_DEC_OUT_DIS) F(HWIF_DEC_OUT_BASE) \
+    F(HWIF_JPG_CH_OUT_BASE) F(HWIF_DEC_OUT_BASE) F(HWIF_JPG_CH_OUT_BASE) \
+    F(HWIF_DEC_OUT_BASE) F(HWIF_DEC_OUT_BASE) F(HWIF_DEC_OUT_BASE) \
+    F(HWIF_DEC_E) F(HWIF_AC1_CODE1_CNT) F(HWIF_AC1_CODE2_CNT) \
+    F(HWIF_AC1_CODE3_CNT) F(HWIF_AC1_CODE4_CNT) F(HWIF_AC1_CODE5_CNT) \
+    F(HWIF_AC1_CODE6_CNT) F(HWIF_AC1_CODE7_CNT) F(HWIF_AC1_CODE8_CNT) \
+    F(HWIF_AC1_CODE9_CNT) F(HWIF_AC1_CODE10_CNT) F(HWIF_AC1_CODE11_CNT) \
+    F(HWIF_AC1_CODE12_CNT) F(HWIF_AC1_CODE13_CNT) F(HWIF_AC1_CODE14_CNT) \
+    F(HWIF_AC1_CODE15_CNT) F(HWIF_AC1_CODE16_CNT) F(HWIF_AC2_CODE1_CNT) \
+    F(HWIF_AC2_CODE2_CNT) F(HWIF_AC2_CODE3_CNT) F(HWIF_AC2_CODE4_CNT) \
+    F(HWIF_AC2_CODE5_CNT) F(HWIF_AC2_CODE6_CNT) F(HWIF_AC2_CODE7_CNT) \
+    F(HWIF_AC2_CODE8_CNT) F(HWIF_AC2_CODE9_CNT) F(HWIF_AC2_CODE10_CNT) \
+    F(HWIF_AC2_CODE11_CNT) F(HWIF_AC2_CODE12_CNT) F(HWIF_AC2_CODE13_CNT) \
+    F(HWIF_AC2_CODE14_CNT) F(HWIF_AC2_CODE15_CNT) F(HWIF_AC2_CODE16_CNT) \
+    F(HWIF_DC1_CODE1_CNT) F(HWIF_DC1_CODE2_CNT) F(HWIF_DC1_CODE3_CNT) \
+    F(HWIF_DC1_CODE4_CNT) F(HWIF_DC1_CODE5_CNT) F(HWIF_DC1_CODE6_CNT) \
+    F(HWIF_DC1_CODE7_CNT) F(HWIF_DC1_CODE8_CNT) F(HWIF_DC1_CODE9_CNT) \
+    F(HWIF_DC1_CODE10_CNT) F(HWIF_DC1_CODE11_CNT) F(HWIF_DC1_CODE12_CNT) \
+    F(HWIF_DC1_CODE13_CNT) F(HWIF_DC1_CODE14_CNT) F(HWIF_DC1_CODE15_CNT) \
+    F(HWIF_DC1_CODE16_CNT) F(HWIF_DC2_CODE1_CNT) F(HWIF_DC2_CODE2_CNT) \
+    F(HWIF_DC2_CODE3_CNT) F(HWIF_DC2_CODE4_CNT) F(HWIF_DC2_CODE5_CNT) \
+    F(HWIF_DC2_CODE6_CNT) F(HWIF_DC2_CODE7_CNT) F(HWIF_DC2_CODE8_CNT) \
+    F(HWIF_DC2_CODE9_CNT) F(HWIF_DC2_CODE10_CNT) F(HWIF_DC2_CODE11_CNT) \
+    F(HWIF_DC2_CODE12_CNT) F(HWIF_DC2_CODE13_CNT) F(HWIF_DC2_CODE14_CNT) \
+    F(HWIF_DC2_CODE15_CNT) F(HWIF_DC2_CODE16_CNT) F(HWIF_CR_AC_VLCTABLE) \
+    F(HWIF_CB_AC_VLCTABLE) F(HWIF_CB_AC_VLCTABLE) F(HWIF_CB_AC_VLCTABLE) \
+    F(HWIF_CR_AC_VLCTABLE) F(HWIF_CR_AC_VLCTABLE) F(HWIF_CR_DC_VLCTABLE) \
+    F(HWIF_CB_DC_VLCTABLE) F(HWIF_CB_DC_VLCTABLE) F(HWIF_CB_DC_VLCTABLE) \
+    F(HWIF_CR_DC_VLCTABLE) F(HWIF_CR_DC_VLCTABLE) F(HWIF_CR_DC_VLCTABLE3) \
+    F(HWIF_CB_DC_VLCTABLE3) F(HWIF_CR_DC_VLCTABLE) F(HWIF_CB_DC_VLCTABLE) \
+    F(HWIF_CR_DC_VLCTABLE3) F(HWIF_CB_DC_VLCTABLE3) F(HWIF_CR_DC_VLCTABLE) \
+    F(HWIF_CR_DC_VLCTABLE3) F(HWIF_CB_DC_VLCTABLE) F(HWIF_CB_DC_VLCTABLE3) \
+    F(HWIF_CR_DC_VLCTABLE) F(HWIF_CR_DC_VLCTABLE3) F(HWIF_CB_DC_VLCTABLE) \
+    F(HWIF_CB_DC_VLCTABLE3) F(HWIF_RLC_VLC_BASE) F(HWIF_STRM_START_BIT) \
+    F(HWIF_STREAM_LEN) F(HWIF_STREAM_LEN) F(HWIF_JPEG_STREAM_ALL)
+
+/* vc1hwd_asic.c: VC1RunAsic, SetReferenceBaseAddress and
+ * SetIntensityCompensationParameters */
+#define VC1_PICTURE_FIELDS(F) \
+    F(HWIF_PIC_INTERLACE_E) F(HWIF_PIC_FIELDMODE_E) F(HWIF_PIC_B_E) \
+    F(HWIF_FWD_INTERLACE_E) F(HWIF_FWD_INTERLACE_E) F(HWIF_PIC_INTER_E) \
+    F(HWIF_PIC_TOPFIELD_E) F(HWIF_TOPFIELDFIRST_E) F(HWIF_PIC_MB_WIDTH) \
+    F(HWIF_PIC_MB_HEIGHT_P) F(HWIF_VC1_HEIGHT_EXT) F(HWIF_MB_WIDTH_OFF) \
+    F(HWIF_MB_HEIGHT_OFF) F(HWIF_MB_WIDTH_OFF) F(HWIF_MB_HEIGHT_OFF) \
+    F(HWIF_REF_TOPFIELD_E) F(HWIF_REF_TOPFIELD_E) F(HWIF_FILTERING_DIS) \
+    F(HWIF_PIC_FIXED_QUANT) F(HWIF_WRITE_MVS_E) F(HWIF_WRITE_MVS_E) \
+    F(HWIF_WRITE_MVS_E) F(HWIF_SYNC_MARKER_E) F(HWIF_DQ_PROFILE) \
+    F(HWIF_DQBI_LEVEL) F(HWIF_RANGE_RED_FRM_E) F(HWIF_RANGE_RED_FRM_E) \
+    F(HWIF_FAST_UVMC_E) F(HWIF_TRANSDCTAB) F(HWIF_TRANSACFRM) \
+    F(HWIF_TRANSACFRM2) F(HWIF_MB_MODE_TAB) F(HWIF_MVTAB) F(HWIF_CBPTAB) \
+    F(HWIF_2MV_BLK_PAT_TAB) F(HWIF_4MV_BLK_PAT_TAB) F(HWIF_REF_FRAMES) \
+    F(HWIF_START_CODE_E) F(HWIF_INIT_QP) F(HWIF_BITPLANE0_E) \
+    F(HWIF_BITPLANE1_E) F(HWIF_BITPLANE2_E) F(HWIF_BITPLANE0_E) \
+    F(HWIF_BITPLANE1_E) F(HWIF_BITPLANE2_E) F(HWIF_BITPLANE0_E) \
+    F(HWIF_BITPLANE1_E) F(HWIF_BITPLANE0_E) F(HWIF_BITPLANE1_E) \
+    F(HWIF_BITPLANE2_E) F(HWIF_BITPLANE0_E) F(HWIF_BITPLANE1_E) \
+    F(HWIF_BITPLANE2_E) F(HWIF_BITPLANE2_E) F(HWIF_ALT_PQUANT) \
+    F(HWIF_DQ_EDGES) F(HWIF_TTMBF) F(HWIF_PQINDEX) F(HWIF_BILIN_MC_E) \
+    F(HWIF_UNIQP_E) F(HWIF_HALFQP_E) F(HWIF_TTFRM) F(HWIF_DQUANT_E) \
+    F(HWIF_VC1_ADV_E) F(HWIF_REF_DIST_FWD) F(HWIF_REF_DIST_BWD) \
+    F(HWIF_REF_DIST_FWD) F(HWIF_REF_DIST_BWD) F(HWIF_MV_SCALEFACTOR) \
+    F(HWIF_RLC_VLC_BASE) F(HWIF_STRM_START_BIT) F(HWIF_STREAM_LEN) \
+    F(HWIF_2ND_BYTE_EMUL_E) F(HWIF_2ND_BYTE_EMUL_E) F(HWIF_DEC_OUT_BASE) \
+    F(HWIF_DPB_ILACE_MODE) F(HWIF_DEC_OUT_BASE) F(HWIF_DEC_OUT_BASE) \
+    F(HWIF_DPB_ILACE_MODE) F(HWIF_PIC_HEADER_LEN) F(HWIF_PIC_4MV_E) \
+    F(HWIF_PREV_ANC_TYPE) F(HWIF_RANGE_RED_REF_E) F(HWIF_RANGE_RED_REF_E) \
+    F(HWIF_RANGE_RED_REF_E) F(HWIF_VC1_DIFMV_RANGE) F(HWIF_MV_RANGE) \
+    F(HWIF_OVERLAP_E) F(HWIF_OVERLAP_E) F(HWIF_OVERLAP_METHOD) \
+    F(HWIF_OVERLAP_E) F(HWIF_OVERLAP_METHOD) F(HWIF_OVERLAP_METHOD) \
+    F(HWIF_OVERLAP_E) F(HWIF_OVERLAP_E) F(HWIF_OVERLAP_METHOD) \
+    F(HWIF_MV_ACCURACY_FWD) F(HWIF_MPEG4_VC1_RC) F(HWIF_BITPL_CTRL_BASE) \
+    F(HWIF_DIR_MV_BASE) F(HWIF_DEC_E) F(HWIF_RLC_VLC_BASE) \
+    F(HWIF_STRM_START_BIT) F(HWIF_STREAM_LEN) F(HWIF_DEC_IRQ_STAT) \
+    F(HWIF_DEC_IRQ) F(HWIF_DEC_IRQ_STAT) F(HWIF_DEC_IRQ) F(HWIF_REFER0_BASE) \
+    F(HWIF_REFER1_BASE) F(HWIF_REFER0_BASE) F(HWIF_REFER1_BASE) \
+    F(HWIF_REFER0_BASE) F(HWIF_REFER1_BASE) F(HWIF_REFER0_BASE) \
+    F(HWIF_REFER1_BASE) F(HWIF_REFER0_BASE) F(HWIF_REFER1_BASE) \
+    F(HWIF_REFER0_BASE) F(HWIF_REFER1_BASE) F(HWIF_REFER0_BASE) \
+    F(HWIF_REFER1_BASE) F(HWIF_REFER2_BASE) F(HWIF_REFER3_BASE) \
+    F(HWIF_REFER0_BASE) F(HWIF_REFER1_BASE) F(HWIF_REFER2_BASE) \
+    F(HWIF_REFER3_BASE) F(HWIF_ICOMP0_E) F(HWIF_ICOMP1_E) F(HWIF_ICOMP2_E) \
+    F(HWIF_ICOMP3_E) F(HWIF_ICOMP4_E) F(HWIF_REFTOPFIRST_E) F(HWIF_ICOMP0_E) \
+    F(HWIF_ISCALE0) F(HWIF_ISHIFT0) F(HWIF_ICOMP1_E) F(HWIF_ISCALE1) \
+    F(HWIF_ISHIFT1) F(HWIF_ICOMP1_E) F(HWIF_ISCALE1) F(HWIF_ISHIFT1) \
+    F(HWIF_ICOMP0_E) F(HWIF_ISCALE0) F(HWIF_ISHIFT0) F(HWIF_ICOMP1_E) \
+    F(HWIF_ISCALE1) F(HWIF_ISHIFT1) F(HWIF_ICOMP0_E) F(HWIF_ISCALE0) \
+    F(HWIF_ISHIFT0) F(HWIF_ICOMP1_E) F(HWIF_ISCALE1) F(HWIF_ISHIFT1) \
+    F(HWIF_ICOMP2_E) F(HWIF_ISCALE2) F(HWIF_ISHIFT2) F(HWIF_ICOMP2_E) \
+    F(HWIF_ISCALE2) F(HWIF_ISHIFT2) F(HWIF_ICOMP0_E) F(HWIF_ISCALE0) \
+    F(HWIF_ISHIFT0) F(HWIF_ICOMP1_E) F(HWIF_ISCALE1) F(HWIF_ISHIFT1) \
+    F(HWIF_ICOMP2_E) F(HWIF_ISCALE2) F(HWIF_ISHIFT2) F(HWIF_ICOMP3_E) \
+    F(HWIF_ISCALE3) F(HWIF_ISHIFT3) F(HWIF_ICOMP4_E) F(HWIF_ISCALE4) \
+    F(HWIF_ISHIFT4) F(HWIF_ICOMP0_E) F(HWIF_ISCALE0) F(HWIF_ISHIFT0) \
+    F(HWIF_ICOMP1_E) F(HWIF_ISCALE1) F(HWIF_ISHIFT1) F(HWIF_ICOMP2_E) \
+    F(HWIF_ISCALE2) F(HWIF_ISHIFT2) F(HWIF_ICOMP3_E) F(HWIF_ISCALE3) \
+    F(HWIF_ISHIFT3) F(HWIF_ICOMP4_E) F(HWIF_ISCALE4) F(HWIF_ISHIFT4)
+
+/* vp8hwd_asic.c: VP8HwdAsicInitPicture, VP8HwdAsicStrmPosUpdate and
+ * VP8HwdAsicRun */
+#define VP8_PICTURE_FIELDS(F) \
+    F(HWIF_DEC_OUT_DIS) F(HWIF_DEC_OUT_DIS) F(HWIF_DEC_OUT_BASE) \
+    F(HWIF_REFER6_BASE) F(HWIF_REFER0_BASE) F(HWIF_REFER0_BASE) \
+    F(HWIF_REFER1_BASE) F(HWIF_JPEG_SLICE_H) F(HWIF_VP8_STRIDE_E) \
+    F(HWIF_VP8_CH_BASE_E) F(HWIF_REFER4_BASE) F(HWIF_REFER2_BASE) \
+    F(HWIF_GREF_SIGN_BIAS) F(HWIF_REFER5_BASE) F(HWIF_REFER3_BASE) \
+    F(HWIF_AREF_SIGN_BIAS) F(HWIF_PIC_INTER_E) F(HWIF_SKIP_MODE) \
+    F(HWIF_FILT_TYPE) F(HWIF_FILT_SHARPNESS) F(HWIF_FILT_LEVEL_0) \
+    F(HWIF_FILT_LEVEL_0) F(HWIF_FILT_LEVEL_1) F(HWIF_FILT_LEVEL_2) \
+    F(HWIF_FILT_LEVEL_3) F(HWIF_FILT_LEVEL_0) F(HWIF_FILT_LEVEL_1) \
+    F(HWIF_FILT_LEVEL_2) F(HWIF_FILT_LEVEL_3) F(HWIF_SEGMENT_E) \
+    F(HWIF_SEGMENT_UPD_E) F(HWIF_FILTERING_DIS) F(HWIF_FILTERING_DIS) \
+    F(HWIF_FILTERING_DIS) F(HWIF_CH_MV_RES) F(HWIF_BILIN_MC_E) \
+    F(HWIF_BOOLEAN_VALUE) F(HWIF_BOOLEAN_RANGE) F(HWIF_QUANT_0) \
+    F(HWIF_QUANT_1) F(HWIF_QUANT_2) F(HWIF_QUANT_3) F(HWIF_QUANT_4) \
+    F(HWIF_QUANT_5) F(HWIF_QUANT_0) F(HWIF_QUANT_0) F(HWIF_QUANT_1) \
+    F(HWIF_QUANT_2) F(HWIF_QUANT_3) F(HWIF_QUANT_0) F(HWIF_QUANT_1) \
+    F(HWIF_QUANT_2) F(HWIF_QUANT_3) F(HWIF_QUANT_DELTA_0) \
+    F(HWIF_QUANT_DELTA_1) F(HWIF_QUANT_DELTA_2) F(HWIF_QUANT_DELTA_3) \
+    F(HWIF_QUANT_DELTA_4) F(HWIF_FILT_REF_ADJ_0) F(HWIF_FILT_REF_ADJ_1) \
+    F(HWIF_FILT_REF_ADJ_2) F(HWIF_FILT_REF_ADJ_3) F(HWIF_FILT_MB_ADJ_0) \
+    F(HWIF_FILT_MB_ADJ_1) F(HWIF_FILT_MB_ADJ_2) F(HWIF_FILT_MB_ADJ_3) \
+    F(HWIF_FILT_REF_ADJ_0) F(HWIF_FILT_REF_ADJ_1) F(HWIF_FILT_REF_ADJ_2) \
+    F(HWIF_FILT_REF_ADJ_3) F(HWIF_FILT_MB_ADJ_0) F(HWIF_FILT_MB_ADJ_1) \
+    F(HWIF_FILT_MB_ADJ_2) F(HWIF_FILT_MB_ADJ_3) F(HWIF_PRED_TAP_2_M1) \
+    F(HWIF_PRED_TAP_2_4) F(HWIF_PRED_TAP_4_M1) F(HWIF_PRED_TAP_4_4) \
+    F(HWIF_PRED_TAP_6_M1) F(HWIF_PRED_TAP_6_4) F(HWIF_INIT_DC_COMP0) \
+    F(HWIF_INIT_DC_COMP1) F(HWIF_INIT_DC_MATCH0) F(HWIF_INIT_DC_MATCH1) \
+    F(HWIF_VP7_VERSION) F(HWIF_STARTMB_X) F(HWIF_STARTMB_Y) \
+    F(HWIF_ERROR_CONC_MODE) F(HWIF_WRITE_MVS_E) F(HWIF_WRITE_MVS_E) \
+    F(HWIF_DIR_MV_BASE) F(HWIF_WRITE_MVS_E) F(HWIF_DIR_MV_BASE) \
+    F(HWIF_STARTMB_X) F(HWIF_STARTMB_Y) F(HWIF_ERROR_CONC_MODE) \
+    F(HWIF_VP6HWPART1_BASE) F(HWIF_STRM1_START_BIT) F(HWIF_STREAM_LEN) \
+    F(HWIF_STREAM_LEN_EXT) F(HWIF_STREAM1_LEN) F(HWIF_COEFFS_PART_AM) \
+    F(HWIF_DEC_E) F(HWIF_DEC_IRQ_STAT) F(HWIF_DEC_IRQ) F(HWIF_DEC_IRQ_STAT) \
+    F(HWIF_DEC_IRQ)
+
+#define SET_REF(id) \
+    (SetDecRegister)(regBase, id, value); value = value * 69069 + 1;
+#define SET_FIELD(id) \
+    SetDecRegister(regBase, id, value); value = value * 69069 + 1;
+#define GET_REF(id)     sum = sum * 31 + (GetDecRegister)(regBase, id);
+#define GET_FIELD(id)   sum = sum * 31 + GetDecRegister(regBase, id);
+
+static void JpegSetupRef(u32 * regBase, u32 value)
+{
+    JPEG_PICTURE_FIELDS(SET_REF)
+}
+
+static void JpegSetupField(u32 * regBase, u32 value)
+{
+    JPEG_PICTURE_FIELDS(SET_FIELD)
+}
+
+static u32 JpegReadRef(const u32 * regBase)
+{
+    u32 sum = 0;
+
+    JPEG_PICTURE_FIELDS(GET_REF)
+    return sum;
+}
+
+static u32 JpegReadField(const u32 * regBase)
+{
+    u32 sum = 0;
+
+    JPEG_PICTURE_FIELDS(GET_FIELD)
+    return sum;
+}
+
+static void Vc1SetupRef(u32 * regBase, u32 value)
+{
+    VC1_PICTURE_FIELDS(SET_REF)
+}
+
+static void Vc1SetupField(u32 * regBase, u32 value)
+{
+    VC1_PICTURE_FIELDS(SET_FIELD)
+}
+
+static u32 Vc1ReadRef(const u32 * regBase)
+{
+    u32 sum = 0;
+
+    VC1_PICTURE_FIELDS(GET_REF)
+    return sum;
+}
+
+static u32 Vc1ReadField(const u32 * regBase)
+{
+    u32 sum = 0;
+
+    VC1_PICTURE_FIELDS(GET_FIELD)
+    return sum;
+}
+
+static void Vp8SetupRef(u32 * regBase, u32 value)
+{
+    VP8_PICTURE_FIELDS(SET_REF)
+}
+
+static void Vp8SetupField(u32 * regBase, u32 value)
+{
+    VP8_PICTURE_FIELDS(SET_FIELD)
+}
+
+static u32 Vp8ReadRef(const u32 * regBase)
+{
+    u32 sum = 0;
+
+    VP8_PICTURE_FIELDS(GET_REF)
+    return sum;
+}
+
+static u32 Vp8ReadField(const u32 * regBase)
+{
+    u32 sum = 0;
+
+    VP8_PICTURE_FIELDS(GET_FIELD)
+    return sum;
+}
+
+typedef struct
+{
+    const char *name;
+    u32 fields;
+    void (*setup[2])(u32 *, u32);
+    u32 (*read[2])(const u32 *);
+} codecSetup_t;
+
+#define COUNT_FIELD(id) + 1
+
+/* table based and inline; not static so that the replays are called, not
+ * inlined, as the decoders call their setup once per picture */
+codecSetup_t regdrvSetups[] = {
+    { "JPEG", 0 JPEG_PICTURE_FIELDS(COUNT_FIELD),
+      { JpegSetupRef, JpegSetupField }, { JpegReadRef, JpegReadField } },
+    { "VC-1", 0 VC1_PICTURE_FIELDS(COUNT_FIELD),
+      { Vc1SetupRef, Vc1SetupField }, { Vc1ReadRef, Vc1ReadField } },
+    { "VP8", 0 VP8_PICTURE_FIELDS(COUNT_FIELD),
+      { Vp8SetupRef, Vp8SetupField }, { Vp8ReadRef, Vp8ReadField } }
+};
+
+/*------------------------------------------------------------------------------
+    Register fields: the generated constants against the table
+------------------------------------------------------------------------------*/
+
+u32 RegdrvCheck(u32 iterations)
+{
+    static const u32 ids[] = {
+        HWIF_DEC_IRQ_STAT, HWIF_PP_IRQ_STAT, HWIF_MPEG4_DC_BASE,
+        HWIF_VP6HWGOLDEN_BASE, HWIF_PJPEG_COEFF_BUF, HWIF_INTER_VIEW_BASE
+    };
+    u32 regsRef[TEST_REGISTERS], regsTest[TEST_REGISTERS];
+    u32 failures = 0;
+    u32 timeRef, timeTest, sumRef, sumTest;
+    u32 c, n, i, value;
+
+    /* the hand written fields and the aliases */
+    for (i = 0; i < TEST_REGISTERS; i++)
+        regsRef[i] = regsTest[i] = TestRandom();
+    value = TestRandom();
+    (SetDecRegister)(regsRef, HWIF_DEC_IRQ_STAT, value);
+    (SetDecRegister)(regsRef, HWIF_PP_IRQ_STAT, value);
+    (SetDecRegister)(regsRef, HWIF_MPEG4_DC_BASE, value);
+    (SetDecRegister)(regsRef, HWIF_VP6HWGOLDEN_BASE, value);
+    (SetDecRegister)(regsRef, HWIF_PJPEG_COEFF_BUF, value);
+    (SetDecRegister)(regsRef, HWIF_INTER_VIEW_BASE, value);
+    SetDecRegister(regsTest, HWIF_DEC_IRQ_STAT, value);
+    SetDecRegister(regsTest, HWIF_PP_IRQ_STAT, value);
+    SetDecRegister(regsTest, HWIF_MPEG4_DC_BASE, value);
+    SetDecRegister(regsTest, HWIF_VP6HWGOLDEN_BASE, value);
+    SetDecRegister(regsTest, HWIF_PJPEG_COEFF_BUF, value);
+    SetDecRegister(regsTest, HWIF_INTER_VIEW_BASE, value);
+    sumRef = sumTest = 0;
+    for (i = 0; i < sizeof(ids) / sizeof(ids[0]); i++)
+        sumRef = sumRef * 31 + (GetDecRegister)(regsRef, ids[i]);
+    sumTest = sumTest * 31 + GetDecRegister(regsTest, HWIF_DEC_IRQ_STAT);
+    sumTest = sumTest * 31 + GetDecRegister(regsTest, HWIF_PP_IRQ_STAT);
+    sumTest = sumTest * 31 + GetDecRegister(regsTest, HWIF_MPEG4_DC_BASE);
+    sumTest = sumTest * 31 + GetDecRegister(regsTest, HWIF_VP6HWGOLDEN_BASE);
+    sumTest = sumTest * 31 + GetDecRegister(regsTest, HWIF_PJPEG_COEFF_BUF);
+    sumTest = sumTest * 31 + GetDecRegister(regsTest, HWIF_INTER_VIEW_BASE);
+    if (memcmp(regsRef, regsTest, sizeof(regsRef)) || sumRef != sumTest)
+    {
+        failures++;
+        printf("FAIL register fields outside the generated table\n");
+    }
+
+    /* the per-picture setup of each codec, checked and timed */
+    for (c = 0; c < sizeof(regdrvSetups) / sizeof(regdrvSetups[0]); c++)
+    {
+        const codecSetup_t *pSetup = &regdrvSetups[c];
+
+        for (i = 0; i < TEST_REGISTERS; i++)
+            regsRef[i] = regsTest[i] = TestRandom();
+        sumRef = sumTest = 0;
+
+        timeRef = TestTimeUs();
+        for (n = 0; n < iterations * 100; n++)
+        {
+            pSetup->setup[0](regsRef, n);
+            sumRef += pSetup->read[0](regsRef);
+        }
+        timeRef = TestTimeUs() - timeRef;
+
+        timeTest = TestTimeUs();
+        for (n = 0; n < iterations * 100; n++)
+        {
+            pSetup->setup[1](regsTest, n);
+            sumTest += pSetup->read[1](regsTest);
+        }
+        timeTest = TestTimeUs() - timeTest;
+
+        if (sumRef != sumTest || memcmp(regsRef, regsTest, sizeof(regsRef)))
+        {
+            failures++;
+            printf("FAIL %s picture setup differs\n", pSetup->name);
+        }
+
+        printf("register fields, %s: %u pictures of %u fields set and read, "
+               "%u us before, %u us now\n", pSetup->name, iterations * 100,
+               pSetup->fields, timeRef, timeTest);
+    }
+
+    return failures;
+}
@@ -460,6 +460,46 @@ VC1DecRet VC1DecDecode(VC1DecInst decInst,
         isIntra = HANTRO_TRUE;
     }
 
+    /* I pictures only: keep skipping after the mode is switched off until
+     * an I picture gives a valid reference again. The whole frame is
+     * skipped at its first field. */
+    if (decResult == VC1HWD_PIC_HDRS_RDY)
+    {
+        u32 intraPic;
+
+        if (pDecCont->storage.picLayer.fcm == FIELD_INTERLACE)
+            intraPic = pDecCont->storage.picLayer.fieldPicType == FP_I_I;
+        else
+            intraPic = pDecCont->storage.picLayer.picType == PTYPE_I;
+
+        if (pInput->skipNonIntra)
+            pDecCont->storage.skipNonIntra = HANTRO_TRUE;
+        else if (intraPic)
+            pDecCont->storage.skipNonIntra = HANTRO_FALSE;
+
+        if (pDecCont->storage.skipNonIntra && !intraPic)
+        {
+            /* anchors are left as they are, B pictures are skipped until
+             * two new anchors have been decoded */
+            if (pDecCont->storage.picLayer.picType != PTYPE_B &&
+                pDecCont->storage.picLayer.picType != PTYPE_BI)
+                pDecCont->storage.skipB = 2;
+
+            (void)vc1hwdSeekFrameStart(&pDecCont->storage, &streamData);
+            pOutput->pStreamCurrPos = streamData.pStrmCurrPos;
+            pOutput->strmCurrBusAddress = pInput->streamBusAddress +
+                (streamData.pStrmCurrPos - streamData.pStrmBuffStart);
+            pOutput->dataLeft = streamData.strmBuffSize -
+                (streamData.pStrmCurrPos - streamData.pStrmBuffStart);
+
+            if (pDecCont->storage.profile != VC1_ADVANCED)
+                pOutput->dataLeft = 0;
+
+            DEC_API_TRC("VC1DecDecode# VC1DEC_NONREF_PIC_SKIPPED (intra only)");
+            return VC1DEC_NONREF_PIC_SKIPPED;
+        }
+    }
+
     if (pDecCont->storage.picLayer.picType == PTYPE_B ||
         pDecCont->storage.picLayer.picType == PTYPE_BI)
     {
@@ -192,6 +192,7 @@ typedef struct swStrmStorage
     hdr_e hdrsDecoded;  /* Contains info of decoded headers */
     u32 pictureBroken;
     u32 intraFreeze;
+    u32 skipNonIntra;   /* skip P and B pictures until the next I picture */
     u32 previousB;
     u32 previousModeFull;
 
@@ -428,7 +428,7 @@ void VP6HwdAsicInitPicture(VP6DecContainer_t * pDecCont)
 
         for (i = 1; i < BLOCK_SIZE; i++)
         {
-            SetDecRegister(pDecCont->vp6Regs, ScanTblRegId[i],
+            (SetDecRegister)(pDecCont->vp6Regs, ScanTblRegId[i],
                            pDecCont->pb.MergedScanOrder[i]);
         }
     }
@@ -445,7 +445,7 @@ void VP6HwdAsicInitPicture(VP6DecContainer_t * pDecCont)
         {
             for (j = 0; j < 4; j++)
             {
-                SetDecRegister(pDecCont->vp6Regs, TapRegId[i][j],
+                (SetDecRegister)(pDecCont->vp6Regs, TapRegId[i][j],
                                (bcfs[i * 4 + j] & 0xFF));
             }
         }
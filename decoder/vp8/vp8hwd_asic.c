@@ -887,7 +887,7 @@ void VP8HwdAsicInitPicture(VP8DecContainer_t * pDecCont)
 
         for (i = 1; i < 16; i++)
         {
-            SetDecRegister(pDecCont->vp8Regs, ScanTblRegId[i],
+            (SetDecRegister)(pDecCont->vp8Regs, ScanTblRegId[i],
                            pDecCont->decoder.vp7ScanOrder[i]);
         }
     }
@@ -902,7 +902,7 @@ void VP8HwdAsicInitPicture(VP8DecContainer_t * pDecCont)
         {
             for (j = 0; j < 4; j++)
             {
-                SetDecRegister(pDecCont->vp8Regs, TapRegId[i][j],
+                (SetDecRegister)(pDecCont->vp8Regs, TapRegId[i][j],
                     mcFilter[i][j+1]);
             }
             if (i == 2)
@@ -1177,8 +1177,8 @@ void VP8HwdAsicStrmPosUpdate(VP8DecContainer_t * pDecCont, u32 strmBusAddress)
     {
         tmpAddr = strmBusAddress + extraBytesPacked + dec->dctPartitionOffsets[i];
         byteOffset = tmpAddr & 0x7;
-        SetDecRegister(pDecCont->vp8Regs, DctBaseId[i], tmpAddr & 0xFFFFFFF8);
-        SetDecRegister(pDecCont->vp8Regs, DctStartBit[i], byteOffset * 8);
+        (SetDecRegister)(pDecCont->vp8Regs, DctBaseId[i], tmpAddr & 0xFFFFFFF8);
+        (SetDecRegister)(pDecCont->vp8Regs, DctStartBit[i], byteOffset * 8);
     }
 
 
@@ -45,9 +45,17 @@ LOCAL_CFLAGS := -DLOG_TAG=\"gralloc\" -DGRALLOC_32_BITS -DPLATFORM_SDK_VERSION=$
 LOCAL_SRC_FILES := \
 	gralloc_module.cpp \
 	alloc_device.cpp \
-	framebuffer_device.cpp
+	framebuffer_device.cpp \
+	gralloc_buffer_map.cpp
 
 LOCAL_MODULE := gralloc.$(TARGET_BOARD_PLATFORM)
 LOCAL_MODULE_RELATIVE_PATH := hw
 
 include $(BUILD_SHARED_LIBRARY)
+
+# fb_post rect copy check and timing against a fake framebuffer
+include $(CLEAR_VARS)
+LOCAL_SRC_FILES := tests/fb_copy_benchmark.cpp
+LOCAL_MODULE := gralloc_fb_copy_benchmark
+LOCAL_MODULE_TAGS := optional
+include $(BUILD_HOST_EXECUTABLE)
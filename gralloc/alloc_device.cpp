@@ -30,6 +30,7 @@
 #include "alloc_device.h"
 #include "gralloc_priv.h"
 #include "gralloc_helper.h"
+#include "gralloc_buffer_map.h"
 #include "framebuffer_device.h"
 
 #include <linux/ion.h>
@@ -42,7 +43,6 @@ static int gralloc_alloc_buffer(alloc_device_t *dev, size_t size, int usage, buf
 {
 	private_module_t *m = reinterpret_cast<private_module_t *>(dev->common.module);
 	ion_user_handle_t ion_hnd;
-	unsigned char *cpu_ptr;
 	int shared_fd;
 	int ret;
 	unsigned int ion_flags = 0;
@@ -89,21 +89,7 @@ static int gralloc_alloc_buffer(alloc_device_t *dev, size_t size, int usage, buf
 //	else
 //		phys_data.phys = 0;
 
-	cpu_ptr = (unsigned char *)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, shared_fd, 0);
-
-	if (cpu_ptr == MAP_FAILED)
-	{
-		AERR("ion_map( %d ) failed", m->ion_client);
-
-		if (0 != ion_free(m->ion_client, ion_hnd))
-		{
-			AERR("ion_free( %d ) failed", m->ion_client);
-		}
-			close(shared_fd);
-		return -1;
-	}
-
-	private_handle_t *hnd = new private_handle_t(private_handle_t::PRIV_FLAGS_USES_ION, usage, size, cpu_ptr, private_handle_t::LOCK_STATE_MAPPED);
+	private_handle_t *hnd = new private_handle_t(private_handle_t::PRIV_FLAGS_USES_ION, usage, size, NULL, 0);
 
 	if (hnd != NULL)
 	{
@@ -113,9 +99,18 @@ static int gralloc_alloc_buffer(alloc_device_t *dev, size_t size, int usage, buf
 		if (usage & GRALLOC_USAGE_PRIVATE_CAMERA)
 			hnd->fd = m->ion_client;
 
-//		ALOGD("gralloc_alloc_buffer: handle = %p size = %u phy = 0x%x vir = %p ion_hnd = %d, ion_client = %d", hnd, size, hnd->phys_addr, hnd->base, hnd->ion_hnd, m->ion_client);
-		*pHandle = hnd;
-		return 0;
+		/* buffers nobody reads or writes through the CPU outside of
+		 * lock/unlock are mapped on demand by gralloc_lock
+		 */
+		if (!gralloc_needs_eager_map(usage) || gralloc_map_buffer(hnd) == 0)
+		{
+//			ALOGD("gralloc_alloc_buffer: handle = %p size = %u phy = 0x%x vir = %p ion_hnd = %d, ion_client = %d", hnd, size, hnd->phys_addr, hnd->base, hnd->ion_hnd, m->ion_client);
+			*pHandle = hnd;
+			return 0;
+		}
+
+		AERR("ion_map( %d ) failed", m->ion_client);
+		delete hnd;
 	}
 	else
 	{
@@ -123,13 +118,6 @@ static int gralloc_alloc_buffer(alloc_device_t *dev, size_t size, int usage, buf
 	}
 
 	close(shared_fd);
-	ret = munmap(cpu_ptr, size);
-
-	if (0 != ret)
-	{
-		AERR("munmap failed for base:%p size: %lu", cpu_ptr, (unsigned long)size);
-	}
-
 	ret = ion_free(m->ion_client, ion_hnd);
 
 	if (0 != ret)
@@ -399,14 +387,10 @@ static int alloc_device_free(alloc_device_t *dev, buffer_handle_t handle)
 	{
 		private_module_t *m = reinterpret_cast<private_module_t *>(dev->common.module);
 //		ALOGD("ion_free(handle = %p ion_client: %d ion_hnd: %p )", hnd, m->ion_client, (void *)(uintptr_t)hnd->ion_hnd);
-		/* Buffer might be unregistered so we need to check for invalid ump handle*/
-		if (0 != hnd->base)
-		{
-			if (0 != munmap((void *)hnd->base, hnd->size))
-			{
-				AERR("Failed to munmap handle 0x%p", hnd);
-			}
-		}
+		/* Buffer might be unregistered or never mapped at all */
+		pthread_mutex_lock(&gralloc_map_lock);
+		gralloc_unmap_buffer(const_cast<private_handle_t *>(hnd));
+		pthread_mutex_unlock(&gralloc_map_lock);
 
 		close(hnd->share_fd);
 
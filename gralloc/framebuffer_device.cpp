@@ -37,9 +37,19 @@
 #include "alloc_device.h"
 #include "gralloc_priv.h"
 #include "gralloc_helper.h"
+#include "gralloc_fb_copy.h"
 
 static int swapInterval = 1;
 
+/* Area of the next non-framebuffer post that has to be copied to the screen */
+static struct
+{
+	int left;
+	int top;
+	int width;
+	int height;
+} updateRect = { 0, 0, 0, 0 };
+
 enum
 {
 	PAGE_FLIP = 0x00000001,
@@ -74,6 +84,22 @@ static int fb_set_swap_interval(struct framebuffer_device_t *dev, int interval)
 	return 0;
 }
 
+static int fb_set_update_rect(struct framebuffer_device_t *dev, int left, int top, int width, int height)
+{
+	if (left < 0 || top < 0 || width <= 0 || height <= 0 ||
+	    left + width > (int)dev->width || top + height > (int)dev->height)
+	{
+		return -EINVAL;
+	}
+
+	updateRect.left = left;
+	updateRect.top = top;
+	updateRect.width = width;
+	updateRect.height = height;
+
+	return 0;
+}
+
 static int fb_post(struct framebuffer_device_t *dev, buffer_handle_t buffer)
 {
 	if (private_handle_t::validate(buffer) < 0)
@@ -85,6 +111,19 @@ static int fb_post(struct framebuffer_device_t *dev, buffer_handle_t buffer)
 	private_handle_t const *hnd = reinterpret_cast<private_handle_t const *>(buffer);
 	private_module_t *m = reinterpret_cast<private_module_t *>(dev->common.module);
 
+	/* the damaged area set through setUpdateRect only applies to this post */
+	int left = 0, top = 0, width = m->info.xres, height = m->info.yres;
+
+	if (updateRect.width > 0 && updateRect.height > 0)
+	{
+		left = updateRect.left;
+		top = updateRect.top;
+		width = updateRect.width;
+		height = updateRect.height;
+	}
+
+	updateRect.width = updateRect.height = 0;
+
 	if (m->currentBuffer)
 	{
 		m->base.unlock(&m->base, m->currentBuffer);
@@ -114,14 +153,23 @@ static int fb_post(struct framebuffer_device_t *dev, buffer_handle_t buffer)
 	{
 		void *fb_vaddr;
 		void *buffer_vaddr;
+		const int bytes_per_pixel = m->info.bits_per_pixel >> 3;
 
 		m->base.lock(&m->base, m->framebuffer, GRALLOC_USAGE_SW_WRITE_RARELY,
-		             0, 0, m->info.xres, m->info.yres, &fb_vaddr);
+		             left, top, width, height, &fb_vaddr);
+
+		if (m->base.lock(&m->base, buffer, GRALLOC_USAGE_SW_READ_RARELY,
+		                 left, top, width, height, &buffer_vaddr) < 0)
+		{
+			m->base.unlock(&m->base, m->framebuffer);
+			return -EINVAL;
+		}
 
-		m->base.lock(&m->base, buffer, GRALLOC_USAGE_SW_READ_RARELY,
-		             0, 0, m->info.xres, m->info.yres, &buffer_vaddr);
+		/* the buffer rows may be padded differently from the screen lines */
+		const size_t buffer_stride = hnd->stride ? hnd->stride * bytes_per_pixel : m->finfo.line_length;
 
-		memcpy(fb_vaddr, buffer_vaddr, m->finfo.line_length * m->info.yres);
+		fb_copy_rect((uint8_t *)fb_vaddr, m->finfo.line_length, (const uint8_t *)buffer_vaddr, buffer_stride,
+		             left, top, width, height, bytes_per_pixel);
 
 		m->base.unlock(&m->base, buffer);
 		m->base.unlock(&m->base, m->framebuffer);
@@ -423,7 +471,7 @@ int framebuffer_device_open(hw_module_t const *module, const char *name, hw_devi
 	dev->common.close = fb_close;
 	dev->setSwapInterval = fb_set_swap_interval;
 	dev->post = fb_post;
-	dev->setUpdateRect = 0;
+	dev->setUpdateRect = fb_set_update_rect;
 	dev->compositionComplete = &compositionComplete;
 
 	int stride = m->finfo.line_length / (m->info.bits_per_pixel >> 3);
@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2010 ARM Limited. All rights reserved.
+ *
+ * Copyright (C) 2008 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include <cutils/log.h>
+
+#include "alloc_device.h"
+#include "gralloc_priv.h"
+#include "gralloc_buffer_map.h"
+
+/*
+ * Every CPU mapping of an ION buffer made by this process is tracked here.
+ * Eager mappings live until the buffer is unregistered or freed. Lazy ones
+ * are created by gralloc_lock and kept on a LRU list once unlocked, so a
+ * buffer locked every frame doesn't pay a mmap/munmap each time, while
+ * buffers the CPU touched once don't stay mapped forever.
+ */
+struct map_entry
+{
+	private_handle_t *hnd;
+	void *base;
+	size_t size;
+	bool eager;
+	struct map_entry *prev;
+	struct map_entry *next;
+};
+
+struct map_stats
+{
+	size_t eager_bytes;
+	size_t lazy_bytes;
+	unsigned int eager_count;
+	unsigned int lazy_count;
+	unsigned int lazy_maps;
+	unsigned int evictions;
+};
+
+pthread_mutex_t gralloc_map_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_mutex_t s_entry_lock = PTHREAD_MUTEX_INITIALIZER;
+/* most recently used first */
+static struct map_entry *s_head = NULL;
+static struct map_entry *s_tail = NULL;
+static struct map_stats s_stats;
+
+static void list_unlink(struct map_entry *e)
+{
+	if (e->prev)
+	{
+		e->prev->next = e->next;
+	}
+	else
+	{
+		s_head = e->next;
+	}
+
+	if (e->next)
+	{
+		e->next->prev = e->prev;
+	}
+	else
+	{
+		s_tail = e->prev;
+	}
+
+	e->prev = e->next = NULL;
+}
+
+static void list_push_front(struct map_entry *e)
+{
+	e->prev = NULL;
+	e->next = s_head;
+
+	if (s_head)
+	{
+		s_head->prev = e;
+	}
+	else
+	{
+		s_tail = e;
+	}
+
+	s_head = e;
+}
+
+static struct map_entry *find_entry(private_handle_t *hnd)
+{
+	for (struct map_entry *e = s_head; e != NULL; e = e->next)
+	{
+		if (e->hnd == hnd)
+		{
+			return e;
+		}
+	}
+
+	return NULL;
+}
+
+static struct map_entry *create_entry(private_handle_t *hnd, bool eager)
+{
+	void *base = mmap(NULL, hnd->size, PROT_READ | PROT_WRITE, MAP_SHARED, hnd->share_fd, 0);
+
+	if (MAP_FAILED == base)
+	{
+		AERR("mmap( share_fd:%d ) failed with %s", hnd->share_fd, strerror(errno));
+		return NULL;
+	}
+
+	struct map_entry *e = (struct map_entry *)calloc(1, sizeof(struct map_entry));
+
+	if (e == NULL)
+	{
+		AERR("Out of memory tracking mapping of handle 0x%p", hnd);
+		munmap(base, hnd->size);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	e->hnd = hnd;
+	e->base = base;
+	e->size = hnd->size;
+	e->eager = eager;
+	list_push_front(e);
+
+	if (eager)
+	{
+		s_stats.eager_bytes += e->size;
+		s_stats.eager_count++;
+	}
+	else
+	{
+		s_stats.lazy_bytes += e->size;
+		s_stats.lazy_count++;
+		s_stats.lazy_maps++;
+		ALOGV("lazily mapped handle %p size %u: %u lazy (%u bytes) / %u eager (%u bytes) mappings, %u maps %u evictions",
+		      hnd, e->size, s_stats.lazy_count, s_stats.lazy_bytes, s_stats.eager_count, s_stats.eager_bytes,
+		      s_stats.lazy_maps, s_stats.evictions);
+	}
+
+	hnd->base = (unsigned char *)base + hnd->offset;
+	hnd->lockState |= private_handle_t::LOCK_STATE_MAPPED;
+
+	return e;
+}
+
+static void destroy_entry(struct map_entry *e)
+{
+	list_unlink(e);
+
+	if (munmap(e->base, e->size) < 0)
+	{
+		AERR("Could not munmap base:0x%p size:%lu '%s'", e->base, (unsigned long)e->size, strerror(errno));
+	}
+
+	if (e->eager)
+	{
+		s_stats.eager_bytes -= e->size;
+		s_stats.eager_count--;
+	}
+	else
+	{
+		s_stats.lazy_bytes -= e->size;
+		s_stats.lazy_count--;
+	}
+
+	e->hnd->base = 0;
+	e->hnd->lockState &= ~(private_handle_t::LOCK_STATE_MAPPED);
+	free(e);
+}
+
+/* callers hold gralloc_map_lock, so lockState of the tracked handles is stable */
+static void evict_idle(struct map_entry *keep)
+{
+	struct map_entry *e = s_tail;
+
+	while (e != NULL && s_stats.lazy_bytes > GRALLOC_LAZY_MAP_BUDGET)
+	{
+		struct map_entry *prev = e->prev;
+
+		if (e != keep && !e->eager && !(e->hnd->lockState & private_handle_t::LOCK_STATE_WRITE))
+		{
+			destroy_entry(e);
+			s_stats.evictions++;
+		}
+
+		e = prev;
+	}
+}
+
+int gralloc_map_buffer(private_handle_t *hnd)
+{
+	int ret = 0;
+
+	pthread_mutex_lock(&s_entry_lock);
+
+	struct map_entry *e = find_entry(hnd);
+
+	if (e == NULL)
+	{
+		if (create_entry(hnd, true) == NULL)
+		{
+			ret = -errno;
+		}
+	}
+	else if (!e->eager)
+	{
+		/* promote a lazy mapping, it must not be evicted from now on */
+		s_stats.lazy_bytes -= e->size;
+		s_stats.lazy_count--;
+		s_stats.eager_bytes += e->size;
+		s_stats.eager_count++;
+		e->eager = true;
+	}
+
+	pthread_mutex_unlock(&s_entry_lock);
+
+	return ret;
+}
+
+int gralloc_acquire_buffer(private_handle_t *hnd)
+{
+	int ret = 0;
+
+	pthread_mutex_lock(&s_entry_lock);
+
+	struct map_entry *e = find_entry(hnd);
+
+	if (e == NULL)
+	{
+		e = create_entry(hnd, false);
+
+		if (e == NULL)
+		{
+			ret = -errno;
+		}
+	}
+	else
+	{
+		list_unlink(e);
+		list_push_front(e);
+	}
+
+	if (e != NULL)
+	{
+		evict_idle(e);
+	}
+
+	pthread_mutex_unlock(&s_entry_lock);
+
+	return ret;
+}
+
+void gralloc_trim_mappings(void)
+{
+	pthread_mutex_lock(&s_entry_lock);
+	evict_idle(NULL);
+	pthread_mutex_unlock(&s_entry_lock);
+}
+
+void gralloc_unmap_buffer(private_handle_t *hnd)
+{
+	pthread_mutex_lock(&s_entry_lock);
+
+	struct map_entry *e = find_entry(hnd);
+
+	if (e != NULL)
+	{
+		destroy_entry(e);
+	}
+	else
+	{
+		hnd->base = 0;
+	}
+
+	pthread_mutex_unlock(&s_entry_lock);
+}
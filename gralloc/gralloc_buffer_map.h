@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2010 ARM Limited. All rights reserved.
+ *
+ * Copyright (C) 2008 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRALLOC_BUFFER_MAP_H_
+#define GRALLOC_BUFFER_MAP_H_
+
+#include <stddef.h>
+#include <pthread.h>
+#include <hardware/gralloc.h>
+
+#include "gralloc_priv.h"
+
+/* Upper bound (bytes) of CPU mappings created on demand by gralloc_lock that
+ * are kept alive after unlock. Least recently used ones above it get unmapped.
+ */
+#ifndef GRALLOC_LAZY_MAP_BUDGET
+#define GRALLOC_LAZY_MAP_BUDGET (32 * 1024 * 1024)
+#endif
+
+/* Buffers with these usage bits are touched by the CPU through hnd->base
+ * without going through lock/unlock (the OMX components read and write the
+ * pixels of HW_VIDEO_ENCODER and camera buffers directly), so they are still
+ * mapped when they are allocated or registered.
+ */
+#define GRALLOC_USAGE_EAGER_MAP_MASK (GRALLOC_USAGE_SW_READ_MASK | \
+				      GRALLOC_USAGE_SW_WRITE_MASK | \
+				      GRALLOC_USAGE_HW_VIDEO_ENCODER | \
+				      GRALLOC_USAGE_PRIVATE_CAMERA)
+
+/* Held while the lockState of a handle changes and around the calls below
+ * that take it, so evicting a mapping never races with a lock, unregister or
+ * free of the same buffer.
+ */
+extern pthread_mutex_t gralloc_map_lock;
+
+inline bool gralloc_needs_eager_map(int usage)
+{
+	return (usage & GRALLOC_USAGE_EAGER_MAP_MASK) != 0;
+}
+
+// Map the whole buffer now and keep it mapped until gralloc_unmap_buffer
+int gralloc_map_buffer(private_handle_t *hnd);
+
+// Map the buffer if needed for a CPU lock (caller holds gralloc_map_lock)
+int gralloc_acquire_buffer(private_handle_t *hnd);
+
+// Unmap idle lazy mappings above the budget (same lock)
+void gralloc_trim_mappings(void);
+
+// Unmap the buffer whatever way it was mapped (same lock)
+void gralloc_unmap_buffer(private_handle_t *hnd);
+
+#endif /* GRALLOC_BUFFER_MAP_H_ */
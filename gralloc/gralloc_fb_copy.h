@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2010 ARM Limited. All rights reserved.
+ *
+ * Copyright (C) 2008 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRALLOC_FB_COPY_H_
+#define GRALLOC_FB_COPY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __ARM_NEON__
+#include <arm_neon.h>
+#endif
+
+/*
+ * Copy a row with 64 byte NEON bursts, prefetching a few cache lines ahead so
+ * the loads of the (uncached) source don't stall the stores to the framebuffer.
+ */
+static inline void fb_copy_row(uint8_t *dst, const uint8_t *src, size_t len)
+{
+#ifdef __ARM_NEON__
+	while (len >= 64)
+	{
+		__builtin_prefetch(src + 256);
+		uint8x16_t v0 = vld1q_u8(src);
+		uint8x16_t v1 = vld1q_u8(src + 16);
+		uint8x16_t v2 = vld1q_u8(src + 32);
+		uint8x16_t v3 = vld1q_u8(src + 48);
+		vst1q_u8(dst, v0);
+		vst1q_u8(dst + 16, v1);
+		vst1q_u8(dst + 32, v2);
+		vst1q_u8(dst + 48, v3);
+		src += 64;
+		dst += 64;
+		len -= 64;
+	}
+#endif
+	memcpy(dst, src, len);
+}
+
+static inline void fb_copy_rect(uint8_t *dst, size_t dst_stride, const uint8_t *src, size_t src_stride,
+                                int left, int top, int width, int height, int bytes_per_pixel)
+{
+	const size_t len = width * bytes_per_pixel;
+
+	dst += top * dst_stride + left * bytes_per_pixel;
+	src += top * src_stride + left * bytes_per_pixel;
+
+	/* full width of two buffers laid out the same way is one contiguous block */
+	if (dst_stride == src_stride && len == dst_stride)
+	{
+		fb_copy_row(dst, src, len * height);
+		return;
+	}
+
+	for (int y = 0; y < height; y++)
+	{
+		fb_copy_row(dst, src, len);
+		dst += dst_stride;
+		src += src_stride;
+	}
+}
+
+#endif /* GRALLOC_FB_COPY_H_ */
@@ -27,13 +27,12 @@
 #include "gralloc_priv.h"
 #include "alloc_device.h"
 #include "framebuffer_device.h"
+#include "gralloc_buffer_map.h"
 
 #include <linux/ion.h>
 #include <ion/ion.h>
 #include <sys/mman.h>
 
-static pthread_mutex_t s_map_lock = PTHREAD_MUTEX_INITIALIZER;
-
 static int gralloc_device_open(const hw_module_t *module, const char *name, hw_device_t **device)
 {
 	int status = -EINVAL;
@@ -65,7 +64,7 @@ static int gralloc_register_buffer(gralloc_module_t const *module, buffer_handle
 
 	int retval = -EINVAL;
 
-	pthread_mutex_lock(&s_map_lock);
+	pthread_mutex_lock(&gralloc_map_lock);
 
 	hnd->pid = getpid();
 
@@ -80,8 +79,6 @@ static int gralloc_register_buffer(gralloc_module_t const *module, buffer_handle
 	else if (hnd->flags & private_handle_t::PRIV_FLAGS_USES_ION)
 	{
 		int ret;
-		unsigned char *mappedAddress;
-		size_t size = hnd->size;
 		hw_module_t *pmodule = NULL;
 		private_module_t *m = NULL;
 
@@ -113,19 +110,22 @@ static int gralloc_register_buffer(gralloc_module_t const *module, buffer_handle
 			}
 		}
 
-		mappedAddress = (unsigned char *)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, hnd->share_fd, 0);
+		/* base still holds the address from the allocating process */
+		hnd->base = 0;
 
-		if (MAP_FAILED == mappedAddress)
+		if (gralloc_needs_eager_map(hnd->usage))
 		{
-			AERR("mmap( share_fd:%d ) failed with %s",  hnd->share_fd, strerror(errno));
-			retval = -errno;
-			goto cleanup;
+			ret = gralloc_map_buffer(hnd);
+
+			if (ret < 0)
+			{
+				retval = ret;
+				goto cleanup;
+			}
 		}
 
-		hnd->base = mappedAddress + hnd->offset;
-//		ALOGD("gralloc_register_buffer: base = 0x%08x", hnd->base);
 		hnd->lockState &= ~(private_handle_t::LOCK_STATE_UNREGISTERED);
-		pthread_mutex_unlock(&s_map_lock);
+		pthread_mutex_unlock(&gralloc_map_lock);
 		return 0;
 	}
 	else
@@ -134,7 +134,7 @@ static int gralloc_register_buffer(gralloc_module_t const *module, buffer_handle
 	}
 
 cleanup:
-	pthread_mutex_unlock(&s_map_lock);
+	pthread_mutex_unlock(&gralloc_map_lock);
 	return retval;
 }
 
@@ -146,13 +146,7 @@ static void unmap_buffer(private_handle_t *hnd)
 	}
 	else if (hnd->flags & private_handle_t::PRIV_FLAGS_USES_ION)
 	{
-		void *base = (void *)hnd->base;
-		size_t size = hnd->size;
-
-		if (munmap(base, size) < 0)
-		{
-			AERR("Could not munmap base:0x%p size:%lu '%s'", base, (unsigned long)size, strerror(errno));
-		}
+		gralloc_unmap_buffer(hnd);
 	}
 	else
 	{
@@ -184,7 +178,7 @@ static int gralloc_unregister_buffer(gralloc_module_t const *module, buffer_hand
 	}
 	else if (hnd->pid == getpid()) // never unmap buffers that were not registered in this process
 	{
-		pthread_mutex_lock(&s_map_lock);
+		pthread_mutex_lock(&gralloc_map_lock);
 
 		hnd->lockState &= ~(private_handle_t::LOCK_STATE_MAPPED);
 
@@ -196,7 +190,7 @@ static int gralloc_unregister_buffer(gralloc_module_t const *module, buffer_hand
 
 		hnd->lockState |= private_handle_t::LOCK_STATE_UNREGISTERED;
 
-		pthread_mutex_unlock(&s_map_lock);
+		pthread_mutex_unlock(&gralloc_map_lock);
 	}
 	else
 	{
@@ -216,12 +210,12 @@ static int gralloc_lock(gralloc_module_t const *module, buffer_handle_t handle,
 
 	private_handle_t *hnd = (private_handle_t *)handle;
 
-	pthread_mutex_lock(&s_map_lock);
+	pthread_mutex_lock(&gralloc_map_lock);
 
 	if (hnd->lockState & private_handle_t::LOCK_STATE_UNREGISTERED)
 	{
 		AERR("Locking on an unregistered buffer 0x%p, returning error", hnd);
-		pthread_mutex_unlock(&s_map_lock);
+		pthread_mutex_unlock(&gralloc_map_lock);
 		return -EINVAL;
 	}
 
@@ -230,15 +224,28 @@ static int gralloc_lock(gralloc_module_t const *module, buffer_handle_t handle,
 		hnd->writeOwner = usage & GRALLOC_USAGE_SW_WRITE_MASK;
 	}
 
-	hnd->lockState |= private_handle_t::LOCK_STATE_WRITE;
-
-	pthread_mutex_unlock(&s_map_lock);
-
 	if (usage & (GRALLOC_USAGE_SW_READ_MASK | GRALLOC_USAGE_SW_WRITE_MASK))
 	{
+		if (hnd->flags & private_handle_t::PRIV_FLAGS_USES_ION)
+		{
+			/* map on first CPU access, locked buffers are never evicted */
+			int ret = gralloc_acquire_buffer(hnd);
+
+			if (ret < 0)
+			{
+				AERR("Could not map buffer 0x%p for CPU access", hnd);
+				pthread_mutex_unlock(&gralloc_map_lock);
+				return ret;
+			}
+		}
+
 		*vaddr = (void *)hnd->base;
 	}
 
+	hnd->lockState |= private_handle_t::LOCK_STATE_WRITE;
+
+	pthread_mutex_unlock(&gralloc_map_lock);
+
 	MALI_IGNORE(module);
 	MALI_IGNORE(l);
 	MALI_IGNORE(t);
@@ -282,7 +289,7 @@ static int gralloc_unlock(gralloc_module_t const *module, buffer_handle_t handle
 		}
 	}
 
-	pthread_mutex_lock(&s_map_lock);
+	pthread_mutex_lock(&gralloc_map_lock);
 
 	hnd->lockState &= ~(private_handle_t::LOCK_STATE_WRITE);
 
@@ -291,8 +298,12 @@ static int gralloc_unlock(gralloc_module_t const *module, buffer_handle_t handle
 	{
 		unmap_buffer(hnd);
 	}
+	else if (hnd->flags & private_handle_t::PRIV_FLAGS_USES_ION)
+	{
+		gralloc_trim_mappings();
+	}
 
-	pthread_mutex_unlock(&s_map_lock);
+	pthread_mutex_unlock(&gralloc_map_lock);
 
 	return 0;
 }
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2010 ARM Limited. All rights reserved.
+ *
+ * Copyright (C) 2008 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Checks fb_copy_rect against a byte loop on a fake framebuffer and times a
+ * full screen post against damaged-rect posts.
+ *
+ *   fb_copy_benchmark [xres yres [iterations]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../gralloc_fb_copy.h"
+
+#define BYTES_PER_PIXEL 4
+
+struct fake_fb
+{
+	uint8_t *base;
+	size_t line_length;
+	int xres;
+	int yres;
+};
+
+static int64_t now_ns(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (int64_t)t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+static void fill(uint8_t *p, size_t size, unsigned seed)
+{
+	for (size_t i = 0; i < size; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		p[i] = seed >> 16;
+	}
+}
+
+static void reference_copy(uint8_t *dst, size_t dst_stride, const uint8_t *src, size_t src_stride,
+                           int left, int top, int width, int height)
+{
+	for (int y = top; y < top + height; y++)
+	{
+		for (int x = left * BYTES_PER_PIXEL; x < (left + width) * BYTES_PER_PIXEL; x++)
+		{
+			dst[y * dst_stride + x] = src[y * src_stride + x];
+		}
+	}
+}
+
+static int check_rect(const fake_fb &fb, const uint8_t *src, size_t src_stride,
+                      int left, int top, int width, int height)
+{
+	const size_t size = fb.line_length * fb.yres;
+	uint8_t *expected = (uint8_t *)malloc(size);
+
+	fill(fb.base, size, 1);
+	memcpy(expected, fb.base, size);
+
+	reference_copy(expected, fb.line_length, src, src_stride, left, top, width, height);
+	fb_copy_rect(fb.base, fb.line_length, src, src_stride, left, top, width, height, BYTES_PER_PIXEL);
+
+	int ok = memcmp(expected, fb.base, size) == 0;
+
+	if (!ok)
+	{
+		printf("FAIL rect %d,%d %dx%d src stride %zu\n", left, top, width, height, src_stride);
+	}
+
+	free(expected);
+	return ok;
+}
+
+static double time_post(const fake_fb &fb, const uint8_t *src, size_t src_stride,
+                        int left, int top, int width, int height, int iterations)
+{
+	int64_t start = now_ns();
+
+	for (int i = 0; i < iterations; i++)
+	{
+		fb_copy_rect(fb.base, fb.line_length, src, src_stride, left, top, width, height, BYTES_PER_PIXEL);
+	}
+
+	return (now_ns() - start) / 1000.0 / iterations;
+}
+
+int main(int argc, char **argv)
+{
+	fake_fb fb;
+	int iterations = argc > 3 ? atoi(argv[3]) : 100;
+
+	fb.xres = argc > 2 ? atoi(argv[1]) : 1080;
+	fb.yres = argc > 2 ? atoi(argv[2]) : 1920;
+	/* screen lines padded like the K3 framebuffer, buffers padded to 16 pixels */
+	fb.line_length = ((fb.xres * BYTES_PER_PIXEL) + 63) & ~63;
+	fb.base = (uint8_t *)malloc(fb.line_length * fb.yres);
+
+	const size_t padded_stride = ((fb.xres + 15) & ~15) * BYTES_PER_PIXEL;
+	uint8_t *src = (uint8_t *)malloc(padded_stride * fb.yres);
+	fill(src, padded_stride * fb.yres, 2);
+
+	int failures = 0;
+	const int rects[][4] =
+	{
+		{ 0, 0, fb.xres, fb.yres },
+		{ 0, 0, 1, 1 },
+		{ fb.xres - 1, fb.yres - 1, 1, 1 },
+		{ 3, 5, 17, 9 },
+		{ 0, fb.yres / 2, fb.xres, 40 },
+		{ fb.xres / 3, fb.yres / 3, fb.xres / 3, fb.yres / 3 },
+	};
+
+	for (size_t i = 0; i < sizeof(rects) / sizeof(rects[0]); i++)
+	{
+		/* same layout as the screen (single block path) and a padded buffer */
+		failures += !check_rect(fb, src, fb.line_length, rects[i][0], rects[i][1], rects[i][2], rects[i][3]);
+		failures += !check_rect(fb, src, padded_stride, rects[i][0], rects[i][1], rects[i][2], rects[i][3]);
+	}
+
+	double full = time_post(fb, src, padded_stride, 0, 0, fb.xres, fb.yres, iterations);
+	double status_bar = time_post(fb, src, padded_stride, 0, 0, fb.xres, fb.yres / 20, iterations);
+	double quarter = time_post(fb, src, padded_stride, fb.xres / 4, fb.yres / 4, fb.xres / 2, fb.yres / 2, iterations);
+
+	printf("%dx%d: full screen %.1f us, status bar %.1f us, centre quarter %.1f us\n",
+	       fb.xres, fb.yres, full, status_bar, quarter);
+	printf("%s\n", failures ? "FAILED" : "PASSED");
+
+	free(src);
+	free(fb.base);
+
+	return failures ? 1 : 0;
+}
@@ -35,29 +35,40 @@ struct memtrack_record record_templates[] = {
 	},
 };
 
+/*
+ * Second graphics record: the part of the gralloc buffers the process has
+ * mapped for CPU access. gralloc maps most buffers on demand only, so this
+ * is usually well below the allocated size reported in the first record.
+ */
+struct memtrack_record ion_record_templates[] = {
+	{
+	    .flags = MEMTRACK_FLAG_SMAPS_UNACCOUNTED |
+		     MEMTRACK_FLAG_PRIVATE |
+		     MEMTRACK_FLAG_NONSECURE,
+	},
+	{
+	    .flags = MEMTRACK_FLAG_SMAPS_ACCOUNTED |
+		     MEMTRACK_FLAG_SHARED |
+		     MEMTRACK_FLAG_NONSECURE,
+	},
+};
+
 int memtrack_init(const struct memtrack_module *module)
 {
 	return 0;
 }
 
-static int mali_memtrack_get_memory(pid_t pid, enum memtrack_type type,
-				    struct memtrack_record *records,
-				    size_t *num_records)
+/* Sum of the virtual size of the mappings of pid whose name starts with prefix */
+static int smaps_mapped_size(pid_t pid, const char *prefix, size_t *size)
 {
 	FILE *fp;
 	char tmp[128], line[1024];
 	char *name;
-	size_t unaccounted_size = 0;
 	unsigned long int start, end;
 	int name_pos;
+	size_t prefix_len = strlen(prefix);
 
-	size_t allocated_records = ARRAY_SIZE(record_templates);
-	*num_records = ARRAY_SIZE(record_templates);
-
-	if (records == NULL)
-		return 0;
-
-	memcpy(records, record_templates, sizeof(struct memtrack_record) * allocated_records);
+	*size = 0;
 
 	sprintf(tmp, "/proc/%d/smaps", pid);
 	fp = fopen(tmp, "r");
@@ -68,8 +79,8 @@ static int mali_memtrack_get_memory(pid_t pid, enum memtrack_type type,
 				while (isspace(line[name_pos]))
 					name_pos++;
 				name = line + name_pos;
-				if (!strncmp(name, "/dev/mali", 9))
-					unaccounted_size += end - start;
+				if (!strncmp(name, prefix, prefix_len))
+					*size += end - start;
 			}
 		}
 		fclose(fp);
@@ -79,6 +90,28 @@ static int mali_memtrack_get_memory(pid_t pid, enum memtrack_type type,
 		return -errno;
 	}
 
+	return 0;
+}
+
+static int mali_memtrack_get_memory(pid_t pid, enum memtrack_type type,
+				    struct memtrack_record *records,
+				    size_t *num_records)
+{
+	size_t unaccounted_size = 0;
+	int ret;
+
+	size_t allocated_records = ARRAY_SIZE(record_templates);
+	*num_records = ARRAY_SIZE(record_templates);
+
+	if (records == NULL)
+		return 0;
+
+	memcpy(records, record_templates, sizeof(struct memtrack_record) * allocated_records);
+
+	ret = smaps_mapped_size(pid, "/dev/mali", &unaccounted_size);
+	if (ret < 0)
+		return ret;
+
 	if (allocated_records > 0)
 		records[0].size_in_bytes = unaccounted_size;
 
@@ -92,16 +125,20 @@ static int ion_memtrack_get_memory(pid_t pid, enum memtrack_type type,
 	FILE *fp;
 	char line[1024];
 	size_t unaccounted_size = 0;
+	size_t mapped_size = 0;
 	unsigned int line_size;
 	int line_pid;
 
-	size_t allocated_records = ARRAY_SIZE(record_templates);
-	*num_records = ARRAY_SIZE(record_templates);
+	size_t allocated_records = *num_records;
+	*num_records = ARRAY_SIZE(ion_record_templates);
 
 	if (records == NULL)
 		return 0;
 
-	memcpy(records, record_templates, sizeof(struct memtrack_record) * allocated_records);
+	if (allocated_records > ARRAY_SIZE(ion_record_templates))
+		allocated_records = ARRAY_SIZE(ion_record_templates);
+
+	memcpy(records, ion_record_templates, sizeof(struct memtrack_record) * allocated_records);
 
 	fp = fopen("/sys/kernel/debug/ion/gralloc", "r");
 
@@ -122,6 +159,13 @@ static int ion_memtrack_get_memory(pid_t pid, enum memtrack_type type,
 	if (allocated_records > 0)
 		records[0].size_in_bytes = unaccounted_size;
 
+	/* ion buffers shared through dma_buf fds show up as anon_inode:dmabuf */
+	if (allocated_records > 1) {
+		if (smaps_mapped_size(pid, "anon_inode:dmabuf", &mapped_size) < 0)
+			mapped_size = 0;
+		records[1].size_in_bytes = mapped_size;
+	}
+
 	return 0;
 }
 
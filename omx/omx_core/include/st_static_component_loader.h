@@ -46,6 +46,7 @@ typedef struct stLoaderComponentType{
   OMX_ERRORTYPE (*constructor)(OMX_COMPONENTTYPE*,OMX_STRING cComponentName); /**< constructor function pointer for each Linux ST OpenMAX component */
   OMX_U32 nqualitylevels;/**< number of available quality levels */
   multiResourceDescriptor** multiResourceLevel;
+  unsigned int library; /**< index of the library providing the component in the loader's library list */
 } stLoaderComponentType;
 
 /** @brief The initialization of the ST specific component loader.
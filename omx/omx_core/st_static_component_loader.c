@@ -33,6 +33,10 @@
 #include <strings.h>
 #include <errno.h>
 #include <assert.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 
 #include "common.h"
 #include "st_static_component_loader.h"
@@ -43,17 +47,37 @@
 #define LOG_TAG "st_static_component_loader"
 #include <log/log.h>
 
-/** This pointer holds and handle allocate by this loader and requested by
- * some application. If the IL client does not de-allocate it calling
- * explicitly the FreeHandle function, any pending handle is release at the
- * end, when the global function OMX_Deinit is called. This list takes track of
- * any handle
+/** The component libraries known by this loader. A library is opened only
+ * when one of its components is created for the first time, the components
+ * and roles it provides are read from the registry file instead.
  */
-void *handleLibList[100];
-/** Current number of handles already allocated by this loader
+typedef struct stLoaderLibraryType {
+  const char* name;
+  void* handle;
+} stLoaderLibraryType;
+
+static stLoaderLibraryType libraryList[] = {
+  { "libhantrovideodec.so", NULL },
+  { "libhantrovideoenc.so", NULL },
+  { NULL, NULL }
+};
+
+/** Registry of the components and roles of the libraries in libraryList,
+ * generated at the first OMX_Init and regenerated whenever a library changes.
+ * The directory is created by init on stock Android (media:media 0700); it is
+ * created here if missing, and the file is made readable by every process
+ * using the core. A registry that can't be read or written only costs the
+ * library queries at OMX_Init.
  */
-OMX_U32 numLib = 0;
+#ifndef ST_REGISTRY_FILE
+#define ST_REGISTRY_FILE "/data/misc/media/hantro_omx_registry"
+#endif
+
+#ifndef ST_LIBRARY_DIR
+#define ST_LIBRARY_DIR "/system/lib/"
+#endif
 
+#define ST_REGISTRY_MAGIC "hantro-omx-registry 1"
 
 /** @brief The initialization of the ST specific component loader.
  *
@@ -69,80 +93,347 @@ void st_static_setup_component_loader(BOSA_COMPONENTLOADER * st_static_loader) {
 	  st_static_loader->BOSA_GetComponentsOfRole = &BOSA_ST_GetComponentsOfRole;
 }
 
+/** @brief Frees a component template and the strings it owns
+ */
+static void st_free_template(stLoaderComponentType* template) {
+  unsigned int j;
+
+  if(template->name_requested) {
+    free(template->name_requested);
+    template->name_requested = NULL;
+  }
+
+  for(j = 0 ; j < template->name_specific_length; j++){
+    if(template->name_specific && template->name_specific[j]) {
+      free(template->name_specific[j]);
+      template->name_specific[j] = NULL;
+    }
+    if(template->role_specific && template->role_specific[j]) {
+      free(template->role_specific[j]);
+      template->role_specific[j] = NULL;
+    }
+  }
+
+  if(template->name_specific) {
+    free(template->name_specific);
+    template->name_specific = NULL;
+  }
+  if(template->role_specific) {
+    free(template->role_specific);
+    template->role_specific = NULL;
+  }
+  if(template->name){
+    free(template->name);
+    template->name=NULL;
+  }
+  free(template);
+}
+
+/** @brief Frees a NULL terminated template list
+ */
+static void st_free_template_list(stLoaderComponentType** templateList) {
+  int i = 0;
+
+  if (templateList == NULL) {
+    return;
+  }
+  while(templateList[i]) {
+    st_free_template(templateList[i]);
+    templateList[i] = NULL;
+    i++;
+  }
+  free(templateList);
+}
+
+/** @brief Modification time and size of a library, used to notice a stale registry
+ */
+static void st_library_stamp(const char* name, long* mtime, long* size) {
+  char path[PATH_MAX];
+  struct stat st;
+
+  snprintf(path, sizeof(path), "%s%s", ST_LIBRARY_DIR, name);
+  if (stat(path, &st) != 0) {
+    *mtime = 0;
+    *size = 0;
+    return;
+  }
+  *mtime = (long)st.st_mtime;
+  *size = (long)st.st_size;
+}
+
+/** @brief Opens a library of libraryList if it is not open yet
+ *
+ * Called only when a component of the library is created, so a process
+ * that uses only the decoder never loads the encoder library at all. Bionic
+ * binds all symbols at load time, RTLD_LAZY or not.
+ */
+static void* st_open_library(unsigned int lib) {
+  if (libraryList[lib].handle == NULL) {
+    libraryList[lib].handle = dlopen(libraryList[lib].name, RTLD_LAZY);
+    if (libraryList[lib].handle == NULL) {
+      ALOGW("could not load %s: %s", libraryList[lib].name, dlerror());
+    } else {
+      ALOGV("openned %s", libraryList[lib].name);
+    }
+  }
+  return libraryList[lib].handle;
+}
+
+/** @brief Asks a library for the templates of its components
+ *
+ * Returns a NULL terminated list of the templates, or NULL if the library
+ * can't be used.
+ */
+static stLoaderComponentType** st_query_library(unsigned int lib) {
+  int (*fptr)(stLoaderComponentType **stComponents);
+  stLoaderComponentType** stComponents;
+  void* handle;
+  int num_of_comp;
+  int i;
+
+  if ((handle = st_open_library(lib)) == NULL) {
+    return NULL;
+  }
+  if ((fptr = dlsym(handle, "omx_component_library_Setup")) == NULL) {
+    ALOGW("the library %s is not compatible with ST static component loader - %s", libraryList[lib].name, dlerror());
+    return NULL;
+  }
+
+  num_of_comp = (int)(*fptr)(NULL);
+  stComponents = calloc(num_of_comp + 1, sizeof(stLoaderComponentType*));
+  if (stComponents == NULL) {
+    return NULL;
+  }
+  for (i = 0; i<num_of_comp; i++) {
+    stComponents[i] = calloc(1, sizeof(stLoaderComponentType));
+    if (stComponents[i] == NULL) {
+      st_free_template_list(stComponents);
+      return NULL;
+    }
+    stComponents[i]->library = lib;
+  }
+  (*fptr)(stComponents);
+
+  return stComponents;
+}
+
+/** @brief Appends a template to a NULL terminated template list
+ */
+static int st_add_template(stLoaderComponentType*** templateList, int* count,
+    stLoaderComponentType* template) {
+  stLoaderComponentType** list;
+
+  list = realloc(*templateList, (*count + 2) * sizeof (stLoaderComponentType*));
+  if (list == NULL) {
+    return -1;
+  }
+  list[(*count)++] = template;
+  list[*count] = NULL;
+  *templateList = list;
+
+  return 0;
+}
+
+/** @brief Reads the component templates from the registry file
+ *
+ * The registry is used only if every library in libraryList is still the
+ * one it was generated from. Returns NULL if it is missing or stale.
+ * The templates have no constructor until their library is opened.
+ */
+static stLoaderComponentType** st_read_registry(void) {
+  stLoaderComponentType** templateList = NULL;
+  stLoaderComponentType* template = NULL;
+  char line[3 * OMX_MAX_STRINGNAME_SIZE];
+  char name[OMX_MAX_STRINGNAME_SIZE];
+  char role[OMX_MAX_STRINGNAME_SIZE];
+  unsigned int lib, nroles, version;
+  unsigned int nlibs = 0, roles = 0;
+  long mtime, size, cur_mtime, cur_size;
+  int count = 0;
+  int ok = 1;
+  FILE* fp;
+
+  if ((fp = fopen(ST_REGISTRY_FILE, "r")) == NULL) {
+    return NULL;
+  }
+  if (fgets(line, sizeof(line), fp) == NULL ||
+      strncmp(line, ST_REGISTRY_MAGIC, strlen(ST_REGISTRY_MAGIC)) != 0) {
+    fclose(fp);
+    return NULL;
+  }
+
+  while (ok && fgets(line, sizeof(line), fp) != NULL) {
+    if (sscanf(line, "library %u %127s %ld %ld", &lib, name, &mtime, &size) == 4) {
+      /* libraries are listed in libraryList order */
+      if (lib != nlibs || libraryList[lib].name == NULL ||
+          strcmp(libraryList[lib].name, name) != 0) {
+        ok = 0;
+        break;
+      }
+      st_library_stamp(name, &cur_mtime, &cur_size);
+      if (mtime != cur_mtime || size != cur_size) {
+        ALOGV("%s changed since the registry was written", name);
+        ok = 0;
+        break;
+      }
+      nlibs++;
+    } else if (sscanf(line, "component %u %127s %x %u", &lib, name, &version, &nroles) == 4) {
+      if (lib >= nlibs || roles != 0) {
+        ok = 0;
+        break;
+      }
+      template = calloc(1, sizeof(stLoaderComponentType));
+      if (template == NULL || st_add_template(&templateList, &count, template) != 0) {
+        free(template);
+        ok = 0;
+        break;
+      }
+      template->library = lib;
+      template->componentVersion.nVersion = version;
+      template->name = calloc(1, OMX_MAX_STRINGNAME_SIZE);
+      template->name_specific = calloc(nroles + 1, sizeof(char *));
+      template->role_specific = calloc(nroles + 1, sizeof(char *));
+      if (template->name == NULL || template->name_specific == NULL ||
+          template->role_specific == NULL) {
+        ok = 0;
+        break;
+      }
+      strncpy(template->name, name, OMX_MAX_STRINGNAME_SIZE - 1);
+      roles = nroles;
+    } else if (sscanf(line, "role %127s %127s", name, role) == 2) {
+      unsigned int j;
+
+      if (template == NULL || roles == 0) {
+        ok = 0;
+        break;
+      }
+      j = template->name_specific_length++;
+      template->name_specific[j] = calloc(1, OMX_MAX_STRINGNAME_SIZE);
+      template->role_specific[j] = calloc(1, OMX_MAX_STRINGNAME_SIZE);
+      if (template->name_specific[j] == NULL || template->role_specific[j] == NULL) {
+        ok = 0;
+        break;
+      }
+      strncpy(template->name_specific[j], name, OMX_MAX_STRINGNAME_SIZE - 1);
+      strncpy(template->role_specific[j], role, OMX_MAX_STRINGNAME_SIZE - 1);
+      roles--;
+    } else {
+      ok = 0;
+    }
+  }
+  fclose(fp);
+
+  if (!ok || roles != 0 || count == 0 || libraryList[nlibs].name != NULL) {
+    ALOGV("ignoring registry %s", ST_REGISTRY_FILE);
+    st_free_template_list(templateList);
+    return NULL;
+  }
+
+  return templateList;
+}
+
+/** @brief Writes the component templates to the registry file
+ *
+ * The file is written under a temporary name and renamed, so a reader
+ * never sees it half written.
+ */
+static void st_write_registry(stLoaderComponentType** templateList) {
+  char path[PATH_MAX];
+  char* slash;
+  unsigned int lib, j;
+  long mtime, size;
+  int i, fd;
+  FILE* fp;
+
+  strncpy(path, ST_REGISTRY_FILE, sizeof(path) - 1);
+  path[sizeof(path) - 1] = '\0';
+  slash = strrchr(path, '/');
+  if (slash != NULL && slash != path) {
+    *slash = '\0';
+    if (mkdir(path, 0770) != 0 && errno != EEXIST) {
+      ALOGW("could not create %s: %s", path, strerror(errno));
+      return;
+    }
+  }
+
+  snprintf(path, sizeof(path), "%s.%d", ST_REGISTRY_FILE, (int)getpid());
+  fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    ALOGW("could not write %s: %s", path, strerror(errno));
+    return;
+  }
+  /* whatever the umask of the process writing it */
+  if (fchmod(fd, 0644) != 0 || (fp = fdopen(fd, "w")) == NULL) {
+    ALOGW("could not write %s: %s", path, strerror(errno));
+    close(fd);
+    unlink(path);
+    return;
+  }
+
+  fprintf(fp, "%s\n", ST_REGISTRY_MAGIC);
+  for (lib = 0; libraryList[lib].name != NULL; lib++) {
+    st_library_stamp(libraryList[lib].name, &mtime, &size);
+    fprintf(fp, "library %u %s %ld %ld\n", lib, libraryList[lib].name, mtime, size);
+  }
+  for (i = 0; templateList[i]; i++) {
+    fprintf(fp, "component %u %s %x %u\n", templateList[i]->library, templateList[i]->name,
+        (unsigned int)templateList[i]->componentVersion.nVersion, templateList[i]->name_specific_length);
+    for (j = 0; j < templateList[i]->name_specific_length; j++) {
+      fprintf(fp, "role %s %s\n", templateList[i]->name_specific[j], templateList[i]->role_specific[j]);
+    }
+  }
+
+  if (fclose(fp) != 0 || rename(path, ST_REGISTRY_FILE) != 0) {
+    ALOGW("could not write %s: %s", ST_REGISTRY_FILE, strerror(errno));
+    unlink(path);
+    return;
+  }
+  ALOGV("wrote %s", ST_REGISTRY_FILE);
+}
+
 /** @brief the ST static loader constructor
  *
  * This function creates the ST static component loader, and creates
- * the list of available components, based on a registry file
- * created by a separate application. It is called omxregister,
- * and must be called before the use of this loader
+ * the list of available components from the registry file. If there is no
+ * up to date registry, the component libraries are queried and the registry
+ * is written for the next time.
  */
-
 OMX_ERRORTYPE BOSA_ST_InitComponentLoader(BOSA_COMPONENTLOADER *loader) {
-  int num_of_comp=0;
   stLoaderComponentType** templateList;
-  stLoaderComponentType** stComponentsTemp;
-  void* handle;
-  int (*fptr)(stLoaderComponentType **stComponents);
+  stLoaderComponentType** stComponents;
+  unsigned int lib;
+  int count = 0;
   int i;
-  int listindex;
 
-  templateList = malloc(sizeof (stLoaderComponentType*));
-  templateList[0] = NULL;
-
-  /* Setup lib names */
   ALOGV("[%s] start", __func__);
-/*
-  char *libnames[5];
-  libnames[0] = (char*)malloc(NAME_MAX);
-  sprintf(libnames[0], "libhantrovideodec.so");
-  libnames[1] = (char*)malloc(NAME_MAX);
-  sprintf(libnames[1], "libhantroimagedec.so");
-  libnames[2] = (char*)malloc(NAME_MAX);
-  sprintf(libnames[2], "libhantrovideoenc.so");
-  libnames[3] = (char*)malloc(NAME_MAX);
-  sprintf(libnames[3], "libhantroimageenc.so");
-  libnames[4] = NULL;
-*/
-  char *libnames[3];
-  libnames[0] = (char*)malloc(NAME_MAX);
-  sprintf(libnames[0], "libhantrovideodec.so");
-  libnames[1] = (char*)malloc(NAME_MAX);
-  sprintf(libnames[1], "libhantrovideoenc.so");
-  libnames[2] = NULL;
-
-  ALOGV("[%s] after setting up libnames", __func__);
-
-  listindex = 0;
-  while (libnames[listindex] != NULL) {
-	  ALOGV("libname: %s",libnames[listindex]);
-	  if ((handle = dlopen(libnames[listindex], RTLD_NOW)) == NULL) {
-		ALOGW("could not load %s: %s", libnames[listindex], dlerror());
-	  } else {
-		ALOGV("openned %s", libnames[listindex]);
-		handleLibList[numLib]=handle;
-		numLib++;
-		ALOGV("openned %s (%d)", libnames[listindex], __LINE__);
-		if ((fptr = dlsym(handle, "omx_component_library_Setup")) == NULL) {
-		  ALOGW("the library %s is not compatible with ST static component loader - %s", libnames[listindex], dlerror());
-		} else {
-		  ALOGV("dlsym was success");
-		  num_of_comp = (int)(*fptr)(NULL);
-		  templateList = realloc(templateList, (listindex + num_of_comp + 1) * sizeof (stLoaderComponentType*));
-		  templateList[listindex + num_of_comp] = NULL;
-		  stComponentsTemp = calloc(num_of_comp, sizeof(stLoaderComponentType*));
-		  for (i = 0; i<num_of_comp; i++) {
-			stComponentsTemp[i] = calloc(1, sizeof(stLoaderComponentType));
-		  }
-		  (*fptr)(stComponentsTemp);
-		  for (i = 0; i<num_of_comp; i++) {
-			templateList[listindex + i] = stComponentsTemp[i];
-			ALOGV("In %s comp name[%d]=%s",__func__,listindex + i,templateList[listindex + i]->name);
-		  }
-		  free(stComponentsTemp);
-		  stComponentsTemp = NULL;
-		  listindex+= i;
-		}
-	  }
+
+  templateList = st_read_registry();
+  if (templateList == NULL) {
+    templateList = calloc(1, sizeof (stLoaderComponentType*));
+    if (templateList == NULL) {
+      return OMX_ErrorInsufficientResources;
+    }
+
+    for (lib = 0; libraryList[lib].name != NULL; lib++) {
+      ALOGV("libname: %s", libraryList[lib].name);
+      if ((stComponents = st_query_library(lib)) == NULL) {
+        continue;
+      }
+      for (i = 0; stComponents[i]; i++) {
+        if (st_add_template(&templateList, &count, stComponents[i]) != 0) {
+          while (stComponents[i]) {
+            st_free_template(stComponents[i++]);
+          }
+          break;
+        }
+        ALOGV("In %s comp name[%d]=%s", __func__, count - 1, stComponents[i]->name);
+      }
+      free(stComponents);
+    }
+
+    if (count > 0) {
+      st_write_registry(templateList);
+    }
   }
 
   loader->loaderPrivate = templateList;
@@ -158,66 +449,54 @@ OMX_ERRORTYPE BOSA_ST_InitComponentLoader(BOSA_COMPONENTLOADER *loader) {
  * This function deallocates the list of available components.
  */
 OMX_ERRORTYPE BOSA_ST_DeInitComponentLoader(BOSA_COMPONENTLOADER *loader) {
-  unsigned int i, j;
+  unsigned int i;
   int err;
-  stLoaderComponentType** templateList;
   ALOGD("In %s", __func__);
-  templateList = (stLoaderComponentType**)loader->loaderPrivate;
 
-  ALOGV("In %s", __func__);
+  st_free_template_list((stLoaderComponentType**)loader->loaderPrivate);
+  loader->loaderPrivate = NULL;
 
-  i = 0;
-  while(templateList[i]) {
-    if(templateList[i]->name_requested) {
-      free(templateList[i]->name_requested);
-      templateList[i]->name_requested = NULL;
+  for(i = 0; libraryList[i].name != NULL; i++) {
+    if(libraryList[i].handle == NULL) {
+      continue;
     }
-
-    for(j = 0 ; j < templateList[i]->name_specific_length; j++){
-      if(templateList[i]->name_specific[j]) {
-        free(templateList[i]->name_specific[j]);
-        templateList[i]->name_specific[j] = NULL;
-      }
-      if(templateList[i]->role_specific[j]) {
-        free(templateList[i]->role_specific[j]);
-        templateList[i]->role_specific[j] = NULL;
-      }
-    }
-
-    if(templateList[i]->name_specific) {
-      free(templateList[i]->name_specific);
-      templateList[i]->name_specific = NULL;
-    }
-    if(templateList[i]->role_specific) {
-      free(templateList[i]->role_specific);
-      templateList[i]->role_specific = NULL;
-    }
-    if(templateList[i]->name){
-      free(templateList[i]->name);
-      templateList[i]->name=NULL;
-    }
-    free(templateList[i]);
-    templateList[i] = NULL;
-    i++;
-  }
-  if(templateList) {
-    free(templateList);
-    templateList = NULL;
-  }
-
-  for(i = 0; i < numLib; i++) {
-    err = dlclose(handleLibList[i]);
+    err = dlclose(libraryList[i].handle);
     if(err != 0) {
       ALOGW("In %s Error %d in dlclose of lib %i", __func__,err,i);
     }
+    libraryList[i].handle = NULL;
   }
 
-  numLib = 0;
-
   ALOGV( "Out of %s", __func__);
   return OMX_ErrorNone;
 }
 
+/** @brief Looks up the constructor of a component read from the registry
+ *
+ * Opens the library of the component and copies the constructor from the
+ * template the library sets up for it.
+ */
+static OMX_ERRORTYPE st_resolve_constructor(stLoaderComponentType* template) {
+  stLoaderComponentType** stComponents;
+  int i;
+
+  if ((stComponents = st_query_library(template->library)) == NULL) {
+    return OMX_ErrorComponentNotFound;
+  }
+  for (i = 0; stComponents[i]; i++) {
+    if (stComponents[i]->name && !strcmp(stComponents[i]->name, template->name)) {
+      template->constructor = stComponents[i]->constructor;
+    }
+  }
+  st_free_template_list(stComponents);
+
+  if (template->constructor == NULL) {
+    ALOGE("%s does not provide %s", libraryList[template->library].name, template->name);
+    return OMX_ErrorComponentNotFound;
+  }
+  return OMX_ErrorNone;
+}
+
 /** @brief creator of the requested OpenMAX component
  *
  * This function searches for the requested component in the internal list.
@@ -269,6 +548,12 @@ OMX_ERRORTYPE BOSA_ST_CreateComponent(
 
   //component name matches with general component name field
   ALOGV("Found base requested template %s", cComponentName);
+  if (templateList[componentPosition]->constructor == NULL) {
+    eError = st_resolve_constructor(templateList[componentPosition]);
+    if (eError != OMX_ErrorNone) {
+      return eError;
+    }
+  }
   /* Build ST component from template and fill fields */
   if (templateList[componentPosition]->name_requested == NULL)
   {    /* This check is to prevent memory leak in case two instances of the same component are loaded */
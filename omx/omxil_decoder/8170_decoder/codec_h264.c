@@ -87,6 +87,11 @@ static void decoder_destroy_h264(CODEC_PROTOTYPE * arg)
 
         if (this->instance)
         {
+            H264DecInfo info;
+
+            if (H264DecGetInfo(this->instance, &info) == H264DEC_OK)
+                ALOGI("DPB: %u picture buffers allocated, %u KB saved",
+                      info.picBuffAllocated, info.picBuffBytesSaved / 1024);
             H264DecRelease(this->instance);
             this->instance = 0;
         }
@@ -129,6 +134,8 @@ static CODEC_STATE decoder_decode_h264(CODEC_PROTOTYPE * arg,
     input.streamBusAddress = buf->bus_address;
     input.dataLen = buf->streamlen;
     input.picId = this->picId;
+    input.skipNonReference = buf->skip == DECODE_SKIP_NON_REFERENCE;
+    input.skipNonIntra = buf->skip == DECODE_SKIP_NON_INTRA;
     TRACE_PRINT( "Pic id %d, stream lenght %d \n", input.picId,
                 input.dataLen);
     *consumed = 0;
@@ -216,6 +223,10 @@ static CODEC_STATE decoder_decode_h264(CODEC_PROTOTYPE * arg,
     case H264DEC_ADVANCED_TOOLS:
         stat = CODEC_NEED_MORE;
         break;
+    case H264DEC_NONREF_PIC_SKIPPED:
+        this->picId++;
+        stat = CODEC_PIC_SKIPPED;
+        break;
     case H264DEC_STRM_PROCESSED:
         stat = CODEC_NEED_MORE;
         break;
@@ -480,6 +491,73 @@ static int decoder_scanframe_h264(CODEC_PROTOTYPE * arg, STREAM_BUFFER * buf,
 #endif
 }
 
+// read an ue(v) syntax element, emulation prevention bytes are not removed
+// which is fine for the first few fields of a slice header
+static OMX_U32 read_ue(const OMX_U8 * data, OMX_U32 len, OMX_U32 * bit)
+{
+    OMX_U32 zeros = 0;
+    OMX_U32 val = 0;
+    OMX_U32 n;
+
+    while (*bit < len * 8 && !((data[*bit >> 3] >> (7 - (*bit & 7))) & 1))
+    {
+        zeros++;
+        (*bit)++;
+    }
+    if (zeros > 31 || *bit + 1 + zeros > len * 8)
+        return 0xFFFFFFFF;
+    (*bit)++;
+    for (n = 0; n < zeros; n++)
+    {
+        val = (val << 1) | ((data[*bit >> 3] >> (7 - (*bit & 7))) & 1);
+        (*bit)++;
+    }
+    return (1U << zeros) - 1 + val;
+}
+
+static int decoder_keyframe_h264(CODEC_PROTOTYPE * arg, STREAM_BUFFER * buf)
+{
+    // the first slice NAL unit of the access unit decides: IDR pictures
+    // start a closed GOP, I slices (also non-IDR ones, streams may have a
+    // single IDR) an open one. An access unit that updates the parameter
+    // sets is always decoded, whatever its slices.
+    const OMX_U8 *data = buf->bus_data;
+    OMX_BOOL param_sets = OMX_FALSE;
+    OMX_U32 i;
+
+    for (i = 0; i + 4 < buf->streamlen; ++i)
+    {
+        if (data[i] || data[i + 1] || data[i + 2] != 0x01)
+            continue;
+
+        OMX_U32 type = data[i + 3] & 0x1F;
+
+        if (type == 7 || type == 8)
+            param_sets = OMX_TRUE;
+        if (type == 5)
+            return KEYFRAME_CLOSED;
+        if (type == 1)
+        {
+            OMX_U32 bit = 0;
+            OMX_U32 len = buf->streamlen - (i + 4);
+
+            read_ue(data + i + 4, len, &bit); // first_mb_in_slice
+            OMX_U32 slice_type = read_ue(data + i + 4, len, &bit);
+
+            if (slice_type == 0xFFFFFFFF)
+                return KEYFRAME_UNKNOWN;
+            slice_type %= 5;
+            if (slice_type == 2 || slice_type == 4)
+                return KEYFRAME_OPEN;
+            if (param_sets)
+                return KEYFRAME_UNKNOWN;
+            return slice_type == 1 ? KEYFRAME_B : KEYFRAME_INTER;
+        }
+        i += 2;
+    }
+    return KEYFRAME_UNKNOWN;
+}
+
 static CODEC_STATE decoder_setppargs_h264(CODEC_PROTOTYPE * codec,
                                           PP_ARGS * args)
 {
@@ -551,7 +629,8 @@ static CODEC_STATE decoder_setscaling_h264(CODEC_PROTOTYPE *codec, OMX_U32 width
 #endif
 
 // create codec instance and initialize it
-CODEC_PROTOTYPE *HantroHwDecOmx_decoder_create_h264(OMX_BOOL conceal_errors)
+CODEC_PROTOTYPE *HantroHwDecOmx_decoder_create_h264(OMX_BOOL conceal_errors,
+                                                    OMX_BOOL low_latency)
 {
     CODEC_H264 *this = OSAL_Malloc(sizeof(CODEC_H264));
 
@@ -562,6 +641,7 @@ CODEC_PROTOTYPE *HantroHwDecOmx_decoder_create_h264(OMX_BOOL conceal_errors)
     this->base.getinfo = decoder_getinfo_h264;
     this->base.getframe = decoder_getframe_h264;
     this->base.scanframe = decoder_scanframe_h264;
+    this->base.keyframe = decoder_keyframe_h264;
     this->base.setppargs = decoder_setppargs_h264;
 #ifdef DYNAMIC_SCALING
     this->base.setscaling = decoder_setscaling_h264;
@@ -577,6 +657,10 @@ CODEC_PROTOTYPE *HantroHwDecOmx_decoder_create_h264(OMX_BOOL conceal_errors)
     if (ret == H264DEC_OK)
         ret = H264DecSetMvc(this->instance);
 #endif
+    // output in decoding order, no waiting for the DPB to fill up, unless
+    // the SPS of the stream signals reordering
+    if (ret == H264DEC_OK && low_latency)
+        ret = H264DecSetLowLatency(this->instance);
 #endif
 
 #ifdef IS_8190
@@ -29,7 +29,9 @@ extern "C"
 
 // create codec instance
     CODEC_PROTOTYPE *HantroHwDecOmx_decoder_create_h264(OMX_BOOL
-                                                        conceal_errors);
+                                                        conceal_errors,
+                                                        OMX_BOOL
+                                                        low_latency);
 
 #ifdef __cplusplus
 }
@@ -17,6 +17,11 @@
 --
 ------------------------------------------------------------------------------*/
 
+//#define LOG_NDEBUG 0
+#define LOG_TAG "omxil_decoder_jpeg"
+#include <log/log.h>
+#define TRACE_PRINT ALOGV
+
 #include "codec_jpeg.h"
 #include "post_processor.h"
 #include <jpegdecapi.h>
@@ -68,6 +73,12 @@ typedef struct CODEC_JPEG
     OMX_BOOL forcedSlice;
     OMX_U32 imageSize;
     OMX_BOOL ppInfoSet;
+    OMX_BOOL ppSliced;
+
+    // decode the embedded thumbnail when it covers this size
+    OMX_BOOL thumbnail;
+    OMX_U32 thumbWidth;
+    OMX_U32 thumbHeight;
 
 } CODEC_JPEG;
 
@@ -102,6 +113,156 @@ static OMX_U32 decoder_offset_ratio(OMX_U32 sampling)
 
 }
 
+// pick the cheapest source for the requested output: the embedded thumbnail
+// if it is at least as large, otherwise the full image. When the thumbnail is
+// used, its properties replace the full image info for the rest of the decode.
+static void decoder_select_image_jpeg(CODEC_JPEG * this)
+{
+    this->input.decImageType = JPEGDEC_IMAGE;
+
+    if (!this->thumbnail || this->mjpeg)
+        return;
+
+    if (this->info.thumbnailType != JPEGDEC_THUMBNAIL_JPEG ||
+        this->info.outputWidthThumb < this->thumbWidth ||
+        this->info.outputHeightThumb < this->thumbHeight)
+        return;
+
+    TRACE_PRINT("decoding %ux%u thumbnail instead of %ux%u image\n",
+                this->info.outputWidthThumb, this->info.outputHeightThumb,
+                this->info.outputWidth, this->info.outputHeight);
+
+    this->input.decImageType = JPEGDEC_THUMBNAIL;
+    this->info.displayWidth = this->info.displayWidthThumb;
+    this->info.displayHeight = this->info.displayHeightThumb;
+    this->info.outputWidth = this->info.outputWidthThumb;
+    this->info.outputHeight = this->info.outputHeightThumb;
+    this->info.outputFormat = this->info.outputFormatThumb;
+    this->info.codingMode = this->info.codingModeThumb;
+}
+
+// check if standalone pp can be run slice by slice straight into the output
+// frame. Each slice must map 1:1 to a band of output rows (or columns when
+// rotated by 90 degrees), so scaling and masks need the whole image.
+static OMX_BOOL decoder_pp_can_slice_jpeg(const CODEC_JPEG * this)
+{
+    const PPConfig *cfg = &this->pp_config;
+
+    OMX_U32 width = this->info.outputWidth;
+
+    OMX_U32 top = 0;
+
+    OMX_U32 height = this->info.outputHeight;
+
+    if (this->pp_state != PP_STANDALONE || !this->forcedSlice)
+        return OMX_FALSE;
+
+    if (cfg->ppOutMask1.enable || cfg->ppOutMask2.enable)
+        return OMX_FALSE;
+
+    if (cfg->ppInCrop.enable)
+    {
+        width = cfg->ppInCrop.width;
+        top = cfg->ppInCrop.originY;
+        height = cfg->ppInCrop.height;
+    }
+    // slices start on MCU rows, so must the cropped area
+    if (top % MCU_SIZE || height % MCU_SIZE)
+        return OMX_FALSE;
+
+    if (cfg->ppInRotation.rotation == PP_ROTATION_LEFT_90 ||
+        cfg->ppInRotation.rotation == PP_ROTATION_RIGHT_90)
+        return cfg->ppOutImg.width == height && cfg->ppOutImg.height == width;
+
+    return cfg->ppOutImg.width == width && cfg->ppOutImg.height == height;
+}
+
+// run standalone pp on one decoded slice. The slice is read from the
+// decoder's own slice buffer and written at its position in the output frame
+// using the pp frame buffer mode, so no full size copy of the image is needed.
+static CODEC_STATE decoder_pp_slice_jpeg(CODEC_JPEG * this,
+                                         const JpegDecOutput * output,
+                                         OMX_U32 row, OMX_U32 rows,
+                                         FRAME * frame)
+{
+    PPConfig slice = this->pp_config;
+
+    OMX_U32 left = 0;
+
+    OMX_U32 width = this->info.outputWidth;
+
+    OMX_U32 top = 0;
+
+    OMX_U32 height = this->info.outputHeight;
+
+    if (this->pp_config.ppInCrop.enable)
+    {
+        left = this->pp_config.ppInCrop.originX;
+        width = this->pp_config.ppInCrop.width;
+        top = this->pp_config.ppInCrop.originY;
+        height = this->pp_config.ppInCrop.height;
+    }
+
+    // rows of this slice inside the cropped area
+    OMX_U32 first = row > top ? row : top;
+
+    OMX_U32 last = row + rows < top + height ? row + rows : top + height;
+
+    if (first >= last)
+        return CODEC_OK;
+
+    HantroHwDecOmx_pp_set_input_buffer_planes(&slice,
+                                              output->outputPictureY.busAddress,
+                                              output->outputPictureCbCr.
+                                              busAddress);
+    slice.ppInImg.height = rows;
+    slice.ppInCrop.enable = 1;
+    slice.ppInCrop.originX = left;
+    slice.ppInCrop.originY = first - row;
+    slice.ppInCrop.width = width;
+    slice.ppInCrop.height = last - first;
+
+    // planes are laid out for the whole output picture
+    HantroHwDecOmx_pp_set_output_buffer(&slice, frame);
+    slice.ppOutFrmBuffer.enable = 1;
+    slice.ppOutFrmBuffer.frameBufferWidth = this->pp_config.ppOutImg.width;
+    slice.ppOutFrmBuffer.frameBufferHeight = this->pp_config.ppOutImg.height;
+    slice.ppOutFrmBuffer.writeOriginX = 0;
+    slice.ppOutFrmBuffer.writeOriginY = 0;
+
+    switch (slice.ppInRotation.rotation)
+    {
+    case PP_ROTATION_LEFT_90:
+        slice.ppOutImg.width = last - first;
+        slice.ppOutFrmBuffer.writeOriginX = first - top;
+        break;
+    case PP_ROTATION_RIGHT_90:
+        slice.ppOutImg.width = last - first;
+        slice.ppOutFrmBuffer.writeOriginX = top + height - last;
+        break;
+    case PP_ROTATION_180:
+    case PP_ROTATION_VER_FLIP:
+        slice.ppOutImg.height = last - first;
+        slice.ppOutFrmBuffer.writeOriginY = top + height - last;
+        break;
+    default:
+        slice.ppOutImg.height = last - first;
+        slice.ppOutFrmBuffer.writeOriginY = first - top;
+        break;
+    }
+
+    PPResult res = HantroHwDecOmx_pp_set(this->pp_instance, &slice);
+
+    if (res != PP_OK)
+        return CODEC_ERROR_UNSPECIFIED;
+
+    res = HantroHwDecOmx_pp_execute(this->pp_instance);
+    if (res != PP_OK)
+        return CODEC_ERROR_UNSPECIFIED;
+
+    return CODEC_OK;
+}
+
 // destroy codec instance
 static void decoder_destroy_jpeg(CODEC_PROTOTYPE * arg)
 {
@@ -159,16 +320,17 @@ static CODEC_STATE decoder_decode_jpeg(CODEC_PROTOTYPE * arg,
     this->input.streamBuffer.busAddress = buf->bus_address;
     this->input.streamLength = buf->streamlen;
     this->input.bufferSize = 0; // note: use this if streamlen > 2097144
-    this->input.decImageType = JPEGDEC_IMAGE;   // Only fullres supported
 
     if (this->state == JPEG_PARSE_HEADERS)
     {
+        this->input.decImageType = JPEGDEC_IMAGE;
         JpegDecRet ret =
             JpegDecGetImageInfo(this->instance, &this->input, &this->info);
         *consumed = 0;
         switch (ret)
         {
         case JPEGDEC_OK:
+            decoder_select_image_jpeg(this);
             if (this->pp_state != PP_PIPELINE && 
                 (this->pp_config.ppOutImg.pixFormat != 
                  this->info.outputFormat))
@@ -263,7 +425,23 @@ static CODEC_STATE decoder_decode_jpeg(CODEC_PROTOTYPE * arg,
         {
         case JPEGDEC_FRAME_READY:
 
-            if (this->Y.bus_address)
+            if (this->ppSliced)
+            {
+                // last slice, the rest of the picture is already in the frame
+                CODEC_STATE state =
+                    decoder_pp_slice_jpeg(this, &output,
+                                          this->info.outputHeight -
+                                          this->scanLinesLeft,
+                                          this->scanLinesLeft, frame);
+                if (state != CODEC_OK)
+                {
+                    return state;
+                }
+
+                frame->size = HantroHwDecOmx_pp_get_framesize(&this->pp_config);
+                this->scanLinesLeft = 0;
+            }
+            else if (this->Y.bus_address)
             {
                 assert(this->pp_state == PP_STANDALONE);
                 OMX_U32 luma = this->info.outputWidth * this->scanLinesLeft;
@@ -357,6 +535,8 @@ static CODEC_STATE decoder_decode_jpeg(CODEC_PROTOTYPE * arg,
 
         case JPEGDEC_SLICE_READY:
             {
+                OMX_U32 row = this->info.outputHeight - this->scanLinesLeft;
+
                 if (!this->forcedSlice)
                     frame->size = this->scanLineSize * this->sliceHeight;
                 this->scanLinesLeft -= this->sliceHeight;
@@ -375,7 +555,18 @@ static CODEC_STATE decoder_decode_jpeg(CODEC_PROTOTYPE * arg,
                     break;
                 }
 
-                if (this->pp_state == PP_STANDALONE)
+                if (this->ppSliced)
+                {
+                    // pp the slice while it is still in the decoder's buffer.
+                    // the frame is complete only after the last slice
+                    CODEC_STATE state =
+                        decoder_pp_slice_jpeg(this, &output, row,
+                                              this->sliceHeight, frame);
+                    if (state != CODEC_OK)
+                        return state;
+                    frame->size = 0;
+                }
+                else if (this->pp_state == PP_STANDALONE)
                 {
                     if (this->Y.bus_address == 0)
                     {
@@ -570,6 +761,7 @@ static CODEC_STATE decoder_getinfo_jpeg(CODEC_PROTOTYPE * arg,
         this->ppInfoSet = OMX_TRUE;
         pkg->imageSize = HantroHwDecOmx_pp_get_framesize(&this->pp_config);
     }
+    this->ppSliced = decoder_pp_can_slice_jpeg(this);
 
     return CODEC_OK;
 }
@@ -639,6 +831,22 @@ static CODEC_STATE decoder_setppargs_jpeg(CODEC_PROTOTYPE * codec,
             HantroHwDecOmx_pp_set_output(&this->pp_config, args, OMX_FALSE);
         if (this->transforms == PPTR_ARG_ERROR)
             return CODEC_ERROR_INVALID_ARGUMENT;
+
+        // crop is given in full image coordinates, so it rules out the
+        // thumbnail. Without a target size there is nothing to compare to.
+        this->thumbnail = args->thumbnail && !(this->transforms & PPTR_CROP) &&
+            args->scale.width > 0 && args->scale.height > 0;
+        if (args->rotation == ROTATE_LEFT_90 ||
+            args->rotation == ROTATE_RIGHT_90)
+        {
+            this->thumbWidth = args->scale.height;
+            this->thumbHeight = args->scale.width;
+        }
+        else
+        {
+            this->thumbWidth = args->scale.width;
+            this->thumbHeight = args->scale.height;
+        }
 #ifdef ENABLE_PP
         if (this->transforms == PPTR_NONE)
         {
@@ -695,8 +903,10 @@ CODEC_PROTOTYPE *HantroHwDecOmx_decoder_create_jpeg(OMX_BOOL motion_jpeg)
 #ifdef ENABLE_CODEC_MJPEG
     this->input.motionJpeg = motion_jpeg;
 #endif
+    this->mjpeg = motion_jpeg;
     this->forcedSlice = OMX_FALSE;
     this->ppInfoSet = OMX_FALSE;
+    this->ppSliced = OMX_FALSE;
 
     if (ret != JPEGDEC_OK)
     {
@@ -126,6 +126,8 @@ static CODEC_STATE decoder_decode_mpeg2(CODEC_PROTOTYPE * arg,
     input.dataLen = buf->streamlen;
     frame->size = 0;
     input.picId = this->picId;
+    input.skipNonReference = buf->skip == DECODE_SKIP_NON_REFERENCE;
+    input.skipNonIntra = buf->skip == DECODE_SKIP_NON_INTRA;
 
 #ifdef MPEG2_DECODE_STATISTICS
     struct timeval tv1, tv2;
@@ -168,6 +170,10 @@ static CODEC_STATE decoder_decode_mpeg2(CODEC_PROTOTYPE * arg,
         this->picId++;
         stat = CODEC_HAS_FRAME;
         break;
+    case MPEG2DEC_NONREF_PIC_SKIPPED:
+        this->picId++;
+        stat = CODEC_PIC_SKIPPED;
+        break;
     case MPEG2DEC_HDRS_RDY:
         if (this->pp_state == PP_PIPELINE)
         {
@@ -378,6 +384,23 @@ static CODEC_STATE decoder_getframe_mpeg2(CODEC_PROTOTYPE * arg, FRAME * frame,
     return CODEC_ERROR_UNSPECIFIED;
 }
 
+/* Picture coding type of the first picture header in the buffer */
+
+static int decoder_keyframe_mpeg2(CODEC_PROTOTYPE * arg, STREAM_BUFFER * buf)
+{
+    const OMX_U8 *data = buf->bus_data;
+    OMX_U32 i;
+
+    for (i = 0; i + 5 < buf->streamlen; ++i)
+    {
+        // picture_start_code, temporal_reference (10), picture_coding_type (3)
+        if (!data[i] && !data[i + 1] && data[i + 2] == 0x01 && !data[i + 3])
+            return ((data[i + 5] >> 3) & 0x07) == 1 ? KEYFRAME_CLOSED :
+                KEYFRAME_INTER;
+    }
+    return KEYFRAME_UNKNOWN;
+}
+
 /* Find first and last startcode of stream. places masked by "first" and "last" */
 
 static int decoder_scanframe_mpeg2(CODEC_PROTOTYPE * arg, STREAM_BUFFER * buf,
@@ -506,6 +529,7 @@ CODEC_PROTOTYPE *HantroHwDecOmx_decoder_create_mpeg2(void)
     this->base.getinfo = decoder_getinfo_mpeg2;
     this->base.getframe = decoder_getframe_mpeg2;
     this->base.scanframe = decoder_scanframe_mpeg2;
+    this->base.keyframe = decoder_keyframe_mpeg2;
     this->base.setppargs = decoder_setppargs_mpeg2;
 #ifdef DYNAMIC_SCALING
 	this->base.setscaling = decoder_setscaling_mpeg2;
@@ -157,6 +157,8 @@ static CODEC_STATE decoder_decode_mpeg4(CODEC_PROTOTYPE * arg,
     input.enableDeblock = this->enableDeblock;
     frame->size = 0;
     input.picId = this->picId;
+    input.skipNonReference = buf->skip == DECODE_SKIP_NON_REFERENCE;
+    input.skipNonIntra = buf->skip == DECODE_SKIP_NON_INTRA;
 
 #ifdef MPEG4_DECODE_STATISTICS
     struct timeval tv1, tv2;
@@ -222,6 +224,11 @@ static CODEC_STATE decoder_decode_mpeg4(CODEC_PROTOTYPE * arg,
         TRACE_PRINT("MP4DecDecode: STRM_PROCESSED\n");
         stat = CODEC_NEED_MORE;
         break;
+    case MP4DEC_NONREF_PIC_SKIPPED:
+        TRACE_PRINT("MP4DecDecode: NONREF_PIC_SKIPPED\n");
+        this->picId++;
+        stat = CODEC_PIC_SKIPPED;
+        break;
     case MP4DEC_VOS_END:   //NOTE: ??
         TRACE_PRINT("MP4DecDecode: VOS_END\n");
         stat = CODEC_HAS_FRAME;
@@ -455,6 +462,35 @@ static CODEC_STATE decoder_getframe_mpeg4(CODEC_PROTOTYPE * arg, FRAME * frame,
     return CODEC_ERROR_UNSPECIFIED;
 }
 
+static int decoder_keyframe_mpeg4(CODEC_PROTOTYPE * arg, STREAM_BUFFER * buf)
+{
+    CODEC_MPEG4 *this = (CODEC_MPEG4 *) arg;
+    const OMX_U8 *data = buf->bus_data;
+    OMX_U32 i;
+
+    assert(this);
+    // Sorenson and the custom formats have their own picture headers
+    if (this->format != MPEG4FORMAT_MPEG4)
+        return KEYFRAME_UNKNOWN;
+
+    for (i = 0; i + 4 < buf->streamlen; ++i)
+    {
+        if (data[i] || data[i + 1])
+            continue;
+        // vop_start_code, vop_coding_type (2)
+        if (data[i + 2] == 0x01 && data[i + 3] == 0xB6)
+            return (data[i + 4] >> 6) == 0 ? KEYFRAME_CLOSED : KEYFRAME_INTER;
+        // short video header at the buffer start: PSC (22), TR (8), PTYPE
+        if (i == 0 && (data[i + 2] & 0xFC) == 0x80)
+        {
+            if (((data[i + 4] >> 2) & 0x07) == 0x07)
+                return KEYFRAME_UNKNOWN;
+            return (data[i + 4] & 0x02) ? KEYFRAME_INTER : KEYFRAME_CLOSED;
+        }
+    }
+    return KEYFRAME_UNKNOWN;
+}
+
 static int decoder_scanframe_mpeg4(CODEC_PROTOTYPE * arg, STREAM_BUFFER * buf,
                                    OMX_U32 * first, OMX_U32 * last)
 {
@@ -594,6 +630,7 @@ CODEC_PROTOTYPE *HantroHwDecOmx_decoder_create_mpeg4(OMX_BOOL enable_deblocking,
     this->base.getinfo = decoder_getinfo_mpeg4;
     this->base.getframe = decoder_getframe_mpeg4;
     this->base.scanframe = decoder_scanframe_mpeg4;
+    this->base.keyframe = decoder_keyframe_mpeg4;
     this->base.setppargs = decoder_setppargs_mpeg4;
 #ifdef DYNAMIC_SCALING
 	this->base.setscaling = decoder_setscaling_mpeg4;
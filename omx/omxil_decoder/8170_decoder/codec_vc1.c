@@ -222,6 +222,8 @@ static CODEC_STATE decoder_decode_vc1(CODEC_PROTOTYPE * arg,
         input.streamBusAddress = buf->bus_address;
         input.streamSize = buf->streamlen;
         input.picId = 0;
+        input.skipNonReference = buf->skip == DECODE_SKIP_NON_REFERENCE;
+        input.skipNonIntra = buf->skip == DECODE_SKIP_NON_INTRA;
 
         if (this->pp_state == PP_PIPELINE && this->update_pp_out == OMX_TRUE)
         {
@@ -281,6 +283,12 @@ static CODEC_STATE decoder_decode_vc1(CODEC_PROTOTYPE * arg,
             return CODEC_HAS_INFO;  //??
         case VC1DEC_STRM_PROCESSED:
             return CODEC_NEED_MORE;
+        case VC1DEC_NONREF_PIC_SKIPPED:
+            if (this->metadata.profile != 8)
+            {
+                *consumed = buf->streamlen;
+            }
+            return CODEC_PIC_SKIPPED;
         case VC1DEC_PARAM_ERROR:
             return CODEC_ERROR_INVALID_ARGUMENT;
         case VC1DEC_NOT_INITIALIZED:
@@ -515,6 +523,107 @@ static int decoder_scanframe_vc1(CODEC_PROTOTYPE * arg, STREAM_BUFFER * buf,
     }
 }
 
+// next bit of the picture header, 1 past the end of the buffer
+static OMX_U32 read_bit(const OMX_U8 * data, OMX_U32 len, OMX_U32 * bit)
+{
+    OMX_U32 val = *bit < len * 8 ? (data[*bit >> 3] >> (7 - (*bit & 7))) & 1 : 1;
+
+    (*bit)++;
+    return val;
+}
+
+// PTYPE of a simple or main profile frame, see SMPTE 421M 7.1.1
+static int keyframe_simple_vc1(const VC1DecMetaData * meta,
+                               const OMX_U8 * data, OMX_U32 len)
+{
+    OMX_U32 bit = 0;
+
+    if (len == 0)
+        return KEYFRAME_UNKNOWN;
+
+    bit += meta->frameInterp;   // INTERPFRM
+    bit += 2;                   // FRMCNT
+    bit += meta->rangeRed;      // RANGEREDFRM
+
+    if (meta->maxBframes == 0)  // 0 I, 1 P
+        return read_bit(data, len, &bit) ? KEYFRAME_INTER : KEYFRAME_CLOSED;
+
+    // 1 P, 01 I, 00 B or BI; the B frames after an I frame may refer to the
+    // anchor before it
+    if (read_bit(data, len, &bit))
+        return KEYFRAME_INTER;
+    return read_bit(data, len, &bit) ? KEYFRAME_OPEN : KEYFRAME_B;
+}
+
+// FCM and PTYPE or FPTYPE of an advanced profile frame header, see
+// SMPTE 421M 7.1.1
+static int keyframe_advanced_vc1(OMX_U32 interlaced, const OMX_U8 * data,
+                                 OMX_U32 len)
+{
+    OMX_U32 bit = 0;
+    OMX_U32 n;
+
+    if (interlaced && read_bit(data, len, &bit) &&
+        read_bit(data, len, &bit))
+    {
+        // field pair: 000 I/I, 001 I/P, 010 P/I, 011 P/P, 1xx B and BI
+        OMX_U32 fptype = 0;
+
+        for (n = 0; n < 3; n++)
+            fptype = (fptype << 1) | read_bit(data, len, &bit);
+        if (fptype >= 4)
+            return KEYFRAME_B;
+        return fptype == 0 ? KEYFRAME_OPEN : KEYFRAME_INTER;
+    }
+
+    // 0 P, 10 B, 110 I, 1110 BI, 1111 skipped
+    for (n = 0; n < 4 && read_bit(data, len, &bit); n++)
+        ;
+    if (n == 2)
+        return KEYFRAME_OPEN;
+    return (n == 1 || n == 3) ? KEYFRAME_B : KEYFRAME_INTER;
+}
+
+static int decoder_keyframe_vc1(CODEC_PROTOTYPE * arg, STREAM_BUFFER * buf)
+{
+    CODEC_VC1 *this = (CODEC_VC1 *) arg;
+    const OMX_U8 *data = buf->bus_data;
+    VC1DecInfo info;
+    OMX_U32 i;
+
+    assert(this);
+    if (this->state != VC1_DECODE)
+        return KEYFRAME_UNKNOWN;
+
+    if (this->metadata.profile != 8)
+        return keyframe_simple_vc1(&this->metadata, data, buf->streamlen);
+
+    // advanced profile: an entry point header starts a GOP, closed if its
+    // CLOSED_ENTRY flag is set; otherwise the frame header decides
+    for (i = 0; i + 4 < buf->streamlen; ++i)
+    {
+        if (data[i] || data[i + 1] || data[i + 2] != 0x01)
+            continue;
+
+        // entry point: BROKEN_LINK (1), CLOSED_ENTRY (1)
+        if (data[i + 3] == 0x0E)
+            return (data[i + 4] & 0x40) ? KEYFRAME_CLOSED : KEYFRAME_OPEN;
+        if (data[i + 3] == 0x0D)
+        {
+            if (VC1DecGetInfo(this->instance, &info) != VC1DEC_OK)
+                return KEYFRAME_UNKNOWN;
+            return keyframe_advanced_vc1(info.interlacedSequence,
+                                         data + i + 4,
+                                         buf->streamlen - (i + 4));
+        }
+        // sequence header and user data come before the frame
+        if (data[i + 3] != 0x0F && (data[i + 3] < 0x1B || data[i + 3] > 0x1F))
+            return KEYFRAME_UNKNOWN;
+        i += 2;
+    }
+    return KEYFRAME_UNKNOWN;
+}
+
 static CODEC_STATE decoder_setppargs_vc1(CODEC_PROTOTYPE * codec,
                                          PP_ARGS * args)
 {
@@ -602,6 +711,7 @@ CODEC_PROTOTYPE *HantroHwDecOmx_decoder_create_vc1()
     this->base.getinfo = decoder_getinfo_vc1;
     this->base.getframe = decoder_getframe_vc1;
     this->base.scanframe = decoder_scanframe_vc1;
+    this->base.keyframe = decoder_keyframe_vc1;
     this->base.setppargs = decoder_setppargs_vc1;
 #ifdef DYNAMIC_SCALING
 	this->base.setscaling = decoder_setscaling_vc1;
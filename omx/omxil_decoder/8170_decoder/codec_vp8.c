@@ -353,6 +353,14 @@ static int decoder_scanframe_vp8(CODEC_PROTOTYPE * arg, STREAM_BUFFER * buf,
     return 1;
 }
 
+static int decoder_keyframe_vp8(CODEC_PROTOTYPE * arg, STREAM_BUFFER * buf)
+{
+    // frame tag: key_frame flag is 0 for key frames
+    if (buf->streamlen == 0)
+        return KEYFRAME_UNKNOWN;
+    return (buf->bus_data[0] & 0x01) ? KEYFRAME_INTER : KEYFRAME_CLOSED;
+}
+
 static CODEC_STATE decoder_setppargs_vp8(CODEC_PROTOTYPE * codec,
                                          PP_ARGS * args)
 {
@@ -439,6 +447,7 @@ CODEC_PROTOTYPE *HantroHwDecOmx_decoder_create_vp8()
     this->base.getinfo = decoder_getinfo_vp8;
     this->base.getframe = decoder_getframe_vp8;
     this->base.scanframe = decoder_scanframe_vp8;
+    this->base.keyframe = decoder_keyframe_vp8;
     this->base.setppargs = decoder_setppargs_vp8;
 #ifdef DYNAMIC_SCALING
 	this->base.setscaling = decoder_setscaling_vp8;
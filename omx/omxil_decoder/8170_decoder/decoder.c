@@ -48,6 +48,7 @@
 #include "codec_avs.h"
 #include "codec_vp8.h"
 #include "codec_webp.h"
+#include "perf_counters.h"
 #include <OMX_VideoExt.h>
 
 #ifdef DECODER_COLOR_FORMAT_NV21
@@ -100,6 +101,14 @@ typedef struct TIMESTAMP_BUFFER
     OMX_TICKS cur_timestamp
 } TIMESTAMP_BUFFER;
 
+// resuming at a keyframe after the input is flushed, see async_skip_to_keyframe
+typedef struct KEYFRAME_SEEK
+{
+    OMX_BOOL seeking;        // input flushed, no keyframe decoded since
+    OMX_BOOL skipLeading;    // resumed in an open GOP, no anchor after the keyframe yet
+    OMX_U32 skipped;         // input buffers skipped since the flush
+} KEYFRAME_SEEK;
+
 #define GET_DECODER(comp) (OMX_DECODER*)(((OMX_COMPONENTTYPE*)comp)->pComponentPrivate)
 
 typedef struct FRAME_BUFFER
@@ -201,7 +210,16 @@ typedef struct OMX_DECODER
     OMX_BOOL outputPortFlushPending;
     OMX_BOOL dispatchOutputImmediately;
     OMX_BOOL useNativeBuf;
+    OMX_BOOL lowLatency;
+#ifdef OMX_DECODER_VIDEO_DOMAIN
+    OMX_VIDEO_CONFIG_DECODESKIPTYPE conf_decode_skip;
+    KEYFRAME_SEEK kf_seek;
+#endif
+#ifdef OMX_DECODER_IMAGE_DOMAIN
+    OMX_IMAGE_CONFIG_DECODETARGETTYPE conf_decode_target;
+#endif
 #endif
+    PERF_COUNTERS perf;
 
 #ifdef DSPG_DUMP_STREAM
     int streamDumpFd;
@@ -286,6 +304,45 @@ static void pop_timestamp(OMX_DECODER * dec, OMX_TICKS *timestamp)
     /*printf("Pop timestamp %ld count %d\n", timestamp->nLowPart, dec->ts_buf.count);*/
 }
 
+// forget the timestamp of a picture the codec skipped, it has no output frame
+static void drop_timestamp(OMX_DECODER * dec, OMX_TICKS *timestamp)
+{
+    OMX_U32 i;
+
+    for (i = 0; i < dec->ts_buf.count; i++)
+    {
+        if (!memcmp(&dec->ts_buf.ts_data[i], timestamp, sizeof(OMX_TICKS)))
+            break;
+    }
+
+    if (i == dec->ts_buf.count)
+        return;
+
+    memmove(&dec->ts_buf.ts_data[i], &dec->ts_buf.ts_data[i+1], sizeof(OMX_TICKS)*(dec->ts_buf.count-i-1));
+    dec->ts_buf.count--;
+}
+
+// queue depths seen when an input buffer is taken for decoding
+static void perf_sample_queues(OMX_DECODER *dec)
+{
+    HantroHwDecOmx_perf_add_queues(&dec->perf,
+                                   HantroOmx_port_buffer_queue_count(&dec->in),
+                                   HantroOmx_port_buffer_queue_count(&dec->out));
+}
+
+static void perf_dump(OMX_DECODER *dec)
+{
+    OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE c;
+
+    HantroHwDecOmx_perf_get(&dec->perf, &c);
+    ALOGI("perf %p: %u frames in %u ms, decode %u calls %u ms (avg %u us, max %u us), "
+          "hw wait %u %u ms (max %u us per call), output %u ms, copy %u ms %u KB, "
+          "input queue avg %u max %u, output queue avg %u max %u",
+          dec, c.nFrames, c.nElapsedMs, c.nCodecCalls, c.nCodecTotalMs, c.nCodecAvgUs,
+          c.nCodecMaxUs, c.nHwWaits, c.nHwWaitTotalMs, c.nHwWaitMaxUs, c.nOutputTotalMs, c.nCopyTotalMs, c.nCopyKBytes, c.nInputQueueAvg, c.nInputQueueMax,
+          c.nOutputQueueAvg, c.nOutputQueueMax);
+}
+
 static OMX_ERRORTYPE async_decoder_set_state(OMX_COMMANDTYPE, OMX_U32, OMX_PTR,
                                              OMX_PTR);
 static OMX_ERRORTYPE async_decoder_disable_port(OMX_COMMANDTYPE, OMX_U32,
@@ -503,7 +560,10 @@ static OMX_ERRORTYPE decoder_deinit(OMX_IN OMX_HANDLETYPE hComponent)
         decoder_dealloc_buffers(dec, &dec->inpp);
         TRACE_PRINT("API: dealloc buffers done\n");
         if (dec->codec)
+        {
+            perf_dump(dec);
             dec->codec->destroy(dec->codec);
+        }
 
         TRACE_PRINT("API: dealloc codec done\n");
 
@@ -1126,6 +1186,11 @@ static
   if ((param)->nPortIndex != PORT_INDEX_INPUT) \
       return OMX_ErrorBadPortIndex;
 
+// for structures copied whole, the client nSize must match what is copied
+#define CHECK_PARAM_SIZE(param, type) \
+  if ((param)->nSize != sizeof(type)) \
+      return OMX_ErrorBadParameter;
+
 #if (defined OMX_DECODER_VIDEO_DOMAIN)
 static
     OMX_ERRORTYPE decoder_set_parameter(OMX_IN OMX_HANDLETYPE hComponent,
@@ -1386,6 +1451,18 @@ static
 		ALOGD("useNativeBuf = %u", dec->useNativeBuf);
 		break;
 	}
+#endif
+#ifdef ANDROID_MOD
+    case OMX_HantroIndexParamVideoLowLatency:
+        {
+            CHECK_STATE_LOADED(dec->state);
+            OMX_CONFIG_BOOLEANTYPE *param = (OMX_CONFIG_BOOLEANTYPE *) pParam;
+
+            TRACE_PRINT("OMX.hantro.index.param.video.lowLatency: %d", param->bEnabled);
+            dec->lowLatency = param->bEnabled;
+            dec->dispatchOutputImmediately = param->bEnabled;
+        }
+        break;
 #endif
     default:
         TRACE_PRINT("API: unsupported settings index 0x%x", nIndex);
@@ -1858,6 +1935,15 @@ static int wmv_profiles[][2] = {
 
 	break;
 	}
+#endif
+#ifdef ANDROID_MOD
+    case OMX_HantroIndexParamVideoLowLatency:
+        {
+            OMX_CONFIG_BOOLEANTYPE *param = (OMX_CONFIG_BOOLEANTYPE *) pParam;
+
+            param->bEnabled = dec->lowLatency;
+        }
+        break;
 #endif
     default:
         TRACE_PRINT("API: unsupported settings index\n");
@@ -2348,6 +2434,39 @@ static
             memcpy(&dec->conf_mask, param, param->nSize);
         }
         break;
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_IMAGE_DOMAIN)
+    case OMX_HantroIndexConfigImageDecodeTarget:
+        {
+            OMX_IMAGE_CONFIG_DECODETARGETTYPE *param =
+                (OMX_IMAGE_CONFIG_DECODETARGETTYPE *) pParam;
+            if (param->eTarget != OMX_ImageDecodeTargetFullImage &&
+                param->eTarget != OMX_ImageDecodeTargetAuto)
+                return OMX_ErrorBadParameter;
+            CHECK_PARAM_SIZE(param, OMX_IMAGE_CONFIG_DECODETARGETTYPE);
+            memcpy(&dec->conf_decode_target, param, param->nSize);
+        }
+        break;
+#endif
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_VIDEO_DOMAIN)
+    case OMX_HantroIndexConfigVideoDecodeSkip:
+        {
+            OMX_VIDEO_CONFIG_DECODESKIPTYPE *param =
+                (OMX_VIDEO_CONFIG_DECODESKIPTYPE *) pParam;
+            if (param->eSkip != OMX_VideoDecodeSkipNone &&
+                param->eSkip != OMX_VideoDecodeSkipNonReference &&
+                param->eSkip != OMX_VideoDecodeSkipNonIntra)
+                return OMX_ErrorBadParameter;
+            TRACE_PRINT("OMX.hantro.index.config.video.decodeSkip: %d", param->eSkip);
+            dec->conf_decode_skip.eSkip = param->eSkip;
+        }
+        break;
+#endif
+#ifdef ANDROID_MOD
+    case OMX_HantroIndexConfigPerfCounters:
+        perf_dump(dec);
+        HantroHwDecOmx_perf_reset(&dec->perf);
+        break;
+#endif
     default:
         return OMX_ErrorUnsupportedIndex;
     }
@@ -2450,6 +2569,29 @@ static
             memcpy(param, &dec->conf_mask, param->nSize);
         }
         break;
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_IMAGE_DOMAIN)
+    case OMX_HantroIndexConfigImageDecodeTarget:
+        {
+            OMX_IMAGE_CONFIG_DECODETARGETTYPE *param =
+                (OMX_IMAGE_CONFIG_DECODETARGETTYPE *) pParam;
+            param->eTarget = dec->conf_decode_target.eTarget;
+        }
+        break;
+#endif
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_VIDEO_DOMAIN)
+    case OMX_HantroIndexConfigVideoDecodeSkip:
+        {
+            OMX_VIDEO_CONFIG_DECODESKIPTYPE *param =
+                (OMX_VIDEO_CONFIG_DECODESKIPTYPE *) pParam;
+            param->eSkip = dec->conf_decode_skip.eSkip;
+        }
+        break;
+#endif
+#ifdef ANDROID_MOD
+    case OMX_HantroIndexConfigPerfCounters:
+        HantroHwDecOmx_perf_get(&dec->perf, (OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE *) pParam);
+        break;
+#endif
 #ifdef ENABLE_CODEC_VP8
     case OMX_IndexConfigVideoVp8ReferenceFrameType:
         {
@@ -2878,6 +3020,26 @@ static OMX_ERRORTYPE decoder_get_extension_index(
 	{
 		*pIndexType = (OMX_INDEXTYPE)OMX_GoogleIndexUseAndroidNativeBuffer2;
 	}
+#ifdef OMX_DECODER_VIDEO_DOMAIN
+	else if (!strcmp(cParameterName, "OMX.hantro.index.param.video.lowLatency"))
+	{
+		*pIndexType = (OMX_INDEXTYPE)OMX_HantroIndexParamVideoLowLatency;
+	}
+	else if (!strcmp(cParameterName, "OMX.hantro.index.config.video.decodeSkip"))
+	{
+		*pIndexType = (OMX_INDEXTYPE)OMX_HantroIndexConfigVideoDecodeSkip;
+	}
+#endif
+#ifdef OMX_DECODER_IMAGE_DOMAIN
+	else if (!strcmp(cParameterName, "OMX.hantro.index.config.image.decodeTarget"))
+	{
+		*pIndexType = (OMX_INDEXTYPE)OMX_HantroIndexConfigImageDecodeTarget;
+	}
+#endif
+	else if (!strcmp(cParameterName, "OMX.hantro.index.config.perfCounters"))
+	{
+		*pIndexType = (OMX_INDEXTYPE)OMX_HantroIndexConfigPerfCounters;
+	}
 	else
 	{
 		ALOGE("%s: %s not implemented!\n", __func__, cParameterName);
@@ -3245,6 +3407,7 @@ OMX_ERRORTYPE HantroHwDecOmx_video_constructor(OMX_COMPONENTTYPE * comp,
     dec->outputPortFlushPending = OMX_FALSE;
     dec->dispatchOutputImmediately = OMX_FALSE;
 //    dec->dispatchOutputImmediately = OMX_TRUE;
+    dec->lowLatency = OMX_FALSE;
 #endif
 
 #ifdef DSPG_DUMP_STREAM
@@ -3533,7 +3696,13 @@ static OMX_ERRORTYPE transition_to_idle_from_loaded(OMX_DECODER * dec)
         strcpy((char *) dec->role, "video_decoder.avc");
         dec->codec =
             HantroHwDecOmx_decoder_create_h264(dec->in.def.format.video.
-                                               bFlagErrorConcealment);
+                                               bFlagErrorConcealment,
+#ifdef ANDROID_MOD
+                                               dec->lowLatency
+#else
+                                               OMX_FALSE
+#endif
+                                               );
         TRACE_PRINT("ASYNC: created h264 codec\n");
         break;
 #endif
@@ -3767,6 +3936,8 @@ static OMX_ERRORTYPE transition_to_idle_from_loaded(OMX_DECODER * dec)
     assert(dec->codec->scanframe);
     assert(dec->codec->setppargs);
 
+    HantroHwDecOmx_perf_reset(&dec->perf);
+
     OMX_U32 input_buffer_size = dec->in.def.nBufferSize;
 
     OMX_U32 output_buffer_size = dec->out.def.nBufferSize;
@@ -3885,6 +4056,9 @@ static OMX_ERRORTYPE transition_to_idle_from_loaded(OMX_DECODER * dec)
     args.format = dec->out.def.format.image.eColorFormat;
     args.scale.width = dec->out.def.format.image.nFrameWidth;
     args.scale.height = dec->out.def.format.image.nFrameHeight;
+#ifdef ANDROID_MOD
+    args.thumbnail = dec->conf_decode_target.eTarget == OMX_ImageDecodeTargetAuto;
+#endif
 #endif
     args.crop.left = dec->conf_rect.nLeft;
     args.crop.top = dec->conf_rect.nTop;
@@ -3951,6 +4125,9 @@ FAIL:
         free(dec->ts_buf.ts_data);
         memset(&dec->ts_buf, 0, sizeof(TIMESTAMP_BUFFER));
     }
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_VIDEO_DOMAIN)
+    memset(&dec->kf_seek, 0, sizeof(KEYFRAME_SEEK));
+#endif
 
     if (dec->mask.bus_data)
     {
@@ -4217,6 +4394,7 @@ static OMX_ERRORTYPE transition_to_loaded_from_idle(OMX_DECODER * dec)
 
     TRACE_PRINT("ASYNC: destroying codec\n");
     assert(dec->codec);
+    perf_dump(dec);
     dec->codec->destroy(dec->codec);
     TRACE_PRINT("ASYNC: freeing internal frame buffers\n");
     if (dec->frame_in.bus_address)
@@ -4233,6 +4411,9 @@ static OMX_ERRORTYPE transition_to_loaded_from_idle(OMX_DECODER * dec)
     dec->codec = NULL;
     memset(&dec->frame_in, 0, sizeof(FRAME_BUFFER));
     memset(&dec->ts_buf, 0, sizeof(TIMESTAMP_BUFFER));
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_VIDEO_DOMAIN)
+    memset(&dec->kf_seek, 0, sizeof(KEYFRAME_SEEK));
+#endif
     memset(&dec->frame_out, 0, sizeof(FRAME_BUFFER));
     memset(&dec->mask, 0, sizeof(FRAME_BUFFER));
     TRACE_PRINT("ASYNC: freed internal frame buffers\n");
@@ -4735,6 +4916,16 @@ static
 	dec->ts_buf.count = 0;
 	dec->ts_buf.cur_timestamp = 0;
 
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_VIDEO_DOMAIN)
+    // flushed input means a seek, decoding has to restart from a keyframe
+    if (portindex == OMX_ALL || portindex == PORT_INDEX_INPUT)
+    {
+        dec->kf_seek.seeking = OMX_TRUE;
+        dec->kf_seek.skipLeading = OMX_FALSE;
+        dec->kf_seek.skipped = 0;
+    }
+#endif
+
     TRACE_PRINT("ASYNC: %s done\n", __FUNCTION__);
     return OMX_ErrorNone;
   FAIL:
@@ -5007,13 +5198,16 @@ static
         // copy data from the temporary output buffer
         // into the real output buffer
         TRACE_PRINT("ASYNC: copying from temporary output buffer\n");
+        OSAL_U32 copyStart = OSAL_GetTimeUs();
 	if (dec->useNativeBuf) {
 		struct private_handle_t *handle = (struct private_handle_t *)buff->header->pBuffer;
 		memcpy(handle->base, frm->fb_bus_data, frm->size);
 	}
 	else
 		memcpy(buff->header->pBuffer, frm->fb_bus_data, frm->size);
+        HantroHwDecOmx_perf_add_copy(&dec->perf, OSAL_GetTimeUs() - copyStart, frm->size);
     }
+    dec->perf.frames++;
 /*
 	if (dec->useNativeBuf) {
 		struct private_handle_t *handle = (struct private_handle_t *)buff->header->pBuffer;
@@ -5192,6 +5386,34 @@ static void async_dispatch_last_frame(OMX_DECODER * dec)
     }
 #endif
 
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_VIDEO_DOMAIN)
+    // every frame has been returned already, so the EOS flag goes in an
+    // empty buffer of its own
+    if (dec->buffer == NULL && dec->dispatchOutputImmediately)
+    {
+        BUFFER *buff = NULL;
+        FRAME frm;
+
+        memset(&frm, 0, sizeof(FRAME));
+        if (async_get_frame_buffer(dec, &frm) == OMX_ErrorNone)
+        {
+            HantroOmx_port_lock_buffers(&dec->out);
+            HantroOmx_port_get_buffer(&dec->out, &buff);
+            if (buff)
+                HantroOmx_port_pop_buffer(&dec->out);
+            HantroOmx_port_unlock_buffers(&dec->out);
+        }
+        if (buff)
+        {
+            buff->header->nOffset = 0;
+            buff->header->nFilledLen = 0;
+            buff->header->nFlags = 0;
+            buff->header->nTimeStamp = dec->ts_buf.cur_timestamp;
+            dec->buffer = buff;
+        }
+    }
+#endif
+
     if (dec->buffer == NULL) {
 	TRACE_PRINT("ASYNC: %s dec->buffer == NULL", __func__);
         return;
@@ -5254,7 +5476,12 @@ static
 	if (frm.fb_size == 0 && frm.fb_bus_address == 0 && err == OMX_ErrorNone)
 	    return OMX_ErrorNone;
 
+        DWLWaitStats_t outputWaits;
+        DWLGetWaitStats(&outputWaits);
+        OSAL_U32 outputStart = OSAL_GetTimeUs();
         state = dec->codec->getframe(dec->codec, &frm, EOS);
+        dec->perf.outputUs += OSAL_GetTimeUs() - outputStart;
+        HantroHwDecOmx_perf_add_hw_wait(&dec->perf, &outputWaits);
         TRACE_PRINT("ASYNC: %s state %d\n", __func__, state);
         //TRACE_PRINT("ASYNC getframe isIntra %d isGoldenOrAlternate %d\n", dec->isIntra, dec->isGoldenOrAlternate);
         if (state == CODEC_OK)
@@ -5308,6 +5535,57 @@ static
     return OMX_ErrorNone;
 }
 
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_VIDEO_DOMAIN)
+// Called for each input buffer before it is decoded. After a seek, tells if
+// the buffer holds a picture whose references are gone, so it can be
+// returned without being decoded: inter pictures before the first keyframe
+// and, when that keyframe starts an open GOP, the B pictures before the
+// next anchor picture, which may refer to pictures before the keyframe.
+// The codec decides from the first picture header; buffers it can't
+// classify are decoded.
+static OMX_BOOL async_skip_to_keyframe(OMX_DECODER * dec, BUFFER * buff)
+{
+    KEYFRAME_SEEK *seek = &dec->kf_seek;
+    OMX_BUFFERHEADERTYPE *header = buff->header;
+    STREAM_BUFFER stream;
+    int key;
+
+    if (dec->codec->keyframe == NULL || header->nFilledLen == 0 ||
+        (header->nFlags & (OMX_BUFFERFLAG_EOS | OMX_BUFFERFLAG_CODECCONFIG)))
+        return OMX_FALSE;
+
+    memset(&stream, 0, sizeof(STREAM_BUFFER));
+    stream.bus_data = header->pBuffer + header->nOffset;
+    stream.streamlen = header->nFilledLen;
+    key = dec->codec->keyframe(dec->codec, &stream);
+
+#ifndef DSPG_TIMESTAMP_FIX
+    if ((seek->seeking && (key == KEYFRAME_INTER || key == KEYFRAME_B)) ||
+        (seek->skipLeading && key == KEYFRAME_B))
+    {
+        if ((dec->in.def.format.video.eCompressionFormat) != OMX_VIDEO_CodingVP8)
+            drop_timestamp(dec, &header->nTimeStamp);
+        seek->skipped++;
+        return OMX_TRUE;
+    }
+#endif
+
+    if (seek->seeking && (key == KEYFRAME_CLOSED || key == KEYFRAME_OPEN))
+    {
+        ALOGD("seek: %u input buffers skipped before the keyframe",
+              (unsigned) seek->skipped);
+        seek->seeking = OMX_FALSE;
+        seek->skipLeading = key == KEYFRAME_OPEN;
+    }
+    else if (key != KEYFRAME_UNKNOWN && key != KEYFRAME_B)
+    {
+        // an anchor picture: B pictures from here on have their references
+        seek->skipLeading = OMX_FALSE;
+    }
+    return OMX_FALSE;
+}
+#endif
+
 static
     OMX_ERRORTYPE async_decode_data(OMX_DECODER * dec, OMX_U8 * bus_data,
                                     OSAL_BUS_WIDTH bus_address, OMX_U32 datalen,
@@ -5376,6 +5654,11 @@ static
         stream.streamlen = last - first;
         stream.sliceInfoNum =  dec->sliceInfoNum;
         stream.pSliceInfo =  dec->pSliceInfo;
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_VIDEO_DOMAIN)
+        stream.skip = (DECODE_SKIP) dec->conf_decode_skip.eSkip;
+#else
+        stream.skip = DECODE_SKIP_NONE;
+#endif
 
         OMX_U32 bytes = 0;
 
@@ -5399,8 +5682,13 @@ static
             return err;
         }
 
+        DWLWaitStats_t callWaits;
+        DWLGetWaitStats(&callWaits);
+        OSAL_U32 callStart = OSAL_GetTimeUs();
         CODEC_STATE codec =
             dec->codec->decode(dec->codec, &stream, &bytes, &frm);
+        HantroHwDecOmx_perf_add_call(&dec->perf, OSAL_GetTimeUs() - callStart);
+        HantroHwDecOmx_perf_add_hw_wait(&dec->perf, &callWaits);
 
 #ifndef OMX_DECODER_IMAGE_DOMAIN
         if (frm.size)
@@ -5430,6 +5718,13 @@ static
             ALOGV("streamlen = %u bytes", stream.streamlen);
             ALOGV("dec->codec->decode() returned CODEC_NEED_MORE");
             break;
+        case CODEC_PIC_SKIPPED:
+            ALOGV("dec->codec->decode() returned CODEC_PIC_SKIPPED");
+#ifndef DSPG_TIMESTAMP_FIX
+            if ((dec->in.def.format.video.eCompressionFormat) != OMX_VIDEO_CodingVP8)
+                drop_timestamp(dec, &buff->header->nTimeStamp);
+#endif
+            break;
         case CODEC_HAS_INFO:
             err = async_get_info(dec);
             if (err != OMX_ErrorNone)
@@ -5540,6 +5835,7 @@ static OMX_ERRORTYPE async_decoder_decode(OMX_DECODER * dec)
 	usleep(16666);
         return OMX_ErrorNotReady;
     }
+    perf_sample_queues(dec);
 #ifdef OMX_DECODER_IMAGE_DOMAIN
     if (buff->header->nFilledLen == 0)
     {
@@ -5603,6 +5899,13 @@ static OMX_ERRORTYPE async_decoder_decode(OMX_DECODER * dec)
 
     FRAME_BUFFER *temp = &dec->frame_in;
 
+#if defined(ANDROID_MOD) && defined(OMX_DECODER_VIDEO_DOMAIN)
+    if (temp->size == 0 && async_skip_to_keyframe(dec, buff))
+    {
+        TRACE_PRINT("ASYNC: input buffer before the first keyframe after seek, skipped\n");
+    }
+    else
+#endif
     // if there is previous data in the frame buffer left over from a previous call to decode
     // or if the buffer has possibly misaligned offset or if the buffer is allocated by the client
     // invoke the decoding through the temporary frame buffer
@@ -5635,7 +5938,9 @@ static OMX_ERRORTYPE async_decoder_decode(OMX_DECODER * dec)
 
         OMX_U8 *dst = temp->bus_data + temp->size;  // append to the buffer
         TRACE_PRINT("ASYNC: copy input buffer data into the temporary input buffer");
+        OSAL_U32 copyStart = OSAL_GetTimeUs();
         memcpy(dst, src, len);
+        HantroHwDecOmx_perf_add_copy(&dec->perf, OSAL_GetTimeUs() - copyStart, len);
         temp->size += len;
 
         OMX_U32 retlen = 0;
@@ -5698,7 +6003,9 @@ static OMX_ERRORTYPE async_decoder_decode(OMX_DECODER * dec)
 
             OMX_U8 *src = bus_data;
             TRACE_PRINT("copy data into the temporary buffer");
+            OSAL_U32 copyStart = OSAL_GetTimeUs();
             memcpy(dst, src, retlen);
+            HantroHwDecOmx_perf_add_copy(&dec->perf, OSAL_GetTimeUs() - copyStart, retlen);
             temp->size += retlen;
         }
     }
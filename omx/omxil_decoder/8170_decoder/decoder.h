@@ -43,6 +43,24 @@ extern "C"
         MPEG4FORMAT_CUSTOM_1_3
     } MPEG4_FORMAT;
 
+    // pictures the codec drops without decoding them (trick play)
+    typedef enum DECODE_SKIP
+    {
+        DECODE_SKIP_NONE,
+        DECODE_SKIP_NON_REFERENCE,
+        DECODE_SKIP_NON_INTRA
+    } DECODE_SKIP;
+
+    // first picture of an input buffer, see the keyframe function of a codec
+    typedef enum KEYFRAME_TYPE
+    {
+        KEYFRAME_UNKNOWN = -1,
+        KEYFRAME_INTER,
+        KEYFRAME_CLOSED,
+        KEYFRAME_OPEN,
+        KEYFRAME_B
+    } KEYFRAME_TYPE;
+
     typedef struct STREAM_BUFFER
     {
         OMX_U8 *bus_data;
@@ -50,6 +68,7 @@ extern "C"
         OMX_U32 streamlen;
         OMX_U32 sliceInfoNum;
         OMX_U8 *pSliceInfo;
+        DECODE_SKIP skip;
     } STREAM_BUFFER;
 
     typedef struct STREAM_INFO
@@ -98,9 +117,102 @@ typedef enum OMX_VENDOR_INDEXTYPE {
 	OMX_GoogleIndexEnableAndroidNativeBuffers = (OMX_IndexVendorStartUnused + 1),
 	OMX_GoogleIndexGetAndroidNativeBufferUsage,
 	OMX_GoogleIndexUseAndroidNativeBuffer,
-	OMX_GoogleIndexUseAndroidNativeBuffer2
+	OMX_GoogleIndexUseAndroidNativeBuffer2,
+	OMX_HantroIndexConfigImageDecodeTarget,
+	OMX_HantroIndexParamVideoLowLatency,
+	OMX_HantroIndexConfigVideoDecodeSkip,
+	OMX_HantroIndexConfigPerfCounters
 } OMX_VENDOR_INDEXTYPE;
 
+// 'OMX.hantro.index.param.video.lowLatency' (OMX_CONFIG_BOOLEANTYPE), set in
+// the loaded state. Each output buffer is returned right away instead of
+// being held until the next one is filled, and the EOS flag is sent in an
+// empty buffer of its own. H.264 pictures are also output in decoding order
+// as soon as they are decoded (no DPB output reordering, G1 only) unless the
+// SPS signals reordering with VUI num_reorder_frames > 0; such streams keep
+// display order. A stream with B pictures but without that VUI information
+// is output in decoding order, so only enable this for streams known not to
+// reorder, e.g. from cameras and video calls.
+
+// Pictures left out by the video decoder, set with the
+// 'OMX.hantro.index.config.video.decodeSkip' extension at any time, e.g.
+// for fast forward or scrubbing.
+//
+// OMX_VideoDecodeSkipNonReference drops the pictures no other picture is
+// predicted from (B pictures, H.264 nal_ref_idc 0). OMX_VideoDecodeSkipNonIntra
+// decodes only intra pictures. For H.264 these are IDR pictures and pictures
+// whose slices are all I slices; such an I picture drops the older reference
+// pictures, as an IDR picture would, so inter pictures after it that refer
+// across it (open GOP) show artifacts until the next IDR picture. The
+// dropped input buffers are returned without output and their timestamps
+// are discarded. Once skipping is switched off, inter pictures are decoded
+// again from the next intra picture on.
+typedef enum OMX_VIDEO_DECODESKIPTYPE {
+	OMX_VideoDecodeSkipNone,
+	OMX_VideoDecodeSkipNonReference,
+	OMX_VideoDecodeSkipNonIntra
+} OMX_VIDEO_DECODESKIPTYPE;
+
+typedef struct OMX_VIDEO_CONFIG_DECODESKIPTYPE {
+	OMX_U32 nSize;
+	OMX_VERSIONTYPE nVersion;
+	OMX_U32 nPortIndex;
+	OMX_VIDEO_DECODESKIPTYPE eSkip;
+} OMX_VIDEO_CONFIG_DECODESKIPTYPE;
+
+// Source picked by the image decoder for the output picture, set with the
+// 'OMX.hantro.index.config.image.decodeTarget' extension.
+//
+// OMX_ImageDecodeTargetAuto decodes the JFIF/EXIF thumbnail embedded in the
+// JPEG when it is at least as large as the output port picture. Otherwise the
+// full image is decoded and, if the post-processor is enabled, scaled down to
+// the output port size in the same pass.
+typedef enum OMX_IMAGE_DECODETARGETTYPE {
+	OMX_ImageDecodeTargetFullImage,
+	OMX_ImageDecodeTargetAuto
+} OMX_IMAGE_DECODETARGETTYPE;
+
+typedef struct OMX_IMAGE_CONFIG_DECODETARGETTYPE {
+	OMX_U32 nSize;
+	OMX_VERSIONTYPE nVersion;
+	OMX_U32 nPortIndex;
+	OMX_IMAGE_DECODETARGETTYPE eTarget;
+} OMX_IMAGE_CONFIG_DECODETARGETTYPE;
+
+// Counters of one decoder instance since it was loaded, read with the
+// 'OMX.hantro.index.config.perfCounters' extension at any time. Setting it
+// logs the counters and starts them again from zero.
+//
+// Codec time is spent inside the codec decode call: stream parsing,
+// programming the hardware, running it and waiting for its interrupt.
+// Hardware wait time is the part of the decode and output calls spent in
+// DWLWaitHwReady, waiting for the decoder or post-processor interrupt; the
+// max is the longest wait of one call. Output time is spent fetching
+// decoded pictures from the codec, post-processing included. Copy
+// time is the CPU copying stream and pictures between OMX buffers and codec
+// buffers. The queue depths are sampled whenever an input buffer is taken.
+typedef struct OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE {
+	OMX_U32 nSize;
+	OMX_VERSIONTYPE nVersion;
+	OMX_U32 nPortIndex;
+	OMX_U32 nElapsedMs;         // since the counters were started
+	OMX_U32 nFrames;            // pictures output
+	OMX_U32 nCodecCalls;
+	OMX_U32 nCodecTotalMs;
+	OMX_U32 nCodecAvgUs;
+	OMX_U32 nCodecMaxUs;
+	OMX_U32 nHwWaits;
+	OMX_U32 nHwWaitTotalMs;
+	OMX_U32 nHwWaitMaxUs;
+	OMX_U32 nOutputTotalMs;
+	OMX_U32 nCopyTotalMs;
+	OMX_U32 nCopyKBytes;
+	OMX_U32 nInputQueueMax;     // input buffers waiting to be decoded
+	OMX_U32 nInputQueueAvg;
+	OMX_U32 nOutputQueueMax;    // empty output buffers held by the component
+	OMX_U32 nOutputQueueAvg;
+} OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE;
+
 // A pointer to this struct is passed to the OMX_SetParameter when the extension
 // index for the 'OMX.google.android.index.enableAndroidNativeBuffers' extension
 // is given.
@@ -215,6 +327,10 @@ struct GetAndroidNativeBufferUsageParams {
 
         int dither;
 
+        // Allow decoding the embedded thumbnail instead of the full image
+        // when the thumbnail covers the scaled output size. JPEG only.
+        OMX_BOOL thumbnail;
+
     } PP_ARGS;
 
     typedef enum CODEC_STATE
@@ -223,6 +339,7 @@ struct GetAndroidNativeBufferUsageParams {
         CODEC_HAS_FRAME,
         CODEC_HAS_INFO,
         CODEC_OK,
+        CODEC_PIC_SKIPPED,
         CODEC_ERROR_HW_TIMEOUT = -1,
         CODEC_ERROR_HW_BUS_ERROR = -2,
         CODEC_ERROR_SYS = -3,
@@ -256,6 +373,7 @@ struct GetAndroidNativeBufferUsageParams {
         //    CODEC_NEED_MORE  - nothing happened, codec needs more data.
         //    CODEC_HAS_INFO   - headers were parsed and information about stream is ready.
         //    CODEC_HAS_FRAME  - codec has one or more headers ready
+        //    CODEC_PIC_SKIPPED - a picture was left out as asked by STREAM_BUFFER skip
         //    less than zero   - one of the enumerated error values
         //
         // Parameters:
@@ -320,6 +438,28 @@ struct GetAndroidNativeBufferUsageParams {
         int (*scanframe) (CODEC_PROTOTYPE *, STREAM_BUFFER *, OMX_U32 * first,
                           OMX_U32 * last);
 
+        //
+        // Tell if the decoding unit in the buffer starts with an intra picture,
+        // looking only at the first picture header. Optional, may be NULL.
+        //
+        // The function should return one of the following:
+        //
+        // KEYFRAME_UNKNOWN - unknown, e.g. no picture header found
+        // KEYFRAME_INTER   - inter picture
+        // KEYFRAME_CLOSED  - intra picture, decoding can start from it
+        // KEYFRAME_OPEN    - intra picture, decoding can start from it but
+        //                    B pictures before the next anchor picture may
+        //                    refer to pictures before it (open GOP)
+        // KEYFRAME_B       - B picture; codecs that don't return
+        //                    KEYFRAME_OPEN may return KEYFRAME_INTER instead
+        //
+        // Parameters:
+        //
+        //  CODEC_PROTOTYPE - this codec instance
+        //  STREAM_BUFFER   - frame data pointer
+        //
+        int (*keyframe) (CODEC_PROTOTYPE *, STREAM_BUFFER *);
+
         //
         // Set post-processor arguments.
         //
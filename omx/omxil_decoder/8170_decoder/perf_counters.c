@@ -0,0 +1,91 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2006 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Description :  Per-instance performance counters of the decoder.
+--
+------------------------------------------------------------------------------*/
+
+#include "perf_counters.h"
+#include <string.h>
+
+void HantroHwDecOmx_perf_reset(PERF_COUNTERS * perf)
+{
+    memset(perf, 0, sizeof(PERF_COUNTERS));
+    perf->startMs = OSAL_GetTime();
+}
+
+void HantroHwDecOmx_perf_add_queues(PERF_COUNTERS * perf, OMX_U32 in,
+                                    OMX_U32 out)
+{
+    perf->queueSamples++;
+    perf->inQueueSum += in;
+    perf->outQueueSum += out;
+    if (in > perf->inQueueMax)
+        perf->inQueueMax = in;
+    if (out > perf->outQueueMax)
+        perf->outQueueMax = out;
+}
+
+void HantroHwDecOmx_perf_add_call(PERF_COUNTERS * perf, OMX_U32 us)
+{
+    perf->calls++;
+    perf->callUs += us;
+    if (us > perf->callMaxUs)
+        perf->callMaxUs = us;
+}
+
+void HantroHwDecOmx_perf_add_hw_wait(PERF_COUNTERS * perf,
+                                     const DWLWaitStats_t * before)
+{
+    DWLWaitStats_t after;
+    OMX_U32 us;
+
+    DWLGetWaitStats(&after);
+    us = after.waitUs - before->waitUs;
+    perf->hwWaits += after.waits - before->waits;
+    perf->hwWaitUs += us;
+    if (us > perf->hwWaitMaxUs)
+        perf->hwWaitMaxUs = us;
+}
+
+void HantroHwDecOmx_perf_add_copy(PERF_COUNTERS * perf, OMX_U32 us,
+                                  OMX_U32 bytes)
+{
+    perf->copyUs += us;
+    perf->copyBytes += bytes;
+}
+
+void HantroHwDecOmx_perf_get(const PERF_COUNTERS * perf,
+                             OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE * out)
+{
+    out->nElapsedMs = OSAL_GetTime() - perf->startMs;
+    out->nFrames = perf->frames;
+    out->nCodecCalls = perf->calls;
+    out->nCodecTotalMs = (OMX_U32)(perf->callUs / 1000);
+    out->nCodecAvgUs = perf->calls ? (OMX_U32)(perf->callUs / perf->calls) : 0;
+    out->nCodecMaxUs = perf->callMaxUs;
+    out->nHwWaits = perf->hwWaits;
+    out->nHwWaitTotalMs = (OMX_U32)(perf->hwWaitUs / 1000);
+    out->nHwWaitMaxUs = perf->hwWaitMaxUs;
+    out->nOutputTotalMs = (OMX_U32)(perf->outputUs / 1000);
+    out->nCopyTotalMs = (OMX_U32)(perf->copyUs / 1000);
+    out->nCopyKBytes = (OMX_U32)(perf->copyBytes / 1024);
+    out->nInputQueueMax = perf->inQueueMax;
+    out->nInputQueueAvg = perf->queueSamples ?
+        (OMX_U32)((perf->inQueueSum + perf->queueSamples / 2) / perf->queueSamples) : 0;
+    out->nOutputQueueMax = perf->outQueueMax;
+    out->nOutputQueueAvg = perf->queueSamples ?
+        (OMX_U32)((perf->outQueueSum + perf->queueSamples / 2) / perf->queueSamples) : 0;
+}
@@ -0,0 +1,78 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2006 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Description :  Per-instance performance counters of the decoder.
+--
+------------------------------------------------------------------------------*/
+
+#ifndef HANTRO_PERF_COUNTERS_H
+#define HANTRO_PERF_COUNTERS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "decoder.h"
+#include <dwl.h>
+
+// always-on counters of the instance, times in microseconds
+    typedef struct PERF_COUNTERS
+    {
+        OMX_U32 startMs;                 // OSAL_GetTime when counting started
+        OMX_U32 frames;                  // pictures dispatched to the output port
+        OMX_U32 calls;                   // codec decode calls
+        OMX_U32 callMaxUs;
+        unsigned long long callUs;
+        OMX_U32 hwWaits;                 // DWLWaitHwReady calls inside the codec
+        OMX_U32 hwWaitMaxUs;             // longest wait of one codec call
+        unsigned long long hwWaitUs;
+        unsigned long long outputUs;     // codec getframe calls
+        unsigned long long copyUs;
+        unsigned long long copyBytes;
+        OMX_U32 queueSamples;
+        OMX_U32 inQueueMax;
+        OMX_U32 outQueueMax;
+        unsigned long long inQueueSum;
+        unsigned long long outQueueSum;
+    } PERF_COUNTERS;
+
+// zero the counters and start counting now
+    void HantroHwDecOmx_perf_reset(PERF_COUNTERS * perf);
+
+// queue depths seen when an input buffer is taken for decoding
+    void HantroHwDecOmx_perf_add_queues(PERF_COUNTERS * perf, OMX_U32 in,
+                                        OMX_U32 out);
+
+// one codec decode call of 'us'
+    void HantroHwDecOmx_perf_add_call(PERF_COUNTERS * perf, OMX_U32 us);
+
+// hardware waits of this thread since the DWL stats in 'before', i.e. of the
+// codec call just made; the DWL keeps them per thread
+    void HantroHwDecOmx_perf_add_hw_wait(PERF_COUNTERS * perf,
+                                         const DWLWaitStats_t * before);
+
+// one CPU copy of 'bytes' taking 'us'
+    void HantroHwDecOmx_perf_add_copy(PERF_COUNTERS * perf, OMX_U32 us,
+                                      OMX_U32 bytes);
+
+// the counters as returned by the perfCounters config
+    void HantroHwDecOmx_perf_get(const PERF_COUNTERS * perf,
+                                 OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE * out);
+
+#ifdef __cplusplus
+}
+#endif
+#endif                       // HANTRO_PERF_COUNTERS_H
@@ -0,0 +1,296 @@
+/*------------------------------------------------------------------------------
+--                                                                            --
+--       This software is confidential and proprietary and may be used        --
+--        only as expressly authorized by a licensing agreement from          --
+--                                                                            --
+--                            Hantro Products Oy.                             --
+--                                                                            --
+--                   (C) COPYRIGHT 2006 HANTRO PRODUCTS OY                    --
+--                            ALL RIGHTS RESERVED                             --
+--                                                                            --
+--                 The entire notice above must be reproduced                 --
+--                  on all copies and should not be removed.                  --
+--                                                                            --
+--------------------------------------------------------------------------------
+--
+--  Description :  Check of the decoder instance perf counters against
+--                 hardware runs of known length. Two instances decode at
+--                 the same time in threads of their own, as two components
+--                 would; their fake codec calls wait on the polling DWL
+--                 while another thread raises the picture ready interrupt
+--                 bit after the delay of the run. The counters read with
+--                 the perfCounters config must cover the delays of the
+--                 instance, and only those: no more than the time the runs
+--                 really took, as the sleeps of the fake hardware may
+--                 overrun. The cost of the counting per codec call is
+--                 measured and printed as well.
+--
+------------------------------------------------------------------------------*/
+
+#include "perf_counters.h"
+#include "dwl_linux.h"
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// time counted for a run besides the time it took: the polling DWL looks at
+// the interrupt register once a millisecond
+#define TEST_RUN_OVERHEAD_US    1500
+// counting must stay under 1% of a picture taking this long in hardware
+#define TEST_PICTURE_US         1000
+#define TEST_OVERHEAD_CALLS     100000
+#define TEST_MAX_RUNS           3
+#define TEST_MAX_CALLS          8
+
+typedef struct FAKE_HW
+{
+    hX170dwl_t dwl;
+    u32 regs[128];
+    u32 delayUs;
+    OSAL_U32 doneUs;            // when the interrupt bit was raised
+} FAKE_HW;
+
+// one codec decode call: the hardware runs it starts, e.g. one per slice
+typedef struct FAKE_CALL
+{
+    OMX_U32 runs;
+    OMX_U32 delayUs[TEST_MAX_RUNS];
+} FAKE_CALL;
+
+typedef struct INSTANCE
+{
+    const char *name;
+    const FAKE_CALL *calls;
+    OMX_U32 numCalls;
+    FAKE_HW hw;
+    PERF_COUNTERS perf;
+    OMX_U32 tookUs[TEST_MAX_CALLS];     // hardware runs of each call, as run
+    OMX_U32 failures;
+} INSTANCE;
+
+static const FAKE_CALL callsA[] = {
+    { 1, { 8000 } },
+    { 2, { 3000, 3000 } },
+    { 0, { 0 } },               // headers only, no hardware run
+    { 1, { 20000 } },
+    { 3, { 0, 1000, 2000 } }
+};
+
+static const FAKE_CALL callsB[] = {
+    { 1, { 12000 } },
+    { 1, { 12000 } },
+    { 2, { 500, 25000 } }
+};
+
+static void *fake_hw_run(void *arg)
+{
+    FAKE_HW *hw = (FAKE_HW *) arg;
+
+    if (hw->delayUs)
+        usleep(hw->delayUs);
+    hw->doneUs = OSAL_GetTimeUs();
+    hw->dwl.pRegBase[HX170DEC_REG_START / 4] |= DWL_HW_PIC_RDY_BIT;
+    return NULL;
+}
+
+// runs the hardware of the call, returns the time the runs took
+static OMX_U32 fake_decode(FAKE_HW *hw, const FAKE_CALL *call, OMX_U32 *tookUs)
+{
+    OMX_U32 i;
+
+    *tookUs = 0;
+    for (i = 0; i < call->runs; i++)
+    {
+        pthread_t thread;
+        OSAL_U32 start;
+
+        memset(hw->regs, 0, sizeof(hw->regs));
+        hw->delayUs = call->delayUs[i];
+        start = OSAL_GetTimeUs();
+        if (pthread_create(&thread, NULL, fake_hw_run, hw) != 0)
+            return 1;
+        if (DWLWaitHwReady(&hw->dwl, (u32)(-1)) != DWL_HW_WAIT_OK)
+            return 1;
+        (void) pthread_join(thread, NULL);
+        *tookUs += hw->doneUs - start;
+    }
+    return 0;
+}
+
+// the codec call as decoder_decode makes it
+static OMX_U32 counted_decode(INSTANCE *inst, const FAKE_CALL *call,
+                              OMX_U32 *tookUs)
+{
+    DWLWaitStats_t callWaits;
+    OSAL_U32 callStart;
+    OMX_U32 ret;
+
+    DWLGetWaitStats(&callWaits);
+    callStart = OSAL_GetTimeUs();
+    ret = fake_decode(&inst->hw, call, tookUs);
+    HantroHwDecOmx_perf_add_call(&inst->perf, OSAL_GetTimeUs() - callStart);
+    HantroHwDecOmx_perf_add_hw_wait(&inst->perf, &callWaits);
+    return ret;
+}
+
+static void init_instance(INSTANCE *inst, const char *name,
+                          const FAKE_CALL *calls, OMX_U32 numCalls)
+{
+    assert(numCalls <= TEST_MAX_CALLS);
+    memset(inst, 0, sizeof(INSTANCE));
+    inst->name = name;
+    inst->calls = calls;
+    inst->numCalls = numCalls;
+    inst->hw.dwl.clientType = DWL_CLIENT_TYPE_H264_DEC;
+    inst->hw.dwl.pRegBase = inst->hw.regs;
+    inst->hw.dwl.regSize = sizeof(inst->hw.regs);
+    HantroHwDecOmx_perf_reset(&inst->perf);
+}
+
+static void *decode_instance(void *arg)
+{
+    INSTANCE *inst = (INSTANCE *) arg;
+    OMX_U32 i;
+
+    for (i = 0; i < inst->numCalls; i++)
+        inst->failures += counted_decode(inst, &inst->calls[i],
+                                         &inst->tookUs[i]);
+    return NULL;
+}
+
+static OMX_U32 check_instance(const INSTANCE *inst)
+{
+    OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE c;
+    OMX_U32 runs = 0, totalUs = 0, maxUs = 0, tookUs = 0, maxTookUs = 0;
+    OMX_U32 failures = inst->failures;
+    OMX_U32 i, j;
+
+    for (i = 0; i < inst->numCalls; i++)
+    {
+        OMX_U32 us = 0;
+
+        for (j = 0; j < inst->calls[i].runs; j++)
+            us += inst->calls[i].delayUs[j];
+        runs += inst->calls[i].runs;
+        totalUs += us;
+        if (us > maxUs)
+            maxUs = us;
+        // the longest wait of a call, allowing for the counting of each run
+        tookUs += inst->tookUs[i];
+        us = inst->tookUs[i] + inst->calls[i].runs * TEST_RUN_OVERHEAD_US;
+        if (us > maxTookUs)
+            maxTookUs = us;
+    }
+
+    HantroHwDecOmx_perf_get(&inst->perf, &c);
+    printf("%s: %u calls %u ms, hw wait %u %u ms (max %u us); "
+           "injected %u runs %u us (max %u us per call), run %u us\n",
+           inst->name, c.nCodecCalls, c.nCodecTotalMs, c.nHwWaits,
+           c.nHwWaitTotalMs, c.nHwWaitMaxUs, runs, totalUs, maxUs, tookUs);
+
+    if (c.nCodecCalls != inst->numCalls)
+    {
+        printf("FAIL %s: %u codec calls counted, %u made\n", inst->name,
+               c.nCodecCalls, inst->numCalls);
+        failures++;
+    }
+    if (c.nHwWaits != runs)
+    {
+        printf("FAIL %s: %u hardware waits counted, %u runs\n", inst->name,
+               c.nHwWaits, runs);
+        failures++;
+    }
+    if (c.nHwWaitTotalMs < totalUs / 1000 ||
+        c.nHwWaitTotalMs > (tookUs + runs * TEST_RUN_OVERHEAD_US) / 1000)
+    {
+        printf("FAIL %s: %u ms hardware wait counted, %u us injected, "
+               "%u us run\n", inst->name, c.nHwWaitTotalMs, totalUs, tookUs);
+        failures++;
+    }
+    if (c.nHwWaitMaxUs < maxUs || c.nHwWaitMaxUs > maxTookUs)
+    {
+        printf("FAIL %s: longest wait %u us counted, %u us injected\n",
+               inst->name, c.nHwWaitMaxUs, maxUs);
+        failures++;
+    }
+    if (c.nCodecTotalMs < c.nHwWaitTotalMs)
+    {
+        printf("FAIL %s: %u ms codec time is less than its hardware wait\n",
+               inst->name, c.nCodecTotalMs);
+        failures++;
+    }
+    return failures;
+}
+
+// what the counting adds to a codec call with one hardware run: the
+// component's clock reads and DWL stats, and the DWL's own bookkeeping in
+// a wait that finds the hardware already done
+static OMX_U32 measure_overhead(void)
+{
+    static const FAKE_CALL none = { 0, { 0 } };
+    INSTANCE inst;
+    OSAL_U32 start, countUs, waitUs;
+    OMX_U32 i, tookUs;
+
+    init_instance(&inst, "overhead", NULL, 0);
+
+    start = OSAL_GetTimeUs();
+    for (i = 0; i < TEST_OVERHEAD_CALLS; i++)
+        (void) counted_decode(&inst, &none, &tookUs);
+    countUs = OSAL_GetTimeUs() - start;
+
+    inst.hw.regs[HX170DEC_REG_START / 4] = DWL_HW_PIC_RDY_BIT;
+    start = OSAL_GetTimeUs();
+    for (i = 0; i < TEST_OVERHEAD_CALLS; i++)
+        (void) DWLWaitHwReady(&inst.hw.dwl, (u32)(-1));
+    waitUs = OSAL_GetTimeUs() - start;
+
+    printf("counting: %u ns per codec call, %u ns per hardware wait "
+           "(%u.%03u%% of a %u us picture)\n",
+           (OMX_U32)((unsigned long long) countUs * 1000 / TEST_OVERHEAD_CALLS),
+           (OMX_U32)((unsigned long long) waitUs * 1000 / TEST_OVERHEAD_CALLS),
+           (OMX_U32)((unsigned long long)(countUs + waitUs) * 100 /
+                     TEST_OVERHEAD_CALLS / TEST_PICTURE_US),
+           (OMX_U32)((unsigned long long)(countUs + waitUs) * 100000 /
+                     TEST_OVERHEAD_CALLS / TEST_PICTURE_US % 1000),
+           TEST_PICTURE_US);
+
+    if ((unsigned long long)(countUs + waitUs) * 100 >
+        (unsigned long long) TEST_OVERHEAD_CALLS * TEST_PICTURE_US)
+    {
+        printf("FAIL counting takes 1%% or more of a %u us picture\n",
+               TEST_PICTURE_US);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    INSTANCE a, b;
+    pthread_t threadA, threadB;
+    OMX_U32 failures = 0;
+
+    init_instance(&a, "instance A", callsA, sizeof(callsA) / sizeof(callsA[0]));
+    init_instance(&b, "instance B", callsB, sizeof(callsB) / sizeof(callsB[0]));
+
+    if (pthread_create(&threadA, NULL, decode_instance, &a) != 0 ||
+        pthread_create(&threadB, NULL, decode_instance, &b) != 0)
+    {
+        printf("FAIL cannot start the decoding threads\n");
+        return 1;
+    }
+    (void) pthread_join(threadA, NULL);
+    (void) pthread_join(threadB, NULL);
+
+    failures += check_instance(&a);
+    failures += check_instance(&b);
+    failures += measure_overhead();
+
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+
+    return failures ? 1 : 0;
+}
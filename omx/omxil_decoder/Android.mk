@@ -107,6 +107,7 @@ libhantrovideodec_SRCS = $(VIDEO_SRCS) \
 			$(base_SRCS) \
 			8170_decoder/codec_pp.c \
 			8170_decoder/post_processor.c \
+			8170_decoder/perf_counters.c \
 			8170_decoder/library_entry_point.c \
 			8170_decoder/decoder.c
 
@@ -189,6 +190,7 @@ libhantroimagedec_SRCS = $(IMAGE_SRCS) \
 			$(base_SRCS) \
 			8170_decoder/codec_pp.c \
 			8170_decoder/post_processor.c \
+			8170_decoder/perf_counters.c \
 			8170_decoder/library_entry_point.c \
 			8170_decoder/decoder.c
 
@@ -211,3 +213,53 @@ LOCAL_MODULE_TAGS := optional
 #include $(BUILD_SHARED_LIBRARY)
 
 
+
+#
+# Perf counter check against the polling DWL with faked hardware runs, on
+# the host and on the device
+#
+
+include $(CLEAR_VARS)
+LOCAL_SRC_FILES := 8170_decoder/tests/perf_counters_test.c \
+		   8170_decoder/perf_counters.c \
+		   OSAL.c \
+		   ../../decoder/dwl/dwl_linux.c \
+		   ../../decoder/dwl/dwl_linux_lock.c \
+		   ../../decoder/dwl/dwl_x170_linux_no_drv.c
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/ \
+		    $(LOCAL_PATH)/8170_decoder \
+		    $(TOP)/frameworks/native/include/media/openmax \
+		    $(LOCAL_PATH)/../../decoder/inc \
+		    $(LOCAL_PATH)/../../decoder/common \
+		    $(LOCAL_PATH)/../../decoder/dwl
+LOCAL_CFLAGS := -DANDROID \
+		-DDEC_MODULE_PATH=\"/dev/hx170dec\" \
+		-DMEMALLOC_MODULE_PATH=\"/dev/memalloc\" \
+		-Wno-unused-parameter
+LOCAL_SHARED_LIBRARIES := liblog
+LOCAL_LDLIBS := -lpthread
+LOCAL_MODULE := hantro_perf_counters_test
+LOCAL_MODULE_TAGS := optional
+include $(BUILD_HOST_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_SRC_FILES := 8170_decoder/tests/perf_counters_test.c \
+		   8170_decoder/perf_counters.c \
+		   OSAL.c \
+		   ../../decoder/dwl/dwl_linux.c \
+		   ../../decoder/dwl/dwl_linux_lock.c \
+		   ../../decoder/dwl/dwl_x170_linux_no_drv.c
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/ \
+		    $(LOCAL_PATH)/8170_decoder \
+		    $(TOP)/frameworks/native/include/media/openmax \
+		    $(LOCAL_PATH)/../../decoder/inc \
+		    $(LOCAL_PATH)/../../decoder/common \
+		    $(LOCAL_PATH)/../../decoder/dwl
+LOCAL_CFLAGS := -DANDROID \
+		-DDEC_MODULE_PATH=\"/dev/hx170dec\" \
+		-DMEMALLOC_MODULE_PATH=\"/dev/memalloc\" \
+		-Wno-unused-parameter
+LOCAL_SHARED_LIBRARIES := liblog
+LOCAL_MODULE := hantro_perf_counters_test
+LOCAL_MODULE_TAGS := optional
+include $(BUILD_EXECUTABLE)
@@ -35,6 +35,23 @@ extern "C"
 
 // hantro encoder interface
 
+typedef enum FRAME_TYPE
+{
+    INTRA_FRAME,
+    PREDICTED_FRAME
+} FRAME_TYPE;
+
+/**
+ * Called by the codec from inside encode() each time a slice of the picture
+ * is complete in the stream buffer, for every slice but the last one. The
+ * last slice and anything the codec writes after it are left to common,
+ * which outputs them after encode() returns and completes the picture
+ * there, once. Returns OMX_FALSE if the slice was not taken, in which case
+ * the codec stops calling and common outputs the rest of the picture.
+ */
+typedef OMX_BOOL (*STREAM_SLICE_READY)(void* pAppData, OMX_U8* data, OMX_U32 len,
+                                       FRAME_TYPE type);
+
 /**
  * Structure for encoded stream
  */
@@ -47,13 +64,11 @@ typedef struct STREAM_BUFFER
 
     OMX_U32 *pOutBuf[9];        // vp8 partition pointers
     OMX_U32 streamSize[9];      // vp8 partition sizes
-} STREAM_BUFFER;
 
-typedef enum FRAME_TYPE
-{
-    INTRA_FRAME,
-    PREDICTED_FRAME
-} FRAME_TYPE;
+    STREAM_SLICE_READY sliceReady;  // set by common, NULL for whole pictures
+    void* pSliceAppData;            // set by common
+    OMX_U32 sliceBytesDone;         // set by codec, bytes taken by sliceReady
+} STREAM_BUFFER;
 
 /**
  * Structure for raw input frame
@@ -210,6 +225,67 @@ typedef struct ENCODER_COMMON_CONFIG
 
 } ENCODER_COMMON_CONFIG;
 
+// rectangular macroblock area, bottom and right are inclusive
+typedef struct OMX_VIDEO_ROIAREATYPE
+{
+    OMX_BOOL bEnable;
+    OMX_U32 nTop;
+    OMX_U32 nLeft;
+    OMX_U32 nBottom;
+    OMX_U32 nRight;
+} OMX_VIDEO_ROIAREATYPE;
+
+// OMX.hantro.index.config.video.roi
+// Region of interest coding, can be changed between pictures.
+typedef struct OMX_VIDEO_CONFIG_ROITYPE
+{
+    OMX_U32 nSize;
+    OMX_VERSIONTYPE nVersion;
+    OMX_U32 nPortIndex;
+
+    // macroblocks always coded as intra
+    OMX_VIDEO_ROIAREATYPE sIntraArea;
+
+    // QP of the regions is lowered by the delta, [-15..0]
+    OMX_VIDEO_ROIAREATYPE sRoi1Area;
+    OMX_S32 nRoi1DeltaQp;
+    OMX_VIDEO_ROIAREATYPE sRoi2Area;
+    OMX_S32 nRoi2DeltaQp;
+
+    // QP delta for areas detected as skin, [-51..0], 0 = disabled
+    OMX_S32 nAdaptiveRoi;
+} OMX_VIDEO_CONFIG_ROITYPE;
+
+// OMX.hantro.index.config.perfCounters
+// Counters of one encoder instance since it was loaded, can be read at any
+// time. Setting it logs the counters and starts them again from zero.
+// Codec time is spent inside the codec encode call, waiting for the
+// hardware included; the encoder wrapper (EWL) is a prebuilt library, so the
+// wait can't be told apart from the rest of the call. Convert time is spent
+// waiting for opaque RGBA input to be turned into YUV (conversion
+// overlapping an encode is not counted), copy time moving pictures and
+// stream between OMX buffers and codec buffers. The queue depths are
+// sampled whenever an input buffer is taken.
+typedef struct OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE
+{
+    OMX_U32 nSize;
+    OMX_VERSIONTYPE nVersion;
+    OMX_U32 nPortIndex;
+    OMX_U32 nElapsedMs;         // since the counters were started
+    OMX_U32 nFrames;            // pictures encoded
+    OMX_U32 nCodecCalls;
+    OMX_U32 nCodecTotalMs;
+    OMX_U32 nCodecAvgUs;
+    OMX_U32 nCodecMaxUs;
+    OMX_U32 nConvertTotalMs;
+    OMX_U32 nCopyTotalMs;
+    OMX_U32 nCopyKBytes;
+    OMX_U32 nInputQueueMax;     // input pictures waiting to be encoded
+    OMX_U32 nInputQueueAvg;
+    OMX_U32 nOutputQueueMax;    // empty output buffers held by the component
+    OMX_U32 nOutputQueueAvg;
+} OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE;
+
 #ifdef __cplusplus
 }
 #endif
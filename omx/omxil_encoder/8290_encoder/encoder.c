@@ -27,6 +27,11 @@
 #define TRACE_PRINT(args...) ALOGV(args)
 #include "../../../gralloc/gralloc_priv.h"
 #include <hardware/power.h>
+
+// Layout opaque (RGBA) input is converted to before encoding
+#ifndef OPAQUE_INPUT_FORMAT
+#define OPAQUE_INPUT_FORMAT OMX_COLOR_FormatYUV420Planar
+#endif
 #endif
 
 #include <OSAL.h>
@@ -83,6 +88,8 @@ static OMX_ERRORTYPE async_encode_stabilized_data(OMX_ENCODER* pEnc, OMX_U8* bus
 static OMX_ERRORTYPE async_encode_video_data(OMX_ENCODER* pEnc, OMX_U8* bus_data, OSAL_BUS_WIDTH bus_address,
                                 OMX_U32 datalen, BUFFER* buff, OMX_U32* retlen, OMX_U32 frameSize );
 static OMX_ERRORTYPE set_avc_intra_period(OMX_ENCODER* pEnc);
+static OMX_ERRORTYPE set_avc_coding_ctrl(OMX_ENCODER* pEnc);
+static OMX_ERRORTYPE store_intra_refresh(OMX_ENCODER* pEnc, const OMX_VIDEO_PARAM_INTRAREFRESHTYPE* param);
 static OMX_ERRORTYPE set_frame_rate(OMX_ENCODER* pEnc);
 #endif
 // image domain specific functions
@@ -109,6 +116,73 @@ static OMX_ERRORTYPE calculate_new_outputBufferSize(OMX_ENCODER* pEnc);
 
 #define GET_ENCODER(comp) (OMX_ENCODER*)(((OMX_COMPONENTTYPE*)(comp))->pComponentPrivate)
 
+static void perf_reset(PERF_COUNTERS* perf)
+{
+    memset(perf, 0, sizeof(PERF_COUNTERS));
+    perf->startMs = OSAL_GetTime();
+}
+
+// queue depths seen when an input buffer is taken for encoding
+static void perf_sample_queues(OMX_ENCODER* pEnc)
+{
+    PERF_COUNTERS* perf = &pEnc->perf;
+    OMX_U32 in  = HantroOmx_port_buffer_queue_count(&pEnc->inputPort);
+    OMX_U32 out = HantroOmx_port_buffer_queue_count(&pEnc->outputPort);
+
+    perf->queueSamples++;
+    perf->inQueueSum  += in;
+    perf->outQueueSum += out;
+    if (in > perf->inQueueMax)
+        perf->inQueueMax = in;
+    if (out > perf->outQueueMax)
+        perf->outQueueMax = out;
+}
+
+static void perf_add_call(PERF_COUNTERS* perf, OMX_U32 us)
+{
+    perf->calls++;
+    perf->callUs += us;
+    if (us > perf->callMaxUs)
+        perf->callMaxUs = us;
+}
+
+static void perf_add_copy(PERF_COUNTERS* perf, OMX_U32 us, OMX_U32 bytes)
+{
+    perf->copyUs    += us;
+    perf->copyBytes += bytes;
+}
+
+static void perf_get(PERF_COUNTERS* perf, OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE* out)
+{
+    out->nElapsedMs      = OSAL_GetTime() - perf->startMs;
+    out->nFrames         = perf->frames;
+    out->nCodecCalls     = perf->calls;
+    out->nCodecTotalMs   = (OMX_U32)(perf->callUs / 1000);
+    out->nCodecAvgUs     = perf->calls ? (OMX_U32)(perf->callUs / perf->calls) : 0;
+    out->nCodecMaxUs     = perf->callMaxUs;
+    out->nConvertTotalMs = (OMX_U32)(perf->convertUs / 1000);
+    out->nCopyTotalMs    = (OMX_U32)(perf->copyUs / 1000);
+    out->nCopyKBytes     = (OMX_U32)(perf->copyBytes / 1024);
+    out->nInputQueueMax  = perf->inQueueMax;
+    out->nInputQueueAvg  = perf->queueSamples ?
+        (OMX_U32)((perf->inQueueSum + perf->queueSamples / 2) / perf->queueSamples) : 0;
+    out->nOutputQueueMax = perf->outQueueMax;
+    out->nOutputQueueAvg = perf->queueSamples ?
+        (OMX_U32)((perf->outQueueSum + perf->queueSamples / 2) / perf->queueSamples) : 0;
+}
+
+static void perf_dump(OMX_ENCODER* pEnc)
+{
+    OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE c;
+
+    perf_get(&pEnc->perf, &c);
+    ALOGI("perf %p: %u frames in %u ms, encode %u calls %u ms (avg %u us, max %u us), "
+          "convert %u ms, copy %u ms %u KB, input queue avg %u max %u, output queue avg %u max %u",
+          pEnc, c.nFrames, c.nElapsedMs, c.nCodecCalls, c.nCodecTotalMs, c.nCodecAvgUs, c.nCodecMaxUs,
+          c.nConvertTotalMs, c.nCopyTotalMs, c.nCopyKBytes, c.nInputQueueAvg, c.nInputQueueMax,
+          c.nOutputQueueAvg, c.nOutputQueueMax);
+}
+
 
 
 /**
@@ -314,13 +388,23 @@ OMX_ERRORTYPE encoder_deinit( OMX_HANDLETYPE hComponent )
         encoder_dealloc_buffers(pEnc, &pEnc->inputPort);
         encoder_dealloc_buffers(pEnc, &pEnc->outputPort);
         if (pEnc->codec)
+        {
+            perf_dump(pEnc);
             pEnc->codec->destroy(pEnc->codec);
+        }
         /*if (pEnc->frame_in.bus_address)
             FRAME_BUFF_FREE(&pEnc->alloc, &pEnc->frame_in);*/
         if (pEnc->frame_out.bus_address)
             FRAME_BUFF_FREE(&pEnc->alloc, &pEnc->frame_out);
         if (pEnc->tempBuffer.bus_address)
             FRAME_BUFF_FREE(&pEnc->alloc, &pEnc->tempBuffer);
+#ifdef ANDROID
+        yuv_pool_destroy(pEnc->yuvPool);
+        pEnc->yuvPool = NULL;
+        pEnc->convertAhead = NULL;
+        if (pEnc->nextBuffer.bus_address)
+            FRAME_BUFF_FREE(&pEnc->alloc, &pEnc->nextBuffer);
+#endif
     }
     else
     {
@@ -873,6 +957,11 @@ OMX_ERRORTYPE encoder_free_buffer(OMX_IN OMX_HANDLETYPE hComponent,
   if ((param)->nPortIndex != PORT_INDEX_INPUT) \
       return OMX_ErrorBadPortIndex;
 
+// for structures copied whole, the client nSize must match what is copied
+#define CHECK_PARAM_SIZE(param, type) \
+  if ((param)->nSize != sizeof(type)) \
+      return OMX_ErrorBadParameter;
+
 #ifdef OMX_ENCODER_VIDEO_DOMAIN
 static
 OMX_ERRORTYPE encoder_set_parameter(OMX_IN OMX_HANDLETYPE hComponent,
@@ -1033,6 +1122,7 @@ OMX_ERRORTYPE encoder_set_parameter(OMX_IN OMX_HANDLETYPE hComponent,
                         config->eLevel = param->eLevel;
                         config->eProfile = param->eProfile;
                         config->nPFrames = param->nPFrames;
+                        config->nSliceHeaderSpacing = param->nSliceHeaderSpacing;
                         break;
                     default:
                         TRACE_PRINT("API: No such port\n");
@@ -1343,6 +1433,21 @@ OMX_ERRORTYPE encoder_set_parameter(OMX_IN OMX_HANDLETYPE hComponent,
 		}
 		break;
 	}
+        case OMX_IndexParamVideoIntraRefresh:
+            {
+                OMX_VIDEO_PARAM_INTRAREFRESHTYPE* param = (OMX_VIDEO_PARAM_INTRAREFRESHTYPE*)pParam;
+                CHECK_PORT_OUTPUT(param);
+                return store_intra_refresh(pEnc, param);
+            }
+            break;
+	case OMX_HantroIndexParamVideoSliceOutput:
+	{
+		OMX_CONFIG_BOOLEANTYPE *param = (OMX_CONFIG_BOOLEANTYPE *)pParam;
+		CHECK_PORT_STATE(pEnc, &pEnc->outputPort.def);
+		TRACE_PRINT("OMX.hantro.index.param.video.sliceOutput: %d", param->bEnabled);
+		pEnc->encConfig.sliceOutput.bEnabled = param->bEnabled;
+		break;
+	}
         default:
             TRACE_PRINT("API: unsupported settings index\n");
             return OMX_ErrorUnsupportedIndex;
@@ -1541,6 +1646,20 @@ OMX_ERRORTYPE encoder_get_parameter(OMX_IN    OMX_HANDLETYPE hComponent,
                     return OMX_ErrorBadPortIndex;
             }
             break;
+        case OMX_IndexParamVideoIntraRefresh:
+            {
+                OMX_VIDEO_PARAM_INTRAREFRESHTYPE* param = (OMX_VIDEO_PARAM_INTRAREFRESHTYPE*)pParam;
+                CHECK_PORT_OUTPUT(param);
+                CHECK_PARAM_SIZE(param, OMX_VIDEO_PARAM_INTRAREFRESHTYPE);
+                memcpy(param, &pEnc->encConfig.cir, sizeof(OMX_VIDEO_PARAM_INTRAREFRESHTYPE));
+            }
+            break;
+        case OMX_HantroIndexParamVideoSliceOutput:
+            {
+                OMX_CONFIG_BOOLEANTYPE* param = (OMX_CONFIG_BOOLEANTYPE*)pParam;
+                param->bEnabled = pEnc->encConfig.sliceOutput.bEnabled;
+            }
+            break;
 #if !defined (ENC8270) && !defined (ENC8290) && !defined (ENCH1)
         case OMX_IndexParamVideoMpeg4:
             {
@@ -2313,7 +2432,34 @@ OMX_ERRORTYPE encoder_set_config(OMX_IN OMX_HANDLETYPE hComponent,
                 set_avc_intra_period(pEnc);
             }
             break;
+        case OMX_IndexParamVideoIntraRefresh:
+            {
+                OMX_VIDEO_PARAM_INTRAREFRESHTYPE* param = (OMX_VIDEO_PARAM_INTRAREFRESHTYPE*) pParam;
+                CHECK_PORT_OUTPUT(param);
+                return store_intra_refresh(pEnc, param);
+            }
+            break;
+        case OMX_HantroIndexConfigVideoRoi:
+            {
+                OMX_VIDEO_CONFIG_ROITYPE* param = (OMX_VIDEO_CONFIG_ROITYPE*) pParam;
+                CHECK_PORT_OUTPUT(param);
+                CHECK_PARAM_SIZE(param, OMX_VIDEO_CONFIG_ROITYPE);
+                if (param->nRoi1DeltaQp < -15 || param->nRoi1DeltaQp > 0 ||
+                    param->nRoi2DeltaQp < -15 || param->nRoi2DeltaQp > 0 ||
+                    param->nAdaptiveRoi < -51 || param->nAdaptiveRoi > 0)
+                {
+                    TRACE_PRINT("API: roi qp delta out of range\n");
+                    return OMX_ErrorBadParameter;
+                }
+                memcpy(&pEnc->encConfig.roi, param, sizeof(OMX_VIDEO_CONFIG_ROITYPE));
+                pEnc->encConfig.bCodingCtrlChanged = OMX_TRUE;
+            }
+            break;
 #endif /* OMX_ENCODER_VIDEO_DOMAIN */
+        case OMX_HantroIndexConfigPerfCounters:
+            perf_dump(pEnc);
+            perf_reset(&pEnc->perf);
+            break;
         default: return OMX_ErrorUnsupportedIndex;
     }
 
@@ -2395,7 +2541,26 @@ OMX_ERRORTYPE encoder_get_config(OMX_IN    OMX_HANDLETYPE hComponent,
                 memcpy(param, &pEnc->encConfig.avcIdr, param->nSize);
             }
             break;
+        case OMX_IndexParamVideoIntraRefresh:
+            {
+                OMX_VIDEO_PARAM_INTRAREFRESHTYPE* param = (OMX_VIDEO_PARAM_INTRAREFRESHTYPE*) pParam;
+                CHECK_PORT_OUTPUT(param);
+                CHECK_PARAM_SIZE(param, OMX_VIDEO_PARAM_INTRAREFRESHTYPE);
+                memcpy(param, &pEnc->encConfig.cir, sizeof(OMX_VIDEO_PARAM_INTRAREFRESHTYPE));
+            }
+            break;
+        case OMX_HantroIndexConfigVideoRoi:
+            {
+                OMX_VIDEO_CONFIG_ROITYPE* param = (OMX_VIDEO_CONFIG_ROITYPE*) pParam;
+                CHECK_PORT_OUTPUT(param);
+                CHECK_PARAM_SIZE(param, OMX_VIDEO_CONFIG_ROITYPE);
+                memcpy(param, &pEnc->encConfig.roi, sizeof(OMX_VIDEO_CONFIG_ROITYPE));
+            }
+            break;
 #endif /* OMX_ENCODER_VIDEO_DOMAIN */
+        case OMX_HantroIndexConfigPerfCounters:
+            perf_get(&pEnc->perf, (OMX_HANTRO_CONFIG_PERFCOUNTERSTYPE*) pParam);
+            break;
 
         default: return OMX_ErrorUnsupportedIndex;
     }
@@ -2688,6 +2853,18 @@ OMX_ERRORTYPE encoder_get_extension_index(OMX_HANDLETYPE hComponent, OMX_STRING
 	{
 		*pIndexType = (OMX_INDEXTYPE)OMX_GoogleIndexStoreMetaDataInBuffers;
 	}
+	else if (!strcmp(cParameterName, "OMX.hantro.index.param.video.sliceOutput"))
+	{
+		*pIndexType = (OMX_INDEXTYPE)OMX_HantroIndexParamVideoSliceOutput;
+	}
+	else if (!strcmp(cParameterName, "OMX.hantro.index.config.video.roi"))
+	{
+		*pIndexType = (OMX_INDEXTYPE)OMX_HantroIndexConfigVideoRoi;
+	}
+	else if (!strcmp(cParameterName, "OMX.hantro.index.config.perfCounters"))
+	{
+		*pIndexType = (OMX_INDEXTYPE)OMX_HantroIndexConfigPerfCounters;
+	}
 	else
 	{
 		ALOGE("%s: %s not implemented!\n", __func__, cParameterName);
@@ -3095,9 +3272,12 @@ OMX_ERRORTYPE calculate_frame_size( OMX_ENCODER* pEnc, OMX_U32* frameSize )
         case OMX_COLOR_FormatYUV420PackedSemiPlanar:
         case OMX_COLOR_FormatYUV420PackedPlanar:
 	case OMX_COLOR_FormatAndroidOpaque:
+            // chroma planes round odd sizes up
             *frameSize =
             pEnc->inputPort.def.format.video.nFrameHeight *
-            pEnc->inputPort.def.format.video.nStride * 3/2;
+            pEnc->inputPort.def.format.video.nStride +
+            ((pEnc->inputPort.def.format.video.nFrameHeight + 1) / 2) *
+            ((pEnc->inputPort.def.format.video.nStride + 1) / 2) * 2;
             break;
         case OMX_COLOR_Format16bitARGB4444:
         case OMX_COLOR_Format16bitARGB1555:
@@ -3189,6 +3369,21 @@ OMX_ERRORTYPE set_avc_defaults( OMX_ENCODER* pEnc)
 
     deb->bDeblocking = OMX_FALSE;
 
+    pEnc->encConfig.sliceOutput.bEnabled = OMX_FALSE;
+
+    OMX_VIDEO_PARAM_INTRAREFRESHTYPE* cir = 0;
+    cir = &pEnc->encConfig.cir;
+    cir->nPortIndex = PORT_INDEX_OUTPUT;
+    cir->eRefreshMode = OMX_VIDEO_IntraRefreshCyclic;
+    cir->nAirMBs = 0;
+    cir->nAirRef = 0;
+    cir->nCirMBs = 0;
+
+    OMX_VIDEO_CONFIG_ROITYPE* roi = 0;
+    roi = &pEnc->encConfig.roi;
+    memset(roi, 0, sizeof(OMX_VIDEO_CONFIG_ROITYPE));
+    roi->nPortIndex = PORT_INDEX_OUTPUT;
+
     OMX_VIDEO_PARAM_QUANTIZATIONTYPE* quantization  = 0;
     quantization = &pEnc->encConfig.videoQuantization;
     quantization->nPortIndex = PORT_INDEX_OUTPUT;
@@ -3619,7 +3814,7 @@ TRACE_PRINT("TEST Codec\n");
             config.pp_config.origHeight = pEnc->inputPort.def.format.video.nFrameHeight;
             config.nSliceHeight = 0;
 	    if (pEnc->inputPort.def.format.video.eColorFormat == OMX_COLOR_FormatAndroidOpaque)
-		config.pp_config.formatType = OMX_COLOR_FormatYUV420Planar;
+		config.pp_config.formatType = OPAQUE_INPUT_FORMAT;
 	    else
 		config.pp_config.formatType = pEnc->inputPort.def.format.video.eColorFormat;
             config.common_config.nInputFramerate = pEnc->inputPort.def.format.video.xFramerate;
@@ -3661,6 +3856,15 @@ TRACE_PRINT("TEST Codec\n");
                 config.pp_config.xOffset = pEnc->encConfig.crop.nLeft;
                 config.pp_config.yOffset = pEnc->encConfig.crop.nTop;
             }
+            if ( pEnc->encConfig.sliceOutput.bEnabled &&
+                 pEnc->encConfig.avc.nSliceHeaderSpacing > 0 )
+            {
+                // only low-latency output slices the picture, whole pictures stay one slice.
+                // nSliceHeaderSpacing is in macroblocks, the codec slices by macroblock rows
+                OMX_U32 mbPerRow = (config.common_config.nOutputWidth + 15) / 16;
+                config.nSliceHeight = 16 * ((pEnc->encConfig.avc.nSliceHeaderSpacing + mbPerRow - 1) / mbPerRow);
+                TRACE_PRINT("ASYNC: slice height %u\n", (unsigned)config.nSliceHeight);
+            }
             config.h264_config.eProfile = pEnc->encConfig.avc.eProfile;
             config.h264_config.eLevel = pEnc->encConfig.avc.eLevel;
             config.bDisableDeblocking = pEnc->encConfig.deblocking.bDeblocking;
@@ -3722,6 +3926,8 @@ TRACE_PRINT("TEST Codec\n");
             config.bSeiMessages = OMX_FALSE;
 
             codec = HantroHwEncOmx_encoder_create_h264( &config );
+            // cir and roi are set up before the first picture
+            pEnc->encConfig.bCodingCtrlChanged = OMX_TRUE;
 ALOGV("%s: codec created", __func__);
         }
         break;
@@ -4326,6 +4532,7 @@ ALOGV("%s: codec created", __func__);
     pEnc->codec     = codec;
     pEnc->frame_in  = in;
     pEnc->frame_out = out;
+    perf_reset(&pEnc->perf);
 
     return OMX_ErrorNone;
 
@@ -4343,6 +4550,23 @@ ALOGV("%s: codec created", __func__);
 }
 
 
+#ifdef ANDROID
+/**
+ * static void opaque_convert_cancel(OMX_ENCODER* pEnc)
+ * Waits for a conversion started ahead on a queued input buffer, so that the
+ * buffer can be handed back to the client.
+ */
+static
+void opaque_convert_cancel(OMX_ENCODER* pEnc)
+{
+    if (!pEnc->convertAhead)
+        return;
+
+    yuv_pool_wait(pEnc->yuvPool);
+    pEnc->convertAhead = NULL;
+}
+#endif
+
 /**
  * static OMX_ERRORTYPE async_encoder_return_buffers(OMX_ENCODER* pEnc, PORT* p)
  */
@@ -4352,6 +4576,11 @@ OMX_ERRORTYPE async_encoder_return_buffers(OMX_ENCODER* pEnc, PORT* p)
     if (HantroOmx_port_is_supplier(p))
         return OMX_ErrorNone;
 
+#ifdef ANDROID
+    if (p == &pEnc->inputPort)
+        opaque_convert_cancel(pEnc);
+#endif
+
     TRACE_PRINT("ASYNC: %s\n", __FUNCTION__);
     TRACE_PRINT("ASYNC: returning allocated buffers on port %d to %p %d\n",
                 (int)p->def.nPortIndex,
@@ -4531,6 +4760,7 @@ OMX_ERRORTYPE transition_to_loaded_from_idle(OMX_ENCODER* pEnc)
 
     assert(pEnc->codec);
 
+    perf_dump(pEnc);
     pEnc->codec->destroy(pEnc->codec);
 
 //BS:: do not free input buffer, address is used as zero copy from upper layers
@@ -4540,6 +4770,14 @@ OMX_ERRORTYPE transition_to_loaded_from_idle(OMX_ENCODER* pEnc)
         FRAME_BUFF_FREE(&pEnc->alloc, &pEnc->frame_out);
     if (pEnc->tempBuffer.bus_address)
         FRAME_BUFF_FREE(&pEnc->alloc, &pEnc->tempBuffer);
+#ifdef ANDROID
+    yuv_pool_destroy(pEnc->yuvPool);
+    pEnc->yuvPool = NULL;
+    pEnc->convertAhead = NULL;
+    if (pEnc->nextBuffer.bus_address)
+        FRAME_BUFF_FREE(&pEnc->alloc, &pEnc->nextBuffer);
+    memset(&pEnc->nextBuffer, 0, sizeof(FRAME_BUFFER));
+#endif
 
     pEnc->codec    = NULL;
     memset(&pEnc->frame_in,  0, sizeof(FRAME_BUFFER));
@@ -5149,6 +5387,234 @@ OMX_ERRORTYPE async_end_stream( OMX_ENCODER* pEnc )
 
 
 #ifdef OMX_ENCODER_VIDEO_DOMAIN
+#ifdef ANDROID
+/**
+ * OMX_U32 opaque_input_pitch(OMX_ENCODER* pEnc, BUFFER* buff)
+ * Row pitch in bytes of the RGBA frame behind an opaque input buffer,
+ * taken from its gralloc handle when the buffer carries one.
+ */
+static
+OMX_U32 opaque_input_pitch(OMX_ENCODER* pEnc, BUFFER* buff)
+{
+    if (pEnc->inputPort.StoreMetadata && buff->header->nAllocLen == 8)
+    {
+        struct VideoGrallocMetadata *meta = (struct VideoGrallocMetadata *)buff->header->pBuffer;
+        struct private_handle_t *handle = (struct private_handle_t *)meta->pHandle;
+
+        if (handle && handle->stride > 0)
+            return handle->stride * 4;
+    }
+
+    return pEnc->inputPort.def.format.video.nFrameWidth * 4;
+}
+
+/**
+ * static OMX_BOOL eos_without_frame(BUFFER* buff)
+ * An EOS input buffer that only ends the stream. One that also carries a
+ * frame is encoded first.
+ */
+static
+OMX_BOOL eos_without_frame(BUFFER* buff)
+{
+    return (buff->header->nFlags & OMX_BUFFERFLAG_EOS) &&
+           (buff->header->nFilledLen == 0 || (!buff->bus_data && !buff->bus_address));
+}
+
+/**
+ * OMX_ERRORTYPE alloc_temp_input(OMX_ENCODER* pEnc, FRAME_BUFFER* buff, OMX_U32 frameSize)
+ * Internal DMA buffer for input frames the hardware can't read in place.
+ */
+static
+OMX_ERRORTYPE alloc_temp_input(OMX_ENCODER* pEnc, FRAME_BUFFER* buff, OMX_U32 frameSize)
+{
+    if (buff->bus_address)
+    {
+        if (buff->capacity >= frameSize)
+            return OMX_ErrorNone;
+        // the frame grew since the buffer was allocated
+        FRAME_BUFF_FREE(&pEnc->alloc, buff);
+        memset(buff, 0, sizeof(FRAME_BUFFER));
+    }
+
+    OMX_U8* bus_data = NULL;
+    OSAL_BUS_WIDTH bus_address = 0;
+    OMX_U32 allocsize = frameSize;
+
+    ALOGV("Allocating temp input buffer, allocsize = %u", allocsize);
+    OMX_ERRORTYPE err = OSAL_AllocatorAllocMem(&pEnc->alloc, &allocsize, &bus_data, &bus_address);
+    if (err != OMX_ErrorNone)
+        return err;
+    ALOGV("Alllocated: %u", allocsize);
+    buff->bus_address = bus_address;
+    buff->bus_data = bus_data;
+    buff->capacity = allocsize;
+
+    return OMX_ErrorNone;
+}
+
+/**
+ * static int opaque_convert_start(OMX_ENCODER* pEnc, BUFFER* inputBuffer, FRAME_BUFFER* dst)
+ * Hands the RGBA frame of an opaque input buffer to the conversion workers,
+ * converted straight into the layout the codec was configured for.
+ */
+static
+int opaque_convert_start(OMX_ENCODER* pEnc, BUFFER* inputBuffer, FRAME_BUFFER* dst)
+{
+    OMX_U32 width  = pEnc->inputPort.def.format.video.nFrameWidth;
+    OMX_U32 height = pEnc->inputPort.def.format.video.nFrameHeight;
+    OMX_U32 stride = pEnc->inputPort.def.format.video.nStride;
+    OMX_U32 chromaStride = (stride + 1) / 2;
+    OMX_U8* luma   = dst->bus_data;
+    OMX_U8* chroma = luma + stride * height;
+
+    if (OPAQUE_INPUT_FORMAT == OMX_COLOR_FormatYUV420SemiPlanar)
+        return ABGRToNV12_start(pEnc->yuvPool, inputBuffer->bus_data, opaque_input_pitch(pEnc, inputBuffer),
+                   luma, stride, chroma, stride, width, height);
+
+    // an odd last row or column still has its own chroma sample
+    return ABGRToI420_start(pEnc->yuvPool, inputBuffer->bus_data, opaque_input_pitch(pEnc, inputBuffer),
+               luma, stride, chroma, chromaStride, chroma + ((height + 1) / 2) * chromaStride, chromaStride,
+               width, height);
+}
+
+/**
+ * static void opaque_convert_ahead(OMX_ENCODER* pEnc, OMX_U32 frameSize)
+ * Starts converting the input buffer queued behind the current one into
+ * nextBuffer, so the workers convert frame N+1 while the hardware encodes
+ * frame N. The buffer stays queued; async_video_encoder_encode collects the
+ * result when it reaches it.
+ */
+static
+void opaque_convert_ahead(OMX_ENCODER* pEnc, OMX_U32 frameSize)
+{
+    BUFFER* next = NULL;
+
+    if (HantroOmx_port_lock_buffers(&pEnc->inputPort) != OMX_ErrorNone)
+        return;
+    HantroOmx_port_get_buffer_at(&pEnc->inputPort, &next, 1);
+    HantroOmx_port_unlock_buffers(&pEnc->inputPort);
+
+    if (!next || eos_without_frame(next))
+        return;
+    if (alloc_temp_input(pEnc, &pEnc->nextBuffer, frameSize) != OMX_ErrorNone)
+        return;
+
+    if (opaque_convert_start(pEnc, next, &pEnc->nextBuffer) == 0)
+        pEnc->convertAhead = next;
+}
+
+/**
+ * OMX_U32 metadata_input_stride(OMX_ENCODER* pEnc, BUFFER* buff)
+ * Row stride in pixels of the frame behind a camera or gralloc metadata
+ * input buffer.
+ */
+static
+OMX_U32 metadata_input_stride(OMX_ENCODER* pEnc, BUFFER* buff)
+{
+    if (buff->header->nAllocLen == 8)
+    {
+        struct VideoGrallocMetadata *meta = (struct VideoGrallocMetadata *)buff->header->pBuffer;
+        struct private_handle_t *handle = (struct private_handle_t *)meta->pHandle;
+
+        if (handle && handle->stride > 0)
+            return handle->stride;
+    }
+    else if (buff->header->nFilledLen == 32)
+    {
+        struct CameraSourceMetadata *meta = (struct CameraSourceMetadata *)buff->header->pBuffer;
+        return meta->width;
+    }
+
+    return pEnc->inputPort.def.format.video.nStride;
+}
+
+/**
+ * static OMX_ERRORTYPE async_encode_metadata_input(OMX_ENCODER* pEnc, BUFFER* inputBuffer,
+ *                                                  OMX_U32 frameSize)
+ * Encodes the YUV frame a metadata input buffer refers to. When the buffer has
+ * a physical address and the layout the codec was set up for, the hardware
+ * reads it in place. Otherwise the frame is copied row by row into the
+ * internal buffer first.
+ */
+static
+OMX_ERRORTYPE async_encode_metadata_input(OMX_ENCODER* pEnc, BUFFER* inputBuffer, OMX_U32 frameSize)
+{
+    OMX_U32 srcStride = metadata_input_stride(pEnc, inputBuffer);
+    OMX_U32 dstStride = pEnc->inputPort.def.format.video.nStride;
+    OMX_U32 width     = pEnc->inputPort.def.format.video.nFrameWidth;
+    OMX_U32 height    = pEnc->inputPort.def.format.video.nFrameHeight;
+    OMX_U32 retlen    = 0;
+    OMX_ERRORTYPE err;
+
+    if (inputBuffer->bus_address && srcStride == dstStride && inputBuffer->allocsize >= frameSize)
+    {
+        TRACE_PRINT("ASYNC: encoding in place from 0x%x\n", inputBuffer->bus_address);
+        return async_encode_video_data(pEnc, inputBuffer->bus_data, inputBuffer->bus_address,
+                                       frameSize, inputBuffer, &retlen, frameSize);
+    }
+
+    if (inputBuffer->bus_data == NULL || srcStride < width ||
+        (OMX_U64)frameSize * srcStride / dstStride > inputBuffer->allocsize)
+    {
+        ALOGE("%s: input frame is not accessible (phys 0x%x virt %p stride %u size %u)", __func__,
+              inputBuffer->bus_address, inputBuffer->bus_data, srcStride, inputBuffer->allocsize);
+        return OMX_ErrorBadParameter;
+    }
+
+    err = alloc_temp_input(pEnc, &pEnc->tempBuffer, frameSize);
+    if (err != OMX_ErrorNone)
+        return err;
+
+    ALOGV("%s: copying frame (phys 0x%x stride %u -> %u)", __func__,
+          inputBuffer->bus_address, srcStride, dstStride);
+
+    OMX_U8* src = inputBuffer->bus_data;
+    OMX_U8* dst = pEnc->tempBuffer.bus_data;
+    OMX_U32 rows, rowlen, planes, i, y;
+    OSAL_U32 copyStart = OSAL_GetTimeUs();
+
+    switch (pEnc->inputPort.def.format.video.eColorFormat)
+    {
+        case OMX_COLOR_FormatYUV420Planar:
+        case OMX_COLOR_FormatYUV420PackedPlanar:
+            // luma and two chroma planes of half stride
+            for (y = 0; y < height; y++)
+                memcpy(dst + y * dstStride, src + y * srcStride, width);
+            src += srcStride * height;
+            dst += dstStride * height;
+            for (i = 0; i < 2; i++)
+            {
+                for (y = 0; y < (height + 1) / 2; y++)
+                    memcpy(dst + y * ((dstStride + 1) / 2), src + y * ((srcStride + 1) / 2), (width + 1) / 2);
+                src += ((srcStride + 1) / 2) * ((height + 1) / 2);
+                dst += ((dstStride + 1) / 2) * ((height + 1) / 2);
+            }
+            break;
+        case OMX_COLOR_FormatYUV420SemiPlanar:
+        case OMX_COLOR_FormatYUV420PackedSemiPlanar:
+            // luma plane and interleaved chroma plane of the same stride
+            for (planes = 0, rows = height; planes < 2; planes++, rows = (height + 1) / 2)
+            {
+                for (y = 0; y < rows; y++)
+                    memcpy(dst + y * dstStride, src + y * srcStride, width);
+                src += srcStride * rows;
+                dst += dstStride * rows;
+            }
+            break;
+        default:
+            // single plane of packed pixels
+            rowlen = frameSize / (dstStride * height);
+            for (y = 0; y < height; y++)
+                memcpy(dst + y * dstStride * rowlen, src + y * srcStride * rowlen, width * rowlen);
+            break;
+    }
+    perf_add_copy(&pEnc->perf, OSAL_GetTimeUs() - copyStart, frameSize);
+
+    return async_encode_video_data(pEnc, pEnc->tempBuffer.bus_data, pEnc->tempBuffer.bus_address,
+                                   frameSize, inputBuffer, &retlen, frameSize);
+}
+#endif
+
 /**
  * OMX_ERRORTYPE async_video_encoder_encode(OMX_ENCODER* pEnc)
  * 1. Get next input buffer from buffer queue
@@ -5201,36 +5667,66 @@ OMX_ERRORTYPE async_video_encoder_encode(OMX_ENCODER* pEnc)
     //For conformance tester
     if ( !inputBuffer )
         return OMX_ErrorNone;
+    perf_sample_queues(pEnc);
 
     FRAME_BUFFER*   tempBuffer = &pEnc->frame_in;
 
     if (pEnc->inputPort.def.format.video.eColorFormat == OMX_COLOR_FormatAndroidOpaque) {
-	if (inputBuffer->header->nFlags & OMX_BUFFERFLAG_EOS)
+	if (eos_without_frame(inputBuffer))
 	    goto EOS;
-	if (!pEnc->tempBuffer.bus_address) {
-	    OMX_U8* bus_data = NULL;
-	    OSAL_BUS_WIDTH bus_address = 0;
-	    OMX_U32 allocsize = frameSize;
+	if (!pEnc->yuvPool) {
+	    pEnc->yuvPool = yuv_pool_create();
+	    if (!pEnc->yuvPool)
+		return OMX_ErrorInsufficientResources;
+	}
+	OSAL_U32 convertStart = OSAL_GetTimeUs();
+
+	if (pEnc->convertAhead == inputBuffer) {
+	    // converted into nextBuffer while the previous frame was encoded
+	    FRAME_BUFFER converted = pEnc->nextBuffer;
+
+	    yuv_pool_wait(pEnc->yuvPool);
+	    pEnc->convertAhead = NULL;
+	    pEnc->nextBuffer = pEnc->tempBuffer;
+	    pEnc->tempBuffer = converted;
+	} else {
+	    int ret;
 
-	    ALOGV("Allocating temp input buffer, allocsize = %u", allocsize);
-	    err = OSAL_AllocatorAllocMem(&pEnc->alloc, &allocsize, &bus_data, &bus_address);
+	    opaque_convert_cancel(pEnc);
+	    err = alloc_temp_input(pEnc, &pEnc->tempBuffer, frameSize);
 	    if (err != OMX_ErrorNone)
 		return err;
-	    ALOGV("Alllocated: %u", allocsize);
-	    pEnc->tempBuffer.bus_address = bus_address;
-	    pEnc->tempBuffer.bus_data = bus_data;
-	    pEnc->tempBuffer.capacity = allocsize;
+	    ret = opaque_convert_start(pEnc, inputBuffer, &pEnc->tempBuffer);
+	    if (ret == 0)
+		yuv_pool_wait(pEnc->yuvPool);
+	    ALOGV("RGBA conversion returned %d", ret);
 	}
+	pEnc->perf.convertUs += OSAL_GetTimeUs() - convertStart;
 	tempBuffer = &pEnc->tempBuffer;
-	OMX_U32 width = pEnc->inputPort.def.format.video.nFrameWidth;
-	OMX_U32 height = pEnc->inputPort.def.format.video.nFrameHeight;
-	ALOGV("Converting to I420...");
-	err = ABGRToI420_multithread(inputBuffer->bus_data, width * 4,
-               tempBuffer->bus_data, width,
-               tempBuffer->bus_data + (width * height), width / 2,
-               tempBuffer->bus_data + (width * height * 5) / 4, width / 2,
-               width, height);
-	ALOGV("ABGRToI420 returned %d", err);
+
+	opaque_convert_ahead(pEnc, frameSize);
+    }
+    else if (pEnc->inputPort.StoreMetadata && !pEnc->encConfig.stab.bStab) {
+	// camera and gralloc frames are not copied to frame_in, see async_encode_metadata_input
+	if (eos_without_frame(inputBuffer))
+	    goto EOS;
+	err = async_encode_metadata_input(pEnc, inputBuffer, frameSize);
+	if (err != OMX_ErrorNone)
+	{
+	    if (err == OMX_ErrorOverflow)
+	    {
+		TRACE_PRINT("ASYNC: firing OMX_EventErrorOverflow\n");
+		pEnc->app_callbacks.EventHandler(pEnc->self, pEnc->app_data, OMX_EventError, OMX_ErrorOverflow, 0, NULL);
+	    }
+	    else if (err == OMX_ErrorBadParameter)
+	    {
+		TRACE_PRINT("ASYNC: firing OMX_ErrorBadParameter\n");
+		pEnc->app_callbacks.EventHandler(pEnc->self, pEnc->app_data, OMX_EventError, OMX_ErrorBadParameter, 0, NULL);
+	    }
+	    else
+		goto INVALID_STATE;
+	}
+	goto EOS;
     }
     else {
 
@@ -5393,6 +5889,22 @@ EOS:
         inputBuffer->header->pMarkData            = NULL;
     }
 
+#ifdef ANDROID
+    if (pEnc->inputPort.StoreMetadata)
+    {
+        // the frame belongs to the client again, forget where it was. The
+        // next use of this header is resolved again from its metadata.
+        inputBuffer->bus_data    = NULL;
+        inputBuffer->bus_address = 0;
+        inputBuffer->allocsize   = 0;
+        if (pEnc->frame_in.size == 0)
+        {
+            pEnc->frame_in.bus_data    = NULL;
+            pEnc->frame_in.bus_address = 0;
+        }
+    }
+#endif
+
     if (HantroOmx_port_is_tunneled(&pEnc->inputPort))
     {
         ((OMX_COMPONENTTYPE*)pEnc->inputPort.tunnelcomp)->FillThisBuffer(pEnc->inputPort.tunnelcomp, inputBuffer->header);
@@ -5531,6 +6043,12 @@ OMX_ERRORTYPE async_encode_stabilized_data(OMX_ENCODER* pEnc, OMX_U8* bus_data,
             pEnc->encConfig.intraRefresh.IntraRefreshVOP = OMX_FALSE;
         }
 
+        if ( pEnc->encConfig.bCodingCtrlChanged == OMX_TRUE &&
+             pEnc->outputPort.def.format.video.eCompressionFormat == OMX_VIDEO_CodingAVC )
+        {
+            set_avc_coding_ctrl(pEnc);
+        }
+
         bzero( &stream, sizeof( STREAM_BUFFER ) );
 #ifdef USE_TEMP_OUTPUT_BUFFER
         stream.buf_max_size = tempBuffer->capacity;
@@ -5543,7 +6061,9 @@ OMX_ERRORTYPE async_encode_stabilized_data(OMX_ENCODER* pEnc, OMX_U8* bus_data,
 #endif
         CODEC_STATE codecState = CODEC_ERROR_UNSPECIFIED;
 
+        OSAL_U32 callStart = OSAL_GetTimeUs();
         codecState = pEnc->codec->encode(pEnc->codec,&frame, &stream);
+        perf_add_call(&pEnc->perf, OSAL_GetTimeUs() - callStart);
         if ( codecState < 0 )
         {
             if (codecState == CODEC_ERROR_BUFFER_OVERFLOW)
@@ -5562,6 +6082,7 @@ OMX_ERRORTYPE async_encode_stabilized_data(OMX_ENCODER* pEnc, OMX_U8* bus_data,
                 return OMX_ErrorUndefined;
             }
         }
+        pEnc->perf.frames++;
 
         //Move frame start bit to the beginning of the frame buffer
         OMX_U32 rem = datalen - frame.fb_frameSize;
@@ -5577,6 +6098,7 @@ OMX_ERRORTYPE async_encode_stabilized_data(OMX_ENCODER* pEnc, OMX_U8* bus_data,
         }
 
 #ifdef USE_TEMP_OUTPUT_BUFFER
+        OSAL_U32 copyStart = OSAL_GetTimeUs();
         if(pEnc->outputPort.def.format.video.eCompressionFormat == OMX_VIDEO_CodingVP8)
         {
             dataSize = 0;
@@ -5594,6 +6116,7 @@ OMX_ERRORTYPE async_encode_stabilized_data(OMX_ENCODER* pEnc, OMX_U8* bus_data,
         }
         else
             memcpy( outputBuffer->header->pBuffer, stream.bus_data, stream.streamlen);
+        perf_add_copy(&pEnc->perf, OSAL_GetTimeUs() - copyStart, stream.streamlen);
 #endif
 
         outputBuffer->header->nOffset    = 0;
@@ -5640,6 +6163,147 @@ OMX_ERRORTYPE async_encode_stabilized_data(OMX_ENCODER* pEnc, OMX_U8* bus_data,
     return OMX_ErrorNone;
 }
 
+// state of the picture being output slice by slice
+typedef struct SLICE_OUTPUT
+{
+    OMX_ENCODER*    pEnc;
+    BUFFER*         inputBuffer;
+    OMX_U32         nSent;          // buffers of this picture passed on so far
+    OMX_ERRORTYPE   err;
+} SLICE_OUTPUT;
+
+/**
+ * static OMX_BOOL async_send_slice(SLICE_OUTPUT* slice, OMX_U8* data, OMX_U32 len,
+ *                                  FRAME_TYPE type, OMX_U32 flags)
+ * Copies coded slice data to the next output buffer and returns it right
+ * away. flags are added to the buffer; the one with OMX_BUFFERFLAG_ENDOFFRAME
+ * completes the picture and carries the marks.
+ */
+static
+OMX_BOOL async_send_slice(SLICE_OUTPUT* slice, OMX_U8* data, OMX_U32 len,
+                          FRAME_TYPE type, OMX_U32 flags)
+{
+    OMX_ENCODER*    pEnc            = slice->pEnc;
+    BUFFER*         inputBuffer     = slice->inputBuffer;
+    BUFFER*         outputBuffer    = NULL;
+    int             retry           = 200;
+
+    if (slice->err != OMX_ErrorNone)
+        return OMX_FALSE;
+
+    while (outputBuffer == NULL && retry > 0)
+    {
+        if (pEnc->statetrans == OMX_StateIdle)
+            return OMX_FALSE;
+        retry--;
+        slice->err = HantroOmx_port_lock_buffers(&pEnc->outputPort);
+        if (slice->err != OMX_ErrorNone)
+            return OMX_FALSE;
+        HantroOmx_port_get_buffer(&pEnc->outputPort, &outputBuffer);
+        HantroOmx_port_unlock_buffers(&pEnc->outputPort);
+        if (outputBuffer == NULL)
+            OSAL_ThreadSleep(RETRY_INTERVAL);
+    }
+    if (outputBuffer == NULL)
+    {
+        // not fatal, the slice goes out together with the rest of the picture
+        TRACE_PRINT("ASYNC: there's no output buffer for slice!\n");
+        return OMX_FALSE;
+    }
+
+    if (len > outputBuffer->header->nAllocLen)
+    {
+        TRACE_PRINT("ASYNC: output buffer is too small for slice!\n");
+        slice->err = OMX_ErrorOverflow;
+        return OMX_FALSE;
+    }
+
+    memcpy(outputBuffer->header->pBuffer, data, len);
+
+    outputBuffer->header->nOffset    = 0;
+    outputBuffer->header->nFilledLen = len;
+    outputBuffer->header->nTimeStamp = inputBuffer->header->nTimeStamp;
+    outputBuffer->header->nFlags     = (inputBuffer->header->nFlags &
+                                        ~(OMX_BUFFERFLAG_EOS | OMX_BUFFERFLAG_ENDOFFRAME)) | flags;
+    outputBuffer->header->hMarkTargetComponent = NULL;
+    outputBuffer->header->pMarkData            = NULL;
+
+#ifdef ANDROID_MOD
+    if (type == INTRA_FRAME)
+        outputBuffer->header->nFlags |= OMX_BUFFERFLAG_SYNCFRAME;
+#endif
+
+    if (flags & OMX_BUFFERFLAG_ENDOFFRAME)
+    {
+        int markcount = pEnc->mark_write_pos - pEnc->mark_read_pos;
+        if (markcount)
+        {
+            outputBuffer->header->hMarkTargetComponent = pEnc->marks[pEnc->mark_read_pos].hMarkTargetComponent;
+            outputBuffer->header->pMarkData            = pEnc->marks[pEnc->mark_read_pos].pMarkData;
+            pEnc->mark_read_pos++;
+            if (--markcount == 0)
+            {
+                pEnc->mark_read_pos  = 0;
+                pEnc->mark_write_pos = 0;
+            }
+        }
+        else
+        {
+            outputBuffer->header->hMarkTargetComponent = inputBuffer->header->hMarkTargetComponent;
+            outputBuffer->header->pMarkData            = inputBuffer->header->pMarkData;
+        }
+    }
+
+    HantroOmx_port_lock_buffers(&pEnc->outputPort);
+    HantroOmx_port_pop_buffer(&pEnc->outputPort);
+    HantroOmx_port_unlock_buffers(&pEnc->outputPort);
+
+    if (HantroOmx_port_is_tunneled(&pEnc->outputPort))
+    {
+        ((OMX_COMPONENTTYPE*)pEnc->outputPort.tunnelcomp)->EmptyThisBuffer(pEnc->outputPort.tunnelcomp, outputBuffer->header);
+    }
+    else
+    {
+        pEnc->app_callbacks.FillBufferDone(pEnc->self, pEnc->app_data, outputBuffer->header);
+    }
+    slice->nSent++;
+
+    return OMX_TRUE;
+}
+
+/**
+ * static OMX_BOOL async_output_slice(void* pAppData, OMX_U8* data, OMX_U32 len,
+ *                                    FRAME_TYPE type)
+ * Codec slice callback in low-latency mode, for every slice but the last.
+ */
+static
+OMX_BOOL async_output_slice(void* pAppData, OMX_U8* data, OMX_U32 len, FRAME_TYPE type)
+{
+    return async_send_slice((SLICE_OUTPUT*)pAppData, data, len, type, 0);
+}
+
+/**
+ * static void async_drop_slices(SLICE_OUTPUT* slice, OMX_U8* data)
+ * The picture failed after some of its slices were passed on. They can't be
+ * taken back, so the picture is completed with an empty buffer flagged
+ * OMX_BUFFERFLAG_DATACORRUPT for the client to drop it.
+ */
+static
+void async_drop_slices(SLICE_OUTPUT* slice, OMX_U8* data)
+{
+    OMX_ERRORTYPE err = slice->err;
+
+    if (slice->nSent == 0)
+        return;
+
+    ALOGE("dropping partial picture of %u slice buffers", (unsigned)slice->nSent);
+    slice->err = OMX_ErrorNone;
+    if (!async_send_slice(slice, data, 0, PREDICTED_FRAME,
+            OMX_BUFFERFLAG_ENDOFFRAME | OMX_BUFFERFLAG_DATACORRUPT))
+        ALOGE("no output buffer to complete the partial picture");
+    slice->err = err;
+}
+
 /**
  * OMX_ERRORTYPE async_encode_video_data(OMX_ENCODER* pEnc,
  *                                  OMX_U8* bus_data,
@@ -5660,9 +6324,19 @@ OMX_ERRORTYPE async_encode_video_data(OMX_ENCODER* pEnc, OMX_U8* bus_data, OSAL_
     BUFFER*         outputBuffer        = NULL;         //Output buffer from client
     OMX_ERRORTYPE   err                 = OMX_ErrorNone;
     OMX_U32         i, dataSize;
+    SLICE_OUTPUT    slice;
+    OMX_BOOL        sliceMode           = OMX_FALSE;
 
 static uint32_t n = 0;
 
+    // low-latency output: each H264 slice in its own buffer as soon as it is coded
+    if (pEnc->encConfig.sliceOutput.bEnabled &&
+        pEnc->encConfig.avc.nSliceHeaderSpacing > 0 &&
+        pEnc->outputPort.def.format.video.eCompressionFormat == OMX_VIDEO_CodingAVC)
+    {
+        sliceMode = OMX_TRUE;
+    }
+
 #ifdef USE_TEMP_OUTPUT_BUFFER
     FRAME_BUFFER*   tempBuffer          = &pEnc->frame_out;
 #endif
@@ -5771,6 +6445,12 @@ static uint32_t n = 0;
             pEnc->encConfig.intraRefresh.IntraRefreshVOP = OMX_FALSE;
         }
 
+        if ( pEnc->encConfig.bCodingCtrlChanged == OMX_TRUE &&
+             pEnc->outputPort.def.format.video.eCompressionFormat == OMX_VIDEO_CodingAVC )
+        {
+            set_avc_coding_ctrl(pEnc);
+        }
+
         bzero( &stream, sizeof( STREAM_BUFFER ) );
 #ifdef USE_TEMP_OUTPUT_BUFFER
         stream.buf_max_size = tempBuffer->capacity;
@@ -5781,13 +6461,38 @@ static uint32_t n = 0;
         stream.bus_data = outputBuffer->bus_data;
         stream.bus_address = outputBuffer->bus_address;
 #endif
+        if (sliceMode)
+        {
+            // the codec writes to the internal buffer, slices are copied out as they complete
+            stream.buf_max_size = pEnc->frame_out.capacity;
+            stream.bus_data = pEnc->frame_out.bus_data;
+            stream.bus_address = pEnc->frame_out.bus_address;
+            stream.sliceReady = async_output_slice;
+            stream.pSliceAppData = &slice;
+
+            slice.pEnc = pEnc;
+            slice.inputBuffer = inputBuffer;
+            slice.nSent = 0;
+            slice.err = OMX_ErrorNone;
+        }
         CODEC_STATE codecState = CODEC_ERROR_UNSPECIFIED;
 
+        OSAL_U32 callStart = OSAL_GetTimeUs();
         codecState = pEnc->codec->encode(pEnc->codec, &frame, &stream);
+        perf_add_call(&pEnc->perf, OSAL_GetTimeUs() - callStart);
+
+        if (sliceMode && slice.err != OMX_ErrorNone)
+        {
+            ALOGE("slice output failed: %s", HantroOmx_str_omx_err(slice.err));
+            async_drop_slices(&slice, stream.bus_data);
+            return slice.err;
+        }
 
         if ( codecState < 0 )
         {
             TRACE_PRINT("ASYNC: codecState - %d\n", codecState);
+            if (sliceMode)
+                async_drop_slices(&slice, stream.bus_data);
             if (codecState == CODEC_ERROR_BUFFER_OVERFLOW)
             {
                 ALOGE("pEnc->codec->encode returned CODEC_ERROR_BUFFER_OVERFLOW!");
@@ -5804,6 +6509,7 @@ static uint32_t n = 0;
                 return OMX_ErrorUndefined;
             }
         }
+        pEnc->perf.frames++;
         TRACE_PRINT("ASYNC: codecState = %u\n", (unsigned)codecState);
 
         OMX_U32 rem = datalen - frame.fb_frameSize;
@@ -5814,6 +6520,23 @@ static uint32_t n = 0;
         datalen -=  frame.fb_frameSize;
 
         TRACE_PRINT("ASYNC: v = %u\n", (unsigned)datalen);
+
+        if (sliceMode)
+        {
+            // whatever was not passed on slice by slice completes the picture
+            OMX_U32 done = stream.sliceBytesDone;
+
+            if (!async_send_slice(&slice, stream.bus_data + done, stream.streamlen - done,
+                    codecState == CODEC_CODED_INTRA ? INTRA_FRAME : PREDICTED_FRAME,
+                    OMX_BUFFERFLAG_ENDOFFRAME))
+            {
+                async_drop_slices(&slice, stream.bus_data);
+                return slice.err != OMX_ErrorNone ? slice.err : OMX_ErrorOverflow;
+            }
+            outputBuffer = NULL;
+            continue;
+        }
+
         TRACE_PRINT("ASYNC: output buffer size: %d\n", (int)outputBuffer->header->nAllocLen);
         if (stream.streamlen > outputBuffer->header->nAllocLen)
         {
@@ -5822,6 +6545,7 @@ static uint32_t n = 0;
         }
 
 #ifdef USE_TEMP_OUTPUT_BUFFER
+        OSAL_U32 copyStart = OSAL_GetTimeUs();
         if(pEnc->outputPort.def.format.video.eCompressionFormat == OMX_VIDEO_CodingVP8)
         {
             dataSize = 0;
@@ -5839,6 +6563,7 @@ static uint32_t n = 0;
         }
         else
             memcpy( outputBuffer->header->pBuffer, stream.bus_data, stream.streamlen);
+        perf_add_copy(&pEnc->perf, OSAL_GetTimeUs() - copyStart, stream.streamlen);
 #endif
 
         outputBuffer->header->nOffset    = 0;
@@ -5902,6 +6627,45 @@ OMX_ERRORTYPE set_avc_intra_period(OMX_ENCODER* pEnc)
     return OMX_ErrorNone;
 }
 
+OMX_ERRORTYPE store_intra_refresh(OMX_ENCODER* pEnc, const OMX_VIDEO_PARAM_INTRAREFRESHTYPE* param)
+{
+    assert(pEnc);
+    TRACE_PRINT("%s\n", __FUNCTION__);
+
+    CHECK_PARAM_SIZE(param, OMX_VIDEO_PARAM_INTRAREFRESHTYPE);
+
+    // the hardware has no adaptive intra refresh, cyclic part of "both" is used
+    if (param->eRefreshMode == OMX_VIDEO_IntraRefreshAdaptive ||
+        param->eRefreshMode >= OMX_VIDEO_IntraRefreshMax)
+    {
+        TRACE_PRINT("API: unsupported intra refresh mode %d\n", param->eRefreshMode);
+        return OMX_ErrorUnsupportedSetting;
+    }
+
+    memcpy(&pEnc->encConfig.cir, param, sizeof(OMX_VIDEO_PARAM_INTRAREFRESHTYPE));
+    pEnc->encConfig.bCodingCtrlChanged = OMX_TRUE;
+
+    return OMX_ErrorNone;
+}
+
+OMX_ERRORTYPE set_avc_coding_ctrl(OMX_ENCODER* pEnc)
+{
+    assert(pEnc);
+    TRACE_PRINT("%s\n", __FUNCTION__);
+
+    pEnc->encConfig.bCodingCtrlChanged = OMX_FALSE;
+
+    if (HantroHwEncOmx_encoder_coding_ctrl_h264(pEnc->codec, pEnc->encConfig.cir.nCirMBs,
+            &pEnc->encConfig.roi) != CODEC_OK)
+    {
+        // not fatal, the picture is coded with the previous settings
+        ALOGE("%s: cir/roi rejected by the codec", __FUNCTION__);
+        return OMX_ErrorBadParameter;
+    }
+
+    return OMX_ErrorNone;
+}
+
 OMX_ERRORTYPE set_frame_rate(OMX_ENCODER* pEnc)
 {
     assert(pEnc);
@@ -5989,6 +6753,7 @@ OMX_ERRORTYPE async_image_encoder_encode(OMX_ENCODER* pEnc)
       //For conformance tester
     if ( !inputBuffer )
         return OMX_ErrorNone;
+    perf_sample_queues(pEnc);
     FRAME_BUFFER*   tempBuffer = &pEnc->frame_in;
 
     // if there is previous data in the frame buffer left over from a previous call to encode
@@ -6189,7 +6954,9 @@ OMX_ERRORTYPE async_encode_image_data(OMX_ENCODER* pEnc, OMX_U8* bus_data, OSAL_
         stream.bus_address = tempBuffer->bus_address;
         CODEC_STATE codecState = CODEC_ERROR_UNSPECIFIED;
 
+        OSAL_U32 callStart = OSAL_GetTimeUs();
         codecState = pEnc->codec->encode(pEnc->codec,&frame, &stream);
+        perf_add_call(&pEnc->perf, OSAL_GetTimeUs() - callStart);
         TRACE_PRINT("ASYNC: codecState - %d\n", codecState );
         if ( codecState < 0 )
         {
@@ -6212,7 +6979,9 @@ OMX_ERRORTYPE async_encode_image_data(OMX_ENCODER* pEnc, OMX_U8* bus_data, OSAL_
             TRACE_PRINT("ASYNC: output buffer is too small!\n");
             return OMX_ErrorOverflow;
         }
+        OSAL_U32 copyStart = OSAL_GetTimeUs();
         memcpy(outputBuffer->header->pBuffer, stream.bus_data, stream.streamlen);
+        perf_add_copy(&pEnc->perf, OSAL_GetTimeUs() - copyStart, stream.streamlen);
 
         outputBuffer->header->nOffset    = 0;
         outputBuffer->header->nFilledLen = stream.streamlen;
@@ -6249,6 +7018,7 @@ OMX_ERRORTYPE async_encode_image_data(OMX_ENCODER* pEnc, OMX_U8* bus_data, OSAL_
             if ( pEnc->sliceNum > pEnc->numOfSlices )
             {
                 pEnc->frameCounter++;
+                pEnc->perf.frames++;
                 TRACE_PRINT("OMX_BUFFERFLAG_ENDOFFRAME \n");
 
                 outputBuffer->header->nFlags &= OMX_BUFFERFLAG_ENDOFFRAME;
@@ -6257,6 +7027,7 @@ OMX_ERRORTYPE async_encode_image_data(OMX_ENCODER* pEnc, OMX_U8* bus_data, OSAL_
         }
         else
         {
+            pEnc->perf.frames++;
             TRACE_PRINT("OMX_BUFFERFLAG_ENDOFFRAME \n");
             outputBuffer->header->nFlags &= OMX_BUFFERFLAG_ENDOFFRAME;
         }
@@ -84,6 +84,13 @@ typedef struct VIDEO_ENCODER_CONFIG
     OMX_CONFIG_ROTATIONTYPE             rotation;
     OMX_CONFIG_RECTTYPE                 crop;
     OMX_CONFIG_INTRAREFRESHVOPTYPE      intraRefresh;
+    OMX_CONFIG_BOOLEANTYPE              sliceOutput; //Output every H264 slice in its own buffer
+                                                     //as soon as it is coded. nSliceHeaderSpacing
+                                                     //only slices the picture when this is set.
+    OMX_VIDEO_PARAM_INTRAREFRESHTYPE    cir;    //Only cyclic mode, nCirMBs intra macroblocks per picture
+    OMX_VIDEO_CONFIG_ROITYPE            roi;
+    OMX_BOOL                            bCodingCtrlChanged; //cir or roi to be passed to codec before
+                                                            //the next picture
 #ifdef ENCH1
     OMX_VIDEO_PARAM_VP8TYPE             vp8;
     OMX_VIDEO_VP8REFERENCEFRAMETYPE     vp8Ref;
@@ -100,6 +107,24 @@ typedef struct IMAGE_ENCODER_CONFIG
 }IMAGE_ENCODER_CONFIG;
 #endif
 
+// always-on counters of the instance, times in microseconds
+typedef struct PERF_COUNTERS
+{
+    OMX_U32                         startMs;    // OSAL_GetTime when counting started
+    OMX_U32                         frames;     // pictures encoded
+    OMX_U32                         calls;      // codec encode calls
+    OMX_U32                         callMaxUs;
+    unsigned long long              callUs;
+    unsigned long long              convertUs;  // waiting for opaque RGBA input to YUV
+    unsigned long long              copyUs;
+    unsigned long long              copyBytes;
+    OMX_U32                         queueSamples;
+    OMX_U32                         inQueueMax;
+    OMX_U32                         outQueueMax;
+    unsigned long long              inQueueSum;
+    unsigned long long              outQueueSum;
+}PERF_COUNTERS;
+
 typedef struct OMX_ENCODER
 {
     BASECOMP                        base;
@@ -116,6 +141,11 @@ typedef struct OMX_ENCODER
     FRAME_BUFFER                    frame_in;
     FRAME_BUFFER                    frame_out;
     FRAME_BUFFER                    tempBuffer;
+#ifdef ANDROID
+    struct yuv_pool*                yuvPool;    // RGBA->I420 workers for opaque input
+    FRAME_BUFFER                    nextBuffer; // next opaque frame, converted ahead
+    BUFFER*                         convertAhead; // input buffer converting into nextBuffer
+#endif
     OMX_PORT_PARAM_TYPE             ports;
     OMX_HANDLETYPE                  self;
     OSAL_ALLOCATOR                  alloc;
@@ -127,6 +157,7 @@ typedef struct OMX_ENCODER
     OMX_MARKTYPE                    marks[10];
     OMX_U32                         mark_read_pos;
     OMX_U32                         mark_write_pos;
+    PERF_COUNTERS                   perf;
 #ifdef OMX_ENCODER_VIDEO_DOMAIN 
     VIDEO_ENCODER_CONFIG    encConfig;
 #endif //OMX_ENCODER_VIDEO_DOMAIN
@@ -148,7 +179,10 @@ typedef struct OMX_ENCODER
 OMX_ERRORTYPE HantroHwEncOmx_encoder_init( OMX_HANDLETYPE hComponent );
 
 typedef enum OMX_VENDOR_INDEXTYPE {
-	OMX_GoogleIndexStoreMetaDataInBuffers = (OMX_IndexVendorStartUnused + 5)
+	OMX_GoogleIndexStoreMetaDataInBuffers = (OMX_IndexVendorStartUnused + 5),
+	OMX_HantroIndexParamVideoSliceOutput = (OMX_IndexVendorStartUnused + 6),
+	OMX_HantroIndexConfigVideoRoi = (OMX_IndexVendorStartUnused + 7),
+	OMX_HantroIndexConfigPerfCounters = (OMX_IndexVendorStartUnused + 8)
 } OMX_VENDOR_INDEXTYPE;
 
 #endif //~ENCODER_H
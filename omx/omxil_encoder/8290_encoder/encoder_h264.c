@@ -46,6 +46,10 @@ typedef struct ENCODER_H264
     OMX_U32 nIFrameCounter;
     OMX_U32 nPFrames;
     OMX_U32 nTotalFrames;
+    OMX_U32 nSlices;                // slices per picture, 1 if not sliced
+    OMX_U32 nMbWidth;
+    OMX_U32 nMbHeight;
+    STREAM_BUFFER* sliceStream;     // stream of the picture being encoded
 } ENCODER_H264;
 
 #if defined (ENC8290) || defined (ENCH1)
@@ -186,6 +190,42 @@ static CODEC_STATE encoder_stream_end_h264(ENCODER_PROTOTYPE* arg,
     return stat;
 }
 
+#if defined (ENC8290) || defined (ENCH1)
+// pass completed slices on while the rest of the picture is still being coded
+static void encoder_slice_ready_h264(H264EncSliceReady* slice)
+{
+    ENCODER_H264* this = (ENCODER_H264*)slice->pAppData;
+    STREAM_BUFFER* stream = this->sliceStream;
+    FRAME_TYPE type;
+    OMX_U32 offset = 0;
+    u32 i;
+
+    if (stream == NULL || stream->sliceReady == NULL)
+        return;
+
+    type = (this->encIn.codingType == H264ENC_INTRA_FRAME) ? INTRA_FRAME : PREDICTED_FRAME;
+
+    for (i = 0; i < slice->slicesReadyPrev; i++)
+        offset += slice->sliceSizes[i];
+
+    for (i = slice->slicesReadyPrev; i < slice->slicesReady; i++)
+    {
+        OMX_U32 len = slice->sliceSizes[i];
+
+        // an earlier slice was refused, the rest goes out with the picture;
+        // the last slice always does, it completes the picture
+        if (offset != stream->sliceBytesDone || i + 1 >= this->nSlices)
+            break;
+
+        if (!stream->sliceReady(stream->pSliceAppData, (OMX_U8*)slice->pOutBuf + offset, len, type))
+            break;
+
+        stream->sliceBytesDone += len;
+        offset += len;
+    }
+}
+#endif
+
 static CODEC_STATE encoder_encode_h264(ENCODER_PROTOTYPE* arg, FRAME* frame,
         STREAM_BUFFER* stream)
 {
@@ -198,8 +238,8 @@ ALOGV("%s start", __func__);
     this->encIn.busLuma = frame->fb_bus_address;
     this->encIn.busChromaU = frame->fb_bus_address + (this->origWidth
             * this->origHeight);
-    this->encIn.busChromaV = this->encIn.busChromaU + (this->origWidth
-            * this->origHeight / 4);
+    this->encIn.busChromaV = this->encIn.busChromaU + ((this->origWidth + 1) / 2)
+            * ((this->origHeight + 1) / 2);
 
     this->encIn.timeIncrement = this->nEstTimeInc;
 
@@ -270,7 +310,20 @@ ALOGV("%s: H264EncStrmEncode start", __func__);
 #if !defined (ENC8290) && !defined (ENCH1)
         ret = H264EncStrmEncode(this->instance, &this->encIn, &encOut);
 #else
-        ret = H264EncStrmEncode(this->instance, &this->encIn, &encOut, NULL, NULL);
+    {
+        stream->sliceBytesDone = 0;
+        if (stream->sliceReady && this->nSlices > 1)
+        {
+            this->sliceStream = stream;
+            ret = H264EncStrmEncode(this->instance, &this->encIn, &encOut,
+                                    encoder_slice_ready_h264, this);
+            this->sliceStream = NULL;
+        }
+        else
+        {
+            ret = H264EncStrmEncode(this->instance, &this->encIn, &encOut, NULL, NULL);
+        }
+    }
 #endif
     switch (ret)
     {
@@ -514,6 +567,10 @@ ENCODER_PROTOTYPE* HantroHwEncOmx_encoder_create_h264(const H264_CONFIG* params)
     this->nPFrames = params->nPFrames;
     this->nIFrameCounter = 0;
     this->nEstTimeInc = cfg.frameRateDenom;
+    this->nSlices = 1;
+    this->sliceStream = NULL;
+    this->nMbWidth = (cfg.width + 15) / 16;
+    this->nMbHeight = (cfg.height + 15) / 16;
 
     H264EncRet ret = H264EncInit(&cfg, &this->instance);
 
@@ -528,6 +585,11 @@ ENCODER_PROTOTYPE* HantroHwEncOmx_encoder_create_h264(const H264_CONFIG* params)
             {
                 // slice height in macroblock rows (each row is 16 pixels)
                 coding_ctrl.sliceSize = params->nSliceHeight / 16;
+                if (coding_ctrl.sliceSize > 0)
+                {
+                    OMX_U32 mbRows = (cfg.height + 15) / 16;
+                    this->nSlices = (mbRows + coding_ctrl.sliceSize - 1) / coding_ctrl.sliceSize;
+                }
             }
 
             if (params->bDisableDeblocking)
@@ -849,3 +911,67 @@ CODEC_STATE HantroHwEncOmx_encoder_frame_rate_h264(ENCODER_PROTOTYPE* arg, OMX_U
 
     return CODEC_OK;
 }
+
+// clip an OMX area to the picture, out of picture areas are disabled
+static void encoder_area_h264(ENCODER_H264* this, H264EncPictureArea* area,
+        const OMX_VIDEO_ROIAREATYPE* omxArea)
+{
+    memset(area, 0, sizeof(H264EncPictureArea));
+
+    if (!omxArea->bEnable || omxArea->nTop >= this->nMbHeight || omxArea->nLeft >= this->nMbWidth ||
+        omxArea->nBottom < omxArea->nTop || omxArea->nRight < omxArea->nLeft)
+    {
+        return;
+    }
+
+    area->enable = 1;
+    area->top = omxArea->nTop;
+    area->left = omxArea->nLeft;
+    area->bottom = omxArea->nBottom < this->nMbHeight ? omxArea->nBottom : this->nMbHeight - 1;
+    area->right = omxArea->nRight < this->nMbWidth ? omxArea->nRight : this->nMbWidth - 1;
+}
+
+CODEC_STATE HantroHwEncOmx_encoder_coding_ctrl_h264(ENCODER_PROTOTYPE* arg, OMX_U32 nCirMBs,
+        const OMX_VIDEO_CONFIG_ROITYPE* roi)
+{
+    ENCODER_H264* this = (ENCODER_H264*)arg;
+    OMX_U32 mbTotal = this->nMbWidth * this->nMbHeight;
+    H264EncCodingCtrl coding_ctrl;
+
+    H264EncRet ret = H264EncGetCodingCtrl(this->instance, &coding_ctrl);
+
+    if (ret == H264ENC_OK)
+    {
+        // every cirInterval:th macroblock is coded intra, the pattern moves on
+        // one macroblock per picture so the whole picture is refreshed in
+        // cirInterval pictures
+        coding_ctrl.cirStart = 0;
+        coding_ctrl.cirInterval = 0;
+        if (nCirMBs > 0)
+        {
+            coding_ctrl.cirInterval = nCirMBs < mbTotal ? (mbTotal + nCirMBs - 1) / nCirMBs : 1;
+        }
+
+        encoder_area_h264(this, &coding_ctrl.intraArea, &roi->sIntraArea);
+        encoder_area_h264(this, &coding_ctrl.roi1Area, &roi->sRoi1Area);
+        encoder_area_h264(this, &coding_ctrl.roi2Area, &roi->sRoi2Area);
+        coding_ctrl.roi1DeltaQp = coding_ctrl.roi1Area.enable ? roi->nRoi1DeltaQp : 0;
+        coding_ctrl.roi2DeltaQp = coding_ctrl.roi2Area.enable ? roi->nRoi2DeltaQp : 0;
+        coding_ctrl.adaptiveRoi = roi->nAdaptiveRoi;
+
+        ret = H264EncSetCodingCtrl(this->instance, &coding_ctrl);
+    }
+
+    switch (ret)
+    {
+        case H264ENC_OK:
+            return CODEC_OK;
+        case H264ENC_NULL_ARGUMENT:
+        case H264ENC_INVALID_ARGUMENT:
+            return CODEC_ERROR_INVALID_ARGUMENT;
+        case H264ENC_INVALID_STATUS:
+            return CODEC_ERROR_INVALID_STATE;
+        default:
+            return CODEC_ERROR_UNSPECIFIED;
+    }
+}
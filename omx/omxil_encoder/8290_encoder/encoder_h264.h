@@ -64,6 +64,9 @@ ENCODER_PROTOTYPE* HantroHwEncOmx_encoder_create_h264(const H264_CONFIG* config)
 CODEC_STATE HantroHwEncOmx_encoder_intra_period_h264(ENCODER_PROTOTYPE* arg, OMX_U32 nPFrames);
 // change encoding frame rate
 CODEC_STATE HantroHwEncOmx_encoder_frame_rate_h264(ENCODER_PROTOTYPE* arg, OMX_U32 xFramerate);
+// change cyclic intra refresh and region of interest coding
+CODEC_STATE HantroHwEncOmx_encoder_coding_ctrl_h264(ENCODER_PROTOTYPE* arg, OMX_U32 nCirMBs,
+        const OMX_VIDEO_CONFIG_ROITYPE* roi);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,147 @@
+/*
+ * Times the opaque input path of the encoder: RGBA to YUV 4:2:0 on one
+ * thread and on the conversion workers, and a stream of frames converted then
+ * encoded in turn against one where frame N+1 converts while frame N
+ * encodes. The encode is simulated by sleeping, as the component thread
+ * sleeps while it waits for the hardware. Also checks that the workers
+ * produce the same picture as a single thread.
+ *
+ *   yuv_benchmark [width height [frames [encode_ms]]]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../yuv.h"
+
+static int64_t now_us(void) {
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (int64_t)t.tv_sec * 1000000 + t.tv_nsec / 1000;
+}
+
+static void fill(uint8_t *p, size_t size, unsigned seed) {
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+	seed = seed * 1103515245 + 12345;
+	p[i] = seed >> 16;
+    }
+}
+
+static void fake_encode(int ms) {
+    struct timespec t = { ms / 1000, (ms % 1000) * 1000000L };
+
+    nanosleep(&t, NULL);
+}
+
+static int convert(struct yuv_pool *pool, const uint8_t *src, uint8_t *dst, int width, int height) {
+    return ABGRToI420_start(pool, src, width * 4, dst, width,
+			    dst + width * height, (width + 1) / 2,
+			    dst + width * height + ((width + 1) / 2) * ((height + 1) / 2), (width + 1) / 2,
+			    width, height);
+}
+
+int main(int argc, char **argv) {
+    int width = argc > 2 ? atoi(argv[1]) : 1280;
+    int height = argc > 2 ? atoi(argv[2]) : 720;
+    int frames = argc > 3 ? atoi(argv[3]) : 100;
+    int encode_ms = argc > 4 ? atoi(argv[4]) : 10;
+    size_t rgba_size = (size_t)width * height * 4;
+    size_t yuv_size = (size_t)width * height + ((width + 1) / 2) * ((height + 1) / 2) * 2;
+    uint8_t *src[2], *dst[2], *expected;
+    struct thread_args args;
+    struct yuv_pool *pool;
+    int64_t start, single, workers, sequential, overlapped;
+    int i, failures = 0;
+
+    for (i = 0; i < 2; i++) {
+	src[i] = malloc(rgba_size);
+	dst[i] = malloc(yuv_size);
+	fill(src[i], rgba_size, i + 1);
+    }
+    expected = malloc(yuv_size);
+
+    pool = yuv_pool_create();
+    if (!pool) {
+	printf("no conversion workers\n");
+	return 1;
+    }
+
+    memset(&args, 0, sizeof(args));
+    args.src_argb = src[0];
+    args.src_stride_argb = width * 4;
+    args.dst_y = expected;
+    args.dst_u = expected + width * height;
+    args.dst_v = args.dst_u + ((width + 1) / 2) * ((height + 1) / 2);
+    args.dst_stride_y = width;
+    args.dst_stride_u = (width + 1) / 2;
+    args.dst_stride_v = (width + 1) / 2;
+    args.uv_step = 1;
+    args.width = width;
+    args.height = height;
+
+    start = now_us();
+    for (i = 0; i < frames; i++)
+	ABGRToYUV420_band(&args, 0, 1);
+    single = (now_us() - start) / frames;
+
+    start = now_us();
+    for (i = 0; i < frames; i++) {
+	if (convert(pool, src[0], dst[0], width, height) == 0)
+	    yuv_pool_wait(pool);
+    }
+    workers = (now_us() - start) / frames;
+
+    if (memcmp(expected, dst[0], yuv_size)) {
+	printf("FAIL: %d workers differ from a single thread\n", pool->threads);
+	failures++;
+    }
+
+    // the encoder before: convert, then encode
+    start = now_us();
+    for (i = 0; i < frames; i++) {
+	if (convert(pool, src[i & 1], dst[0], width, height) == 0)
+	    yuv_pool_wait(pool);
+	fake_encode(encode_ms);
+    }
+    sequential = now_us() - start;
+
+    // convert ahead: frame i + 1 converts into the other buffer while i encodes
+    start = now_us();
+    if (convert(pool, src[0], dst[0], width, height) == 0)
+	yuv_pool_wait(pool);
+    for (i = 0; i < frames; i++) {
+	int ahead = i + 1 < frames && convert(pool, src[(i + 1) & 1], dst[(i + 1) & 1], width, height) == 0;
+
+	fake_encode(encode_ms);
+	if (ahead)
+	    yuv_pool_wait(pool);
+    }
+    overlapped = now_us() - start;
+
+    // even frames come from src[0] and land in dst[0]
+    if (memcmp(expected, dst[0], yuv_size)) {
+	printf("FAIL: converted ahead frame differs\n");
+	failures++;
+    }
+
+    printf("%dx%d: single thread %lld us, %d workers %lld us per frame\n",
+	   width, height, (long long)single, pool->threads, (long long)workers);
+    printf("%d frames, %d ms encode: convert then encode %.1f fps, convert ahead %.1f fps\n",
+	   frames, encode_ms, frames * 1e6 / sequential, frames * 1e6 / overlapped);
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+
+    yuv_pool_destroy(pool);
+    for (i = 0; i < 2; i++) {
+	free(src[i]);
+	free(dst[i]);
+    }
+    free(expected);
+
+    return failures ? 1 : 0;
+}
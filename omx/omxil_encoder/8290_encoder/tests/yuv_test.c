@@ -0,0 +1,174 @@
+/*
+ * Bit-exact check of the opaque input conversion. Frames of awkward sizes
+ * (odd width and height, widths the NEON loop does not cover) are converted
+ * to I420 and NV12 on the conversion workers, and cut into 2 to 4 bands as
+ * more workers would, then compared with a frame converted row pair by row
+ * pair with ABGRToYUVRowPair_C, the reference the NEON kernel must match.
+ * Guard bytes after the frame catch writes past the chroma planes of odd
+ * sized frames.
+ *
+ *   yuv_test
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../yuv.h"
+
+#define GUARD 0xa5
+#define GUARD_SIZE 64
+
+struct layout {
+    int y_stride;
+    int uv_stride;
+    size_t y_size;
+    size_t uv_size;     // one chroma plane, or the interleaved plane
+    size_t size;
+};
+
+static void fill(uint8_t *p, size_t size, unsigned seed) {
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+	seed = seed * 1103515245 + 12345;
+	p[i] = seed >> 16;
+    }
+}
+
+static void get_layout(int width, int height, int stride, int nv12, struct layout *l) {
+    l->y_stride = stride;
+    l->uv_stride = nv12 ? stride : (stride + 1) / 2;
+    l->y_size = (size_t)stride * height;
+    l->uv_size = (size_t)l->uv_stride * ((height + 1) / 2);
+    l->size = l->y_size + l->uv_size * (nv12 ? 1 : 2);
+}
+
+static void reference(const uint8_t *src, int src_stride, uint8_t *dst,
+		      int width, int height, int nv12, const struct layout *l) {
+    uint8_t *dst_u = dst + l->y_size;
+    uint8_t *dst_v = nv12 ? dst_u + 1 : dst_u + l->uv_size;
+    int y;
+
+    for (y = 0; y < height; y += 2) {
+	int next = y + 1 < height ? y + 1 : y;
+
+	ABGRToYUVRowPair_C(src + y * src_stride, src + next * src_stride,
+			   dst + y * l->y_stride, dst + next * l->y_stride,
+			   dst_u + (y / 2) * l->uv_stride, dst_v + (y / 2) * l->uv_stride,
+			   nv12 ? 2 : 1, width);
+    }
+}
+
+static int compare(const uint8_t *expected, const uint8_t *dst, const struct layout *l,
+		   int width, int height, int nv12, int bands) {
+    size_t i;
+
+    if (memcmp(expected, dst, l->size)) {
+	for (i = 0; i < l->size && expected[i] == dst[i]; i++)
+	    ;
+	printf("FAIL %dx%d %s, %d bands: first difference at %zu (%s), %u != %u\n",
+	       width, height, nv12 ? "NV12" : "I420", bands, i,
+	       i < l->y_size ? "Y" : "chroma", dst[i], expected[i]);
+	return 1;
+    }
+
+    for (i = l->size; i < l->size + GUARD_SIZE; i++) {
+	if (dst[i] != GUARD) {
+	    printf("FAIL %dx%d %s, %d bands: written past the frame at %zu\n",
+		   width, height, nv12 ? "NV12" : "I420", bands, i);
+	    return 1;
+	}
+    }
+    return 0;
+}
+
+static int check(struct yuv_pool *pool, int width, int height, int nv12) {
+    int stride = (width + 15) & ~15;
+    int src_stride = ((width + 7) & ~7) * 4;
+    struct thread_args args;
+    struct layout l;
+    uint8_t *src, *expected, *dst;
+    int ret, band, bands, failures = 0;
+
+    get_layout(width, height, stride, nv12, &l);
+    src = malloc((size_t)src_stride * height);
+    expected = malloc(l.size + GUARD_SIZE);
+    dst = malloc(l.size + GUARD_SIZE);
+    fill(src, (size_t)src_stride * height, width * 31 + height);
+
+    // padding bytes are left alone by both
+    memset(expected, GUARD, l.size + GUARD_SIZE);
+    memset(dst, GUARD, l.size + GUARD_SIZE);
+    reference(src, src_stride, expected, width, height, nv12, &l);
+
+    if (nv12)
+	ret = ABGRToNV12_start(pool, src, src_stride, dst, l.y_stride,
+			       dst + l.y_size, l.uv_stride, width, height);
+    else
+	ret = ABGRToI420_start(pool, src, src_stride, dst, l.y_stride,
+			       dst + l.y_size, l.uv_stride,
+			       dst + l.y_size + l.uv_size, l.uv_stride, width, height);
+    if (ret == 0)
+	yuv_pool_wait(pool);
+
+    if (ret != 0) {
+	printf("FAIL %dx%d %s: conversion not started\n", width, height, nv12 ? "NV12" : "I420");
+	failures++;
+    } else {
+	failures += compare(expected, dst, &l, width, height, nv12, pool->threads);
+    }
+
+    for (bands = 2; bands <= YUV_POOL_MAX_THREADS; bands++) {
+	memset(&args, 0, sizeof(args));
+	args.src_argb = src;
+	args.src_stride_argb = src_stride;
+	args.dst_y = dst;
+	args.dst_u = dst + l.y_size;
+	args.dst_v = nv12 ? args.dst_u + 1 : args.dst_u + l.uv_size;
+	args.dst_stride_y = l.y_stride;
+	args.dst_stride_u = l.uv_stride;
+	args.dst_stride_v = l.uv_stride;
+	args.uv_step = nv12 ? 2 : 1;
+	args.width = width;
+	args.height = height;
+
+	memset(dst, GUARD, l.size + GUARD_SIZE);
+	for (band = 0; band < bands; band++)
+	    ABGRToYUV420_band(&args, band, bands);
+	failures += compare(expected, dst, &l, width, height, nv12, bands);
+    }
+
+    free(src);
+    free(expected);
+    free(dst);
+    return failures;
+}
+
+int main(void) {
+    static const int sizes[][2] = {
+	{ 1, 1 }, { 2, 2 }, { 3, 3 }, { 15, 7 }, { 16, 16 }, { 17, 9 },
+	{ 33, 31 }, { 176, 144 }, { 175, 145 }, { 640, 360 }, { 1279, 719 },
+	{ 1280, 720 }, { 1920, 1080 },
+    };
+    struct yuv_pool *pool = yuv_pool_create();
+    unsigned int i;
+    int failures = 0;
+
+    if (!pool) {
+	printf("no conversion workers\n");
+	return 1;
+    }
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+	failures += check(pool, sizes[i][0], sizes[i][1], 0);
+	failures += check(pool, sizes[i][0], sizes[i][1], 1);
+    }
+
+    printf("%u sizes, %d workers: %s\n", (unsigned)(sizeof(sizes) / sizeof(sizes[0])),
+	   pool->threads, failures ? "FAILED" : "PASSED");
+    yuv_pool_destroy(pool);
+
+    return failures ? 1 : 0;
+}
@@ -4,10 +4,12 @@
 #include <sys/types.h>
 #include <sys/sysinfo.h>
 #include <pthread.h>
-#include <semaphore.h>
+#include <stdlib.h>
 #include <log/log.h>
 
-//#define IS_ALIGNED(p, a) (!((uintptr_t)(p) & ((a) - 1)))
+#ifdef __ARM_NEON__
+#include <arm_neon.h>
+#endif
 
 struct thread_args {
     const uint8_t *src_argb;
@@ -18,147 +20,147 @@ struct thread_args {
     int dst_stride_y;
     int dst_stride_u;
     int dst_stride_v;
+    int uv_step;            // 1: planar, 2: Cb/Cr interleaved (dst_v == dst_u + 1)
     int width;
     int height;
-    int cpus;
-//    void (*ABGRToYRow)(const uint8_t *src_abgr, uint8_t *dst_y, int pix);
-//    void (*ABGRToUVRow)(const uint8_t *src_abgr0, int src_stride_abgr, uint8_t *dst_u, uint8_t *dst_v, int width);
 };
 
-static sem_t sem;
-
-#define RGBTOUV(QB, QG, QR)                                                 \
-  "vmul.s16   q8, " #QB ", q10               \n" /* B                    */ \
-  "vmls.s16   q8, " #QG ", q11               \n" /* G                    */ \
-  "vmls.s16   q8, " #QR ", q12               \n" /* R                    */ \
-  "vadd.u16   q8, q8, q15                    \n" /* +128 -> unsigned     */ \
-  "vmul.s16   q9, " #QR ", q10               \n" /* R                    */ \
-  "vmls.s16   q9, " #QG ", q14               \n" /* G                    */ \
-  "vmls.s16   q9, " #QB ", q13               \n" /* B                    */ \
-  "vadd.u16   q9, q9, q15                    \n" /* +128 -> unsigned     */ \
-  "vqshrn.u16  d0, q8, #8                    \n" /* 16 bit to 8 bit U    */ \
-  "vqshrn.u16  d1, q9, #8                    \n" /* 16 bit to 8 bit V    */
-
-void ABGRToUVRow_NEON(const uint8_t *src_abgr,
-                      int src_stride_abgr,
-                      uint8_t *dst_u,
-                      uint8_t *dst_v,
-                      int width) {
-  asm volatile (
-    "add        %1, %0, %1                     \n"  // src_stride + src_abgr
-    "vmov.s16   q10, #112 / 2                  \n"  // UB / VR 0.875 coefficient
-    "vmov.s16   q11, #74 / 2                   \n"  // UG -0.5781 coefficient
-    "vmov.s16   q12, #38 / 2                   \n"  // UR -0.2969 coefficient
-    "vmov.s16   q13, #18 / 2                   \n"  // VB -0.1406 coefficient
-    "vmov.s16   q14, #94 / 2                   \n"  // VG -0.7344 coefficient
-    "vmov.u16   q15, #0x8080                   \n"  // 128.5
-    "1:                                        \n"
-    "vld4.8     {d0, d2, d4, d6}, [%0]!        \n"  // load 8 ABGR pixels.
-    "vld4.8     {d1, d3, d5, d7}, [%0]!        \n"  // load next 8 ABGR pixels.
-    "vpaddl.u8  q2, q2                         \n"  // B 16 bytes -> 8 shorts.
-    "vpaddl.u8  q1, q1                         \n"  // G 16 bytes -> 8 shorts.
-    "vpaddl.u8  q0, q0                         \n"  // R 16 bytes -> 8 shorts.
-    "vld4.8     {d8, d10, d12, d14}, [%1]!     \n"  // load 8 more ABGR pixels.
-    "vld4.8     {d9, d11, d13, d15}, [%1]!     \n"  // load last 8 ABGR pixels.
-    "vpadal.u8  q2, q6                         \n"  // B 16 bytes -> 8 shorts.
-    "vpadal.u8  q1, q5                         \n"  // G 16 bytes -> 8 shorts.
-    "vpadal.u8  q0, q4                         \n"  // R 16 bytes -> 8 shorts.
-    "vrshr.u16  q0, q0, #1                     \n"  // 2x average
-    "vrshr.u16  q1, q1, #1                     \n"
-    "vrshr.u16  q2, q2, #1                     \n"
-    "subs       %4, %4, #16                    \n"  // 32 processed per loop.
-    RGBTOUV(q2, q1, q0)
-    "vst1.8     {d0}, [%2]!                    \n"  // store 8 pixels U.
-    "vst1.8     {d1}, [%3]!                    \n"  // store 8 pixels V.
-    "bgt        1b                             \n"
-  : "+r"(src_abgr),  // %0
-    "+r"(src_stride_abgr),  // %1
-    "+r"(dst_u),     // %2
-    "+r"(dst_v),     // %3
-    "+r"(width)        // %4
-  :
-  : "cc", "memory", "q0", "q1", "q2", "q3", "q4", "q5", "q6", "q7",
-    "q8", "q9", "q10", "q11", "q12", "q13", "q14", "q15"
-  );
-}
-
-void ABGRToYRow_NEON(const uint8_t *src_abgr, uint8_t *dst_y, int width) {
-  asm volatile(
-      "vmov.u8    d4, #33                        \n"  // R * 0.2578 coefficient
-      "vmov.u8    d5, #65                        \n"  // G * 0.5078 coefficient
-      "vmov.u8    d6, #13                        \n"  // B * 0.1016 coefficient
-      "vmov.u8    d7, #16                        \n"  // Add 16 constant
-      "1:                                        \n"
-      "vld4.8     {d0, d1, d2, d3}, [%0]!        \n"  // load 8 pixels of ABGR.
-      "subs       %2, %2, #8                     \n"  // 8 processed per loop.
-      "vmull.u8   q8, d0, d4                     \n"  // R
-      "vmlal.u8   q8, d1, d5                     \n"  // G
-      "vmlal.u8   q8, d2, d6                     \n"  // B
-      "vqrshrun.s16 d0, q8, #7                   \n"  // 16 bit to 8 bit Y
-      "vqadd.u8   d0, d7                         \n"
-      "vst1.8     {d0}, [%1]!                    \n"  // store 8 pixels Y.
-      "bgt        1b                             \n"
-      : "+r"(src_abgr),  // %0
-        "+r"(dst_y),     // %1
-        "+r"(width)      // %2
-      :
-      : "cc", "memory", "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "q8");
-}
 /*
-static __inline int RGBToY(uint8_t r, uint8_t g, uint8_t b) {
-    return (( 66 * r + 129 * g +  25 * b + 128) >> 8) + 16;
+ * BT.601 limited range, fixed point. A pair of ABGR rows (R, G, B, A bytes in
+ * memory) is read once and gives the Y of both rows and the chroma of their
+ * 2x2 blocks. The C version is the reference: it matches the NEON one bit for
+ * bit and converts the columns the NEON loop leaves over. An odd last column
+ * or row is converted as if it was doubled.
+ */
+static inline uint8_t ABGRToY(const uint8_t *p) {
+    int y = ((33 * p[0] + 65 * p[1] + 13 * p[2] + 64) >> 7) + 16;
+
+    return y > 255 ? 255 : y;
 }
 
-static __inline int RGBToU(uint8_t r, uint8_t g, uint8_t b) {
-    return ((-38 * r -  74 * g + 112 * b + 128) >> 8) + 128;
-}
-static __inline int RGBToV(uint8_t r, uint8_t g, uint8_t b) {
-    return ((112 * r -  94 * g -  18 * b + 128) >> 8) + 128;
+// r, g, b are sums over a 2x2 block
+static inline void ABGRToUV(int r, int g, int b, uint8_t *dst_u, uint8_t *dst_v) {
+    r = (r + 1) >> 1;
+    g = (g + 1) >> 1;
+    b = (b + 1) >> 1;
+    *dst_u = (uint16_t)(56 * b - 37 * g - 19 * r + 0x8080) >> 8;
+    *dst_v = (uint16_t)(56 * r - 47 * g - 9 * b + 0x8080) >> 8;
 }
 
-static void ABGRToYRow_C(const uint8_t *src_argb0, uint8_t *dst_y, int width) {
+static void ABGRToYUVRowPair_C(const uint8_t *src0, const uint8_t *src1,
+               uint8_t *dst_y0, uint8_t *dst_y1,
+               uint8_t *dst_u, uint8_t *dst_v, int uv_step, int width) {
     int x;
 
-    for (x = 0; x < width; ++x) {
-	dst_y[0] = RGBToY(src_argb0[0], src_argb0[1], src_argb0[2]);
-	src_argb0 += 4;
-	dst_y += 1;
+    for (x = 0; x < width - 1; x += 2) {
+	dst_y0[0] = ABGRToY(src0);
+	dst_y0[1] = ABGRToY(src0 + 4);
+	dst_y1[0] = ABGRToY(src1);
+	dst_y1[1] = ABGRToY(src1 + 4);
+	ABGRToUV(src0[0] + src0[4] + src1[0] + src1[4],
+		 src0[1] + src0[5] + src1[1] + src1[5],
+		 src0[2] + src0[6] + src1[2] + src1[6], dst_u, dst_v);
+	src0 += 8;
+	src1 += 8;
+	dst_y0 += 2;
+	dst_y1 += 2;
+	dst_u += uv_step;
+	dst_v += uv_step;
+    }
+
+    if (width & 1) {
+	dst_y0[0] = ABGRToY(src0);
+	dst_y1[0] = ABGRToY(src1);
+	ABGRToUV((src0[0] + src1[0]) * 2, (src0[1] + src1[1]) * 2,
+		 (src0[2] + src1[2]) * 2, dst_u, dst_v);
     }
 }
 
-static void ABGRToUVRow_C(const uint8_t *src_rgb0, int src_stride_rgb, uint8_t *dst_u, uint8_t *dst_v, int width) {
-    const uint8_t *src_rgb1 = src_rgb0 + src_stride_rgb;
-    int x;
+#ifdef __ARM_NEON__
+static inline uint8x8_t ABGRToY8_NEON(uint8x8_t r, uint8x8_t g, uint8x8_t b) {
+    uint16x8_t y = vmull_u8(r, vdup_n_u8(33));
 
-    for (x = 0; x < width - 1; x += 2) {
-	uint8_t ab = (src_rgb0[2] + src_rgb0[6] + src_rgb1[2] + src_rgb1[6]) >> 2;
-	uint8_t ag = (src_rgb0[1] + src_rgb0[5] + src_rgb1[1] + src_rgb1[5]) >> 2;
-	uint8_t ar = (src_rgb0[0] + src_rgb0[4] + src_rgb1[0] + src_rgb1[4]) >> 2;
-	dst_u[0] = RGBToU(ar, ag, ab);
-	dst_v[0] = RGBToV(ar, ag, ab);
-	src_rgb0 += 8;
-	src_rgb1 += 8;
-	dst_u += 1;
-	dst_v += 1;
-    }
+    y = vmlal_u8(y, g, vdup_n_u8(65));
+    y = vmlal_u8(y, b, vdup_n_u8(13));
+    return vqadd_u8(vqrshrun_n_s16(vreinterpretq_s16_u16(y), 7), vdup_n_u8(16));
 }
 
-void ABGRToYRow_Any_NEON(const uint8_t *src_argb, uint8_t *dst_y, int width) {
-    int n = width & ~0x07;
+static inline uint8x16_t ABGRToY16_NEON(const uint8x16x4_t *p) {
+    return vcombine_u8(
+	ABGRToY8_NEON(vget_low_u8(p->val[0]), vget_low_u8(p->val[1]), vget_low_u8(p->val[2])),
+	ABGRToY8_NEON(vget_high_u8(p->val[0]), vget_high_u8(p->val[1]), vget_high_u8(p->val[2])));
+}
 
-    if (n > 0)
-	ABGRToYRow_NEON(src_argb, dst_y, n);
-    ABGRToYRow_C(src_argb + n * 4, dst_y + n, width & 0x07);
+// width is a multiple of 16
+static void ABGRToYUVRowPair_NEON(const uint8_t *src0, const uint8_t *src1,
+               uint8_t *dst_y0, uint8_t *dst_y1,
+               uint8_t *dst_u, uint8_t *dst_v, int uv_step, int width) {
+    const uint16x8_t k128 = vdupq_n_u16(0x8080);
+    int x;
+
+    for (x = 0; x < width; x += 16) {
+	uint8x16x4_t p0 = vld4q_u8(src0);
+	uint8x16x4_t p1 = vld4q_u8(src1);
+	int16x8_t r, g, b, u, v;
+	uint8x8_t u8, v8;
+
+	__builtin_prefetch(src0 + 256);
+	__builtin_prefetch(src1 + 256);
+
+	vst1q_u8(dst_y0, ABGRToY16_NEON(&p0));
+	vst1q_u8(dst_y1, ABGRToY16_NEON(&p1));
+
+	// 2x2 sums, halved with rounding
+	r = vreinterpretq_s16_u16(vrshrq_n_u16(vpadalq_u8(vpaddlq_u8(p0.val[0]), p1.val[0]), 1));
+	g = vreinterpretq_s16_u16(vrshrq_n_u16(vpadalq_u8(vpaddlq_u8(p0.val[1]), p1.val[1]), 1));
+	b = vreinterpretq_s16_u16(vrshrq_n_u16(vpadalq_u8(vpaddlq_u8(p0.val[2]), p1.val[2]), 1));
+
+	u = vmulq_s16(b, vdupq_n_s16(56));
+	u = vmlsq_s16(u, g, vdupq_n_s16(37));
+	u = vmlsq_s16(u, r, vdupq_n_s16(19));
+	v = vmulq_s16(r, vdupq_n_s16(56));
+	v = vmlsq_s16(v, g, vdupq_n_s16(47));
+	v = vmlsq_s16(v, b, vdupq_n_s16(9));
+	u8 = vqshrn_n_u16(vaddq_u16(vreinterpretq_u16_s16(u), k128), 8);
+	v8 = vqshrn_n_u16(vaddq_u16(vreinterpretq_u16_s16(v), k128), 8);
+
+	if (uv_step == 2) {
+	    uint8x8x2_t uv;
+
+	    uv.val[0] = u8;
+	    uv.val[1] = v8;
+	    vst2_u8(dst_u, uv);
+	} else {
+	    vst1_u8(dst_u, u8);
+	    vst1_u8(dst_v, v8);
+	}
+
+	src0 += 64;
+	src1 += 64;
+	dst_y0 += 16;
+	dst_y1 += 16;
+	dst_u += 8 * uv_step;
+	dst_v += 8 * uv_step;
     }
+}
+#endif
 
-void ABGRToUVRow_Any_NEON(const uint8_t *src_argb, int src_stride_argb, uint8_t *dst_u, uint8_t *dst_v, int width) {
-    int n = width & ~0x0F;
+static void ABGRToYUVRowPair(const uint8_t *src0, const uint8_t *src1,
+               uint8_t *dst_y0, uint8_t *dst_y1,
+               uint8_t *dst_u, uint8_t *dst_v, int uv_step, int width) {
+    int n = 0;
 
+#ifdef __ARM_NEON__
+    n = width & ~15;
     if (n > 0)
-	ABGRToUVRow_NEON(src_argb, src_stride_argb, dst_u, dst_v, n);
-    ABGRToUVRow_C(src_argb  + n * 4, src_stride_argb, dst_u + (n >> 1), dst_v + (n >> 1), width & 0x0F);
+	ABGRToYUVRowPair_NEON(src0, src1, dst_y0, dst_y1, dst_u, dst_v, uv_step, n);
+#endif
+    if (width > n)
+	ABGRToYUVRowPair_C(src0 + n * 4, src1 + n * 4, dst_y0 + n, dst_y1 + n,
+			   dst_u + (n / 2) * uv_step, dst_v + (n / 2) * uv_step,
+			   uv_step, width - n);
 }
-*/
+
 static inline void setaffinity(int cpu) {
     cpu_set_t cpuset;
 
@@ -168,117 +170,198 @@ static inline void setaffinity(int cpu) {
 	ALOGE("setaffinity: failed to set affinity on cpu %d", cpu);
 }
 
-static void *y1_thread(void *data) {
+/*
+ * Persistent conversion workers, created with the first converted frame and
+ * kept until the component releases its resources. The frame is cut into
+ * bands of row pairs, one per worker, and each band converts Y and UV of its
+ * rows together while the RGBA data is still in cache. CPU 0 is left to the
+ * component thread, the workers are pinned to the other online CPUs.
+ */
+#define YUV_POOL_MAX_THREADS 4
+
+struct yuv_pool;
+
+struct yuv_worker {
+    struct yuv_pool *pool;
+    pthread_t tid;
+    int index;
+};
 
-    struct thread_args *args = (struct thread_args *)data;
-    struct sched_param param = {0};
-    int y, err;
-    const uint8_t *src_argb = args->src_argb;
-    int src_stride_argb = args->src_stride_argb;
-    uint8_t *dst_y = args->dst_y;
-    int dst_stride_y = args->dst_stride_y;
-    int width = args->width;
-    int height = args->height;
+struct yuv_pool {
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    struct yuv_worker workers[YUV_POOL_MAX_THREADS];
+    int threads;
+    int pin;                // workers pinned to CPUs 1..threads
+    unsigned int job;       // frames handed to the workers so far
+    int pending;            // bands of the current frame still converting
+    int quit;
+    struct thread_args args;
+};
 
-    param.sched_priority = 1;
-    err = sched_setscheduler(0, SCHED_FIFO, &param);
-    if (err != 0)
-	ALOGE("y2_thread: failed to set priority");
-    if (args->cpus == 4)
-	setaffinity(1);
-
-    for (y = 0; y < height - 1; y += 2) {
-	ABGRToYRow_NEON(src_argb, dst_y, width);
-//	args->ABGRToYRow(src_argb, dst_y, width);
-	src_argb += src_stride_argb * 2;
-	dst_y += dst_stride_y * 2;
+static void ABGRToYUV420_band(const struct thread_args *args, int band, int bands) {
+    int pairs = (args->height + 1) / 2;
+    int first = pairs * band / bands;
+    int last = pairs * (band + 1) / bands;
+    const uint8_t *src_argb = args->src_argb + first * 2 * args->src_stride_argb;
+    uint8_t *dst_y = args->dst_y + first * 2 * args->dst_stride_y;
+    uint8_t *dst_u = args->dst_u + first * args->dst_stride_u;
+    uint8_t *dst_v = args->dst_v + first * args->dst_stride_v;
+    int y;
+
+    for (y = first; y < last; y++) {
+	const uint8_t *src_next = src_argb + args->src_stride_argb;
+	uint8_t *dst_next = dst_y + args->dst_stride_y;
+
+	// odd height, the last row makes a pair with itself
+	if (2 * y + 1 == args->height) {
+	    src_next = src_argb;
+	    dst_next = dst_y;
+	}
+
+	ABGRToYUVRowPair(src_argb, src_next, dst_y, dst_next, dst_u, dst_v,
+			 args->uv_step, args->width);
+	src_argb += args->src_stride_argb * 2;
+	dst_y += args->dst_stride_y * 2;
+	dst_u += args->dst_stride_u;
+	dst_v += args->dst_stride_v;
     }
-
-    sem_post(&sem);
-    return NULL;
 }
 
-static void *y2_thread(void *data) {
+static void *yuv_worker_thread(void *data) {
 
-    struct thread_args *args = (struct thread_args *)data;
+    struct yuv_worker *worker = (struct yuv_worker *)data;
+    struct yuv_pool *pool = worker->pool;
     struct sched_param param = {0};
-    int y, err;
-    const uint8_t *src_argb = args->src_argb;
-    int src_stride_argb = args->src_stride_argb;
-    uint8_t *dst_y = args->dst_y;
-    int dst_stride_y = args->dst_stride_y;
-    int width = args->width;
-    int height = args->height;
+    unsigned int job = 0;
 
     param.sched_priority = 1;
-    err = sched_setscheduler(0, SCHED_FIFO, &param);
-    if (err != 0)
-	ALOGE("y2_thread: failed to set priority");
-    if (args->cpus == 4)
-	setaffinity(2);
-
-    for (y = 0; y < height - 1; y += 2) {
-	ABGRToYRow_NEON(src_argb + src_stride_argb, dst_y + dst_stride_y, width);
-//	args->ABGRToYRow(src_argb + src_stride_argb, dst_y + dst_stride_y, width);
-	src_argb += src_stride_argb * 2;
-	dst_y += dst_stride_y * 2;
+    if (sched_setscheduler(0, SCHED_FIFO, &param) != 0)
+	ALOGE("yuv_worker_thread: failed to set priority");
+    if (pool->pin)
+	setaffinity(worker->index + 1);
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+	while (!pool->quit && pool->job == job)
+	    pthread_cond_wait(&pool->start, &pool->lock);
+	if (pool->quit)
+	    break;
+	job = pool->job;
+	pthread_mutex_unlock(&pool->lock);
+
+	ABGRToYUV420_band(&pool->args, worker->index, pool->threads);
+
+	pthread_mutex_lock(&pool->lock);
+	if (--pool->pending == 0)
+	    pthread_cond_signal(&pool->done);
     }
+    pthread_mutex_unlock(&pool->lock);
 
-    sem_post(&sem);
     return NULL;
 }
 
-static void *uv_thread(void *data) {
+static void yuv_pool_destroy(struct yuv_pool *pool) {
+    int i;
 
-    struct thread_args *args = (struct thread_args *)data;
-    struct sched_param param = {0};
-    int y, err;
-    const uint8_t *src_argb = args->src_argb;
-    int src_stride_argb = args->src_stride_argb;
-    uint8_t *dst_u = args->dst_u;
-    uint8_t *dst_v = args->dst_v;
-    int dst_stride_u = args->dst_stride_u;
-    int dst_stride_v = args->dst_stride_v;
-    int width = args->width;
-    int height = args->height;
+    if (!pool)
+	return;
 
-    param.sched_priority = 1;
-    err = sched_setscheduler(0, SCHED_FIFO, &param);
-    if (err != 0)
-	ALOGE("uv_thread: failed to set priority");
-    if (args->cpus == 4)
-	setaffinity(3);
-
-    for (y = 0; y < height - 1; y += 2) {
-	ABGRToUVRow_NEON(src_argb, src_stride_argb, dst_u, dst_v, width);
-//	args->ABGRToUVRow(src_argb, src_stride_argb, dst_u, dst_v, width);
-	src_argb += src_stride_argb * 2;
-	dst_u += dst_stride_u;
-	dst_v += dst_stride_v;
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->threads; i++)
+	pthread_join(pool->workers[i].tid, NULL);
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+static struct yuv_pool *yuv_pool_create(void) {
+    struct yuv_pool *pool;
+    int i, threads = get_nprocs() - 1;
+
+    if (threads < 1)
+	threads = 1;
+    if (threads > YUV_POOL_MAX_THREADS)
+	threads = YUV_POOL_MAX_THREADS;
+
+    pool = (struct yuv_pool *)calloc(1, sizeof(struct yuv_pool));
+    if (!pool)
+	return NULL;
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->pin = get_nprocs() > threads;
+
+    for (i = 0; i < threads; i++) {
+	pool->workers[i].pool = pool;
+	pool->workers[i].index = i;
+	if (pthread_create(&pool->workers[i].tid, NULL, yuv_worker_thread, &pool->workers[i]) != 0) {
+	    ALOGE("yuv_pool_create: failed to create worker %d", i);
+	    break;
+	}
+	pool->threads++;
     }
-    sem_post(&sem);
-    return NULL;
+
+    if (!pool->threads) {
+	yuv_pool_destroy(pool);
+	return NULL;
+    }
+
+    ALOGV("yuv_pool_create: %d conversion workers", pool->threads);
+    return pool;
 }
 
-static int ABGRToI420_multithread(const uint8_t *src_argb, int src_stride_argb,
+/*
+ * Hand a frame to the workers and return. The source and destination must
+ * stay untouched until yuv_pool_wait, so the caller may meanwhile e.g. let
+ * the hardware encode the previous frame.
+ */
+static int yuv_pool_start(struct yuv_pool *pool, struct thread_args *args) {
+
+    if (!pool || !args->src_argb || !args->dst_y || !args->dst_u || !args->dst_v ||
+	args->width <= 0 || args->height == 0)
+	return -1;
+
+    // Negative height means invert the image.
+    if (args->height < 0) {
+	args->height = -args->height;
+	args->src_argb = args->src_argb + (args->height - 1) * args->src_stride_argb;
+	args->src_stride_argb = -args->src_stride_argb;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->args = *args;
+    pool->pending = pool->threads;
+    pool->job++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    return 0;
+}
+
+static void yuv_pool_wait(struct yuv_pool *pool) {
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending)
+	pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static int ABGRToI420_start(struct yuv_pool *pool, const uint8_t *src_argb, int src_stride_argb,
                uint8_t *dst_y, int dst_stride_y,
                uint8_t *dst_u, int dst_stride_u,
                uint8_t *dst_v, int dst_stride_v,
                int width, int height) {
-    int i, err, policy;
-    pthread_t tid;
     struct thread_args args;
 
-    if (!src_argb || !dst_y || !dst_u || !dst_v || width <= 0 || height == 0)
-	return -1;
-
-    // Negative height means invert the image.
-    if (height < 0) {
-	height = -height;
-	src_argb = src_argb + (height - 1) * src_stride_argb;
-	src_stride_argb = -src_stride_argb;
-    }
-
     args.src_argb = src_argb;
     args.dst_y = dst_y;
     args.dst_u = dst_u;
@@ -287,39 +370,30 @@ static int ABGRToI420_multithread(const uint8_t *src_argb, int src_stride_argb,
     args.dst_stride_y = dst_stride_y;
     args.dst_stride_u = dst_stride_u;
     args.dst_stride_v = dst_stride_v;
+    args.uv_step = 1;
     args.width = width;
     args.height = height;
-    args.cpus = get_nprocs();
-/*
-    if (IS_ALIGNED(width, 8))
-	args.ABGRToYRow = ABGRToYRow_NEON;
-    else
-	args.ABGRToYRow = ABGRToYRow_Any_NEON;
-
-    if (IS_ALIGNED(width, 16))
-      args.ABGRToUVRow = ABGRToUVRow_NEON;
-    else
-	args.ABGRToUVRow = ABGRToUVRow_Any_NEON;
-*/
-    err = sem_init(&sem, 0, 0);
-    if (err != 0)
-	return err;
-    err = pthread_create(&tid, NULL, y1_thread, &args);
-    if (err != 0)
-	return err;
-    pthread_detach(tid);
-    err = pthread_create(&tid, NULL, y2_thread, &args);
-    if (err != 0)
-	return err;
-    pthread_detach(tid);
-    err = pthread_create(&tid, NULL, uv_thread, &args);
-    if (err != 0)
-	return err;
-    pthread_detach(tid);
-
-    for (i = 0; i < 3; i++)
-	sem_wait(&sem);
-
-    sem_destroy(&sem);
-    return 0;
+
+    return yuv_pool_start(pool, &args);
+}
+
+static int ABGRToNV12_start(struct yuv_pool *pool, const uint8_t *src_argb, int src_stride_argb,
+               uint8_t *dst_y, int dst_stride_y,
+               uint8_t *dst_uv, int dst_stride_uv,
+               int width, int height) {
+    struct thread_args args;
+
+    args.src_argb = src_argb;
+    args.dst_y = dst_y;
+    args.dst_u = dst_uv;
+    args.dst_v = dst_uv ? dst_uv + 1 : NULL;
+    args.src_stride_argb = src_stride_argb;
+    args.dst_stride_y = dst_stride_y;
+    args.dst_stride_u = dst_stride_uv;
+    args.dst_stride_v = dst_stride_uv;
+    args.uv_step = 2;
+    args.width = width;
+    args.height = height;
+
+    return yuv_pool_start(pool, &args);
 }
@@ -130,3 +130,36 @@ LOCAL_PRELINK_MODULE:=false
 LOCAL_MODULE_TAGS := optional
 
 #include $(BUILD_SHARED_LIBRARY)
+
+#
+# Opaque input conversion check and benchmark, on the host and on the
+# device (NEON)
+#
+
+include $(CLEAR_VARS)
+LOCAL_SRC_FILES := 8290_encoder/tests/yuv_test.c
+LOCAL_SHARED_LIBRARIES := liblog
+LOCAL_MODULE := hantro_yuv_test
+LOCAL_MODULE_TAGS := optional
+include $(BUILD_HOST_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_SRC_FILES := 8290_encoder/tests/yuv_test.c
+LOCAL_SHARED_LIBRARIES := liblog
+LOCAL_MODULE := hantro_yuv_test
+LOCAL_MODULE_TAGS := optional
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_SRC_FILES := 8290_encoder/tests/yuv_benchmark.c
+LOCAL_SHARED_LIBRARIES := liblog
+LOCAL_MODULE := hantro_yuv_benchmark
+LOCAL_MODULE_TAGS := optional
+include $(BUILD_HOST_EXECUTABLE)
+
+include $(CLEAR_VARS)
+LOCAL_SRC_FILES := 8290_encoder/tests/yuv_benchmark.c
+LOCAL_SHARED_LIBRARIES := liblog
+LOCAL_MODULE := hantro_yuv_benchmark
+LOCAL_MODULE_TAGS := optional
+include $(BUILD_EXECUTABLE)
@@ -28,6 +28,7 @@
 
 #include <stdio.h>
 #include <sys/time.h>
+#include <time.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/select.h>
@@ -840,3 +841,14 @@ OSAL_U32 OSAL_GetTime()
     return ((OSAL_U32)now.tv_sec) * 1000 + ((OSAL_U32)now.tv_usec) / 1000;
 }
 
+/*------------------------------------------------------------------------------
+    OSAL_GetTimeUs
+    Monotonic microseconds for measuring durations, wraps around
+------------------------------------------------------------------------------*/
+OSAL_U32 OSAL_GetTimeUs()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((OSAL_U32)now.tv_sec) * 1000000 + ((OSAL_U32)now.tv_nsec) / 1000;
+}
+
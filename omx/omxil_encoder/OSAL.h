@@ -115,6 +115,7 @@ OSAL_ERRORTYPE  OSAL_EventWaitMultiple(OSAL_PTR* hEvents, OSAL_BOOL* bSignaled,
 ------------------------------------------------------------------------------*/
 
 OSAL_U32        OSAL_GetTime();
+OSAL_U32        OSAL_GetTimeUs();
 
 
 #ifdef __cplusplus
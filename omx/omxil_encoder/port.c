@@ -353,6 +353,51 @@ OMX_ERRORTYPE HantroOmx_port_push_buffer(PORT* p, BUFFER* buff)
     return OMX_ErrorNone;
 }
 
+/*
+ * Points the bus addresses of a metadata buffer at the gralloc or camera
+ * frame it carries. An EOS buffer may come with or without a frame; without
+ * one its addresses are cleared so that nothing stale gets encoded.
+ */
+static
+OMX_BOOL port_resolve_metadata(BUFFER* pbuf)
+{
+    if (pbuf->header->nAllocLen == 8) { /* GrallocSource */
+	struct VideoGrallocMetadata *meta = (struct VideoGrallocMetadata *)pbuf->header->pBuffer;
+	struct private_handle_t *handle = (struct private_handle_t *)meta->pHandle;
+
+	if ((pbuf->header->nFlags & OMX_BUFFERFLAG_EOS) &&
+	    (pbuf->header->nFilledLen == 0 || !handle)) {
+	    pbuf->bus_data = NULL;
+	    pbuf->bus_address = 0;
+	    return OMX_TRUE;
+	}
+	if (!handle) {
+	    ALOGE("%s: pHandle is null!", __func__);
+	    return OMX_FALSE;
+	}
+	pbuf->bus_data = handle->base;
+	pbuf->bus_address = handle->phys_addr;
+	pbuf->allocsize = handle->size;
+	ALOGV("%s: using native buffer: size = %d width = %d height = %d virt = %p phy = 0x%x", __func__,
+		handle->size, handle->width, handle->height, handle->base, handle->phys_addr);
+    }
+    else
+	if (pbuf->header->nFilledLen == 32) { /* CameraSource */
+	    struct CameraSourceMetadata *meta = (struct CameraSourceMetadata *)pbuf->header->pBuffer;
+	    if (meta->magic != 0x6B337632 /* k3v2 */) {
+		ALOGE("%s: invalid camera magic", __func__);
+		return OMX_FALSE;
+	    }
+	    pbuf->bus_data = meta->virt_addr;
+	    pbuf->allocsize = pbuf->header->nAllocLen = (meta->width * meta->height * 3) / 2;
+//	    pbuf->allocsize = (meta->width * meta->height * 3) / 2;
+	    pbuf->bus_address = meta->phys_addr;
+	    ALOGV("%s: using CameraSource: size = %d width = %d height = %d virt = %p (%p) phy = 0x%x", __func__,
+		    pbuf->allocsize, meta->width, meta->height, meta->virt_addr, pbuf->bus_data, meta->phys_addr);
+	}
+    return OMX_TRUE;
+}
+
 OMX_BOOL HantroOmx_port_get_buffer(PORT* p, BUFFER** buff)
 {
     static int i = 0;
@@ -365,45 +410,12 @@ OMX_BOOL HantroOmx_port_get_buffer(PORT* p, BUFFER** buff)
 
 //    *buff = *HantroOmx_bufferlist_at(&p->bufferqueue, 0);
     BUFFER *pbuf = *HantroOmx_bufferlist_at(&p->bufferqueue, 0);
-    if (p->StoreMetadata) {
-	if (pbuf->header->nAllocLen == 8) { /* GrallocSource */
-	    if (pbuf->header->nFlags & OMX_BUFFERFLAG_EOS) {
-		*buff = pbuf;
-		return OMX_TRUE;
-	    }
-	    struct VideoGrallocMetadata *meta = (struct VideoGrallocMetadata *)pbuf->header->pBuffer;
-	    struct private_handle_t *handle = (struct private_handle_t *)meta->pHandle;
-	    if (!handle) {
-		ALOGE("%s: pHandle is null!", __func__);
-		goto out;
-	    }
-	    pbuf->bus_data = handle->base;
-	    pbuf->bus_address = handle->phys_addr;
-	    pbuf->allocsize = handle->size;
-	    ALOGV("%s: using native buffer: size = %d width = %d height = %d virt = %p phy = 0x%x", __func__,
-		    handle->size, handle->width, handle->height, handle->base, handle->phys_addr);
-	}
-	else
-	    if (pbuf->header->nFilledLen == 32) { /* CameraSource */
-		struct CameraSourceMetadata *meta = (struct CameraSourceMetadata *)pbuf->header->pBuffer;
-		if (meta->magic != 0x6B337632 /* k3v2 */) {
-		    ALOGE("%s: invalid camera magic", __func__);
-		    goto out;
-		}
-		pbuf->bus_data = meta->virt_addr;
-		pbuf->allocsize = pbuf->header->nAllocLen = (meta->width * meta->height * 3) / 2;
-//		pbuf->allocsize = (meta->width * meta->height * 3) / 2;
-		pbuf->bus_address = meta->phys_addr;
-		ALOGV("%s: using CameraSource: size = %d width = %d height = %d virt = %p (%p) phy = 0x%x", __func__,
-			pbuf->allocsize, meta->width, meta->height, meta->virt_addr, pbuf->bus_data, meta->phys_addr);
-	    }
+    if (p->StoreMetadata && !port_resolve_metadata(pbuf)) {
+	*buff = NULL;
+	return OMX_FALSE;
     }
     *buff = pbuf;
     return OMX_TRUE;
-
-out:
-    *buff = NULL;
-    return OMX_FALSE;
 }
 
 OMX_BOOL HantroOmx_port_get_buffer_at(PORT* p, BUFFER** buff, OMX_U32 i)
@@ -416,47 +428,12 @@ OMX_BOOL HantroOmx_port_get_buffer_at(PORT* p, BUFFER** buff, OMX_U32 i)
     }
 //    *buff = *HantroOmx_bufferlist_at(&p->bufferqueue, i);
     BUFFER *pbuf = *HantroOmx_bufferlist_at(&p->bufferqueue, i);
-    if (p->StoreMetadata) {
-	if (pbuf->header->nAllocLen == 8) {
-	    if (pbuf->header->nFlags & OMX_BUFFERFLAG_EOS) {
-		*buff = pbuf;
-		return OMX_TRUE;
-	    }
-	    struct VideoGrallocMetadata *meta = (struct VideoGrallocMetadata *)pbuf->header->pBuffer;
-	    struct private_handle_t *handle = (struct private_handle_t *)meta->pHandle;
-	    if (!handle)
-	    {
-		ALOGE("%s: pHandle is null!", __func__);
-		*buff = NULL;
-		return OMX_FALSE;
-	    }
-	    pbuf->bus_data = handle->base;
-	    pbuf->bus_address = handle->phys_addr;
-	    pbuf->allocsize = handle->size;
-	    ALOGV("%s: using native buffer: size = %d width = %d height = %d virt = %p phy = 0x%x", __func__,
-		    handle->size, handle->width, handle->height, handle->base, handle->phys_addr);
-	}
-	else
-	    if (pbuf->header->nFilledLen == 32) { /* CameraSource */
-		struct CameraSourceMetadata *meta = (struct CameraSourceMetadata *)pbuf->header->pBuffer;
-		if (meta->magic != 0x6B337632 /* k3v2 */) {
-		    ALOGE("%s: invalid camera magic", __func__);
-		    goto out;
-		}
-		pbuf->bus_data = meta->virt_addr;
-		pbuf->allocsize = pbuf->header->nAllocLen = (meta->width * meta->height * 3) / 2;
-//		pbuf->allocsize = (meta->width * meta->height * 3) / 2;
-		pbuf->bus_address = meta->phys_addr;
-		ALOGV("%s: using CameraSource: size = %d width = %d height = %d virt = %p (%p) phy = 0x%x", __func__,
-			pbuf->allocsize, meta->width, meta->height, meta->virt_addr, pbuf->bus_data, meta->phys_addr);
-	    }
+    if (p->StoreMetadata && !port_resolve_metadata(pbuf)) {
+	*buff = NULL;
+	return OMX_FALSE;
     }
     *buff = pbuf;
     return OMX_TRUE;
-
-out:
-    *buff = NULL;
-    return OMX_FALSE;
 }
 
 OMX_BOOL HantroOmx_port_get_allocated_buffer_at(PORT* p, BUFFER** buff, OMX_U32 i)
@@ -35,7 +35,7 @@
 
 /*****************************************************************************/
 
-sensors_vec_t  AccelSensor::dataBuffer;
+SensorRing AccelSensor::dataRing;
 int AccelSensor::mEnabled = 0;
 int64_t AccelSensor::delayms = 0;
 int AccelSensor::current_fullscale = 0;
@@ -43,15 +43,12 @@ int64_t AccelSensor::setDelayBuffer[numSensors] = {0};
 int64_t AccelSensor::writeDelayBuffer[numSensors] = {0};
 int AccelSensor::DecimationBuffer[numSensors] = {0};
 int AccelSensor::DecimationCount = 0;
-pthread_mutex_t AccelSensor::dataMutex;
 
 AccelSensor::AccelSensor()
 	: SensorBase(NULL, SENSOR_DATANAME_ACCELEROMETER),
 	mInputReader(6),
 	mHasPendingEvent(false)
 {
-	pthread_mutex_init(&dataMutex, NULL);
-
 	memset(mPendingEvents, 0, sizeof(mPendingEvents));
 
 	mPendingEvents[Acceleration].version = sizeof(sensors_event_t);
@@ -91,7 +88,6 @@ AccelSensor::~AccelSensor()
 	if (mEnabled) {
 		enable(SENSORS_ACCELEROMETER_HANDLE, 0, 0);
 	}
-	pthread_mutex_destroy(&dataMutex);
 }
 
 #if !defined(NOT_SET_ACC_INITIAL_STATE)
@@ -550,7 +546,7 @@ int AccelSensor::readEvents(sensors_event_t* data, int count)
 			{
 				sensors_vec_t sData;
 				memcpy(sData.v, data_rot, sizeof(data_rot));
-				setBufferData(&sData);
+				setBufferData(&sData, timestamp);
 			}
 
 #if (DEBUG_ACCELEROMETER == 1)
@@ -592,20 +588,19 @@ int AccelSensor::readEvents(sensors_event_t* data, int count)
 	return numEventReceived;
 }
 
-bool AccelSensor::setBufferData(sensors_vec_t *value)
+bool AccelSensor::setBufferData(sensors_vec_t *value, int64_t time)
 {
-	pthread_mutex_lock(&dataMutex);
-	memcpy(&dataBuffer, value, sizeof(sensors_vec_t));
-	pthread_mutex_unlock(&dataMutex);
+	dataRing.write(value, time);
 
 	return true;
 }
 
 bool AccelSensor::getBufferData(sensors_vec_t *lastBufferedValues)
 {
-	pthread_mutex_lock(&dataMutex);
-	memcpy(lastBufferedValues, &dataBuffer, sizeof(sensors_vec_t));
-	pthread_mutex_unlock(&dataMutex);
+	SensorSample sample;
+	bool ret = dataRing.getLatest(&sample);
+
+	*lastBufferedValues = sample.vec;
 
 #if (DEBUG_ACCELEROMETER == 1)
 	STLOGD("AccelSensor: getBufferData got values: x:(%f),y:(%f), z:(%f).",
@@ -613,7 +608,7 @@ bool AccelSensor::getBufferData(sensors_vec_t *lastBufferedValues)
 					lastBufferedValues->z);
 #endif
 
-	return true;
+	return ret;
 }
 
 #endif /* SENSORS_ACCELEROMETER_ENABLE */
@@ -30,6 +30,7 @@
 #include "sensors.h"
 #include "SensorBase.h"
 #include "InputEventReader.h"
+#include "SensorRing.h"
 
 #if defined(STORE_CALIB_ACCEL_ENABLED)
 #include "StoreCalibration.h"
@@ -71,15 +72,14 @@ class AccelSensor : public SensorBase {
 	int setInitialState();
 
 private:
-	static sensors_vec_t  dataBuffer;
+	static SensorRing dataRing;
 	static int64_t setDelayBuffer[numSensors];
 	static int64_t writeDelayBuffer[numSensors];
 	static int DecimationBuffer[numSensors];
 	static int DecimationCount;
-	virtual bool setBufferData(sensors_vec_t *value);
+	virtual bool setBufferData(sensors_vec_t *value, int64_t time);
 	float data_raw[3];
 	float data_rot[3];
-	static pthread_mutex_t dataMutex;
 	int64_t timestamp;
 #if defined(STORE_CALIB_ACCEL_ENABLED)
 	StoreCalibration *pStoreCalibration;
@@ -96,6 +96,7 @@ public:
 	virtual int setFullScale(int32_t handle, int value);
 	virtual int enable(int32_t handle, int enabled, int type);
 	static bool getBufferData(sensors_vec_t *lastBufferedValues);
+	static SensorRing* getDataRing() { return &dataRing; }
 	virtual int getWhatFromHandle(int32_t handle);
 };
 
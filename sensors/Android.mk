@@ -30,7 +30,7 @@ endef
 
 define all-cpp-source-files
        $(patsubst ./%,%, \
-               $(shell cd $(LOCAL_PATH); find . -name "*.cpp"))
+               $(shell cd $(LOCAL_PATH); find . -name "*.cpp" -not -path "./tests/*"))
 endef
 
 ENABLED_SENSORS := LSM330 \
@@ -33,7 +33,7 @@
 #define FETCH_FULL_EVENT_BEFORE_RETURN		0
 
 /*****************************************************************************/
-sensors_vec_t  GyroSensor::dataBuffer;
+SensorRing GyroSensor::dataRing;
 int GyroSensor::mEnabled = 0;
 int64_t GyroSensor::delayms = 0;
 int GyroSensor::startup_samples = DEFAULT_SAMPLES_TO_DISCARD;
@@ -44,7 +44,6 @@ int64_t GyroSensor::setDelayBuffer[numSensors] = {0};
 int64_t GyroSensor::writeDelayBuffer[numSensors] = {0};
 int GyroSensor::DecimationBuffer[numSensors] = {0};
 int GyroSensor::DecimationCount[numSensors] = {0};
-pthread_mutex_t GyroSensor::dataMutex;
 #if (SENSORS_ACCELEROMETER_ENABLE == 1) && (GYROSCOPE_GBIAS_ESTIMATION_STANDALONE == 1)
 AccelSensor* GyroSensor::acc = NULL;
 #endif
@@ -54,8 +53,6 @@ GyroSensor::GyroSensor()
 	mInputReader(6),
 	mHasPendingEvent(false)
 {
-	pthread_mutex_init(&dataMutex, NULL);
-
 #if (GYROSCOPE_GBIAS_ESTIMATION_FUSION == 0)
 	mPendingEvent[Gyro].version = sizeof(sensors_event_t);
 	mPendingEvent[Gyro].sensor = ID_GYROSCOPE;
@@ -98,7 +95,6 @@ GyroSensor::~GyroSensor()
 #if ((SENSORS_ACCELEROMETER_ENABLE == 1) && (GYROSCOPE_GBIAS_ESTIMATION_STANDALONE == 1))
 	acc->~AccelSensor();
 #endif
-	pthread_mutex_destroy(&dataMutex);
 }
 
 #if !defined(NOT_SET_GYRO_INITIAL_STATE)
@@ -509,7 +505,7 @@ int GyroSensor::readEvents(sensors_event_t* data, int count)
 				sData.x = data_rot[0] - gbias_out[0];
 				sData.y = data_rot[1] - gbias_out[1];
 				sData.z = data_rot[2] - gbias_out[2];
-				setBufferData(&sData);
+				setBufferData(&sData, timestamp);
 			}
 
 #if (DEBUG_GYROSCOPE == 1)
@@ -539,20 +535,19 @@ no_data:
 	return numEventReceived;
 }
 
-bool GyroSensor::setBufferData(sensors_vec_t *value)
+bool GyroSensor::setBufferData(sensors_vec_t *value, int64_t time)
 {
-	pthread_mutex_lock(&dataMutex);
-	memcpy(&dataBuffer, value, sizeof(sensors_vec_t));
-	pthread_mutex_unlock(&dataMutex);
+	dataRing.write(value, time);
 
 	return true;
 }
 
 bool GyroSensor::getBufferData(sensors_vec_t *lastBufferedValues)
 {
-	pthread_mutex_lock(&dataMutex);
-	memcpy(lastBufferedValues, &dataBuffer, sizeof(sensors_vec_t));
-	pthread_mutex_unlock(&dataMutex);
+	SensorSample sample;
+	bool ret = dataRing.getLatest(&sample);
+
+	*lastBufferedValues = sample.vec;
 
 #if (DEBUG_GYROSCOPE == 1)
 	STLOGD("GyroSensor: getBufferData got values: x:(%f),y:(%f), z:(%f).",
@@ -561,7 +556,7 @@ bool GyroSensor::getBufferData(sensors_vec_t *lastBufferedValues)
 						lastBufferedValues->z);
 #endif
 
-	return true;
+	return ret;
 }
 
 #endif /* SENSORS_GYROSCOPE_ENABLE */
@@ -30,6 +30,7 @@
 #include "sensors.h"
 #include "SensorBase.h"
 #include "InputEventReader.h"
+#include "SensorRing.h"
 #include "AccelSensor.h"
 
 #if defined(STORE_CALIB_GYRO_ENABLED)
@@ -66,16 +67,15 @@ class GyroSensor : public SensorBase
 private:
 	static int startup_samples;
 	static int samples_to_discard;
-	static sensors_vec_t  dataBuffer;
+	static SensorRing dataRing;
 	static int64_t setDelayBuffer[numSensors];
 	static int64_t writeDelayBuffer[numSensors];
 	static int DecimationBuffer[numSensors];
 	static int DecimationCount[numSensors];
-	virtual bool setBufferData(sensors_vec_t *value);
+	virtual bool setBufferData(sensors_vec_t *value, int64_t time);
 	static float gbias_out[3];
 	float data_raw[3];
 	float data_rot[3];
-	static pthread_mutex_t dataMutex;
 	int64_t timestamp;
 #if defined(STORE_CALIB_GYRO_ENABLED)
 	StoreCalibration *pStoreCalibration;
@@ -95,6 +95,7 @@ public:
 	virtual int setFullScale(int32_t handle, int value);
 	virtual int enable(int32_t handle, int enabled, int type);
 	static bool getBufferData(sensors_vec_t *lastBufferedValues);
+	static SensorRing* getDataRing() { return &dataRing; }
 	static void getGyroDelay(int64_t *Gyro_Delay_ms);
 	virtual int getWhatFromHandle(int32_t handle);
 };
@@ -22,8 +22,7 @@
 
 #include "MagnSensor.h"
 
-sensors_vec_t  MagnSensor::dataBuffer;
-pthread_mutex_t MagnSensor::dataMutex;
+SensorRing MagnSensor::dataRing;
 
 MagnSensor::MagnSensor()
 	: SensorBase(NULL, SENSOR_DATANAME_MAGNETIC),
@@ -32,7 +31,6 @@ MagnSensor::MagnSensor()
 {
 	ALOGV("MagnSensor: Initializing...");
 
-	pthread_mutex_init(&dataMutex, NULL);
 	mEnabled = false;
 	mPendingEvent.version = sizeof(sensors_event_t);
 	mPendingEvent.sensor = ID_MAGNETIC_FIELD;
@@ -143,6 +141,7 @@ int MagnSensor::readEvents(sensors_event_t* data, int count)
 		else
 			if (event->type == EV_SYN) {
 				mPendingEvent.timestamp = timevalToNano(event->time);
+				setBufferData(&mPendingEvent.magnetic, mPendingEvent.timestamp);
 				if (mEnabled) {
 					*data++ = mPendingEvent;
 					count--;
@@ -158,25 +157,24 @@ int MagnSensor::readEvents(sensors_event_t* data, int count)
     return numEventReceived;
 }
 
-bool MagnSensor::setBufferData(sensors_vec_t *value)
+bool MagnSensor::setBufferData(sensors_vec_t *value, int64_t time)
 {
-	pthread_mutex_lock(&dataMutex);
-	memcpy(&dataBuffer, value, sizeof(sensors_vec_t));
-	pthread_mutex_unlock(&dataMutex);
+	dataRing.write(value, time);
 
 	return true;
 }
 
 bool MagnSensor::getBufferData(sensors_vec_t *lastBufferedValues)
 {
-	pthread_mutex_lock(&dataMutex);
-	memcpy(lastBufferedValues, &dataBuffer, sizeof(sensors_vec_t));
-	pthread_mutex_unlock(&dataMutex);
+	SensorSample sample;
+	bool ret = dataRing.getLatest(&sample);
+
+	*lastBufferedValues = sample.vec;
 
 	ALOGV("MagnSensor: getBufferData got values: x:(%f),y:(%f), z:(%f).",
 						lastBufferedValues->x,
 						lastBufferedValues->y,
 						lastBufferedValues->z);
 
-	return true;
+	return ret;
 }
@@ -22,6 +22,7 @@
 #include "sensors.h"
 #include "SensorBase.h"
 #include "InputEventReader.h"
+#include "SensorRing.h"
 
 struct input_event;
 
@@ -30,13 +31,12 @@ class MagnSensor : public SensorBase {
 private:
 	bool mEnabled;
 	bool mHasPendingEvent;
-	static sensors_vec_t dataBuffer;
-	static pthread_mutex_t dataMutex;
+	static SensorRing dataRing;
 	InputEventCircularReader mInputReader;
 	sensors_event_t mPendingEvent;
 	uint32_t mPendingEventsMask;
 	int mPendingEventsFlushCount;
-	virtual bool setBufferData(sensors_vec_t *value);
+	virtual bool setBufferData(sensors_vec_t *value, int64_t time);
 
 public:
 	MagnSensor();
@@ -47,6 +47,7 @@ public:
 	virtual int getWhatFromHandle(int32_t handle);
 	virtual int readEvents(sensors_event_t* data, int count);
 	static bool getBufferData(sensors_vec_t *lastBufferedValues);
+	static SensorRing* getDataRing() { return &dataRing; }
 };
 
 #endif  // ANDROID_COMPORI_SENSOR_H
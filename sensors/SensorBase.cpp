@@ -28,6 +28,7 @@
 #include <string.h>
 #include <linux/ioctl.h>
 #include <linux/rtc.h>
+#include <sys/file.h>
 #include <utils/Atomic.h>
 
 #include "SensorBase.h"
@@ -36,6 +37,8 @@
 
 /*****************************************************************************/
 
+int SensorBase::eventClock = SYSTEM_TIME_REALTIME;
+
 SensorBase::SensorBase(const char* dev_name, const char* data_name)
 	: dev_name(dev_name), data_name(data_name),
 	dev_fd(-1), data_fd(-1)
@@ -93,11 +96,87 @@ bool SensorBase::hasPendingEvents() const
 int SensorBase::openInput(const char* inputDeviceName)
 {
 	int fd = -1;
+#if (SENSORS_REPLAY_ENABLE == 1)
+	fd = openReplayInput(inputDeviceName);
+	if (fd >= 0) {
+		sysfs_device_path_len = strlen(sysfs_device_path);
+		return fd;
+	}
+#endif
 	fd = getSysfsDevicePath(sysfs_device_path, inputDeviceName);
 	sysfs_device_path_len = strlen(sysfs_device_path);
+	if (fd >= 0)
+		setEventClock(fd);
 	return fd;
 }
 
+/*
+ * evdev stamps events with CLOCK_REALTIME unless told otherwise, while sensor
+ * timestamps must follow elapsedRealtime. Kernels that can't stamp evdev
+ * events with CLOCK_BOOTTIME get CLOCK_MONOTONIC, which only drifts from it
+ * across a suspend.
+ */
+void SensorBase::setEventClock(int fd)
+{
+#if defined(EVIOCSCLOCKID)
+	int clock = CLOCK_BOOTTIME;
+
+	if (!ioctl(fd, EVIOCSCLOCKID, &clock)) {
+		eventClock = SYSTEM_TIME_BOOTTIME;
+		return;
+	}
+
+	clock = CLOCK_MONOTONIC;
+	if (!ioctl(fd, EVIOCSCLOCKID, &clock)) {
+		eventClock = SYSTEM_TIME_MONOTONIC;
+		return;
+	}
+#endif
+	STLOGE("SensorBase: couldn't set the event clock of %s, timestamps are CLOCK_REALTIME",
+						data_name);
+}
+
+#if (SENSORS_REPLAY_ENABLE == 1)
+/*
+ * Several drivers may read the same input device (the fusion reads the
+ * gyroscope too), evdev hands each of them a copy of the events but a FIFO
+ * would split them. So the first reader of a device gets <name>, the next
+ * one <name>.1 and so on; an flock() marks the entries already taken.
+ */
+int SensorBase::openReplayInput(const char* inputDeviceName)
+{
+	char path[PATH_MAX];
+	int fd = -1;
+
+	for (int i = 0; i < 4 && fd < 0; i++) {
+		if (i)
+			snprintf(path, sizeof(path), "%s/%s.%d", SENSORS_REPLAY_PATH, inputDeviceName, i);
+		else
+			snprintf(path, sizeof(path), "%s/%s", SENSORS_REPLAY_PATH, inputDeviceName);
+
+		/* read-write so a FIFO doesn't report POLLHUP while the player is away */
+		fd = open(path, O_RDWR | O_NONBLOCK);
+		if (fd < 0)
+			break;
+
+		if (flock(fd, LOCK_EX | LOCK_NB) < 0) {
+			close(fd);
+			fd = -1;
+		}
+	}
+
+	if (fd < 0)
+		return -1;
+
+	snprintf(sysfs_device_path, sizeof(sysfs_device_path), "%s/%s.sysfs/",
+						SENSORS_REPLAY_PATH, inputDeviceName);
+	/* the player stamps the recorded events as it writes them */
+	eventClock = SYSTEM_TIME_BOOTTIME;
+	STLOGI("inputDeviceName = %s replayed from %s", inputDeviceName, path);
+
+	return fd;
+}
+#endif
 
 int SensorBase::getSysfsDevicePath(char* sysfs_path, const char* inputDeviceName)
 {
@@ -329,14 +408,6 @@ int SensorBase::writeSysfsCommand(int32_t handle, const char *sysfsFilename, con
  * These function are here reported to be consistent with the
  * timestamp check used into CTS tests.
  */
-enum {
-	SYSTEM_TIME_REALTIME = 0,  // system-wide realtime clock
-	SYSTEM_TIME_MONOTONIC = 1, // monotonic time since unspecified starting point
-	SYSTEM_TIME_PROCESS = 2,   // high-resolution per-process clock
-	SYSTEM_TIME_THREAD = 3,    // high-resolution per-thread clock
-	SYSTEM_TIME_BOOTTIME = 4   // same as SYSTEM_TIME_MONOTONIC, but including CPU suspend time
-};
-
 int64_t systemTime(int clock)
 {
 	static const clockid_t clocks[] = {
@@ -24,6 +24,8 @@
 #include <sys/cdefs.h>
 #include <sys/types.h>
 
+#include "configuration.h"
+
 #define DELAY_OFF		(-1000000)
 #define MSEC_TO_SEC(x)		((x) / 1000)
 #define NSEC_TO_MSEC(x)		((x) / 1000000)
@@ -34,6 +36,17 @@
 
 struct sensors_event_t;
 
+enum {
+	SYSTEM_TIME_REALTIME = 0,  // system-wide realtime clock
+	SYSTEM_TIME_MONOTONIC = 1, // monotonic time since unspecified starting point
+	SYSTEM_TIME_PROCESS = 2,   // high-resolution per-process clock
+	SYSTEM_TIME_THREAD = 3,    // high-resolution per-thread clock
+	SYSTEM_TIME_BOOTTIME = 4   // same as SYSTEM_TIME_MONOTONIC, but including CPU suspend time
+};
+
+/* nanoseconds of the given SYSTEM_TIME_* clock, as libutils systemTime() */
+int64_t systemTime(int clock);
+
 class SensorBase {
 
 protected:
@@ -44,7 +57,13 @@ protected:
 	int dev_fd;
 	int data_fd;
 
+	static int eventClock;
+
 	int openInput(const char* inputDeviceName);
+	void setEventClock(int fd);
+#if (SENSORS_REPLAY_ENABLE == 1)
+	int openReplayInput(const char* inputDeviceName);
+#endif
 
 
 	static int64_t timevalToNano(timeval const& t) {
@@ -62,6 +81,8 @@ public:
 	virtual int readEvents(sensors_event_t* data, int count) = 0;
 	virtual bool hasPendingEvents() const;
 	virtual int getFd() const;
+	/* SYSTEM_TIME_* clock the input event timestamps are taken from */
+	static int getEventClock() { return eventClock; }
 	virtual int setDelay(int32_t handle, int64_t ns);
 	virtual int enable(int32_t handle, int enabled, int type) = 0;
 	virtual int writeFullScale(int32_t handle, int value);
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2008 The Android Open Source Project
+ * Copyright (C) 2016 Kostyan_nsk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <cutils/log.h>
+
+#include "configuration.h"
+#include "SensorBase.h"
+#include "SensorFifo.h"
+
+/*****************************************************************************/
+
+SensorFifo::SensorFifo(int size)
+	: mBuffer(new sensors_event_t[size]),
+	mSize(size),
+	mWatermark(size - size / 4),
+	mHead(0),
+	mCount(0),
+	mMaxLatency(0),
+	mDeadline(0),
+	mDue(false),
+	mBatched(0),
+	mDropped(0),
+	mMaxDepth(0)
+{
+}
+
+SensorFifo::~SensorFifo()
+{
+	delete [] mBuffer;
+}
+
+void SensorFifo::setMaxLatency(int64_t ns)
+{
+	int64_t oldLatency = mMaxLatency;
+
+	mMaxLatency = ns > 0 ? ns : 0;
+
+	/* shorter latency, or batching switched off: hand out what we hold sooner */
+	if (mCount) {
+		if (!mMaxLatency)
+			mDue = true;
+		else if (mMaxLatency < oldLatency)
+			mDeadline -= oldLatency - mMaxLatency;
+	}
+}
+
+/*
+ * Drops the oldest sample to make room, flush complete events are kept.
+ * Returns false if the FIFO holds nothing but those.
+ */
+bool SensorFifo::dropOldestSample()
+{
+	int i;
+
+	for (i = 0; i < mCount; i++)
+		if (mBuffer[(mHead + i) % mSize].type != SENSOR_TYPE_META_DATA)
+			break;
+	if (i == mCount)
+		return false;
+
+	/* the meta events in front of it move up by one */
+	for (; i > 0; i--)
+		mBuffer[(mHead + i) % mSize] = mBuffer[(mHead + i - 1) % mSize];
+	mHead = (mHead + 1) % mSize;
+	mCount--;
+	mDropped++;
+
+	return true;
+}
+
+bool SensorFifo::push(const sensors_event_t* event, int64_t now)
+{
+	if (mCount == mSize && !dropOldestSample()) {
+		/* full of flush complete events, a sample can go, those can't */
+		if (event->type == SENSOR_TYPE_META_DATA)
+			return false;
+		mDropped++;
+		return true;
+	}
+
+	if (!mCount)
+		mDeadline = now + mMaxLatency;
+
+	mBuffer[(mHead + mCount) % mSize] = *event;
+	mCount++;
+	mBatched++;
+
+	if (mCount > mMaxDepth)
+		mMaxDepth = mCount;
+
+	if (mCount >= mWatermark)
+		mDue = true;
+
+	return true;
+}
+
+bool SensorFifo::isDue(int64_t now) const
+{
+	if (!mCount)
+		return false;
+
+	return mDue || now >= mDeadline;
+}
+
+int SensorFifo::pop(sensors_event_t* data, int count)
+{
+	int n = 0;
+
+	while (n < count && mCount) {
+		data[n++] = mBuffer[mHead];
+		mHead = (mHead + 1) % mSize;
+		mCount--;
+	}
+
+	if (!mCount)
+		mDue = false;
+
+	return n;
+}
+
+void SensorFifo::clear()
+{
+	mHead = 0;
+	mCount = 0;
+	mDue = false;
+}
+
+void SensorFifo::dumpStats(int handle) const
+{
+	STLOGI("SensorFifo: handle %d latency %lld [ms]: %u events batched, max depth %d/%d, %u dropped",
+			handle, NSEC_TO_MSEC(mMaxLatency), mBatched, mMaxDepth, mSize, mDropped);
+}
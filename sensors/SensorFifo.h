@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2008 The Android Open Source Project
+ * Copyright (C) 2016 Kostyan_nsk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_SENSOR_FIFO_H
+#define ANDROID_SENSOR_FIFO_H
+
+#include <stdint.h>
+#include <sys/cdefs.h>
+#include <sys/types.h>
+
+#include "sensors.h"
+
+/*****************************************************************************/
+
+/*
+ * Software replacement for a hardware batching FIFO: events of one sensor
+ * handle are held back until the oldest of them has waited max_report_latency,
+ * the FIFO reaches its watermark or the framework asks for a flush.
+ */
+class SensorFifo
+{
+	sensors_event_t* const mBuffer;
+	const int mSize;
+	const int mWatermark;
+	int mHead;
+	int mCount;
+	int64_t mMaxLatency;
+	int64_t mDeadline;
+	bool mDue;
+
+	/* statistics */
+	uint32_t mBatched;
+	uint32_t mDropped;
+	int mMaxDepth;
+
+	bool dropOldestSample();
+
+public:
+	SensorFifo(int size);
+	~SensorFifo();
+
+	void setMaxLatency(int64_t ns);
+	int64_t getMaxLatency() const { return mMaxLatency; }
+	bool isBatching() const { return mMaxLatency > 0; }
+	bool isEmpty() const { return mCount == 0; }
+
+	/* false if the event could not be queued */
+	bool push(const sensors_event_t* event, int64_t now);
+	void setDue() { mDue = mCount > 0; }
+	bool isDue(int64_t now) const;
+	int64_t getDeadline() const { return mCount ? mDeadline : -1; }
+	int pop(sensors_event_t* data, int count);
+	void clear();
+
+	void dumpStats(int handle) const;
+};
+
+/*****************************************************************************/
+
+#endif  // ANDROID_SENSOR_FIFO_H
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2008 The Android Open Source Project
+ * Copyright (C) 2016 Kostyan_nsk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <cutils/atomic.h>
+#include <cutils/log.h>
+
+#include "configuration.h"
+#include "SensorBase.h"
+#include "SensorRing.h"
+
+#if (SENSOR_RING_SIZE & (SENSOR_RING_SIZE - 1))
+#error "SENSOR_RING_SIZE must be a power of two"
+#endif
+
+#define RING_SLOT(i)	((i) & (SENSOR_RING_SIZE - 1))
+
+/*****************************************************************************/
+
+SensorRing::SensorRing()
+	: mWritten(0),
+	mRead(0),
+	mConsumed(0),
+	mLost(0)
+{
+	memset(mSamples, 0, sizeof(mSamples));
+}
+
+void SensorRing::write(const sensors_vec_t* vec, int64_t timestamp)
+{
+	int32_t w = mWritten;
+	SensorSample* s = &mSamples[RING_SLOT(w)];
+
+	s->vec = *vec;
+	s->timestamp = timestamp;
+
+	/* make the sample visible before the index that covers it */
+	android_atomic_release_store(w + 1, &mWritten);
+}
+
+/*
+ * Copy sample 'index' out of the ring. The writer may have started reusing
+ * its slot meanwhile, in that case the copy can be torn and is rejected.
+ */
+bool SensorRing::copy(int32_t index, SensorSample* sample) const
+{
+	*sample = mSamples[RING_SLOT(index)];
+
+	/* the copy above must complete before the index is read again */
+	__sync_synchronize();
+
+	return (uint32_t)(mWritten - index) < SENSOR_RING_SIZE;
+}
+
+bool SensorRing::getLatest(SensorSample* sample) const
+{
+	int32_t w;
+
+	do {
+		w = android_atomic_acquire_load(&mWritten);
+		if (!w) {
+			/* nothing published yet, read as a zero sample */
+			memset(sample, 0, sizeof(*sample));
+			return false;
+		}
+	} while (!copy(w - 1, sample));
+
+	return true;
+}
+
+bool SensorRing::peek(SensorSample* sample)
+{
+	for (;;) {
+		int32_t w = android_atomic_acquire_load(&mWritten);
+		uint32_t pending = (uint32_t)(w - mRead);
+
+		if (!pending)
+			return false;
+
+		/* keep clear of the slot the writer fills next */
+		if (pending >= SENSOR_RING_SIZE) {
+			mLost += pending - (SENSOR_RING_SIZE - 1);
+			mRead = w - (SENSOR_RING_SIZE - 1);
+		}
+
+		if (copy(mRead, sample))
+			return true;
+	}
+}
+
+void SensorRing::next()
+{
+	mRead++;
+	mConsumed++;
+}
+
+void SensorRing::discard()
+{
+	mRead = android_atomic_acquire_load(&mWritten);
+}
+
+void SensorRing::dumpStats(const char* name)
+{
+	STLOGI("SensorRing: %s: %u samples consumed, %u lost", name, mConsumed, mLost);
+	mConsumed = 0;
+	mLost = 0;
+}
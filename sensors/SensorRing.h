@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2008 The Android Open Source Project
+ * Copyright (C) 2016 Kostyan_nsk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_SENSOR_RING_H
+#define ANDROID_SENSOR_RING_H
+
+#include <stdint.h>
+#include <sys/cdefs.h>
+#include <sys/types.h>
+
+#include "sensors.h"
+
+/*****************************************************************************/
+
+struct SensorSample {
+	sensors_vec_t vec;
+	int64_t timestamp;
+};
+
+/*
+ * Hands the samples of a raw sensor driver over to the fusion engine without
+ * locking. There is a single writer and a single consuming reader; the writer
+ * never waits, so when the reader falls more than SENSOR_RING_SIZE samples
+ * behind the oldest ones are overwritten and counted as lost on the next read.
+ * getLatest() can be used by any number of other readers.
+ */
+class SensorRing
+{
+	SensorSample mSamples[SENSOR_RING_SIZE];
+	volatile int32_t mWritten;	/* samples published, writer owned */
+	int32_t mRead;			/* samples consumed, reader owned */
+
+	/* statistics, reader owned */
+	uint32_t mConsumed;
+	uint32_t mLost;
+
+	bool copy(int32_t index, SensorSample* sample) const;
+
+public:
+	SensorRing();
+
+	void write(const sensors_vec_t* vec, int64_t timestamp);
+
+	bool getLatest(SensorSample* sample) const;
+	bool peek(SensorSample* sample);
+	void next();
+	void discard();
+
+	uint32_t getConsumed() const { return mConsumed; }
+	uint32_t getLost() const { return mLost; }
+	void dumpStats(const char* name);
+};
+
+/*****************************************************************************/
+
+#endif  // ANDROID_SENSOR_RING_H
@@ -114,6 +114,8 @@
 #define DEBUG_SIGN_M				(0)
 #define DEBUG_POLL_RATE				(0)
 #define DEBUG_ACTIVITY_RECO			(0)
+#define DEBUG_BATCHING				(0)
+#define DEBUG_POLL_STATS			(0)
 
 #define STLOGI(...)				ALOGI(__VA_ARGS__)
 #define STLOGE(...)				ALOGE(__VA_ARGS__)
@@ -121,6 +123,30 @@
 #define STLOGD_IF(...)				ALOGD_IF(__VA_ARGS__)
 #define STLOGE_IF(...)				ALOGE_IF(__VA_ARGS__)
 
+/*
+ * Read every input device from SENSORS_REPLAY_PATH/<device name>, a FIFO a
+ * player feeds with recorded struct input_event at the recorded pace, instead
+ * of /dev/input. The player stamps each event with CLOCK_BOOTTIME as it
+ * writes it. The sysfs attributes of such a device are looked up in
+ * SENSORS_REPLAY_PATH/<device name>.sysfs/ (see tests/sensors_replay.cpp)
+ */
+#if !defined(SENSORS_REPLAY_ENABLE)
+#define SENSORS_REPLAY_ENABLE			(0)
+#endif
+#if !defined(SENSORS_REPLAY_PATH)
+#define SENSORS_REPLAY_PATH			"/data/misc/sensors/replay"
+#endif
+
+/* Events held per sensor handle by the software batching FIFO */
+#if !defined(SENSORS_FIFO_MAX_EVENTS)
+#define SENSORS_FIFO_MAX_EVENTS			1000
+#endif
+
+/* Samples held per raw sensor for the fusion engine (power of two) */
+#if !defined(SENSOR_RING_SIZE)
+#define SENSOR_RING_SIZE			64
+#endif
+
 #if !defined(ACCEL_MIN_ODR)
 #define ACCEL_MIN_ODR				1
 #endif
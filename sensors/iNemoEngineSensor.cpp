@@ -72,6 +72,17 @@ int64_t timespecDiff(struct timespec *timeA_p, struct timespec *timeB_p)
 	return (int64_t)timeDiff;
 }
 
+/* Consume the samples of 'ring' up to 'time', keeping the newest of them */
+static void alignSample(SensorRing *ring, int64_t time, sensors_vec_t *vec)
+{
+	SensorSample sample;
+
+	while (ring->peek(&sample) && sample.timestamp <= time) {
+		*vec = sample.vec;
+		ring->next();
+	}
+}
+
 iNemoEngineSensor::iNemoEngineSensor()
 #if (!SENSORS_GYROSCOPE_ENABLE && SENSORS_VIRTUAL_GYROSCOPE_ENABLE)
         : SensorBase(NULL, SENSOR_DATANAME_ACCELEROMETER),
@@ -84,6 +95,7 @@ iNemoEngineSensor::iNemoEngineSensor()
 {
 	memset(mPendingEvents, 0, sizeof(mPendingEvents));
 	memset(mSensorsBufferedVectors, 0, sizeof(sensors_vec_t) * 3);
+	mFusionTimestamp = 0;
 	memset(DecimationCount, 0, sizeof(DecimationCount));
 
 #if (SENSORS_ORIENTATION_ENABLE == 1)
@@ -285,6 +297,7 @@ int iNemoEngineSensor::enable(int32_t handle, int en, int  __attribute__((unused
 		int tmp = mEnabled;
 		mEnabled &= ~(1<<what);
 		if((mEnabled == 0)&&(tmp != 0)) {
+			dumpSampleRings();
 #if (SENSORS_GYROSCOPE_ENABLE == 1)
 			iNemoEngineSensor::gyr->setFullScale(SENSORS_SENSOR_FUSION_HANDLE, GYRO_DEFAULT_RANGE);
 			iNemoEngineSensor::gyr->enable(SENSORS_SENSOR_FUSION_HANDLE, 0, 1);
@@ -341,6 +354,7 @@ int iNemoEngineSensor::enable(int32_t handle, int en, int  __attribute__((unused
 	if (enabled) {
 		enabled = 0;
 		setInitialState();
+		resetSampleRings();
 		clock_gettime(CLOCK_MONOTONIC, &old_time);
 	}
 
@@ -443,6 +457,120 @@ void iNemoEngineSensor::updateDecimations(int64_t delayms)
 #endif
 }
 
+void iNemoEngineSensor::feedFusion(iNemoSensorsData *sdata, int64_t timeElapsed)
+{
+	/** Copy accelerometer data [m/s^2] */
+	memcpy(sdata->accel, mSensorsBufferedVectors[Acceleration].v, sizeof(float) * 3);
+
+	/** Copy magnetometer data [uT] */
+	memcpy(sdata->magn, mSensorsBufferedVectors[MagneticField].v, sizeof(float) * 3);
+
+	/** Copy gyroscope data [rad/sec] */
+	memcpy(sdata->gyro, mSensorsBufferedVectors[AngularSpeed].v, sizeof(float) * 3);
+
+#if (DEBUG_INEMO_SENSOR == 1)
+	STLOGD("Acc_x=%f [m/s^2], Acc_y=%f [m/s^2], Acc_z=%f [m/s^2]", sdata->accel[0], sdata->accel[1], sdata->accel[2]);
+	STLOGD("Mag_x=%f [uT], Mag_y=%f [uT], Mag_z=%f [uT]", sdata->magn[0], sdata->magn[1], sdata->magn[2]);
+	STLOGD("Gyr_x=%f [rad/sec], Gyr_y=%f [rad/sec], Gyr_z=%f [rad/sec]", sdata->gyro[0], sdata->gyro[1], sdata->gyro[2]);
+#endif
+	if ((timeElapsed <= 0) || (timeElapsed > (3 * MSEC_TO_NSEC(GYR_DEFAULT_DELAY))))
+		timeElapsed = MSEC_TO_NSEC(GYR_DEFAULT_DELAY);
+
+	iNemoEngine_API_Run(timeElapsed, sdata);
+}
+
+/*
+ * Run the fusion once for every gyroscope sample queued since the last call,
+ * together with the accelerometer and magnetometer samples taken up to it and
+ * the interval between the sample timestamps. Returns the number of runs, 0
+ * when the gyroscope has not queued a new sample since the previous call.
+ * Only while the gyroscope has not fed the ring at all since the fusion was
+ * (re)started are the latest buffered vectors used, with the time elapsed
+ * since the previous run.
+ */
+int iNemoEngineSensor::runFusion(iNemoSensorsData *sdata, int64_t *timeElapsed)
+{
+	int runs = 0;
+
+#if (SENSORS_GYROSCOPE_ENABLE == 1)
+	SensorRing *gyroRing = GyroSensor::getDataRing();
+	SensorSample gyro;
+	uint32_t lost = gyroRing->getLost();
+
+	while (gyroRing->peek(&gyro)) {
+		gyroRing->next();
+
+#if (SENSORS_ACCELEROMETER_ENABLE == 1)
+		alignSample(AccelSensor::getDataRing(), gyro.timestamp,
+					&mSensorsBufferedVectors[Acceleration]);
+#endif
+#if (SENSORS_MAGNETIC_FIELD_ENABLE == 1)
+		alignSample(MagnSensor::getDataRing(), gyro.timestamp,
+					&mSensorsBufferedVectors[MagneticField]);
+#endif
+		mSensorsBufferedVectors[AngularSpeed] = gyro.vec;
+
+		*timeElapsed = mFusionTimestamp ? gyro.timestamp - mFusionTimestamp : 0;
+		mFusionTimestamp = gyro.timestamp;
+
+		feedFusion(sdata, *timeElapsed);
+		runs++;
+	}
+
+	/* the integration skipped these gyroscope intervals */
+	if (gyroRing->getLost() > lost)
+		STLOGE("iNemoEngineSensor: %u gyroscope samples lost before fusion",
+				gyroRing->getLost() - lost);
+#endif
+
+	clock_gettime(CLOCK_MONOTONIC, &new_time);
+	if (!runs && !mFusionTimestamp) {
+#if (SENSORS_ACCELEROMETER_ENABLE == 1)
+		AccelSensor::getBufferData(&mSensorsBufferedVectors[Acceleration]);
+#endif
+#if (SENSORS_GYROSCOPE_ENABLE == 1)
+		GyroSensor::getBufferData(&mSensorsBufferedVectors[AngularSpeed]);
+#endif
+#if (SENSORS_MAGNETIC_FIELD_ENABLE == 1)
+		MagnSensor::getBufferData(&mSensorsBufferedVectors[MagneticField]);
+#endif
+		*timeElapsed = timespecDiff(&new_time, &old_time);
+		feedFusion(sdata, *timeElapsed);
+		runs++;
+	}
+	old_time = new_time;
+
+	return runs;
+}
+
+/* Drop what the raw drivers queued while the fusion wasn't consuming */
+void iNemoEngineSensor::resetSampleRings()
+{
+#if (SENSORS_ACCELEROMETER_ENABLE == 1)
+	AccelSensor::getDataRing()->discard();
+#endif
+#if (SENSORS_GYROSCOPE_ENABLE == 1)
+	GyroSensor::getDataRing()->discard();
+#endif
+#if (SENSORS_MAGNETIC_FIELD_ENABLE == 1)
+	MagnSensor::getDataRing()->discard();
+#endif
+	mFusionTimestamp = 0;
+}
+
+void iNemoEngineSensor::dumpSampleRings()
+{
+#if (SENSORS_ACCELEROMETER_ENABLE == 1)
+	AccelSensor::getDataRing()->dumpStats("accelerometer");
+#endif
+#if (SENSORS_GYROSCOPE_ENABLE == 1)
+	GyroSensor::getDataRing()->dumpStats("gyroscope");
+#endif
+#if (SENSORS_MAGNETIC_FIELD_ENABLE == 1)
+	MagnSensor::getDataRing()->dumpStats("magnetometer");
+#endif
+}
+
 int iNemoEngineSensor::readEvents(sensors_event_t *data, int count)
 {
 	static int cont = 0;
@@ -494,6 +622,7 @@ int iNemoEngineSensor::readEvents(sensors_event_t *data, int count)
 #if (DEBUG_INEMO_SENSOR == 1)
 				STLOGD("iNemo::Start-up samples = %d", startup_samples);
 #endif
+				resetSampleRings();
 				goto no_data;
 			}
 #if !(defined(GYRO_EVENT_HAS_TIMESTAMP) || defined(ACC_EVENT_HAS_TIMESTAMP))
@@ -510,15 +639,7 @@ int iNemoEngineSensor::readEvents(sensors_event_t *data, int count)
 		gyroDelay_ms = newGyroDelay_ms;
 	}
 
-#if (SENSORS_ACCELEROMETER_ENABLE == 1)
-			AccelSensor::getBufferData(&mSensorsBufferedVectors[Acceleration]);
-#endif
-#if (SENSORS_GYROSCOPE_ENABLE == 1)
-			GyroSensor::getBufferData(&mSensorsBufferedVectors[AngularSpeed]);
-#endif
-#if (SENSORS_MAGNETIC_FIELD_ENABLE == 1)
-			MagnSensor::getBufferData(&mSensorsBufferedVectors[MagneticField]);
-#else
+#if (SENSORS_MAGNETIC_FIELD_ENABLE == 0)
 			/* Constant Magnetometer module is passed to the Library when Mag is disabled */
 			mSensorsBufferedVectors[MagneticField].v[0] = 0.0f;
 			mSensorsBufferedVectors[MagneticField].v[1] = 0.7f;
@@ -529,27 +650,8 @@ int iNemoEngineSensor::readEvents(sensors_event_t *data, int count)
 					(1<<LinearAcceleration) | (1<<GameRotation) |
 					(1<<UncalibGyro) | (1<<RotationMatrix) |
 					(1<<CalibGyro))) {
-				/** Copy accelerometer data [m/s^2] */
-				memcpy(sdata.accel, mSensorsBufferedVectors[Acceleration].v, sizeof(float) * 3);
-
-				/** Copy magnetometer data [uT] */
-				memcpy(sdata.magn, mSensorsBufferedVectors[MagneticField].v, sizeof(float) * 3);
-
-				/** Copy gyroscope data [rad/sec] */
-				memcpy(sdata.gyro, mSensorsBufferedVectors[AngularSpeed].v, sizeof(float) * 3);
-
-#if (DEBUG_INEMO_SENSOR == 1)
-				STLOGD("Acc_x=%f [m/s^2], Acc_y=%f [m/s^2], Acc_z=%f [m/s^2]", sdata.accel[0], sdata.accel[1], sdata.accel[2]);
-				STLOGD("Mag_x=%f [uT], Mag_y=%f [uT], Mag_z=%f [uT]", sdata.magn[0], sdata.magn[1], sdata.magn[2]);
-				STLOGD("Gyr_x=%f [rad/sec], Gyr_y=%f [rad/sec], Gyr_z=%f [rad/sec]", sdata.gyro[0], sdata.gyro[1], sdata.gyro[2]);
-#endif
-				clock_gettime(CLOCK_MONOTONIC, &new_time);
-				timeElapsed = timespecDiff(&new_time, &old_time);
-				if (timeElapsed > (3 * MSEC_TO_NSEC(GYR_DEFAULT_DELAY)))
-					timeElapsed = MSEC_TO_NSEC(GYR_DEFAULT_DELAY);
-
-				iNemoEngine_API_Run(timeElapsed, &sdata);
-				old_time = new_time;
+				if (!runFusion(&sdata, &timeElapsed))
+					goto no_data;
 #if (SENSORS_ORIENTATION_ENABLE == 1)
 				DecimationCount[Orientation]++;
 				if(mEnabled & (1<<Orientation) && (DecimationCount[Orientation] >= DecimationBuffer[Orientation])) {
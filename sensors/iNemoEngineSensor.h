@@ -103,6 +103,12 @@ private:
 	static int DecimationCount[numSensors];
 
 	int64_t timestamp;
+	int64_t mFusionTimestamp;
+
+	void feedFusion(iNemoSensorsData *sdata, int64_t timeElapsed);
+	int runFusion(iNemoSensorsData *sdata, int64_t *timeElapsed);
+	void resetSampleRings();
+	void dumpSampleRings();
 
 public:
 	iNemoEngineSensor();
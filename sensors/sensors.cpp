@@ -52,6 +52,9 @@
 #if (SENSORS_PROXIMITY_ENABLE == 1)
 #include "ProximitySensor.h"
 #endif
+#if (ANDROID_VERSION >= ANDROID_JBMR2)
+#include "SensorFifo.h"
+#endif
 
 
 /*****************************************************************************/
@@ -61,6 +64,8 @@
 #define LIGHT_SENSOR_POLLTIME		2000000000
 #define FREQUENCY_TO_USECONDS(x)		(1000000 / x)
 
+#define BATCH_STATS_PERIOD_NS		SEC_TO_NSEC(10LL)
+
 /*****************************************************************************/
 
 /* The SENSORS Module */
@@ -128,7 +133,7 @@ static const struct sensor_t sSensorList[] = {
 		FREQUENCY_TO_USECONDS(ACCEL_MAX_ODR),
 #if (ANDROID_VERSION >= ANDROID_KK)
 		0,
-		0,
+		SENSORS_FIFO_MAX_EVENTS,
 #if (ANDROID_VERSION >= ANDROID_L)
 		SENSOR_STRING_TYPE_ACCELEROMETER,
 		"",
@@ -153,7 +158,7 @@ static const struct sensor_t sSensorList[] = {
 		10000,
 #if (ANDROID_VERSION >= ANDROID_KK)
 		0,
-		0,
+		SENSORS_FIFO_MAX_EVENTS,
 #if (ANDROID_VERSION >= ANDROID_L)
 		SENSOR_STRING_TYPE_MAGNETIC_FIELD,
 		"",
@@ -178,7 +183,7 @@ static const struct sensor_t sSensorList[] = {
 		FREQUENCY_TO_USECONDS(GYRO_MAX_ODR),
 #if (ANDROID_VERSION >= ANDROID_KK)
 		0,
-		0,
+		SENSORS_FIFO_MAX_EVENTS,
 #if (ANDROID_VERSION >= ANDROID_L)
 		SENSOR_STRING_TYPE_GYROSCOPE,
 		"",
@@ -467,6 +472,35 @@ private:
 #if (ANDROID_VERSION >= ANDROID_JBMR2)
 	static const size_t flushFD = numFds - 1;
 	int mWriteFlushPipe;
+
+	/* software batching, indexed by handle - ID_BASE */
+	SensorFifo* mFifos[ID_COUNT];
+	pthread_mutex_t mBatchLock;
+	uint32_t mWakeups;
+	uint32_t mWakeupEvents;
+	int64_t mStatsStart;
+#if (DEBUG_POLL_STATS == 1)
+	int64_t mCpuStart;
+	int64_t mLatencySum;
+	int64_t mLatencyMax;
+	uint32_t mLatencyEvents;
+#endif
+
+	SensorFifo* fifoFor(int handle) const
+	{
+		int index = handle - ID_BASE;
+
+		if (index < 0 || index >= ID_COUNT)
+			return NULL;
+
+		return mFifos[index];
+	}
+
+	int batchTimeout();
+	int batchEvents(sensors_event_t* data, int count);
+	bool queueFlush(const sensors_event_t* flush_event);
+	int drainFifos(sensors_event_t* data, int count);
+	void updatePollStats(const sensors_event_t* data, int nbEvents);
 #endif
 	SensorBase* mSensors[numSensorDrivers];
 
@@ -602,6 +636,18 @@ sensors_poll_context_t::sensors_poll_context_t()
 #endif
 
 #if (ANDROID_VERSION >= ANDROID_JBMR2)
+	memset(mFifos, 0, sizeof(mFifos));
+	pthread_mutex_init(&mBatchLock, NULL);
+	mWakeups = 0;
+	mWakeupEvents = 0;
+	mStatsStart = systemTime(SYSTEM_TIME_MONOTONIC);
+#if (DEBUG_POLL_STATS == 1)
+	mCpuStart = 0;
+	mLatencySum = 0;
+	mLatencyMax = 0;
+	mLatencyEvents = 0;
+#endif
+
 	int FlushFds[2];
 	int err = pipe(FlushFds);
 	if (err < 0) {
@@ -626,6 +672,11 @@ sensors_poll_context_t::~sensors_poll_context_t()
 #if (ANDROID_VERSION >= ANDROID_JBMR2)
 	close(mPollFds[flushFD].fd);
 	close(mWriteFlushPipe);
+
+	for (int i = 0; i < ID_COUNT; i++) {
+		delete mFifos[i];
+	}
+	pthread_mutex_destroy(&mBatchLock);
 #endif
 }
 
@@ -636,6 +687,20 @@ int sensors_poll_context_t::activate(int handle, int enabled)
 		return index;
 
 	int err =  mSensors[index]->enable(handle, enabled, 0);
+
+#if (ANDROID_VERSION >= ANDROID_JBMR2)
+	/* what was batched for a disabled sensor won't be delivered */
+	if (!enabled) {
+		pthread_mutex_lock(&mBatchLock);
+		SensorFifo* fifo = fifoFor(handle);
+		if (fifo) {
+			fifo->dumpStats(handle);
+			fifo->clear();
+		}
+		pthread_mutex_unlock(&mBatchLock);
+	}
+#endif
+
 	return err;
 }
 
@@ -650,12 +715,21 @@ int sensors_poll_context_t::setDelay(int handle, int64_t ns)
 
 int sensors_poll_context_t::pollEvents(sensors_event_t* data, int count)
 {
+#if (ANDROID_VERSION >= ANDROID_JBMR2)
+	sensors_event_t* const first = data;
+#endif
 	int nbEvents = 0;
 	int n = 0;
+	int timeout;
 
 	do {
 		if (count) {
-			n = poll(mPollFds, numFds, nbEvents ? 0 : -1);
+#if (ANDROID_VERSION >= ANDROID_JBMR2)
+			timeout = nbEvents ? 0 : batchTimeout();
+#else
+			timeout = nbEvents ? 0 : -1;
+#endif
+			n = poll(mPollFds, numFds, timeout);
 			if (n < 0) {
 				STLOGE("poll() failed (%s)", strerror(errno));
 				return -errno;
@@ -669,6 +743,9 @@ int sensors_poll_context_t::pollEvents(sensors_event_t* data, int count)
 				if (nb < count) {
 					mPollFds[i].revents = 0;
 				}
+#if (ANDROID_VERSION >= ANDROID_JBMR2)
+				nb = batchEvents(data, nb);
+#endif
 				count -= nb;
 				nbEvents += nb;
 				data += nb;
@@ -677,25 +754,220 @@ int sensors_poll_context_t::pollEvents(sensors_event_t* data, int count)
 #if (ANDROID_VERSION >= ANDROID_JBMR2)
 		if(mPollFds[flushFD].revents & POLLIN && count) {
 			if (read(mPollFds[flushFD].fd, data, sizeof(struct sensors_event_t)) > 0) {
-				count--;
-				nbEvents++;
-				data++;
+				/* completes only after the events batched before it */
+				if (!queueFlush(data)) {
+					count--;
+					nbEvents++;
+					data++;
+				}
 			}
 			mPollFds[flushFD].revents = 0;
 		}
+
+		int nb = drainFifos(data, count);
+		count -= nb;
+		nbEvents += nb;
+		data += nb;
+#endif
+	} while ((n || !nbEvents) && count);
+
+#if (ANDROID_VERSION >= ANDROID_JBMR2)
+	updatePollStats(first, nbEvents);
 #endif
-	} while (n && count);
 
 	return nbEvents;
 }
 
 #if (ANDROID_VERSION >= ANDROID_JBMR2)
-int sensors_poll_context_t::batch(int sensor_handle, int __attribute__((unused))flags,
+/* poll() timeout in ms until the first batching deadline, -1 if none */
+int sensors_poll_context_t::batchTimeout()
+{
+	int64_t now = systemTime(SYSTEM_TIME_MONOTONIC);
+	int64_t deadline = -1;
+
+	pthread_mutex_lock(&mBatchLock);
+	for (int i = 0; i < ID_COUNT; i++) {
+		SensorFifo* fifo = mFifos[i];
+		if (!fifo || fifo->isEmpty())
+			continue;
+
+		if (fifo->isDue(now)) {
+			deadline = now;
+			break;
+		}
+
+		if (deadline < 0 || fifo->getDeadline() < deadline)
+			deadline = fifo->getDeadline();
+	}
+	pthread_mutex_unlock(&mBatchLock);
+
+	if (deadline < 0)
+		return -1;
+
+	/* round up, waking before the deadline would only poll again */
+	return (int)((deadline - now + MSEC_TO_NSEC(1LL) - 1) / MSEC_TO_NSEC(1LL));
+}
+
+/*
+ * Move the events of batched sensors from data into their FIFO, returns the
+ * number of events left in data for immediate delivery.
+ */
+int sensors_poll_context_t::batchEvents(sensors_event_t* data, int count)
+{
+	int64_t now = systemTime(SYSTEM_TIME_MONOTONIC);
+	int kept = 0;
+
+	pthread_mutex_lock(&mBatchLock);
+	for (int i = 0; i < count; i++) {
+		SensorFifo* fifo = fifoFor(data[i].sensor);
+
+		/* events of a FIFO still draining keep their order too */
+		if (fifo && (fifo->isBatching() || !fifo->isEmpty())) {
+			fifo->push(&data[i], now);
+			continue;
+		}
+
+		if (kept != i)
+			data[kept] = data[i];
+		kept++;
+	}
+	pthread_mutex_unlock(&mBatchLock);
+
+	return kept;
+}
+
+bool sensors_poll_context_t::queueFlush(const sensors_event_t* flush_event)
+{
+	bool queued = false;
+
+	pthread_mutex_lock(&mBatchLock);
+	SensorFifo* fifo = fifoFor(flush_event->meta_data.sensor);
+	if (fifo && !fifo->isEmpty()) {
+		queued = fifo->push(flush_event, systemTime(SYSTEM_TIME_MONOTONIC));
+		fifo->setDue();
+	}
+	pthread_mutex_unlock(&mBatchLock);
+
+	return queued;
+}
+
+int sensors_poll_context_t::drainFifos(sensors_event_t* data, int count)
+{
+	int64_t now = systemTime(SYSTEM_TIME_MONOTONIC);
+	int nbEvents = 0;
+
+	pthread_mutex_lock(&mBatchLock);
+	for (int i = 0; count && i < ID_COUNT; i++) {
+		SensorFifo* fifo = mFifos[i];
+		if (!fifo || !fifo->isDue(now))
+			continue;
+
+		int nb = fifo->pop(data, count);
+		count -= nb;
+		nbEvents += nb;
+		data += nb;
+	}
+	pthread_mutex_unlock(&mBatchLock);
+
+	return nbEvents;
+}
+
+void sensors_poll_context_t::updatePollStats(const sensors_event_t* data, int nbEvents)
+{
+	mWakeups++;
+	mWakeupEvents += nbEvents;
+
+#if (DEBUG_POLL_STATS == 1)
+	/* compare against the clock the input events were stamped with */
+	int64_t delivered = systemTime(SensorBase::getEventClock());
+
+	for (int i = 0; i < nbEvents; i++) {
+		if (data[i].type == SENSOR_TYPE_META_DATA)
+			continue;
+
+		int64_t latency = delivered - data[i].timestamp;
+		mLatencySum += latency;
+		if (latency > mLatencyMax)
+			mLatencyMax = latency;
+		mLatencyEvents++;
+	}
+#else
+	(void)data;
+#endif
+
+#if (DEBUG_BATCHING == 1) || (DEBUG_POLL_STATS == 1)
+	int64_t now = systemTime(SYSTEM_TIME_MONOTONIC);
+	int64_t elapsed = now - mStatsStart;
+
+	if (elapsed < BATCH_STATS_PERIOD_NS)
+		return;
+
+	STLOGD("sensors_poll_context_t: %lld wakeups/min, %u events per wakeup",
+			(int64_t)mWakeups * SEC_TO_NSEC(60LL) / elapsed,
+			mWakeups ? mWakeupEvents / mWakeups : 0);
+
+#if (DEBUG_POLL_STATS == 1)
+	int64_t cpu = systemTime(SYSTEM_TIME_THREAD);
+
+	if (mLatencyEvents && mCpuStart)
+		STLOGD("sensors_poll_context_t: latency avg %lld max %lld [us], %lld [ns] CPU per event",
+				mLatencySum / mLatencyEvents / 1000, mLatencyMax / 1000,
+				(cpu - mCpuStart) / mLatencyEvents);
+
+	mCpuStart = cpu;
+	mLatencySum = 0;
+	mLatencyMax = 0;
+	mLatencyEvents = 0;
+#endif
+
+	pthread_mutex_lock(&mBatchLock);
+	for (int i = 0; i < ID_COUNT; i++) {
+		if (mFifos[i])
+			mFifos[i]->dumpStats(ID_BASE + i);
+	}
+	pthread_mutex_unlock(&mBatchLock);
+
+	mWakeups = 0;
+	mWakeupEvents = 0;
+	mStatsStart = now;
+#endif
+}
+
+int sensors_poll_context_t::batch(int sensor_handle, int flags,
 						int64_t sampling_period_ns,
-				  int64_t __attribute__((unused))max_report_latency_ns)
+						int64_t max_report_latency_ns)
 {
+	int index = handleToDriver(sensor_handle);
+	if (index < 0)
+		return index;
+
+#if (ANDROID_VERSION <= ANDROID_KK)
+	if (flags & SENSORS_BATCH_DRY_RUN)
+		return 0;
+#else
+	(void)flags;
+#endif
+
 	this->setDelay(sensor_handle, sampling_period_ns);
 
+	pthread_mutex_lock(&mBatchLock);
+	SensorFifo* fifo = fifoFor(sensor_handle);
+	if (!fifo && max_report_latency_ns > 0 && sensor_handle >= ID_BASE) {
+		fifo = new SensorFifo(SENSORS_FIFO_MAX_EVENTS);
+		mFifos[sensor_handle - ID_BASE] = fifo;
+	}
+	if (fifo) {
+		if (!max_report_latency_ns && fifo->isBatching())
+			fifo->dumpStats(sensor_handle);
+		fifo->setMaxLatency(max_report_latency_ns);
+	}
+	pthread_mutex_unlock(&mBatchLock);
+
+#if (DEBUG_BATCHING == 1)
+	STLOGD("sensors_poll_context_t::batch handle: %d, period: %lld [ns], latency: %lld [ns]",
+			sensor_handle, sampling_period_ns, max_report_latency_ns);
+#endif
+
 	return 0;
 }
 
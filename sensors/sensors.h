@@ -62,6 +62,7 @@ __BEGIN_DECLS
 #define ID_ACTIVITY_RECOGNIZER			(ID_BASE+22)
 #define ID_TAP					(ID_BASE+23)
 #define ID_HUMIDITY				(ID_BASE+24)
+#define ID_COUNT				(25)
 
 #define SENSORS_ACCELEROMETER_HANDLE		ID_ACCELEROMETER
 #define SENSORS_MAGNETIC_FIELD_HANDLE		ID_MAGNETIC_FIELD
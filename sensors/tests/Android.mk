@@ -0,0 +1,72 @@
+# Copyright (C) 2008 The Android Open Source Project
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+LOCAL_PATH := $(call my-dir)
+
+# SensorRing ordering and sample-loss check, run on the build host
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := sensors_ring_test
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/../conf/ \
+		    $(LOCAL_PATH)/../lib/iNemoEngine_gBias/ \
+		    $(LOCAL_PATH)/../lib/iNemoEngine_SensorFusion/ \
+		    hardware/libhardware/include
+
+LOCAL_CFLAGS := -DLOG_TAG=\"SensorsTest\" \
+		-DANDROID_VERSION=$(PLATFORM_SDK_VERSION) \
+		-DLSM330 -DSENSOR_FUSION -DSENSOR_FUSION_MODULE_PRESENT
+
+LOCAL_SRC_FILES := sensor_ring_test.cpp \
+		   ../SensorRing.cpp
+
+LOCAL_SHARED_LIBRARIES := liblog libcutils
+
+include $(BUILD_HOST_EXECUTABLE)
+
+# Replay harness and poll path benchmark: the HAL without the prebuilt ARM
+# fusion libraries, reading recorded or synthetic input from FIFOs
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := sensors_replay
+LOCAL_MODULE_TAGS := optional
+
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/../conf/ \
+		    $(LOCAL_PATH)/../lib/iNemoEngine_gBias/ \
+		    $(LOCAL_PATH)/../lib/iNemoEngine_SensorFusion/ \
+		    hardware/libhardware/include
+
+LOCAL_CFLAGS := -DLOG_TAG=\"SensorsReplay\" \
+		-DANDROID_VERSION=$(PLATFORM_SDK_VERSION) \
+		-DLSM330 -DAPDS9900 -DAKM8963 -DAKM_DEVICE_AK8963 \
+		-DSENSORS_REPLAY_ENABLE=1 \
+		-DSENSORS_REPLAY_PATH=\"/tmp/sensors-replay\"
+
+LOCAL_SRC_FILES := sensors_replay.cpp \
+		   ../sensors.cpp \
+		   ../SensorBase.cpp \
+		   ../AccelSensor.cpp \
+		   ../GyroSensor.cpp \
+		   ../MagnSensor.cpp \
+		   ../LightSensor.cpp \
+		   ../ProximitySensor.cpp \
+		   ../InputEventReader.cpp \
+		   ../SensorFifo.cpp \
+		   ../SensorRing.cpp \
+		   ../StoreCalibration.cpp
+
+LOCAL_SHARED_LIBRARIES := liblog libcutils libutils
+
+include $(BUILD_HOST_EXECUTABLE)
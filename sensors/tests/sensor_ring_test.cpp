@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2008 The Android Open Source Project
+ * Copyright (C) 2016 Kostyan_nsk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Sample-loss check of SensorRing: a driver thread publishes timestamped
+ * samples while the fusion thread drains them. Every sample must come out
+ * once, in order, untorn, and consumed + lost must add up to what was
+ * written; a reader that keeps up must lose nothing.
+ *
+ *   sensor_ring_test [samples [writer period us]]
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../SensorRing.h"
+
+#define SAMPLE_PERIOD_NS	5000000LL	/* 200 Hz */
+
+struct writer_args {
+	SensorRing *ring;
+	int count;
+	int period_us;
+};
+
+static void make_sample(int i, sensors_vec_t *vec)
+{
+	memset(vec, 0, sizeof(*vec));
+	vec->v[0] = i;
+	vec->v[1] = -i;
+	vec->v[2] = i * 0.5f;
+}
+
+static void *writer(void *arg)
+{
+	writer_args *w = (writer_args *)arg;
+	sensors_vec_t vec;
+
+	for (int i = 1; i <= w->count; i++) {
+		make_sample(i, &vec);
+		w->ring->write(&vec, i * SAMPLE_PERIOD_NS);
+		if (w->period_us) {
+			struct timespec t = { 0, w->period_us * 1000L };
+			nanosleep(&t, NULL);
+		}
+	}
+	return NULL;
+}
+
+/* drain the ring while the writer runs, checking order and content */
+static int drain(SensorRing *ring, int count, pthread_t thread)
+{
+	SensorSample s;
+	int64_t last = 0;
+	int failures = 0;
+	bool done = false;
+
+	for (;;) {
+		if (!ring->peek(&s)) {
+			if (done)
+				break;
+			done = pthread_tryjoin_np(thread, NULL) == 0;
+			continue;
+		}
+		ring->next();
+
+		int i = (int)(s.timestamp / SAMPLE_PERIOD_NS);
+		if (s.timestamp <= last || s.timestamp != i * SAMPLE_PERIOD_NS ||
+				s.vec.v[0] != i || s.vec.v[1] != -i || s.vec.v[2] != i * 0.5f) {
+			if (failures++ < 10)
+				printf("bad sample %d after %lld\n", i, (long long)last);
+		}
+		last = s.timestamp;
+	}
+
+	if (last != count * SAMPLE_PERIOD_NS) {
+		printf("last sample %lld, expected %lld\n", (long long)last, count * SAMPLE_PERIOD_NS);
+		failures++;
+	}
+	if (ring->getConsumed() + ring->getLost() != (uint32_t)count) {
+		printf("%u consumed + %u lost != %d written\n", ring->getConsumed(), ring->getLost(), count);
+		failures++;
+	}
+	return failures;
+}
+
+static int run_threaded(int count, int period_us, bool expect_no_loss)
+{
+	SensorRing ring;
+	writer_args args = { &ring, count, period_us };
+	pthread_t thread;
+
+	pthread_create(&thread, NULL, writer, &args);
+	int failures = drain(&ring, count, thread);
+
+	printf("%d samples, writer period %d us: %u consumed, %u lost\n",
+			count, period_us, ring.getConsumed(), ring.getLost());
+
+	if (expect_no_loss && ring.getLost()) {
+		printf("reader kept up but lost samples\n");
+		failures++;
+	}
+	return failures;
+}
+
+/* a reader that stalls keeps the newest SENSOR_RING_SIZE - 1 samples */
+static int run_overrun()
+{
+	SensorRing ring;
+	SensorSample s;
+	sensors_vec_t vec;
+	const int count = SENSOR_RING_SIZE * 3;
+	int failures = 0;
+	int expected = count - (SENSOR_RING_SIZE - 1) + 1;
+
+	for (int i = 1; i <= count; i++) {
+		make_sample(i, &vec);
+		ring.write(&vec, i * SAMPLE_PERIOD_NS);
+	}
+
+	if (!ring.getLatest(&s) || s.timestamp != count * SAMPLE_PERIOD_NS) {
+		printf("getLatest did not return the newest sample\n");
+		failures++;
+	}
+
+	while (ring.peek(&s)) {
+		ring.next();
+		if (s.timestamp != expected * SAMPLE_PERIOD_NS) {
+			printf("overrun: got sample %lld, expected %d\n",
+					(long long)(s.timestamp / SAMPLE_PERIOD_NS), expected);
+			failures++;
+		}
+		expected++;
+	}
+
+	if (ring.getLost() != (uint32_t)(count - (SENSOR_RING_SIZE - 1)) ||
+			ring.getConsumed() != SENSOR_RING_SIZE - 1) {
+		printf("overrun: %u consumed, %u lost\n", ring.getConsumed(), ring.getLost());
+		failures++;
+	}
+	return failures;
+}
+
+int main(int argc, char **argv)
+{
+	int count = argc > 1 ? atoi(argv[1]) : 200000;
+	int period_us = argc > 2 ? atoi(argv[2]) : 0;
+	int failures = 0;
+
+	failures += run_overrun();
+	/* writer flat out: anything may be lost, but nothing twice or torn */
+	failures += run_threaded(count, period_us, false);
+	/* 2 kHz writer against a spinning reader must not lose samples */
+	failures += run_threaded(2000, 500, true);
+
+	printf("%s\n", failures ? "FAILED" : "PASSED");
+	return failures ? 1 : 0;
+}
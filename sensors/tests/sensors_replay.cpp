@@ -0,0 +1,426 @@
+/*
+ * Copyright (C) 2008 The Android Open Source Project
+ * Copyright (C) 2016 Kostyan_nsk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Off-device replay harness and poll path benchmark.
+ *
+ * The HAL is built into this program with SENSORS_REPLAY_ENABLE, so every
+ * driver reads its input device from a FIFO under SENSORS_REPLAY_PATH. A
+ * player thread feeds those FIFOs, either from a "getevent -t" recording or
+ * with synthetic samples at a fixed rate, stamping each event with
+ * CLOCK_BOOTTIME as it is written. The main thread polls the HAL like the
+ * framework does and reports delivered events, wakeups, end-to-end latency
+ * and the CPU time the poll thread spends per event.
+ *
+ *   sensors_replay [-r rate_hz] [-d seconds] [-l max_latency_ms] [recording]
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <hardware/sensors.h>
+#include <linux/input.h>
+
+#include "../configuration.h"
+#include "../sensors.h"
+
+/* the HAL module, linked in from ../sensors.cpp */
+extern struct sensors_module_t HAL_MODULE_INFO_SYM;
+
+#define REPLAY_COPIES		4	/* readers per device, see SensorBase::openReplayInput */
+#define POLL_BUFFER		64
+#define PACKET_EVENTS		16
+
+struct replay_device {
+	const char *name;
+	const char *attrs[4];
+	int fds[REPLAY_COPIES];
+	struct input_event packet[PACKET_EVENTS];
+	int queued;
+	uint32_t samples;
+	uint32_t dropped;
+};
+
+static replay_device devices[] = {
+#if (SENSORS_ACCELEROMETER_ENABLE == 1)
+	{ SENSOR_DATANAME_ACCELEROMETER,
+	  { ACCEL_DELAY_FILE_NAME, ACCEL_ENABLE_FILE_NAME, ACCEL_RANGE_FILE_NAME, NULL }, { -1 }, { }, 0, 0, 0 },
+#endif
+#if (SENSORS_GYROSCOPE_ENABLE == 1)
+	{ SENSOR_DATANAME_GYROSCOPE,
+	  { GYRO_DELAY_FILE_NAME, GYRO_ENABLE_FILE_NAME, GYRO_RANGE_FILE_NAME, NULL }, { -1 }, { }, 0, 0, 0 },
+#endif
+#if (SENSORS_MAGNETIC_FIELD_ENABLE == 1)
+	/* the compass attributes are absolute /sys paths, enabling it fails here */
+	{ SENSOR_DATANAME_MAGNETIC, { NULL }, { -1 }, { }, 0, 0, 0 },
+#endif
+#if (SENSORS_LIGHT_ENABLE == 1)
+	{ SENSOR_DATANAME_ALS, { ALS_DELAY_FILE_NAME, ALS_ENABLE_FILE_NAME, NULL }, { -1 }, { }, 0, 0, 0 },
+#endif
+#if (SENSORS_PROXIMITY_ENABLE == 1)
+	{ SENSOR_DATANAME_PS, { PROXIMITY_ENABLE_FILE_NAME, NULL }, { -1 }, { }, 0, 0, 0 },
+#endif
+};
+
+#define NUM_DEVICES	(int)(sizeof(devices) / sizeof(devices[0]))
+
+struct replay_record {
+	int device;
+	int64_t time;		/* ns from the start of the recording */
+	uint16_t type;
+	uint16_t code;
+	int32_t value;
+};
+
+static std::vector<replay_record> records;
+static volatile int player_done;
+static int64_t player_start;
+
+static int64_t clock_ns(clockid_t clock)
+{
+	struct timespec t;
+	clock_gettime(clock, &t);
+	return (int64_t)t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+static int find_device(const char *name)
+{
+	for (int i = 0; i < NUM_DEVICES; i++) {
+		if (!strcmp(devices[i].name, name))
+			return i;
+	}
+	return -1;
+}
+
+static void make_dirs(char *path)
+{
+	for (char *p = strchr(path + 1, '/'); p; p = strchr(p + 1, '/')) {
+		*p = '\0';
+		mkdir(path, 0755);
+		*p = '/';
+	}
+}
+
+/* FIFOs and sysfs attribute files SensorBase looks up in replay mode */
+static int setup_replay_dir()
+{
+	char path[PATH_MAX];
+
+	for (int i = 0; i < NUM_DEVICES; i++) {
+		for (int c = 0; c < REPLAY_COPIES; c++) {
+			if (c)
+				snprintf(path, sizeof(path), "%s/%s.%d", SENSORS_REPLAY_PATH, devices[i].name, c);
+			else
+				snprintf(path, sizeof(path), "%s/%s", SENSORS_REPLAY_PATH, devices[i].name);
+			make_dirs(path);
+			unlink(path);
+			if (mkfifo(path, 0600) < 0) {
+				printf("mkfifo %s: %s\n", path, strerror(errno));
+				return -1;
+			}
+		}
+
+		for (int a = 0; devices[i].attrs[a]; a++) {
+			snprintf(path, sizeof(path), "%s/%s.sysfs/%s", SENSORS_REPLAY_PATH,
+					devices[i].name, devices[i].attrs[a]);
+			make_dirs(path);
+			int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+			if (fd >= 0)
+				close(fd);
+		}
+	}
+	return 0;
+}
+
+/*
+ * Parse "getevent -t" output: "add device N: /dev/input/eventX" followed by
+ * its name line, then "[ sec.usec] /dev/input/eventX: type code value" in hex.
+ */
+static int load_recording(const char *file)
+{
+	char line[256], node[64], last_node[64] = "";
+	char nodes[32][64];
+	int node_device[32];
+	int num_nodes = 0;
+	int64_t first = -1;
+	FILE *f = fopen(file, "r");
+
+	if (!f) {
+		printf("can't open %s: %s\n", file, strerror(errno));
+		return -1;
+	}
+
+	while (fgets(line, sizeof(line), f)) {
+		unsigned long sec, usec, type, code, value;
+		char name[64];
+
+		if (sscanf(line, "add device %*d: %63s", node) == 1) {
+			strcpy(last_node, node);
+		} else if (sscanf(line, " name: \"%63[^\"]\"", name) == 1 && last_node[0] && num_nodes < 32) {
+			strcpy(nodes[num_nodes], last_node);
+			node_device[num_nodes++] = find_device(name);
+			last_node[0] = '\0';
+		} else if (sscanf(line, "[ %lu.%lu] %63[^:]: %lx %lx %lx",
+					&sec, &usec, node, &type, &code, &value) == 6) {
+			int device = -1;
+
+			for (int i = 0; i < num_nodes; i++) {
+				if (!strcmp(nodes[i], node))
+					device = node_device[i];
+			}
+			if (device < 0)
+				continue;
+
+			int64_t t = sec * 1000000000LL + usec * 1000LL;
+			if (first < 0)
+				first = t;
+
+			replay_record r = { device, t - first, (uint16_t)type, (uint16_t)code, (int32_t)value };
+			records.push_back(r);
+		}
+	}
+	fclose(f);
+
+	printf("%s: %zu events\n", file, records.size());
+	return records.empty() ? -1 : 0;
+}
+
+static void add_sample(int device, int64_t t, uint16_t type, const uint16_t codes[3], int32_t value)
+{
+	for (int axis = 0; axis < 3; axis++) {
+		replay_record r = { device, t, type, codes[axis], value + axis };
+		records.push_back(r);
+	}
+	replay_record syn = { device, t, EV_SYN, SYN_REPORT, 0 };
+	records.push_back(syn);
+}
+
+/* accelerometer, gyroscope and magnetometer samples at rate_hz */
+static void synthesize(int rate_hz, int seconds)
+{
+	int64_t period = 1000000000LL / rate_hz;
+
+	for (int64_t t = 0; t < seconds * 1000000000LL; t += period) {
+		int32_t v = (int32_t)(t / period) & 0x3ff;
+#if (SENSORS_ACCELEROMETER_ENABLE == 1)
+		static const uint16_t acc[3] = { EVENT_TYPE_ACCEL_X, EVENT_TYPE_ACCEL_Y, EVENT_TYPE_ACCEL_Z };
+		add_sample(find_device(SENSOR_DATANAME_ACCELEROMETER), t, EVENT_TYPE_ACCEL, acc, v);
+#endif
+#if (SENSORS_GYROSCOPE_ENABLE == 1)
+		static const uint16_t gyr[3] = { EVENT_TYPE_GYRO_X, EVENT_TYPE_GYRO_Y, EVENT_TYPE_GYRO_Z };
+		add_sample(find_device(SENSOR_DATANAME_GYROSCOPE), t, EVENT_TYPE_GYRO, gyr, v);
+#endif
+#if (SENSORS_MAGNETIC_FIELD_ENABLE == 1)
+		static const uint16_t mag[3] = { EVENT_TYPE_MAGV_X, EVENT_TYPE_MAGV_Y, EVENT_TYPE_MAGV_Z };
+		add_sample(find_device(SENSOR_DATANAME_MAGNETIC), t, EV_ABS, mag, v);
+#endif
+	}
+	printf("synthetic: %d Hz for %d s, %zu events\n", rate_hz, seconds, records.size());
+}
+
+static void *player(void *)
+{
+	char path[PATH_MAX];
+
+	for (int i = 0; i < NUM_DEVICES; i++) {
+		for (int c = 0; c < REPLAY_COPIES; c++) {
+			if (c)
+				snprintf(path, sizeof(path), "%s/%s.%d", SENSORS_REPLAY_PATH, devices[i].name, c);
+			else
+				snprintf(path, sizeof(path), "%s/%s", SENSORS_REPLAY_PATH, devices[i].name);
+			/* read-write: never block on, nor fail for, a copy nobody opened */
+			devices[i].fds[c] = open(path, O_RDWR | O_NONBLOCK);
+		}
+	}
+
+	player_start = clock_ns(CLOCK_MONOTONIC);
+
+	for (size_t i = 0; i < records.size(); i++) {
+		const replay_record &r = records[i];
+		int64_t wait = player_start + r.time - clock_ns(CLOCK_MONOTONIC);
+
+		if (wait > 0) {
+			struct timespec t = { (time_t)(wait / 1000000000LL), (long)(wait % 1000000000LL) };
+			nanosleep(&t, NULL);
+		}
+
+		replay_device &d = devices[r.device];
+		struct input_event &ev = d.packet[d.queued++];
+
+		memset(&ev, 0, sizeof(ev));
+		ev.type = r.type;
+		ev.code = r.code;
+		ev.value = r.value;
+
+		if (r.type != EV_SYN && d.queued < PACKET_EVENTS)
+			continue;
+
+		/* evdev hands out a whole packet, stamped once, up to SYN_REPORT */
+		int64_t now = clock_ns(CLOCK_BOOTTIME);
+		for (int e = 0; e < d.queued; e++) {
+			d.packet[e].time.tv_sec = now / 1000000000LL;
+			d.packet[e].time.tv_usec = (now % 1000000000LL) / 1000;
+		}
+
+		ssize_t size = d.queued * sizeof(struct input_event);
+		d.samples++;
+		for (int c = 0; c < REPLAY_COPIES; c++) {
+			if (d.fds[c] >= 0 && write(d.fds[c], d.packet, size) != size && c == 0)
+				d.dropped++;
+		}
+		d.queued = 0;
+	}
+
+	player_done = 1;
+	return NULL;
+}
+
+static bool replayed_type(int type)
+{
+	return type == SENSOR_TYPE_ACCELEROMETER || type == SENSOR_TYPE_GYROSCOPE ||
+		type == SENSOR_TYPE_MAGNETIC_FIELD || type == SENSOR_TYPE_LIGHT ||
+		type == SENSOR_TYPE_PROXIMITY;
+}
+
+int main(int argc, char **argv)
+{
+	int rate_hz = 200, seconds = 10, opt;
+	int64_t max_latency = 0;
+
+	while ((opt = getopt(argc, argv, "r:d:l:")) != -1) {
+		switch (opt) {
+		case 'r': rate_hz = atoi(optarg); break;
+		case 'd': seconds = atoi(optarg); break;
+		case 'l': max_latency = atoll(optarg) * 1000000LL; break;
+		default:
+			printf("usage: %s [-r rate_hz] [-d seconds] [-l max_latency_ms] [recording]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	if (optind < argc) {
+		if (load_recording(argv[optind]) < 0)
+			return 2;
+	} else {
+		synthesize(rate_hz, seconds);
+	}
+
+	if (setup_replay_dir() < 0)
+		return 2;
+
+	sensors_poll_device_1_t *dev;
+	if (HAL_MODULE_INFO_SYM.common.methods->open(&HAL_MODULE_INFO_SYM.common,
+			SENSORS_HARDWARE_POLL, (hw_device_t **)&dev)) {
+		printf("can't open the sensors HAL\n");
+		return 2;
+	}
+
+	sensor_t const *list;
+	int count = HAL_MODULE_INFO_SYM.get_sensors_list(&HAL_MODULE_INFO_SYM, &list);
+	std::vector<int> active;
+
+	for (int i = 0; i < count; i++) {
+		if (!replayed_type(list[i].type))
+			continue;
+		dev->batch(dev, list[i].handle, 0, std::max((int64_t)list[i].minDelay * 1000,
+				(int64_t)(1000000000LL / rate_hz)), max_latency);
+		if (!dev->activate((sensors_poll_device_t *)dev, list[i].handle, 1))
+			active.push_back(list[i].handle);
+		else
+			printf("%s: enable failed\n", list[i].name);
+	}
+
+	/* the longest run plus slack, then give up on a missing flush */
+	alarm((records.empty() ? 0 : records.back().time / 1000000000LL) + 30);
+
+	pthread_t thread;
+	pthread_create(&thread, NULL, player, NULL);
+
+	sensors_event_t buffer[POLL_BUFFER];
+	std::vector<int64_t> latency;
+	uint32_t wakeups = 0;
+	size_t flushes = 0;
+	bool flushed = false;
+	int64_t cpu_start = clock_ns(CLOCK_THREAD_CPUTIME_ID);
+
+	while (flushes < active.size()) {
+		if (player_done && !flushed) {
+			/* flush completes only after what was written has been polled */
+			for (size_t i = 0; i < active.size(); i++)
+				dev->flush(dev, active[i]);
+			flushed = true;
+		}
+
+		int n = dev->poll((sensors_poll_device_t *)dev, buffer, POLL_BUFFER);
+		int64_t now = clock_ns(CLOCK_BOOTTIME);
+
+		wakeups++;
+		for (int i = 0; i < n; i++) {
+			if (buffer[i].type == SENSOR_TYPE_META_DATA) {
+				flushes++;
+				continue;
+			}
+			latency.push_back(now - buffer[i].timestamp);
+		}
+	}
+
+	int64_t elapsed = clock_ns(CLOCK_MONOTONIC) - player_start;
+	/* the HAL does all its work in poll() on this thread */
+	int64_t cpu = clock_ns(CLOCK_THREAD_CPUTIME_ID) - cpu_start;
+	pthread_join(thread, NULL);
+
+	for (int i = 0; i < NUM_DEVICES; i++) {
+		if (devices[i].samples)
+			printf("%s: %u samples written, %u dropped by the FIFO\n",
+					devices[i].name, devices[i].samples, devices[i].dropped);
+	}
+
+	if (latency.empty()) {
+		printf("no events delivered\nFAILED\n");
+		return 1;
+	}
+
+	int64_t sum = 0;
+	for (size_t i = 0; i < latency.size(); i++)
+		sum += latency[i];
+	std::sort(latency.begin(), latency.end());
+
+	printf("%zu events in %lld ms, %u wakeups (%.1f events per wakeup)\n",
+			latency.size(), (long long)(elapsed / 1000000), wakeups,
+			(double)latency.size() / wakeups);
+	printf("latency avg %lld p99 %lld max %lld [us], %lld [ns] CPU per event\n",
+			(long long)(sum / (int64_t)latency.size() / 1000),
+			(long long)(latency[latency.size() * 99 / 100] / 1000),
+			(long long)(latency.back() / 1000),
+			(long long)(cpu / (int64_t)latency.size()));
+	printf("PASSED\n");
+
+	dev->common.close(&dev->common);
+	return 0;
+}